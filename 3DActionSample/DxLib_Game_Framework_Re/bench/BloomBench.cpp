@@ -0,0 +1,244 @@
+#include "../src/Graphic/Shader/SoftwareBloom.h"
+#include "../src/Graphic/WorkerPool.h"
+#include "../src/Math/Random.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+// ブルームのCPU実装（SoftwareBloom）のベンチマークと検証
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// 画面の大きさ（1280×720）と、PostEffectがブラーをかける1/4の大きさ（320×180）で、
+// 水平・垂直ブラーとブルーム全体の時間を計測し、GaussianBlurH/V.hlslを1タップずつ真似た参照の実装と比較する。
+// 検証では、インパルス応答が中心に対して対称であること、参照の実装と一致すること、一様な画像が変わらないこと、
+// スレッド数によって結果が変わらないことを確かめる。
+// 使い方：bloom_bench [--bench] [--test]（省略時は両方、検証に失敗すると終了コード1）
+
+// 構造体：計測する画像の大きさ
+struct BloomSize
+{
+	int	width;	// 幅
+	int	height;	// 高さ
+	int	repeat;	// 計測の繰り返し回数
+};
+
+// 計測する画像の大きさ（画面と、その1/4）
+static const BloomSize BenchSizes[]{ { 1280, 720, 10 }, { 320, 180, 100 } };
+// ブラーの半径（SoftwareBloomとシェーダーと同じ）
+static const int BlurRadius{ 4 };
+// 参照の実装との差の許容値
+static const float Tolerance{ 1.0e-6f };
+
+// 失敗した検証の数
+static int s_failures{ 0 };
+// 最適化で消されないようにするための出力先
+static volatile float s_sink{ 0.0f };
+
+// 検証結果の表示
+static void check(const char* name, bool passed)
+{
+	std::printf("  %-52s %s\n", name, passed ? "ok" : "FAILED");
+	s_failures += passed ? 0 : 1;
+}
+
+// 計測の経過時間（ナノ秒）
+using Clock = std::chrono::steady_clock;
+static double elapsed_ns(Clock::time_point start)
+{
+	return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+}
+
+// ランダムな画像の作成（ブルームがかかるように1を超える画素を含む）
+static BloomImage random_image(int width, int height, unsigned int seed)
+{
+	Random random(seed);
+	BloomImage image(width, height);
+	for (auto& value : image.pixels)
+	{
+		value = random.rand_float(0.0f, 2.0f);
+	}
+	return image;
+}
+
+// 参照の実装（シェーダーと同じく、中心、正方向、負方向の順に1タップずつサンプリングする）
+static void blur_reference(const BloomImage& source, BloomImage& result, const BloomCB& param, bool horizontal)
+{
+	result = BloomImage(source.width, source.height);
+	for (int y = 0; y < source.height; ++y)
+	{
+		for (int x = 0; x < source.width; ++x)
+		{
+			float sum[4]{ 0.0f };
+			for (int tap = 0; tap <= BlurRadius * 2; ++tap)
+			{
+				// tap 0は中心、1から4は正方向、5から8は負方向
+				const int offset = (tap <= BlurRadius) ? tap : BlurRadius - tap;
+				const int i = (tap <= BlurRadius) ? tap : tap - BlurRadius;
+				const int sx = horizontal ? std::min(std::max(x + offset, 0), source.width - 1) : x;
+				const int sy = horizontal ? y : std::min(std::max(y + offset, 0), source.height - 1);
+				const float* pixel = source.at(sx, sy);
+				for (int c = 0; c < 4; ++c)
+				{
+					sum[c] += pixel[c] * param.g_GaussianWeights[i];
+				}
+			}
+			float* output = result.at(x, y);
+			std::copy(sum, sum + 3, output);
+			output[3] = 1.0f;
+		}
+	}
+}
+
+// 2つの画像の最大の差
+static float image_difference(const BloomImage& i1, const BloomImage& i2)
+{
+	if (i1.width != i2.width || i1.height != i2.height) return INFINITY;
+	float result = 0.0f;
+	for (std::size_t i = 0; i < i1.pixels.size(); ++i)
+	{
+		result = std::max(result, std::abs(i1.pixels[i] - i2.pixels[i]));
+	}
+	return result;
+}
+
+// 検証
+static void test(const BloomCB& param)
+{
+	std::printf("bloom blur (%d-pixel radius, symmetric)\n", BlurRadius);
+
+	// 1画素だけ光る画像のブラーは、中心から等距離の画素が同じウェイトになる
+	const int size = BlurRadius * 4 + 1;
+	const int center = size / 2;
+	BloomImage impulse(size, size);
+	impulse.at(center, center)[0] = 1.0f;
+	BloomImage blurred_h, blurred;
+	SoftwareBloom::blur_h(impulse, blurred_h, param);
+	SoftwareBloom::blur_v(blurred_h, blurred, param);
+	float response_error = 0.0f;
+	for (int y = 0; y < size; ++y)
+	{
+		for (int x = 0; x < size; ++x)
+		{
+			const int dx = std::abs(x - center);
+			const int dy = std::abs(y - center);
+			const float expected = (dx <= BlurRadius && dy <= BlurRadius) ? param.g_GaussianWeights[dx] * param.g_GaussianWeights[dy] : 0.0f;
+			response_error = std::max(response_error, std::abs(blurred.at(x, y)[0] - expected));
+		}
+	}
+	std::printf("  max impulse response error: %.2e\n", response_error);
+	check("impulse response is symmetric about the centre", response_error <= 1.0e-7f);
+
+	// シェーダーを1タップずつ真似た参照の実装と一致する（端のクランプを含む）
+	const BloomImage source = random_image(97, 61, 1);
+	BloomImage result, reference;
+	SoftwareBloom::blur_h(source, result, param);
+	blur_reference(source, reference, param, true);
+	const float difference_h = image_difference(result, reference);
+	SoftwareBloom::blur_v(source, result, param);
+	blur_reference(source, reference, param, false);
+	const float difference_v = image_difference(result, reference);
+	std::printf("  max difference from the per-tap reference: %.2e (H), %.2e (V)\n", difference_h, difference_v);
+	check("horizontal blur matches the per-tap reference", difference_h <= Tolerance);
+	check("vertical blur matches the per-tap reference", difference_v <= Tolerance);
+
+	// ウェイトの合計は1なので、一様な画像は端も含めて変わらない
+	BloomImage flat(40, 30);
+	for (auto& value : flat.pixels) value = 0.5f;
+	SoftwareBloom::blur_h(flat, blurred_h, param);
+	SoftwareBloom::blur_v(blurred_h, blurred, param);
+	bool unchanged = true;
+	for (int y = 0; y < flat.height; ++y)
+	{
+		for (int x = 0; x < flat.width; ++x)
+		{
+			for (int c = 0; c < 3; ++c) unchanged = unchanged && std::abs(blurred.at(x, y)[c] - 0.5f) <= Tolerance;
+		}
+	}
+	check("a flat image stays flat, edges included", unchanged);
+
+	// スレッド数によって結果が変わらない
+	const BloomImage screen = random_image(BenchSizes[0].width, BenchSizes[0].height, 2);
+	BloomImage single, parallel;
+	WorkerPool::set_thread_count(1);
+	SoftwareBloom::apply(screen, single, param);
+	WorkerPool::set_thread_count(4);
+	SoftwareBloom::apply(screen, parallel, param);
+	WorkerPool::set_thread_count(0);
+	check("four threads match a single thread", single.pixels == parallel.pixels);
+}
+
+// 計測（1回あたりミリ秒）
+template <class Function>
+static double measure(int repeat, Function function)
+{
+	function();
+	const auto start = Clock::now();
+	for (int i = 0; i < repeat; ++i)
+	{
+		function();
+	}
+	return elapsed_ns(start) / repeat / 1.0e6;
+}
+
+// 計測
+static void bench(const BloomCB& param)
+{
+	std::printf("bloom (%d threads, ms per call)\n", WorkerPool::thread_count());
+	std::printf("  %-12s %12s %12s %10s %12s\n", "size", "blur H+V", "per-tap", "speedup", "full bloom");
+	for (const auto& size : BenchSizes)
+	{
+		const BloomImage source = random_image(size.width, size.height, 3);
+		BloomImage blurred_h, blurred, result;
+		const double blur_ms = measure(size.repeat, [&]()
+		{
+			SoftwareBloom::blur_h(source, blurred_h, param);
+			SoftwareBloom::blur_v(blurred_h, blurred, param);
+		});
+		s_sink = blurred.pixels[blurred.pixels.size() / 2];
+		const double reference_ms = measure(std::max(size.repeat / 5, 1), [&]()
+		{
+			blur_reference(source, blurred_h, param, true);
+			blur_reference(blurred_h, blurred, param, false);
+		});
+		s_sink = blurred.pixels[blurred.pixels.size() / 2];
+		// ブルーム全体（輝度抽出で1/4に縮小してからブラーをかけ、元の大きさで合成する）
+		const double apply_ms = measure(size.repeat, [&]()
+		{
+			SoftwareBloom::apply(source, result, param);
+		});
+		s_sink = result.pixels[result.pixels.size() / 2];
+
+		char name[32];
+		std::snprintf(name, sizeof(name), "%dx%d", size.width, size.height);
+		std::printf("  %-12s %12.3f %12.3f %9.2fx %12.3f\n", name, blur_ms, reference_ms, reference_ms / blur_ms, apply_ms);
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	bool run_bench = false;
+	bool run_test = false;
+	for (int i = 1; i < argc; ++i)
+	{
+		if (std::strcmp(argv[i], "--bench") == 0) run_bench = true;
+		else if (std::strcmp(argv[i], "--test") == 0) run_test = true;
+		else
+		{
+			std::printf("usage: bloom_bench [--bench] [--test]\n");
+			return 2;
+		}
+	}
+	if (!run_bench && !run_test) run_bench = run_test = true;
+
+	const BloomCB param;
+	WorkerPool::initialize();
+	if (run_test)
+	{
+		test(param);
+		std::printf("%d check(s) failed\n", s_failures);
+	}
+	if (run_bench) bench(param);
+	WorkerPool::finalize();
+	return (s_failures == 0) ? 0 : 1;
+}
\ No newline at end of file
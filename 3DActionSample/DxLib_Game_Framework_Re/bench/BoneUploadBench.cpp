@@ -0,0 +1,216 @@
+#include "SyntheticAnimation.h"
+#include "../src/Graphic/AnimationPose.h"
+#include "../src/Graphic/BoneUploadCache.h"
+#include "../src/Graphic/SkeletonJobs.h"
+#include "../src/Graphic/WorkerPool.h"
+#include "../src/Math/Matrix.h"
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+// ボーン行列のアップロードのベンチマーク
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// 同じモデルのGhoulのウェーブを、全アクターが1つのモデルハンドルを共有する場合と、アクターごとに複製したハンドルを使う場合
+// （AnimatedMeshと同じ）で描画し、BoneUploadCacheが選んだ1フレームあたりのアップロード数を比較する。
+// 画面外のアクターはAnimationLODの視錐台外の段階と同じく姿勢を固定するため、その割合を変えて計測する。
+// DxLibの呼び出しの代わりに、ハンドルごとのボーン行列の写しに書き込む。
+// 検証では、アップロード後の写しが描画した姿勢と常に一致することと、固定したアクターのアップロードが省略されることを確かめる。
+// 使い方：bone_upload_bench [--bench] [--test]（省略時は両方、検証に失敗すると終了コード1）
+
+// アクター数
+static const int ActorCount{ 200 };
+// 画面外のアクターの割合（計測するもの）
+static const float OffscreenRates[]{ 0.0f, 0.25f, 0.5f, 0.75f };
+// 計測するフレーム数
+static const int FrameCount{ 100 };
+
+// 失敗した検証の数
+static int s_failures{ 0 };
+// 最適化で消されないようにするための出力先
+static volatile float s_sink{ 0.0f };
+
+// 検証結果の表示
+static void check(const char* name, bool passed)
+{
+	std::printf("  %-52s %s\n", name, passed ? "ok" : "FAILED");
+	s_failures += passed ? 0 : 1;
+}
+
+// 構造体：ウェーブ（Animationが毎tick保持する配列と同じ）
+struct Wave
+{
+	std::vector<AffineMatrix>		local_matrices;	// 各アクターのローカル変換行列
+	std::vector<Matrix>				worlds;			// 各アクターのワールド変換行列
+	std::vector<AffineMatrix>		world_matrices;	// 各アクターのボーンのワールド変換行列
+	std::vector<unsigned long long>	changed_bones;	// 各アクターの前回のアップロードから値が変わったボーンのビット
+	std::vector<bool>				frozen;			// 画面外で姿勢を固定しているか
+};
+
+// ウェーブの作成（画面外のアクターは先頭からoffscreen_rateの割合、全ボーンを最初の描画でアップロードする）
+static Wave make_wave(int bone_count, float offscreen_rate)
+{
+	const int words = (bone_count + 63) / 64;
+	Wave wave;
+	wave.local_matrices.resize((std::size_t)ActorCount * bone_count);
+	wave.world_matrices.resize((std::size_t)ActorCount * bone_count);
+	wave.changed_bones.assign((std::size_t)ActorCount * words, ~0ull);
+	for (int actor = 0; actor < ActorCount; ++actor)
+	{
+		wave.worlds.push_back(Matrix::CreateRotationY(actor * 7.0f) * Matrix::CreateTranslation(Vector3((float)(actor % 20) * 50.0f, 0.0f, (float)(actor / 20) * 50.0f)));
+		wave.frozen.push_back(actor < (int)(ActorCount * offscreen_rate));
+	}
+	return wave;
+}
+
+// 1tickの更新（画面内のアクターのみサンプリングし、全アクターのスケルトン変換ジョブを実行する）
+static void update(const Skeleton& skeleton, const AnimationClip& clip, Wave& wave, int tick)
+{
+	const int bone_count = skeleton.bone_count();
+	const int words = (bone_count + 63) / 64;
+	AnimationPose pose;
+	for (int actor = 0; actor < ActorCount; ++actor)
+	{
+		const std::size_t offset = (std::size_t)actor * bone_count;
+		if (!wave.frozen[actor] || tick == 0)
+		{
+			clip.sample(std::fmod(actor * 3.0f + tick * 0.5f, clip.end_time()), pose);
+			pose.to_matrices(&wave.local_matrices[offset]);
+		}
+		SkeletonJobs::add(skeleton, &wave.local_matrices[offset], wave.worlds[actor], &wave.world_matrices[offset], nullptr, nullptr,
+			&wave.changed_bones[(std::size_t)actor * words]);
+	}
+	SkeletonJobs::run();
+}
+
+// 全アクターの描画（sharedがtrueの場合は全アクターが1つのハンドルを共有する、mirrorsはハンドルごとのボーン行列の写し、
+// sameを指定すると各アクターの描画直後の写しがそのアクターの姿勢と一致するかを記録する）
+static void draw(BoneUploadCache& cache, Wave& wave, int bone_count, bool shared, std::vector<std::vector<AffineMatrix>>& mirrors, bool* same = nullptr)
+{
+	const int words = (bone_count + 63) / 64;
+	for (int actor = 0; actor < ActorCount; ++actor)
+	{
+		const AffineMatrix* world_matrices = &wave.world_matrices[(std::size_t)actor * bone_count];
+		auto& mirror = mirrors[shared ? 0 : actor];
+		cache.upload(shared ? 0 : actor, bone_count, world_matrices, &wave.changed_bones[(std::size_t)actor * words], [&](int bone, bool /*full*/)
+		{
+			mirror[bone] = world_matrices[bone];
+		});
+		if (same != nullptr)
+		{
+			*same = *same && std::memcmp(mirror.data(), world_matrices, sizeof(AffineMatrix) * bone_count) == 0;
+		}
+	}
+}
+
+// 検証
+static void test(const Skeleton& skeleton, const AnimationClip& clip)
+{
+	std::printf("bone uploads (%d actors, %d bones, half of them off-screen)\n", ActorCount, skeleton.bone_count());
+	const int bone_count = skeleton.bone_count();
+	const int frozen_count = ActorCount / 2;
+
+	for (const bool shared : { false, true })
+	{
+		// 描画直後のハンドルの写しは、毎tickそのアクターの姿勢と一致する
+		Wave wave = make_wave(bone_count, 0.5f);
+		BoneUploadCache cache;
+		std::vector<std::vector<AffineMatrix>> mirrors(shared ? 1 : ActorCount, std::vector<AffineMatrix>(bone_count));
+		bool same = true;
+		for (int tick = 0; tick < 30; ++tick)
+		{
+			update(skeleton, clip, wave, tick);
+			cache.reset_stats();
+			draw(cache, wave, bone_count, shared, mirrors, &same);
+		}
+		if (shared)
+		{
+			// 共有したハンドルは描画のたびに全ボーンをアップロードする
+			check("a shared handle holds each pose when it is drawn", same);
+			check("a shared handle uploads every bone on every draw", cache.stats().full_uploads == ActorCount
+				&& cache.stats().handle_switches == ActorCount && cache.stats().uploaded_bones == cache.stats().total_bones);
+			continue;
+		}
+
+		// アクターごとのハンドルは切り替えが起きず、固定したアクターはアップロードを省略する
+		check("per-instance handles hold each pose when it is drawn", same);
+		check("per-instance handles never switch arrays", cache.stats().full_uploads == 0 && cache.stats().handle_switches == 0);
+		check("frozen actors skip the upload", cache.stats().skipped_draws == frozen_count
+			&& cache.stats().uploaded_bones == (ActorCount - frozen_count) * bone_count);
+
+		// 記録を消去したハンドルは全ボーンをアップロードし直す
+		cache.reset_stats();
+		cache.erase(0);
+		draw(cache, wave, bone_count, shared, mirrors, &same);
+		check("an erased handle uploads every bone again", same && cache.stats().full_uploads == 1 && cache.stats().uploaded_bones == bone_count);
+	}
+}
+
+// 計測（1フレームあたりのアップロード数とマイクロ秒）
+static void measure(const Skeleton& skeleton, const AnimationClip& clip, float offscreen_rate, bool shared, double& bones, double& us)
+{
+	const int bone_count = skeleton.bone_count();
+	Wave wave = make_wave(bone_count, offscreen_rate);
+	BoneUploadCache cache;
+	std::vector<std::vector<AffineMatrix>> mirrors(shared ? 1 : ActorCount, std::vector<AffineMatrix>(bone_count));
+	update(skeleton, clip, wave, 0);
+	draw(cache, wave, bone_count, shared, mirrors);
+
+	cache.reset_stats();
+	double total_ns = 0.0;
+	for (int tick = 1; tick <= FrameCount; ++tick)
+	{
+		update(skeleton, clip, wave, tick);
+		const auto start = BenchClock::now();
+		draw(cache, wave, bone_count, shared, mirrors);
+		total_ns += elapsed_ns(start);
+	}
+	s_sink = mirrors.back()[bone_count / 2].m[1][3];
+	bones = (double)cache.stats().uploaded_bones / FrameCount;
+	us = total_ns / FrameCount / 1000.0;
+}
+
+// 計測
+static void bench(const Skeleton& skeleton, const AnimationClip& clip)
+{
+	std::printf("bone uploads per frame (%d actors, %d bones, one DxLib call per uploaded bone)\n", ActorCount, skeleton.bone_count());
+	std::printf("  %-12s %14s %14s %10s %12s %12s\n", "off-screen", "shared", "per-instance", "saving", "shared us", "instance us");
+	for (const auto rate : OffscreenRates)
+	{
+		double shared_bones, shared_us, instance_bones, instance_us;
+		measure(skeleton, clip, rate, true, shared_bones, shared_us);
+		measure(skeleton, clip, rate, false, instance_bones, instance_us);
+		std::printf("  %11.0f%% %14.0f %14.0f %9.1f%% %12.1f %12.1f\n", rate * 100.0f, shared_bones, instance_bones,
+			100.0 * (1.0 - instance_bones / shared_bones), shared_us, instance_us);
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	bool run_bench = false;
+	bool run_test = false;
+	for (int i = 1; i < argc; ++i)
+	{
+		if (std::strcmp(argv[i], "--bench") == 0) run_bench = true;
+		else if (std::strcmp(argv[i], "--test") == 0) run_test = true;
+		else
+		{
+			std::printf("usage: bone_upload_bench [--bench] [--test]\n");
+			return 2;
+		}
+	}
+	if (!run_bench && !run_test) run_bench = run_test = true;
+
+	const Skeleton skeleton(synthetic_parents(SyntheticBoneCount));
+	const AnimationClip clip = synthetic_clip(SyntheticBoneCount, SyntheticClipLength, 1);
+
+	WorkerPool::initialize(1);
+	if (run_test)
+	{
+		test(skeleton, clip);
+		std::printf("%d check(s) failed\n", s_failures);
+	}
+	if (run_bench) bench(skeleton, clip);
+	SkeletonJobs::finalize();
+	WorkerPool::finalize();
+	return (s_failures == 0) ? 0 : 1;
+}
\ No newline at end of file
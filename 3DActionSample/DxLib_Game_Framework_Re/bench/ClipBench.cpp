@@ -0,0 +1,243 @@
+#include "SyntheticAnimation.h"
+#include "../src/Graphic/AnimationClip.h"
+#include "../src/Graphic/CompressedAnimationClip.h"
+#include "../src/Graphic/AnimationPose.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+// アニメーションクリップのサンプリングの検証とベンチマーク
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// 読み込み時に焼き込んだクリップ（AnimationClip）から姿勢をサンプリングしてローカル変換行列を作るまでの、
+// アクター1体あたりのコストを計測する。書き出したクリップのファイルを指定すると、それも読み込んで検証・計測する
+// （SkeletalMesh::save_clipで書き出した圧縮クリップと、AnimationClip::saveで書き出したクリップのどちらも読める）。
+// 使い方：clip_bench [--bench] [--test] [クリップファイル...]（省略時は両方、検証に失敗すると終了コード1）
+
+// 計測の繰り返し回数
+static const int RepeatCount{ 2000 };
+// 1フレームあたりのアクター数（ウェーブの最大数）
+static const int ActorCount{ 200 };
+// 一時ファイル名
+static const char* TemporaryFile{ "clip_bench.tmp" };
+
+// 失敗した検証の数
+static int s_failures{ 0 };
+// 最適化で消されないようにするための出力先
+static volatile float s_sink{ 0.0f };
+
+// 検証結果の表示
+static void check(const char* name, bool passed)
+{
+	std::printf("  %-52s %s\n", name, passed ? "ok" : "FAILED");
+	s_failures += passed ? 0 : 1;
+}
+
+// 2つの回転の角度差（ラジアン、acosより精度の良い弦の長さから求める）
+static float rotation_error(const Quaternion& q1, const Quaternion& q2)
+{
+	const Quaternion d = (Quaternion::Dot(q1, q2) < 0.0f) ? q1 + q2 : q1 - q2;
+	const float chord = std::sqrt(Quaternion::Dot(d, d));
+	return 4.0f * std::asin(std::min(chord * 0.5f, 1.0f));
+}
+
+// 姿勢の最大誤差（回転はラジアン、平行移動と拡大縮小は絶対値）
+static float pose_error(const AnimationPose& p1, const AnimationPose& p2)
+{
+	float result = 0.0f;
+	for (int i = 0; i < p1.bone_count(); ++i)
+	{
+		result = std::max(result, rotation_error(p1.rotations[i], p2.rotations[i]));
+		result = std::max(result, Vector3::Distance(p1.translations[i], p2.translations[i]));
+		result = std::max(result, Vector3::Distance(p1.scales[i], p2.scales[i]));
+	}
+	return result;
+}
+
+// 姿勢が有限の値で、回転が単位クオータニオンか
+static bool is_valid(const AnimationPose& pose)
+{
+	for (int i = 0; i < pose.bone_count(); ++i)
+	{
+		const Quaternion& q = pose.rotations[i];
+		const float values[]{ q.x, q.y, q.z, q.w, pose.translations[i].x, pose.translations[i].y, pose.translations[i].z,
+			pose.scales[i].x, pose.scales[i].y, pose.scales[i].z };
+		for (const float v : values)
+		{
+			if (!std::isfinite(v)) return false;
+		}
+		if (std::fabs(Quaternion::Dot(q, q) - 1.0f) > 1.0e-3f) return false;
+	}
+	return true;
+}
+
+// 焼き込んだクリップの検証
+static void test_baked_clip()
+{
+	std::printf("AnimationClip (synthetic, %d bones)\n", SyntheticBoneCount);
+	const AnimationClip clip = synthetic_clip(SyntheticBoneCount, SyntheticClipLength, 1);
+	AnimationPose pose, other;
+
+	// キーの時刻ではキーの値をそのまま返す
+	float key_error = 0.0f;
+	for (int key = 0; key < clip.key_count(); ++key)
+	{
+		clip.sample(clip.key_time(key), pose);
+		for (int bone = 0; bone < clip.bone_count(); ++bone)
+		{
+			key_error = std::max(key_error, rotation_error(pose.rotations[bone], clip.key_rotation(key, bone)));
+			key_error = std::max(key_error, Vector3::Distance(pose.translations[bone], clip.key_translation(key, bone)));
+		}
+	}
+	check("key times reproduce the keys", key_error <= 1.0e-3f);
+
+	// キーの中間では平行移動は線形補間、回転は球面線形補間に近い値になる
+	float mid_error = 0.0f;
+	for (int key = 0; key + 1 < clip.key_count(); ++key)
+	{
+		clip.sample((clip.key_time(key) + clip.key_time(key + 1)) * 0.5f, pose);
+		for (int bone = 0; bone < clip.bone_count(); ++bone)
+		{
+			const Quaternion slerp = Quaternion::Slerp(clip.key_rotation(key, bone), clip.key_rotation(key + 1, bone), 0.5f);
+			const Vector3 lerp = Vector3::Lerp(clip.key_translation(key, bone), clip.key_translation(key + 1, bone), 0.5f);
+			mid_error = std::max(mid_error, rotation_error(pose.rotations[bone], slerp));
+			mid_error = std::max(mid_error, Vector3::Distance(pose.translations[bone], lerp));
+		}
+	}
+	check("midpoints interpolate neighbouring keys", mid_error <= 1.0e-3f);
+
+	// 範囲外の時刻は先頭と末尾に丸める
+	clip.sample(-5.0f, pose);
+	clip.sample(0.0f, other);
+	const bool clamp_start = pose_error(pose, other) == 0.0f;
+	clip.sample(clip.end_time() + 5.0f, pose);
+	clip.sample(clip.end_time(), other);
+	check("times outside the clip are clamped", clamp_start && pose_error(pose, other) == 0.0f);
+
+	// 書き出したファイルを読み込むと同じクリップになる
+	AnimationClip loaded;
+	bool same = clip.save(TemporaryFile) && loaded.load(TemporaryFile) && loaded.key_count() == clip.key_count()
+		&& loaded.bone_count() == clip.bone_count() && loaded.end_time() == clip.end_time();
+	for (int key = 0; same && key < clip.key_count(); ++key)
+	{
+		for (int bone = 0; bone < clip.bone_count(); ++bone)
+		{
+			same = same && std::memcmp(&loaded.key_rotation(key, bone), &clip.key_rotation(key, bone), sizeof(Quaternion)) == 0
+				&& std::memcmp(&loaded.key_translation(key, bone), &clip.key_translation(key, bone), sizeof(Vector3)) == 0;
+		}
+	}
+	check("save and load round trip", same);
+
+	// 途中で切れたファイルは読み込まず、元のクリップを変更しない
+	{
+		std::ifstream in(TemporaryFile, std::ios::binary);
+		std::string data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+		std::ofstream out(TemporaryFile, std::ios::binary | std::ios::trunc);
+		out.write(data.data(), data.size() / 2);
+	}
+	check("truncated file is rejected", !loaded.load(TemporaryFile) && loaded.key_count() == clip.key_count());
+	std::remove(TemporaryFile);
+}
+
+// 書き出したクリップの読み込み（圧縮クリップと焼き込んだクリップのどちらか）
+static bool load_dumped(const char* file_name, AnimationClip& clip, CompressedAnimationClip& compressed, bool& is_compressed)
+{
+	is_compressed = false;
+	if (clip.load(file_name)) return true;
+	is_compressed = true;
+	return compressed.load(file_name);
+}
+
+// 書き出したクリップの検証
+static void test_dumped_clip(const char* file_name)
+{
+	std::printf("%s\n", file_name);
+	AnimationClip clip;
+	CompressedAnimationClip compressed;
+	bool is_compressed = false;
+	const bool loaded = load_dumped(file_name, clip, compressed, is_compressed);
+	check("clip loads", loaded && (is_compressed ? compressed.bone_count() : clip.bone_count()) > 0);
+	if (!loaded) return;
+
+	// 全区間を細かくサンプリングして不正な値が出ないか
+	const float end_time = is_compressed ? compressed.end_time() : clip.end_time();
+	AnimationPose pose;
+	bool valid = true;
+	for (float time = 0.0f; time <= end_time && valid; time += 0.25f)
+	{
+		if (is_compressed) compressed.sample(time, pose);
+		else clip.sample(time, pose);
+		valid = is_valid(pose);
+	}
+	check("samples are finite with unit rotations", valid);
+}
+
+// アクター1体分のサンプリング（姿勢のサンプリングとローカル変換行列への変換）の計測
+template <class Clip>
+static void measure(const char* name, const Clip& clip, int bone_count, float end_time)
+{
+	AnimationPose pose;
+	std::vector<AffineMatrix> local_matrices(bone_count);
+	float time = 0.0f;
+	const auto start = BenchClock::now();
+	for (int r = 0; r < RepeatCount; ++r)
+	{
+		clip.sample(time, pose);
+		pose.to_matrices(local_matrices.data());
+		// アクターごとに再生位置がずれている状態を再現する
+		time += 0.37f;
+		if (time > end_time) time -= end_time;
+	}
+	const double per_actor = elapsed_ns(start) / RepeatCount;
+	s_sink = local_matrices[bone_count / 2].m[0][3];
+	std::printf("  %-40s %4d bones %9.2f us/actor %9.3f ms/%d actors\n", name, bone_count, per_actor / 1000.0, per_actor * ActorCount / 1.0e6, ActorCount);
+}
+
+// ベンチマークの実行
+static void run_bench(const std::vector<const char*>& files)
+{
+	std::printf("sampling cost per actor (sample + to_matrices)\n");
+	const AnimationClip clip = synthetic_clip(SyntheticBoneCount, SyntheticClipLength, 1);
+	measure("AnimationClip (synthetic)", clip, clip.bone_count(), clip.end_time());
+
+	for (const auto file_name : files)
+	{
+		AnimationClip dumped;
+		CompressedAnimationClip compressed;
+		bool is_compressed = false;
+		if (!load_dumped(file_name, dumped, compressed, is_compressed)) continue;
+		if (is_compressed) measure(file_name, compressed, compressed.bone_count(), compressed.end_time());
+		else measure(file_name, dumped, dumped.bone_count(), dumped.end_time());
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	bool bench = false;
+	bool test = false;
+	std::vector<const char*> files;
+	for (int i = 1; i < argc; ++i)
+	{
+		if (std::strcmp(argv[i], "--bench") == 0) bench = true;
+		else if (std::strcmp(argv[i], "--test") == 0) test = true;
+		else if (argv[i][0] == '-')
+		{
+			std::printf("usage: clip_bench [--bench] [--test] [clip files...]\n");
+			return 2;
+		}
+		else files.push_back(argv[i]);
+	}
+	if (!bench && !test) bench = test = true;
+
+	if (test)
+	{
+		test_baked_clip();
+		for (const auto file_name : files) test_dumped_clip(file_name);
+		std::printf("%d check(s) failed\n", s_failures);
+	}
+	if (bench) run_bench(files);
+	return (s_failures == 0) ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,202 @@
+#include "SyntheticAnimation.h"
+#include "../src/Graphic/AnimationClip.h"
+#include "../src/Graphic/CompressedAnimationClip.h"
+#include "../src/Graphic/AnimationPose.h"
+#include "../src/Graphic/Skeleton.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// アニメーションクリップの圧縮のベンチマーク
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// 焼き込んだクリップ（AnimationClip）を圧縮し、圧縮時間、メモリ量、元のキーとの誤差、サンプリングの速度を比較する。
+// AnimationClip::saveで書き出したクリップのファイルを指定すると、それも圧縮して計測する。
+// 使い方：clip_compression_bench [--bench] [--test] [クリップファイル...]（省略時は両方、検証に失敗すると終了コード1）
+
+// 合成クリップの長さ（フレーム、モーションごと）
+static const float ClipLengths[]{ 30.0f, 45.0f, 60.0f, 90.0f, 120.0f, 40.0f, 75.0f, 150.0f };
+// サンプリングの繰り返し回数
+static const int SampleCount{ 2000 };
+// 一時ファイル名
+static const char* TemporaryFile{ "clip_compression_bench.tmp" };
+
+// 失敗した検証の数
+static int s_failures{ 0 };
+// 最適化で消されないようにするための出力先
+static volatile float s_sink{ 0.0f };
+
+// 検証結果の表示
+static void check(const char* name, bool passed)
+{
+	std::printf("  %-52s %s\n", name, passed ? "ok" : "FAILED");
+	s_failures += passed ? 0 : 1;
+}
+
+// 構造体：圧縮の計測結果
+struct CompressionResult
+{
+	ClipCompressionStats	stats;					// 圧縮の統計
+	double					compress_ms{ 0.0 };		// 圧縮時間（ミリ秒）
+	double					raw_sample_ns{ 0.0 };	// 圧縮前のサンプリング時間（ボーンあたりナノ秒）
+	double					sample_ns{ 0.0 };		// 圧縮後のサンプリング時間（ボーンあたりナノ秒）
+};
+
+// サンプリングの計測（ボーンあたりナノ秒）
+template <class Clip>
+static double measure_sampling(const Clip& clip, int bone_count, float end_time)
+{
+	AnimationPose pose;
+	float time = 0.0f;
+	const auto start = BenchClock::now();
+	for (int i = 0; i < SampleCount; ++i)
+	{
+		clip.sample(time, pose);
+		time += 0.37f;
+		if (time > end_time) time -= end_time;
+	}
+	s_sink = pose.rotations[bone_count / 2].w;
+	return elapsed_ns(start) / ((double)SampleCount * bone_count);
+}
+
+// クリップの圧縮と計測
+static CompressionResult compress(const AnimationClip& clip, const std::vector<ClipTolerance>& tolerances, CompressedAnimationClip& compressed)
+{
+	CompressionResult result;
+	const auto start = BenchClock::now();
+	compressed = CompressedAnimationClip(clip, tolerances.data());
+	result.compress_ms = elapsed_ns(start) / 1.0e6;
+	result.stats = compressed.measure(clip);
+	result.raw_sample_ns = measure_sampling(clip, clip.bone_count(), clip.end_time());
+	result.sample_ns = measure_sampling(compressed, clip.bone_count(), clip.end_time());
+	return result;
+}
+
+// 2つの回転の角度差（ラジアン、acosより精度の良い弦の長さから求める）
+static float rotation_error(const Quaternion& q1, const Quaternion& q2)
+{
+	const Quaternion d = (Quaternion::Dot(q1, q2) < 0.0f) ? q1 + q2 : q1 - q2;
+	const float chord = std::sqrt(Quaternion::Dot(d, d));
+	return 4.0f * std::asin(std::min(chord * 0.5f, 1.0f));
+}
+
+// 各ボーンの許容誤差を超えた誤差の最大値（超えていなければ0以下）
+static void measure_excess(const AnimationClip& clip, const CompressedAnimationClip& compressed, const std::vector<ClipTolerance>& tolerances,
+	float& rotation_excess, float& translation_excess)
+{
+	AnimationPose pose;
+	for (int key = 0; key < clip.key_count(); ++key)
+	{
+		compressed.sample(clip.key_time(key), pose);
+		for (int bone = 0; bone < clip.bone_count(); ++bone)
+		{
+			const float rotation = rotation_error(pose.rotations[bone], clip.key_rotation(key, bone));
+			const float translation = Vector3::Distance(pose.translations[bone], clip.key_translation(key, bone));
+			rotation_excess = std::max(rotation_excess, rotation - tolerances[bone].rotation);
+			translation_excess = std::max(translation_excess, translation - tolerances[bone].translation);
+		}
+	}
+}
+
+// 計測結果の表示
+static void print(const char* name, const CompressionResult& result)
+{
+	const auto& stats = result.stats;
+	std::printf("  %-28s %8.1f %8.1f %6.1f%% %8.2f %9.5f %9.5f %9.5f %7.2f %7.2f\n", name,
+		stats.raw_size / 1024.0, stats.compressed_size / 1024.0, 100.0 * stats.compressed_size / std::max(stats.raw_size, 1),
+		result.compress_ms, stats.max_rotation_error, stats.average_rotation_error, stats.max_translation_error,
+		result.raw_sample_ns, result.sample_ns);
+}
+
+// 表の見出しの表示
+static void print_header()
+{
+	std::printf("  %-28s %8s %8s %7s %8s %9s %9s %9s %7s %7s\n", "clip", "raw(KB)", "comp(KB)", "ratio",
+		"comp(ms)", "rot max", "rot avg", "pos max", "raw ns", "comp ns");
+	std::printf("  %-28s %8s %8s %7s %8s %9s %9s %9s %7s %7s\n", "", "", "", "", "", "(rad)", "(rad)", "", "/bone", "/bone");
+}
+
+// ベンチマークと検証の実行
+static void run(const std::vector<const char*>& files, bool test)
+{
+	const Skeleton skeleton(synthetic_parents(SyntheticBoneCount));
+	const auto tolerances = synthetic_tolerances(skeleton);
+
+	std::printf("synthetic motions (%d bones)\n", SyntheticBoneCount);
+	print_header();
+	ClipCompressionStats total;
+	float rotation_excess = -1.0f;
+	float translation_excess = -1.0f;
+	CompressedAnimationClip compressed;
+	for (int motion = 0; motion < (int)(sizeof(ClipLengths) / sizeof(ClipLengths[0])); ++motion)
+	{
+		const AnimationClip clip = synthetic_clip(SyntheticBoneCount, ClipLengths[motion], motion + 1);
+		const auto result = compress(clip, tolerances, compressed);
+		const std::string name = "motion " + std::to_string(motion) + " (" + std::to_string((int)ClipLengths[motion]) + " frames)";
+		print(name.c_str(), result);
+		total.merge(result.stats);
+		measure_excess(clip, compressed, tolerances, rotation_excess, translation_excess);
+	}
+	std::printf("  %-28s %8.1f %8.1f %6.1f%%\n", "total", total.raw_size / 1024.0, total.compressed_size / 1024.0,
+		100.0 * total.compressed_size / std::max(total.raw_size, 1));
+
+	for (const auto file_name : files)
+	{
+		AnimationClip clip;
+		if (!clip.load(file_name))
+		{
+			std::printf("  %s: not a baked clip (AnimationClip::save)\n", file_name);
+			if (test) check("dumped clip loads", false);
+			continue;
+		}
+		// 書き出したクリップにはボーンの階層がないため、全ボーンをルートと同じ最も厳しい許容誤差で圧縮する
+		const std::vector<ClipTolerance> strict(clip.bone_count(), tolerances[0]);
+		print(file_name, compress(clip, strict, compressed));
+	}
+
+	if (!test) return;
+
+	// 誤差は各ボーンの許容誤差に量子化の誤差（回転は15ビット、平行移動は16ビットの刻み幅程度）を加えた範囲に収まる
+	std::printf("checks (excess over tolerance: rotation %.5f rad, translation %.5f)\n", rotation_excess, translation_excess);
+	check("rotation error within tolerance + quantization", rotation_excess <= 2.0e-4f);
+	check("translation error within tolerance + quantization", translation_excess <= 2.0e-3f);
+	check("compressed clips are smaller", total.compressed_size < total.raw_size / 2);
+
+	// 書き出して読み込んだ圧縮クリップは同じ姿勢を返す
+	CompressedAnimationClip loaded;
+	AnimationPose p1, p2;
+	bool same = compressed.save(TemporaryFile) && loaded.load(TemporaryFile) && loaded.bone_count() == compressed.bone_count();
+	for (float time = 0.0f; same && time <= compressed.end_time(); time += 0.5f)
+	{
+		compressed.sample(time, p1);
+		loaded.sample(time, p2);
+		same = std::memcmp(p1.rotations.data(), p2.rotations.data(), sizeof(Quaternion) * p1.bone_count()) == 0
+			&& std::memcmp(p1.translations.data(), p2.translations.data(), sizeof(Vector3) * p1.bone_count()) == 0;
+	}
+	check("save and load round trip", same);
+	std::remove(TemporaryFile);
+}
+
+int main(int argc, char* argv[])
+{
+	bool bench = false;
+	bool test = false;
+	std::vector<const char*> files;
+	for (int i = 1; i < argc; ++i)
+	{
+		if (std::strcmp(argv[i], "--bench") == 0) bench = true;
+		else if (std::strcmp(argv[i], "--test") == 0) test = true;
+		else if (argv[i][0] == '-')
+		{
+			std::printf("usage: clip_compression_bench [--bench] [--test] [clip files...]\n");
+			return 2;
+		}
+		else files.push_back(argv[i]);
+	}
+	if (!bench && !test) test = true;
+
+	run(files, test);
+	if (test) std::printf("%d check(s) failed\n", s_failures);
+	return (s_failures == 0) ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,165 @@
+#include "SyntheticAnimation.h"
+#include "../src/Graphic/AnimationPose.h"
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+// サンプリング位置（ClipCursor）のベンチマーク
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// 圧縮クリップのキーの探索を、前回のキーから順に探すカーソル付きと毎回の二分探索で比較する。
+// 通常の再生（1tickで0.5フレーム）、倍速、ランダムな位置への移動について、クリップの長さを変えて計測する。
+// 検証では、どの再生パターンでもカーソル付きと二分探索のサンプリング結果が一致することを確かめる。
+// 使い方：clip_cursor_bench [--bench] [--test]（省略時は両方、検証に失敗すると終了コード1）
+
+// クリップの長さ（フレーム）
+static const float ClipLengths[]{ 30.0f, 120.0f, 600.0f };
+// 計測するサンプリング回数
+static const int SampleCount{ 4000 };
+
+// 失敗した検証の数
+static int s_failures{ 0 };
+// 最適化で消されないようにするための出力先
+static volatile float s_sink{ 0.0f };
+
+// 検証結果の表示
+static void check(const char* name, bool passed)
+{
+	std::printf("  %-52s %s\n", name, passed ? "ok" : "FAILED");
+	s_failures += passed ? 0 : 1;
+}
+
+// 列挙型：再生パターン
+enum class Playback
+{
+	Normal,		// 1tickで0.5フレーム進む（Animationの通常の再生）
+	Fast,		// 1tickで2フレーム進む
+	Seek,		// 毎回ランダムな位置に移動
+};
+
+// 再生パターンの名前
+static const char* playback_name(Playback playback)
+{
+	switch (playback)
+	{
+	case Playback::Normal:	return "normal (0.5/tick)";
+	case Playback::Fast:	return "fast (2/tick)";
+	default:				return "random seek";
+	}
+}
+
+// 再生時間の列の作成（クリップの終端で先頭に戻る）
+static std::vector<float> make_times(Playback playback, float end_time, int count)
+{
+	Random random(3);
+	std::vector<float> times(count);
+	float time = 0.0f;
+	for (int i = 0; i < count; ++i)
+	{
+		times[i] = time;
+		if (playback == Playback::Seek) time = random.rand_float(0.0f, end_time);
+		else time = std::fmod(time + ((playback == Playback::Normal) ? 0.5f : 2.0f), end_time);
+	}
+	return times;
+}
+
+// サンプリングの計測（ボーンあたりナノ秒、cursorがnullptrの場合は二分探索）
+static double measure(const CompressedAnimationClip& clip, const std::vector<int>& bones, const std::vector<float>& times, ClipCursor* cursor)
+{
+	AnimationPose pose(clip.bone_count());
+	const auto start = BenchClock::now();
+	for (const auto time : times)
+	{
+		clip.sample(time, pose, bones.data(), (int)bones.size(), cursor);
+	}
+	s_sink = pose.rotations[bones.size() / 2].w;
+	return elapsed_ns(start) / ((double)times.size() * bones.size());
+}
+
+// カーソル付きと二分探索の結果が一致するか
+static bool same_samples(const CompressedAnimationClip& clip, const std::vector<int>& bones, const std::vector<float>& times, ClipCursor& cursor)
+{
+	AnimationPose p1(clip.bone_count());
+	AnimationPose p2(clip.bone_count());
+	for (const auto time : times)
+	{
+		clip.sample(time, p1, bones.data(), (int)bones.size(), &cursor);
+		clip.sample(time, p2, bones.data(), (int)bones.size());
+		if (std::memcmp(p1.rotations.data(), p2.rotations.data(), sizeof(Quaternion) * p1.bone_count()) != 0
+			|| std::memcmp(p1.translations.data(), p2.translations.data(), sizeof(Vector3) * p1.bone_count()) != 0
+			|| std::memcmp(p1.scales.data(), p2.scales.data(), sizeof(Vector3) * p1.bone_count()) != 0) return false;
+	}
+	return true;
+}
+
+int main(int argc, char* argv[])
+{
+	bool run_bench = false;
+	bool run_test = false;
+	for (int i = 1; i < argc; ++i)
+	{
+		if (std::strcmp(argv[i], "--bench") == 0) run_bench = true;
+		else if (std::strcmp(argv[i], "--test") == 0) run_test = true;
+		else
+		{
+			std::printf("usage: clip_cursor_bench [--bench] [--test]\n");
+			return 2;
+		}
+	}
+	if (!run_bench && !run_test) run_bench = run_test = true;
+
+	const Skeleton skeleton(synthetic_parents(SyntheticBoneCount));
+	const auto tolerances = synthetic_tolerances(skeleton);
+	std::vector<CompressedAnimationClip> clips;
+	for (int i = 0; i < (int)(sizeof(ClipLengths) / sizeof(ClipLengths[0])); ++i)
+	{
+		clips.emplace_back(synthetic_clip(SyntheticBoneCount, ClipLengths[i], i + 1), tolerances.data());
+	}
+	std::vector<int> bones(SyntheticBoneCount);
+	for (int i = 0; i < SyntheticBoneCount; ++i) bones[i] = i;
+	const Playback playbacks[]{ Playback::Normal, Playback::Fast, Playback::Seek };
+
+	if (run_test)
+	{
+		std::printf("cursor vs binary search\n");
+		bool same = true;
+		for (const auto& clip : clips)
+		{
+			for (const auto playback : playbacks)
+			{
+				ClipCursor cursor;
+				same = same && same_samples(clip, bones, make_times(playback, clip.end_time(), 500), cursor);
+			}
+		}
+		check("every playback pattern matches binary search", same);
+
+		// 巻き戻し、終端、別のクリップへの切り替え
+		ClipCursor cursor;
+		const std::vector<float> rewind{ 20.0f, 25.0f, 3.0f, 0.0f, clips[0].end_time(), 0.5f };
+		check("rewinding and the clip end match binary search", same_samples(clips[0], bones, rewind, cursor));
+		check("switching clips resets the cursor", same_samples(clips[1], bones, rewind, cursor) && cursor.clip == &clips[1]);
+
+		// 一部のボーンのみのサンプリングでも一致する
+		const std::vector<int> subset{ 0, 5, 17, 40, 63 };
+		ClipCursor subset_cursor;
+		check("bone subsets match binary search", same_samples(clips[2], subset, make_times(Playback::Normal, clips[2].end_time(), 500), subset_cursor));
+		std::printf("%d check(s) failed\n", s_failures);
+	}
+
+	if (run_bench)
+	{
+		std::printf("key search (%d bones, ns per bone)\n", SyntheticBoneCount);
+		std::printf("  %-10s %-20s %10s %10s %10s\n", "frames", "playback", "binary", "cursor", "speedup");
+		for (const auto& clip : clips)
+		{
+			for (const auto playback : playbacks)
+			{
+				const auto times = make_times(playback, clip.end_time(), SampleCount);
+				ClipCursor cursor;
+				const double binary_ns = measure(clip, bones, times, nullptr);
+				const double cursor_ns = measure(clip, bones, times, &cursor);
+				std::printf("  %-10.0f %-20s %10.2f %10.2f %9.2fx\n", clip.end_time(), playback_name(playback), binary_ns, cursor_ns, binary_ns / cursor_ns);
+			}
+		}
+	}
+	return (s_failures == 0) ? 0 : 1;
+}
\ No newline at end of file
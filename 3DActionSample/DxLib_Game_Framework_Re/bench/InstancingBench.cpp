@@ -0,0 +1,219 @@
+#include "../src/Graphic/InstanceBuffer.h"
+#include "../src/Graphic/NullRenderBackend.h"
+#include "../src/Graphic/RenderQueue.h"
+#include "../src/Math/Quaternion.h"
+#include "../src/Math/Vector3.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+// 描画コマンドリストのインスタンス描画のベンチマークと検証
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// プレイヤー、ボスとGhoulのウェーブ（10、100、500体）の描画コマンドを記録してNullRenderBackendで実行し、
+// インスタンス描画の容量ごとに1フレームの描画回数と、記録・ソート・ボーン行列の詰め込み・実行の時間を比較する。
+// 容量0はDxLibRenderBackendと同じく、1体ずつdraw_skinnedで描画する。
+// 検証では、InstanceBufferの詰め込みの配置と容量、同じ状態が続く範囲だけがまとまること、
+// 容量ごとのバッチの分割、バッチのボーン行列が記録した順に詰められることを確かめる。
+// 使い方：instancing_bench [--bench] [--test]（省略時は両方、検証に失敗すると終了コード1）
+
+// Ghoulの数（計測するもの）
+static const int GhoulCounts[]{ 10, 100, 500 };
+// インスタンス描画の容量（計測するもの、0でインスタンス描画しない）
+static const int Capacities[]{ 0, InstanceBuffer::DefaultCapacity, 65536 };
+// 1体のボーン数
+static const int BoneCount{ 64 };
+// スケルタルメッシュのID（プレイヤー、ボス、Ghoul）
+static const int ModelPlayer{ 0 };
+static const int ModelBoss{ 1 };
+static const int ModelGhoul{ 2 };
+// 計測するフレーム数
+static const int FrameCount{ 200 };
+
+// 失敗した検証の数
+static int s_failures{ 0 };
+// 最適化で消されないようにするための出力先
+static volatile int s_sink{ 0 };
+
+// 検証結果の表示
+static void check(const char* name, bool passed)
+{
+	std::printf("  %-52s %s\n", name, passed ? "ok" : "FAILED");
+	s_failures += passed ? 0 : 1;
+}
+
+// 計測の経過時間（ナノ秒）
+using Clock = std::chrono::steady_clock;
+static double elapsed_ns(Clock::time_point start)
+{
+	return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+}
+
+// クラス：バッチを記録する描画バックエンド
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// NullRenderBackendと同じく回数を数え、インスタンス描画で受け取ったボーン行列を順に写す。
+class RecordingRenderBackend : public NullRenderBackend
+{
+public:
+	// バインド中のモデルのインスタンスをまとめて描画
+	virtual void draw_instanced(const InstanceBatch& batch) override
+	{
+		NullRenderBackend::draw_instanced(batch);
+		batch_sizes.push_back(batch.instance_count);
+		palettes.insert(palettes.end(), batch.palettes, batch.palettes + batch.instance_count * batch.bone_count);
+	}
+
+	// 各バッチのインスタンス数
+	std::vector<int>			batch_sizes;
+	// 受け取ったボーン行列（バッチ順）
+	std::vector<AffineMatrix>	palettes;
+};
+
+// アクターごとに異なるボーン行列の作成（平行移動にアクターとボーンの番号を入れる）
+static std::vector<AffineMatrix> make_matrices(int actor_count)
+{
+	std::vector<AffineMatrix> result((std::size_t)actor_count * BoneCount);
+	for (int actor = 0; actor < actor_count; ++actor)
+	{
+		for (int bone = 0; bone < BoneCount; ++bone)
+		{
+			result[(std::size_t)actor * BoneCount + bone] = AffineMatrix::CreateWorld(Vector3::One,
+				Quaternion(Vector3::UnitY, (float)bone), Vector3((float)actor, (float)bone, 0.0f));
+		}
+	}
+	return result;
+}
+
+// 1フレームの描画コマンドの記録（ステージの描画パスにプレイヤー、Ghoul、ボスの順、matricesの先頭2体はプレイヤーとボス）
+static void submit_frame(RenderQueue& queue, const std::vector<AffineMatrix>& matrices, int ghoul_count)
+{
+	queue.set_pass(0);
+	queue.submit(ModelPlayer, &matrices[0], BoneCount);
+	for (int ghoul = 0; ghoul < ghoul_count; ++ghoul)
+	{
+		queue.submit(ModelGhoul, &matrices[(std::size_t)(ghoul + 2) * BoneCount], BoneCount);
+	}
+	queue.submit(ModelBoss, &matrices[BoneCount], BoneCount);
+}
+
+// 検証
+static void test()
+{
+	std::printf("instanced draws (%d bones per actor)\n", BoneCount);
+
+	// InstanceBufferはインスタンスnのボーンbをpalettes[n * bone_count + b]に詰め、容量を超える分は受け付けない
+	const auto matrices = make_matrices(4);
+	InstanceBuffer buffer(BoneCount * 3);
+	buffer.begin(ModelGhoul, BoneCount);
+	bool added = true;
+	for (int actor = 0; actor < 3; ++actor) added = added && buffer.add(&matrices[(std::size_t)actor * BoneCount]);
+	const auto batch = buffer.batch();
+	check("palettes are packed instance by instance", added && batch.instance_count == 3 && batch.bone_count == BoneCount
+		&& batch.model == ModelGhoul && std::memcmp(batch.palettes, matrices.data(), sizeof(AffineMatrix) * BoneCount * 3) == 0);
+	check("a full buffer rejects the next instance", !buffer.add(&matrices[(std::size_t)3 * BoneCount]) && buffer.size() == 3);
+	check("instances per batch follow the capacity", buffer.instances_per_batch(BoneCount) == 3 && buffer.instances_per_batch(BoneCount * 4) == 0
+		&& InstanceBuffer().instances_per_batch(BoneCount) == InstanceBuffer::DefaultCapacity / BoneCount);
+
+	// 容量0では1体ずつ描画し、インスタンス描画を使わない
+	const int ghoul_count = 100;
+	const auto wave = make_matrices(ghoul_count + 2);
+	RenderQueue queue;
+	RecordingRenderBackend backend;
+	submit_frame(queue, wave, ghoul_count);
+	queue.sort();
+	queue.execute(backend);
+	check("capacity 0 draws one command at a time", backend.draw_calls() == ghoul_count + 2 && queue.stats().draw_calls == ghoul_count + 2
+		&& queue.stats().instanced_draws == 0 && backend.batch_sizes.empty());
+
+	// 既定の容量では、Ghoulの範囲だけが容量ごとのバッチに分かれ、プレイヤーとボスは1体ずつ描画する
+	const int per_batch = InstanceBuffer::DefaultCapacity / BoneCount;
+	const int batches = (ghoul_count + per_batch - 1) / per_batch;
+	queue.reset_stats();
+	backend.reset();
+	backend.set_instance_capacity(InstanceBuffer::DefaultCapacity);
+	submit_frame(queue, wave, ghoul_count);
+	queue.sort();
+	queue.execute(backend);
+	bool split = (int)backend.batch_sizes.size() == batches;
+	for (int i = 0; i < (int)backend.batch_sizes.size(); ++i)
+	{
+		split = split && backend.batch_sizes[i] == ((i < batches - 1) ? per_batch : ghoul_count - per_batch * (batches - 1));
+	}
+	check("a run of Ghouls splits into full batches", split && queue.stats().instanced_draws == batches && queue.stats().instances == ghoul_count);
+	check("every command is drawn exactly once", queue.stats().commands == ghoul_count + 2 && backend.instances() == ghoul_count + 2
+		&& backend.draw_calls() == batches + 2);
+
+	// バッチのボーン行列は記録した順（ソートは安定）に詰められる
+	check("batched palettes keep the submission order", (int)backend.palettes.size() == ghoul_count * BoneCount
+		&& std::memcmp(backend.palettes.data(), &wave[(std::size_t)2 * BoneCount], sizeof(AffineMatrix) * ghoul_count * BoneCount) == 0);
+
+	// テクスチャが異なるコマンドは同じバッチにまとめない
+	queue.reset_stats();
+	backend.reset();
+	queue.set_pass(0);
+	for (int ghoul = 0; ghoul < 6; ++ghoul)
+	{
+		queue.submit(ModelGhoul, &wave[(std::size_t)ghoul * BoneCount], BoneCount, ghoul % 2);
+	}
+	queue.submit(ModelGhoul, &wave[0], BoneCount, 5);
+	queue.sort();
+	queue.execute(backend);
+	check("a different texture starts a new batch", queue.stats().instanced_draws == 2 && queue.stats().instances == 6
+		&& queue.stats().draw_calls == 3);
+}
+
+// 計測
+static void bench()
+{
+	std::printf("draw calls per frame (player, boss and a Ghoul wave, %d bones, null backend)\n", BoneCount);
+	std::printf("  %-8s %-10s %10s %10s %10s %12s\n", "ghouls", "capacity", "commands", "draws", "instanced", "us/frame");
+	for (const auto ghoul_count : GhoulCounts)
+	{
+		const auto wave = make_matrices(ghoul_count + 2);
+		for (const auto capacity : Capacities)
+		{
+			RenderQueue queue;
+			NullRenderBackend backend;
+			backend.set_instance_capacity(capacity);
+			const auto frame = [&]()
+			{
+				queue.reset_stats();
+				submit_frame(queue, wave, ghoul_count);
+				queue.sort();
+				queue.execute(backend);
+			};
+			frame();
+			const auto start = Clock::now();
+			for (int i = 0; i < FrameCount; ++i) frame();
+			const double us = elapsed_ns(start) / FrameCount / 1000.0;
+			s_sink = backend.draw_calls();
+			std::printf("  %-8d %-10d %10d %10d %10d %12.1f\n", ghoul_count, capacity, queue.stats().commands, queue.stats().draw_calls,
+				queue.stats().instanced_draws, us);
+		}
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	bool run_bench = false;
+	bool run_test = false;
+	for (int i = 1; i < argc; ++i)
+	{
+		if (std::strcmp(argv[i], "--bench") == 0) run_bench = true;
+		else if (std::strcmp(argv[i], "--test") == 0) run_test = true;
+		else
+		{
+			std::printf("usage: instancing_bench [--bench] [--test]\n");
+			return 2;
+		}
+	}
+	if (!run_bench && !run_test) run_bench = run_test = true;
+
+	if (run_test)
+	{
+		test();
+		std::printf("%d check(s) failed\n", s_failures);
+	}
+	if (run_bench) bench();
+	return (s_failures == 0) ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,721 @@
+#include "../src/Math/Vector2.h"
+#include "../src/Math/Vector3.h"
+#include "../src/Math/Matrix.h"
+#include "../src/Math/AffineMatrix.h"
+#include "../src/Math/Quaternion.h"
+#include "../src/Math/MathHelper.h"
+#include "../src/Math/Random.h"
+#include <chrono>
+#include <cmath>
+#include <cfloat>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include <algorithm>
+
+// 数学ライブラリのベンチマークと精度検証
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// Vector2、Vector3、Matrix、AffineMatrix、Quaternionの各演算を、
+// スループット（独立した入力を連続で処理）とレイテンシ（前の結果に依存する入力を連続で処理）で計測し、
+// 倍精度で計算した参照値との誤差を検証する。
+// 逆行列は特異に近い行列でも検証する（MATH_NO_SSEでビルドするとスカラー処理の実装を検証できる）。
+// 使い方：math_bench [--bench] [--accuracy]（省略時は両方、誤差が許容値を超えると終了コード1）
+
+// 入力の数
+static const int InputCount{ 1024 };
+// 計測の繰り返し回数
+static const int RepeatCount{ 200 };
+// 精度検証の試行回数
+static const int TrialCount{ 20000 };
+
+// 入力
+static std::vector<float>		s_scalar;
+static std::vector<float>		s_degree;
+static std::vector<float>		s_t;
+static std::vector<Vector2>		s_v2a;
+static std::vector<Vector2>		s_v2b;
+static std::vector<Vector3>		s_v3a;
+static std::vector<Vector3>		s_v3b;
+static std::vector<Vector3>		s_axis;
+static std::vector<Quaternion>	s_qa;
+static std::vector<Quaternion>	s_qb;
+static std::vector<Matrix>		s_rigid;
+static std::vector<Matrix>		s_affine;
+static std::vector<Matrix>		s_projective;
+static std::vector<AffineMatrix>	s_affine34;
+static std::vector<Matrix>		s_near_affine;
+static std::vector<Matrix>		s_near_projective;
+
+// 最適化で計算が消されないように結果を書き出す先
+static volatile float s_sink{ 0.0f };
+// 最適化で定数として扱われないゼロ（レイテンシ計測で前の結果を次の入力に加えるために使う）
+static volatile float s_zero{ 0.0f };
+
+// 結果の先頭成分の取得（レイテンシ計測で次の入力に依存させるために使う）
+static float first(float value) { return value; }
+static float first(MatrixKind value) { return (float)value; }
+static float first(const Vector2& value) { return value.x; }
+static float first(const Vector3& value) { return value.x; }
+static float first(const Quaternion& value) { return value.x; }
+static float first(const Matrix& value) { return value.m[0][0]; }
+static float first(const AffineMatrix& value) { return value.m[0][0]; }
+
+// ベクトルのx成分に加算した値
+static Vector2 offset(Vector2 v, float d) { v.x += d; return v; }
+static Vector3 offset(Vector3 v, float d) { v.x += d; return v; }
+static Quaternion offset(Quaternion q, float d) { q.x += d; return q; }
+static Matrix offset(Matrix m, float d) { m.m[0][0] += d; return m; }
+static AffineMatrix offset(AffineMatrix m, float d) { m.m[0][0] += d; return m; }
+
+// 単位クオータニオンの生成
+static Quaternion random_quaternion(Random& random)
+{
+	Quaternion q(random.rand_float(-1.0f, 1.0f), random.rand_float(-1.0f, 1.0f), random.rand_float(-1.0f, 1.0f), random.rand_float(-1.0f, 1.0f));
+	return Quaternion::Normalize(q);
+}
+
+// 単位ベクトルの生成
+static Vector3 random_axis(Random& random)
+{
+	Vector3 v(random.rand_float(-1.0f, 1.0f), random.rand_float(-1.0f, 1.0f), random.rand_float(-1.0f, 1.0f));
+	if (v.LengthSquared() < 1.0e-4f) v = Vector3::UnitY;
+	return Vector3::Normalize(v);
+}
+
+// ベクトルの生成
+static Vector3 random_vector(Random& random, float range)
+{
+	return Vector3(random.rand_float(-range, range), random.rand_float(-range, range), random.rand_float(-range, range));
+}
+
+// ビュー・プロジェクション行列の生成
+static Matrix random_view_projection(Random& random)
+{
+	const Vector3 eye = random_vector(random, 100.0f);
+	const Vector3 target = eye + random_axis(random) * random.rand_float(1.0f, 50.0f) + Vector3(0.0f, 0.0f, 0.01f);
+	return Matrix::CreateLookAt(eye, target, Vector3::Up) * Matrix::CreatePerspectiveFieldOfView(random.rand_float(30.0f, 90.0f), 16.0f / 9.0f, 0.3f, 1000.0f);
+}
+
+// 特異に近いアフィン変換行列の生成（3行目を1、2行目の線形結合に近づけ、条件数を10^2～10^4にする）
+static Matrix random_near_singular_affine(Random& random, const Matrix& affine)
+{
+	Matrix result = affine;
+	const float t = random.rand_float(0.2f, 0.8f);
+	const float epsilon = std::pow(10.0f, -random.rand_float(2.0f, 4.0f));
+	const Vector3 noise = random_axis(random) * epsilon;
+	for (int c = 0; c < 3; ++c)
+	{
+		result.m[2][c] = affine.m[0][c] * t + affine.m[1][c] * (1.0f - t) + (&noise.x)[c];
+	}
+	return result;
+}
+
+// 特異に近いビュー・プロジェクション行列の生成（手前と奥のクリップ面の比を極端にし、原点から離れた視点にする）
+static Matrix random_near_singular_projective(Random& random)
+{
+	const Vector3 eye = random_vector(random, 1000.0f);
+	const Vector3 target = eye + random_axis(random) * random.rand_float(1.0f, 50.0f) + Vector3(0.0f, 0.0f, 0.01f);
+	return Matrix::CreateLookAt(eye, target, Vector3::Up) * Matrix::CreatePerspectiveFieldOfView(random.rand_float(30.0f, 90.0f), 16.0f / 9.0f, 0.01f, 100000.0f);
+}
+
+// 入力の作成
+static void make_inputs(Random& random, int count)
+{
+	s_scalar.resize(count); s_degree.resize(count); s_t.resize(count);
+	s_v2a.resize(count); s_v2b.resize(count); s_v3a.resize(count); s_v3b.resize(count); s_axis.resize(count);
+	s_qa.resize(count); s_qb.resize(count);
+	s_rigid.resize(count); s_affine.resize(count); s_projective.resize(count); s_affine34.resize(count);
+	s_near_affine.resize(count); s_near_projective.resize(count);
+	for (int i = 0; i < count; ++i)
+	{
+		s_scalar[i] = random.rand_float(-10.0f, 10.0f);
+		s_degree[i] = random.rand_float(-180.0f, 180.0f);
+		s_t[i] = random.rand_float(0.0f, 1.0f);
+		s_v2a[i] = Vector2(random.rand_float(-10.0f, 10.0f), random.rand_float(-10.0f, 10.0f));
+		s_v2b[i] = Vector2(random.rand_float(-10.0f, 10.0f), random.rand_float(-10.0f, 10.0f));
+		s_v3a[i] = random_vector(random, 10.0f);
+		s_v3b[i] = random_vector(random, 10.0f);
+		s_axis[i] = random_axis(random);
+		s_qa[i] = random_quaternion(random);
+		s_qb[i] = random_quaternion(random);
+		s_rigid[i] = Matrix::CreateWorld(Vector3::One, s_qa[i], random_vector(random, 100.0f));
+		const Vector3 scale(random.rand_float(0.5f, 2.0f), random.rand_float(0.5f, 2.0f), random.rand_float(0.5f, 2.0f));
+		s_affine[i] = Matrix::CreateWorld(scale, s_qb[i], random_vector(random, 100.0f));
+		s_projective[i] = random_view_projection(random);
+		s_affine34[i] = AffineMatrix(s_affine[i]);
+	}
+
+	// 既存の入力を変えないように、特異に近い行列は別の乱数列から作る
+	Random near_random(2);
+	for (int i = 0; i < count; ++i)
+	{
+		s_near_affine[i] = random_near_singular_affine(near_random, s_affine[i]);
+		s_near_projective[i] = random_near_singular_projective(near_random);
+	}
+}
+
+// 計測の経過時間（ナノ秒）
+using Clock = std::chrono::steady_clock;
+static double elapsed_ns(Clock::time_point start)
+{
+	return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+}
+
+// 演算の計測（functionは入力の番号とx成分に加える値から結果を返す）
+template <typename Function>
+static void measure(const char* name, Function function)
+{
+	using Result = decltype(function(0, 0.0f));
+	std::vector<Result> results(InputCount);
+	const float zero = s_zero;
+
+	// スループット：各入力は独立しているので、パイプラインで重ねて実行できる
+	auto start = Clock::now();
+	for (int r = 0; r < RepeatCount; ++r)
+	{
+		for (int i = 0; i < InputCount; ++i)
+		{
+			results[i] = function(i, zero);
+		}
+	}
+	const double throughput = elapsed_ns(start) / ((double)RepeatCount * InputCount);
+
+	// レイテンシ：前の結果の先頭成分に0を掛けて次の入力に加え、直列に実行させる
+	float d = zero;
+	start = Clock::now();
+	for (int r = 0; r < RepeatCount; ++r)
+	{
+		for (int i = 0; i < InputCount; ++i)
+		{
+			d = first(function(i, d)) * zero;
+		}
+	}
+	const double latency = elapsed_ns(start) / ((double)RepeatCount * InputCount);
+
+	s_sink = first(results[InputCount / 2]) + d;
+	std::printf("  %-40s %9.2f %9.2f\n", name, throughput, latency);
+}
+
+// ベンチマークの実行
+static void run_bench()
+{
+	std::printf("%-42s %9s %9s\n", "operation", "tput(ns)", "lat(ns)");
+	// 次の入力への依存を作るための加算と乗算の分（各行の値から差し引いて読む）
+	measure("(dependency overhead)", [](int i, float d) { return s_scalar[i] + d; });
+
+	std::printf("Vector2\n");
+	measure("operator +", [](int i, float d) { return offset(s_v2a[i], d) + s_v2b[i]; });
+	measure("operator * (scalar)", [](int i, float d) { return offset(s_v2a[i], d) * s_scalar[i]; });
+	measure("Dot", [](int i, float d) { return offset(s_v2a[i], d).Dot(s_v2b[i]); });
+	measure("Cross", [](int i, float d) { return offset(s_v2a[i], d).Cross(s_v2b[i]); });
+	measure("Length", [](int i, float d) { return offset(s_v2a[i], d).Length(); });
+	measure("Normalize", [](int i, float d) { return offset(s_v2a[i], d).Normalize(); });
+	measure("Rotate", [](int i, float d) { return s_v2a[i].Rotate(s_degree[i] + d); });
+	measure("Distance", [](int i, float d) { return offset(s_v2a[i], d).Distance(s_v2b[i]); });
+	measure("Lerp", [](int i, float d) { return offset(s_v2a[i], d).Lerp(s_v2b[i], s_t[i]); });
+	measure("ToAngle", [](int i, float d) { return offset(s_v2a[i], d).ToAngle(); });
+	measure("InnerAngle", [](int i, float d) { return offset(s_v2a[i], d).InnerAngle(s_v2b[i]); });
+
+	std::printf("Vector3\n");
+	measure("operator +", [](int i, float d) { return offset(s_v3a[i], d) + s_v3b[i]; });
+	measure("operator * (scalar)", [](int i, float d) { return offset(s_v3a[i], d) * s_scalar[i]; });
+	measure("Dot", [](int i, float d) { return Vector3::Dot(offset(s_v3a[i], d), s_v3b[i]); });
+	measure("Cross", [](int i, float d) { return Vector3::Cross(offset(s_v3a[i], d), s_v3b[i]); });
+	measure("Length", [](int i, float d) { return offset(s_v3a[i], d).Length(); });
+	measure("LengthSquared", [](int i, float d) { return offset(s_v3a[i], d).LengthSquared(); });
+	measure("Normalize", [](int i, float d) { return Vector3::Normalize(offset(s_v3a[i], d)); });
+	measure("Distance", [](int i, float d) { return Vector3::Distance(offset(s_v3a[i], d), s_v3b[i]); });
+	measure("Lerp", [](int i, float d) { return Vector3::Lerp(offset(s_v3a[i], d), s_v3b[i], s_t[i]); });
+	measure("Min", [](int i, float d) { return Vector3::Min(offset(s_v3a[i], d), s_v3b[i]); });
+	measure("Max", [](int i, float d) { return Vector3::Max(offset(s_v3a[i], d), s_v3b[i]); });
+	measure("Clamp", [](int i, float d) { return Vector3::Clamp(offset(s_v3a[i], d), -Vector3::One, Vector3::One); });
+	measure("Transform", [](int i, float d) { return Vector3::Transform(offset(s_v3a[i], d), s_affine[i]); });
+	measure("TransformNormal", [](int i, float d) { return Vector3::TransformNormal(offset(s_v3a[i], d), s_affine[i]); });
+	measure("CreateFromYawPitch", [](int i, float d) { return Vector3::CreateFromYawPitch(s_degree[i] + d, s_degree[i] * 0.5f); });
+	measure("Yaw", [](int i, float d) { return offset(s_v3a[i], d).Yaw(); });
+	measure("Pitch", [](int i, float d) { return offset(s_v3a[i], d).Pitch(); });
+	measure("Angle", [](int i, float d) { return Vector3::Angle(offset(s_v3a[i], d), s_v3b[i]); });
+
+	std::printf("Matrix\n");
+	measure("operator *", [](int i, float d) { return offset(s_affine[i], d) * s_rigid[i]; });
+	measure("operator * (Vector3)", [](int i, float d) { return offset(s_v3a[i], d) * s_projective[i]; });
+	measure("Transpose", [](int i, float d) { return Matrix::Transpose(offset(s_affine[i], d)); });
+	measure("Kind", [](int i, float d) { return offset(s_affine[i], d).Kind(); });
+	measure("Invert (rigid)", [](int i, float d) { return Matrix::Invert(offset(s_rigid[i], d)); });
+	measure("Invert (affine)", [](int i, float d) { return Matrix::Invert(offset(s_affine[i], d)); });
+	measure("Invert (projective)", [](int i, float d) { return Matrix::Invert(offset(s_projective[i], d)); });
+	measure("InvertFast", [](int i, float d) { return Matrix::InvertFast(offset(s_rigid[i], d)); });
+	measure("InvertAffine", [](int i, float d) { return Matrix::InvertAffine(offset(s_affine[i], d)); });
+	measure("InvertGeneral", [](int i, float d) { return Matrix::InvertGeneral(offset(s_projective[i], d)); });
+	measure("CreateRotationX", [](int i, float d) { return Matrix::CreateRotationX(s_degree[i] + d); });
+	measure("CreateRotationY", [](int i, float d) { return Matrix::CreateRotationY(s_degree[i] + d); });
+	measure("CreateRotationZ", [](int i, float d) { return Matrix::CreateRotationZ(s_degree[i] + d); });
+	measure("CreateFromAxisAngle", [](int i, float d) { return Matrix::CreateFromAxisAngle(s_axis[i], s_degree[i] + d); });
+	measure("CreateFromQuaternion", [](int i, float d) { return Matrix::CreateFromQuaternion(offset(s_qa[i], d)); });
+	measure("CreateFromYawPitchRoll", [](int i, float d) { return Matrix::CreateFromYawPitchRoll(s_degree[i] + d, s_degree[i] * 0.5f, s_degree[i] * 0.25f); });
+	measure("CreateWorld", [](int i, float d) { return Matrix::CreateWorld(Vector3::One, offset(s_qa[i], d), s_v3a[i]); });
+	measure("CreateLookAt", [](int i, float d) { return Matrix::CreateLookAt(offset(s_v3a[i], d), s_v3b[i], Vector3::Up); });
+	measure("CreatePerspectiveFieldOfView", [](int, float d) { return Matrix::CreatePerspectiveFieldOfView(45.0f + d, 16.0f / 9.0f, 0.3f, 1000.0f); });
+	measure("Lerp", [](int i, float d) { return Matrix::Lerp(offset(s_rigid[i], d), s_rigid[InputCount - 1 - i], s_t[i]); });
+	measure("NormalizeRotationMatrix", [](int i, float d) { return Matrix::NormalizeRotationMatrix(offset(s_affine[i], d)); });
+	measure("Rotation", [](int i, float d) { return offset(s_affine[i], d).Rotation(); });
+	measure("Decompose", [](int i, float d)
+	{
+		Vector3 scale, translation;
+		Quaternion rotation;
+		offset(s_affine[i], d).Decompose(scale, rotation, translation);
+		return rotation;
+	});
+
+	std::printf("AffineMatrix\n");
+	measure("Multiply", [](int i, float d) { return AffineMatrix::Multiply(offset(s_affine34[i], d), s_affine34[InputCount - 1 - i]); });
+	measure("Invert", [](int i, float d) { return AffineMatrix::Invert(offset(s_affine34[i], d)); });
+	measure("Transform", [](int i, float d) { return AffineMatrix::Transform(offset(s_v3a[i], d), s_affine34[i]); });
+	measure("CreateWorld", [](int i, float d) { return AffineMatrix::CreateWorld(Vector3::One, offset(s_qa[i], d), s_v3a[i]); });
+
+	std::printf("Quaternion\n");
+	measure("operator *", [](int i, float d) { return offset(s_qa[i], d) * s_qb[i]; });
+	measure("Dot", [](int i, float d) { return Quaternion::Dot(offset(s_qa[i], d), s_qb[i]); });
+	measure("Length", [](int i, float d) { return offset(s_qa[i], d).Length(); });
+	measure("Normalize", [](int i, float d) { return Quaternion::Normalize(offset(s_qa[i], d)); });
+	measure("Quaternion(axis, angle)", [](int i, float d) { return Quaternion(s_axis[i], s_degree[i] + d); });
+	measure("Slerp", [](int i, float d) { return Quaternion::Slerp(offset(s_qa[i], d), s_qb[i], s_t[i]); });
+	measure("Nlerp", [](int i, float d) { return Quaternion::Nlerp(offset(s_qa[i], d), s_qb[i], s_t[i]); });
+	measure("CreateFromRotationMatrix", [](int i, float d) { return Quaternion::CreateFromRotationMatrix(offset(s_rigid[i], d)); });
+
+	// 配列の一括補間は要素あたりのスループットのみ
+	std::vector<Quaternion> blended(InputCount);
+	const auto start = Clock::now();
+	for (int r = 0; r < RepeatCount; ++r)
+	{
+		Quaternion::Blend(s_qa.data(), s_qb.data(), s_t.data(), blended.data(), InputCount);
+	}
+	s_sink = blended[InputCount / 2].x;
+	std::printf("  %-40s %9.2f %9s\n", "Blend (per element)", elapsed_ns(start) / ((double)RepeatCount * InputCount), "-");
+}
+
+// 倍精度の参照実装
+struct DVector3 { double x, y, z; };
+struct DQuaternion { double x, y, z, w; };
+struct DMatrix { double m[4][4]; };
+
+static const double DPi{ 3.14159265358979323846 };
+static double to_radian(double degree) { return degree * DPi / 180.0; }
+static double to_degree(double radian) { return radian * 180.0 / DPi; }
+
+static DVector3 to_double(const Vector3& v) { return { v.x, v.y, v.z }; }
+static DQuaternion to_double(const Quaternion& q) { return { q.x, q.y, q.z, q.w }; }
+static DMatrix to_double(const Matrix& m)
+{
+	DMatrix result;
+	for (int r = 0; r < 4; ++r) for (int c = 0; c < 4; ++c) result.m[r][c] = m.m[r][c];
+	return result;
+}
+
+static double dot(const DVector3& a, const DVector3& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+static DVector3 cross(const DVector3& a, const DVector3& b) { return { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x }; }
+static DVector3 normalize(const DVector3& v) { const double l = std::sqrt(dot(v, v)); return { v.x / l, v.y / l, v.z / l }; }
+static DVector3 sub(const DVector3& a, const DVector3& b) { return { a.x - b.x, a.y - b.y, a.z - b.z }; }
+
+static DMatrix multiply(const DMatrix& a, const DMatrix& b)
+{
+	DMatrix result;
+	for (int r = 0; r < 4; ++r) for (int c = 0; c < 4; ++c)
+	{
+		result.m[r][c] = a.m[r][0] * b.m[0][c] + a.m[r][1] * b.m[1][c] + a.m[r][2] * b.m[2][c] + a.m[r][3] * b.m[3][c];
+	}
+	return result;
+}
+
+// 部分ピボット選択付きのガウス・ジョルダン法
+static DMatrix invert(const DMatrix& matrix)
+{
+	double a[4][8];
+	for (int r = 0; r < 4; ++r) for (int c = 0; c < 4; ++c) { a[r][c] = matrix.m[r][c]; a[r][c + 4] = (r == c) ? 1.0 : 0.0; }
+	for (int c = 0; c < 4; ++c)
+	{
+		int pivot = c;
+		for (int r = c + 1; r < 4; ++r) if (std::fabs(a[r][c]) > std::fabs(a[pivot][c])) pivot = r;
+		for (int k = 0; k < 8; ++k) std::swap(a[c][k], a[pivot][k]);
+		const double inv = 1.0 / a[c][c];
+		for (int k = 0; k < 8; ++k) a[c][k] *= inv;
+		for (int r = 0; r < 4; ++r)
+		{
+			if (r == c) continue;
+			const double f = a[r][c];
+			for (int k = 0; k < 8; ++k) a[r][k] -= f * a[c][k];
+		}
+	}
+	DMatrix result;
+	for (int r = 0; r < 4; ++r) for (int c = 0; c < 4; ++c) result.m[r][c] = a[r][c + 4];
+	return result;
+}
+
+static DMatrix from_quaternion(const DQuaternion& q)
+{
+	const double xx = 2 * q.x * q.x, yy = 2 * q.y * q.y, zz = 2 * q.z * q.z;
+	const double xy = 2 * q.x * q.y, xz = 2 * q.x * q.z, yz = 2 * q.y * q.z;
+	const double wx = 2 * q.w * q.x, wy = 2 * q.w * q.y, wz = 2 * q.w * q.z;
+	return { {
+		{ 1 - yy - zz, xy + wz, xz - wy, 0 },
+		{ xy - wz, 1 - xx - zz, yz + wx, 0 },
+		{ xz + wy, yz - wx, 1 - xx - yy, 0 },
+		{ 0, 0, 0, 1 } } };
+}
+
+static DQuaternion axis_angle(const DVector3& axis, double degree)
+{
+	const double s = std::sin(to_radian(degree) / 2);
+	return { axis.x * s, axis.y * s, axis.z * s, std::cos(to_radian(degree) / 2) };
+}
+
+static DQuaternion multiply(const DQuaternion& a, const DQuaternion& b)
+{
+	return {
+		a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+		a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x,
+		a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w,
+		a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z };
+}
+
+static DQuaternion slerp(const DQuaternion& a, DQuaternion b, double t)
+{
+	double c = a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+	if (c < 0) { c = -c; b = { -b.x, -b.y, -b.z, -b.w }; }
+	const double theta = std::acos(std::min(c, 1.0));
+	double k0 = 1 - t, k1 = t;
+	if (theta > 1e-12) { k0 = std::sin(theta * (1 - t)) / std::sin(theta); k1 = std::sin(theta * t) / std::sin(theta); }
+	return { a.x * k0 + b.x * k1, a.y * k0 + b.y * k1, a.z * k0 + b.z * k1, a.w * k0 + b.w * k1 };
+}
+
+static DMatrix rotation(int axis, double degree)
+{
+	const double s = std::sin(to_radian(degree)), c = std::cos(to_radian(degree));
+	if (axis == 0) return { { { 1, 0, 0, 0 }, { 0, c, s, 0 }, { 0, -s, c, 0 }, { 0, 0, 0, 1 } } };
+	if (axis == 1) return { { { c, 0, -s, 0 }, { 0, 1, 0, 0 }, { s, 0, c, 0 }, { 0, 0, 0, 1 } } };
+	return { { { c, s, 0, 0 }, { -s, c, 0, 0 }, { 0, 0, 1, 0 }, { 0, 0, 0, 1 } } };
+}
+
+static DMatrix look_at(const DVector3& position, const DVector3& target, const DVector3& up)
+{
+#ifdef MATH_LEFT_HANDED
+	const DVector3 z = normalize(sub(target, position));
+#else
+	const DVector3 z = normalize(sub(position, target));
+#endif
+	const DVector3 x = normalize(cross(up, z));
+	const DVector3 y = cross(z, x);
+	return { {
+		{ x.x, y.x, z.x, 0 },
+		{ x.y, y.y, z.y, 0 },
+		{ x.z, y.z, z.z, 0 },
+		{ -dot(position, x), -dot(position, y), -dot(position, z), 1 } } };
+}
+
+static DMatrix perspective(double fov, double aspect, double zn, double zf)
+{
+	const double h = 1 / std::tan(to_radian(fov) / 2);
+	const double w = h / aspect;
+#ifdef MATH_LEFT_HANDED
+	return { { { w, 0, 0, 0 }, { 0, h, 0, 0 }, { 0, 0, zf / (zf - zn), 1 }, { 0, 0, -zn * zf / (zf - zn), 0 } } };
+#else
+	return { { { w, 0, 0, 0 }, { 0, h, 0, 0 }, { 0, 0, (zf + zn) / (zn - zf), -1 }, { 0, 0, 2 * zf * zn / (zn - zf), 0 } } };
+#endif
+}
+
+// 誤差（scaleが1未満なら絶対誤差、1以上ならscaleに対する相対誤差）をFLT_EPSILON単位で求める
+// 桁落ちする演算（内積や外積）のscaleは、参照値ではなく各項の絶対値の和にする
+static double error(double value, double reference, double scale)
+{
+	return std::fabs(value - reference) / std::max(1.0, scale) / FLT_EPSILON;
+}
+static double error(float value, double reference)
+{
+	return error(value, reference, std::fabs(reference));
+}
+static double error(const Vector2& value, double x, double y)
+{
+	const double scale = std::max(std::fabs(x), std::fabs(y));
+	return std::max(error(value.x, x, scale), error(value.y, y, scale));
+}
+static double error(const Vector3& value, const DVector3& reference, double scale)
+{
+	return std::max(std::max(error(value.x, reference.x, scale), error(value.y, reference.y, scale)), error(value.z, reference.z, scale));
+}
+static double error(const Vector3& value, const DVector3& reference)
+{
+	return error(value, reference, std::max(std::max(std::fabs(reference.x), std::fabs(reference.y)), std::fabs(reference.z)));
+}
+static double error(const Quaternion& value, const DQuaternion& reference)
+{
+	// qと-qは同じ回転を表すので、近い方と比較する
+	double result[2] = { 0.0, 0.0 };
+	for (int s = 0; s < 2; ++s)
+	{
+		const double sign = (s == 0) ? 1.0 : -1.0;
+		result[s] = std::max(std::max(error(value.x, sign * reference.x, 1.0), error(value.y, sign * reference.y, 1.0)),
+			std::max(error(value.z, sign * reference.z, 1.0), error(value.w, sign * reference.w, 1.0)));
+	}
+	return std::min(result[0], result[1]);
+}
+static double error(const Matrix& value, const DMatrix& reference)
+{
+	double scale = 0.0;
+	for (int r = 0; r < 4; ++r) for (int c = 0; c < 4; ++c) scale = std::max(scale, std::fabs(reference.m[r][c]));
+	double result = 0.0;
+	for (int r = 0; r < 4; ++r) for (int c = 0; c < 4; ++c) result = std::max(result, error(value.m[r][c], reference.m[r][c], scale));
+	return result;
+}
+
+// 行列の条件数（Skeelの条件数 || |M^-1| |M| ||∞、行の拡大縮小に影響されない）
+static double condition(const DMatrix& matrix)
+{
+	const DMatrix inverse = invert(matrix);
+	double result = 0.0;
+	for (int r = 0; r < 4; ++r)
+	{
+		double sum = 0.0;
+		for (int c = 0; c < 4; ++c)
+		{
+			for (int k = 0; k < 4; ++k) sum += std::fabs(inverse.m[r][k]) * std::fabs(matrix.m[k][c]);
+		}
+		result = std::max(result, sum);
+	}
+	return result;
+}
+
+// 逆行列の誤差を条件数で割った値（逆行列の誤差は条件数に比例して大きくなるため、条件数あたりの誤差で検証する）
+static double inverse_error(const Matrix& value, const Matrix& matrix)
+{
+	const DMatrix reference = to_double(matrix);
+	return error(value, invert(reference)) / condition(reference);
+}
+
+// 精度検証の結果
+static int s_failures{ 0 };
+
+// 精度の検証（errorは入力の番号から誤差を返す、toleranceは許容する最大誤差（FLT_EPSILON単位））
+template <typename Function>
+static void check(const char* name, double tolerance, Function error_of)
+{
+	double max_error = 0.0;
+	double sum = 0.0;
+	for (int i = 0; i < TrialCount; ++i)
+	{
+		const double e = error_of(i % InputCount);
+		max_error = std::max(max_error, e);
+		sum += e;
+	}
+	const bool passed = max_error <= tolerance;
+	if (!passed) ++s_failures;
+	std::printf("  %-40s %10.2f %10.2f %10.1f  %s\n", name, sum / TrialCount, max_error, tolerance, passed ? "ok" : "FAILED");
+}
+
+// 精度検証の実行
+static void run_accuracy()
+{
+	std::printf("%-42s %10s %10s %10s  (error in FLT_EPSILON, relative above 1)\n", "operation", "mean", "max", "tolerance");
+
+	std::printf("Vector2\n");
+	check("Dot", 4, [](int i)
+	{
+		const Vector2& a = s_v2a[i]; const Vector2& b = s_v2b[i];
+		return error(a.Dot(b), (double)a.x * b.x + (double)a.y * b.y, std::fabs((double)a.x * b.x) + std::fabs((double)a.y * b.y));
+	});
+	check("Cross", 4, [](int i)
+	{
+		const Vector2& a = s_v2a[i]; const Vector2& b = s_v2b[i];
+		return error(a.Cross(b), (double)a.x * b.y - (double)a.y * b.x, std::fabs((double)a.x * b.y) + std::fabs((double)a.y * b.x));
+	});
+	check("Length", 4, [](int i) { const Vector2& a = s_v2a[i]; return error(a.Length(), std::hypot((double)a.x, (double)a.y)); });
+	check("Normalize", 4, [](int i)
+	{
+		const Vector2& a = s_v2a[i];
+		const double l = std::hypot((double)a.x, (double)a.y);
+		return error(a.Normalize(), a.x / l, a.y / l);
+	});
+	check("Rotate", 8, [](int i)
+	{
+		const Vector2& a = s_v2a[i];
+		const double r = to_radian(s_degree[i]);
+		return error(a.Rotate(s_degree[i]), a.x * std::cos(r) - a.y * std::sin(r), a.x * std::sin(r) + a.y * std::cos(r));
+	});
+	check("Distance", 4, [](int i) { const Vector2& a = s_v2a[i]; const Vector2& b = s_v2b[i]; return error(a.Distance(b), std::hypot((double)a.x - b.x, (double)a.y - b.y)); });
+	check("Lerp", 4, [](int i)
+	{
+		const Vector2& a = s_v2a[i]; const Vector2& b = s_v2b[i]; const double t = s_t[i];
+		return error(a.Lerp(b, s_t[i]), a.x + (b.x - (double)a.x) * t, a.y + (b.y - (double)a.y) * t);
+	});
+
+	std::printf("Vector3\n");
+	check("Dot", 4, [](int i)
+	{
+		const DVector3 a = to_double(s_v3a[i]), b = to_double(s_v3b[i]);
+		return error(Vector3::Dot(s_v3a[i], s_v3b[i]), dot(a, b), std::sqrt(dot(a, a) * dot(b, b)));
+	});
+	check("Cross", 4, [](int i)
+	{
+		const DVector3 a = to_double(s_v3a[i]), b = to_double(s_v3b[i]);
+		return error(Vector3::Cross(s_v3a[i], s_v3b[i]), cross(a, b), std::sqrt(dot(a, a) * dot(b, b)));
+	});
+	check("Length", 4, [](int i) { const DVector3 a = to_double(s_v3a[i]); return error(s_v3a[i].Length(), std::sqrt(dot(a, a))); });
+	check("Normalize", 4, [](int i) { return error(Vector3::Normalize(s_v3a[i]), normalize(to_double(s_v3a[i]))); });
+	check("Distance", 4, [](int i) { const DVector3 d = sub(to_double(s_v3a[i]), to_double(s_v3b[i])); return error(Vector3::Distance(s_v3a[i], s_v3b[i]), std::sqrt(dot(d, d))); });
+	check("Lerp", 4, [](int i)
+	{
+		const DVector3 a = to_double(s_v3a[i]), b = to_double(s_v3b[i]);
+		const double t = s_t[i];
+		return error(Vector3::Lerp(s_v3a[i], s_v3b[i], s_t[i]), DVector3{ a.x + (b.x - a.x) * t, a.y + (b.y - a.y) * t, a.z + (b.z - a.z) * t });
+	});
+	check("Transform", 8, [](int i)
+	{
+		const DVector3 v = to_double(s_v3a[i]);
+		const DMatrix m = to_double(s_projective[i]);
+		double r[4], scale[4];
+		for (int c = 0; c < 4; ++c)
+		{
+			r[c] = v.x * m.m[0][c] + v.y * m.m[1][c] + v.z * m.m[2][c] + m.m[3][c];
+			scale[c] = std::fabs(v.x * m.m[0][c]) + std::fabs(v.y * m.m[1][c]) + std::fabs(v.z * m.m[2][c]) + std::fabs(m.m[3][c]);
+		}
+		// 同次座標での誤差を、wで割った後の座標の大きさに換算する
+		const double w = std::fabs(r[3]);
+		const double s = std::max(std::max(scale[0], scale[1]), std::max(scale[2], scale[3])) / w;
+		return error(Vector3::Transform(s_v3a[i], s_projective[i]), DVector3{ r[0] / r[3], r[1] / r[3], r[2] / r[3] }, s * std::max(1.0, scale[3] / w));
+	});
+	check("TransformNormal", 8, [](int i)
+	{
+		const DVector3 v = to_double(s_v3a[i]);
+		const DMatrix m = to_double(s_affine[i]);
+		double r[3];
+		for (int c = 0; c < 3; ++c) r[c] = v.x * m.m[0][c] + v.y * m.m[1][c] + v.z * m.m[2][c];
+		return error(Vector3::TransformNormal(s_v3a[i], s_affine[i]), DVector3{ r[0], r[1], r[2] });
+	});
+	check("Angle", 1024, [](int i)
+	{
+		const DVector3 a = normalize(to_double(s_v3a[i])), b = normalize(to_double(s_v3b[i]));
+		return error(Vector3::Angle(s_v3a[i], s_v3b[i]), to_degree(std::acos(std::max(-1.0, std::min(1.0, dot(a, b))))));
+	});
+
+	std::printf("Matrix\n");
+	check("operator *", 8, [](int i) { return error(s_affine[i] * s_projective[i], multiply(to_double(s_affine[i]), to_double(s_projective[i]))); });
+	check("CreateRotationX", 8, [](int i) { return error(Matrix::CreateRotationX(s_degree[i]), rotation(0, s_degree[i])); });
+	check("CreateRotationY", 8, [](int i) { return error(Matrix::CreateRotationY(s_degree[i]), rotation(1, s_degree[i])); });
+	check("CreateRotationZ", 8, [](int i) { return error(Matrix::CreateRotationZ(s_degree[i]), rotation(2, s_degree[i])); });
+	check("CreateFromYawPitchRoll", 8, [](int i)
+	{
+		const float yaw = s_degree[i], pitch = s_degree[i] * 0.5f, roll = s_degree[i] * 0.25f;
+		const DMatrix reference = multiply(multiply(rotation(2, roll), rotation(0, pitch)), rotation(1, yaw));
+		return error(Matrix::CreateFromYawPitchRoll(yaw, pitch, roll), reference);
+	});
+	check("CreateFromQuaternion", 4, [](int i) { return error(Matrix::CreateFromQuaternion(s_qa[i]), from_quaternion(to_double(s_qa[i]))); });
+	check("CreateFromAxisAngle", 8, [](int i)
+	{
+		return error(Matrix::CreateFromAxisAngle(s_axis[i], s_degree[i]), from_quaternion(axis_angle(to_double(s_axis[i]), s_degree[i])));
+	});
+	check("CreateLookAt", 8, [](int i)
+	{
+		return error(Matrix::CreateLookAt(s_v3a[i], s_v3b[i], Vector3::Up), look_at(to_double(s_v3a[i]), to_double(s_v3b[i]), DVector3{ 0, 1, 0 }));
+	});
+	check("CreatePerspectiveFieldOfView", 8, [](int i)
+	{
+		const float fov = 30.0f + 60.0f * s_t[i];
+		return error(Matrix::CreatePerspectiveFieldOfView(fov, 16.0f / 9.0f, 0.3f, 1000.0f), perspective(fov, 16.0 / 9.0, 0.3, 1000.0));
+	});
+	check("Invert (rigid)", 32, [](int i) { return error(Matrix::Invert(s_rigid[i]), invert(to_double(s_rigid[i]))); });
+	check("Invert (affine)", 16, [](int i) { return error(Matrix::Invert(s_affine[i]), invert(to_double(s_affine[i]))); });
+	check("Invert (projective)", 2048, [](int i) { return error(Matrix::Invert(s_projective[i]), invert(to_double(s_projective[i]))); });
+	check("InvertFast", 32, [](int i) { return error(Matrix::InvertFast(s_rigid[i]), invert(to_double(s_rigid[i]))); });
+	check("InvertAffine", 16, [](int i) { return error(Matrix::InvertAffine(s_affine[i]), invert(to_double(s_affine[i]))); });
+	check("InvertGeneral", 2048, [](int i) { return error(Matrix::InvertGeneral(s_projective[i]), invert(to_double(s_projective[i]))); });
+
+	// 特異に近い行列は誤差を条件数で割って検証する（許容値は条件数 × FLT_EPSILON）
+	double min_condition = DBL_MAX, max_condition = 0.0;
+	for (int i = 0; i < InputCount; ++i)
+	{
+		const double k = std::max(condition(to_double(s_near_affine[i])), condition(to_double(s_near_projective[i])));
+		min_condition = std::min(min_condition, k);
+		max_condition = std::max(max_condition, k);
+	}
+	std::printf("Matrix (near singular, error per condition number %.0e..%.0e)\n", min_condition, max_condition);
+	check("Invert (affine)", 1, [](int i) { return inverse_error(Matrix::Invert(s_near_affine[i]), s_near_affine[i]); });
+	check("InvertAffine", 1, [](int i) { return inverse_error(Matrix::InvertAffine(s_near_affine[i]), s_near_affine[i]); });
+	check("InvertGeneral (affine)", 1, [](int i) { return inverse_error(Matrix::InvertGeneral(s_near_affine[i]), s_near_affine[i]); });
+	check("AffineMatrix::Invert", 1, [](int i)
+	{
+		return inverse_error(AffineMatrix::Invert(AffineMatrix(s_near_affine[i])).ToMatrix(), s_near_affine[i]);
+	});
+	check("Invert (projective)", 1, [](int i) { return inverse_error(Matrix::Invert(s_near_projective[i]), s_near_projective[i]); });
+	check("InvertGeneral (projective)", 1, [](int i) { return inverse_error(Matrix::InvertGeneral(s_near_projective[i]), s_near_projective[i]); });
+
+	std::printf("AffineMatrix\n");
+	check("Multiply", 8, [](int i)
+	{
+		const int j = InputCount - 1 - i;
+		return error(AffineMatrix::Multiply(s_affine34[i], s_affine34[j]).ToMatrix(), multiply(to_double(s_affine[i]), to_double(s_affine[j])));
+	});
+	check("Invert", 16, [](int i) { return error(AffineMatrix::Invert(s_affine34[i]).ToMatrix(), invert(to_double(s_affine[i]))); });
+	check("Transform", 8, [](int i)
+	{
+		const DVector3 v = to_double(s_v3a[i]);
+		const DMatrix m = to_double(s_affine[i]);
+		double r[3];
+		for (int c = 0; c < 3; ++c) r[c] = v.x * m.m[0][c] + v.y * m.m[1][c] + v.z * m.m[2][c] + m.m[3][c];
+		return error(AffineMatrix::Transform(s_v3a[i], s_affine34[i]), DVector3{ r[0], r[1], r[2] });
+	});
+
+	std::printf("Quaternion\n");
+	check("operator *", 8, [](int i) { return error(s_qa[i] * s_qb[i], multiply(to_double(s_qa[i]), to_double(s_qb[i]))); });
+	check("Normalize", 4, [](int i)
+	{
+		const Quaternion q = s_qa[i] * 3.0f;
+		const DQuaternion d = to_double(q);
+		const double l = std::sqrt(d.x * d.x + d.y * d.y + d.z * d.z + d.w * d.w);
+		return error(Quaternion::Normalize(q), DQuaternion{ d.x / l, d.y / l, d.z / l, d.w / l });
+	});
+	check("Quaternion(axis, angle)", 4, [](int i) { return error(Quaternion(s_axis[i], s_degree[i]), axis_angle(to_double(s_axis[i]), s_degree[i])); });
+	check("Slerp", 8, [](int i) { return error(Quaternion::Slerp(s_qa[i], s_qb[i], s_t[i]), slerp(to_double(s_qa[i]), to_double(s_qb[i]), s_t[i])); });
+	// 補正付き正規化線形補間は近似なので、slerpとの差を許容値とする
+	check("Nlerp (vs slerp)", 8192, [](int i) { return error(Quaternion::Nlerp(s_qa[i], s_qb[i], s_t[i]), slerp(to_double(s_qa[i]), to_double(s_qb[i]), s_t[i])); });
+	check("Blend (vs slerp)", 8192, [](int i)
+	{
+		// 4要素単位のSIMD処理と端数の処理の両方を通るように5要素で補間する
+		Quaternion result[5];
+		const int base = std::min(i, InputCount - 5);
+		Quaternion::Blend(&s_qa[base], &s_qb[base], &s_t[base], result, 5);
+		double e = 0.0;
+		for (int k = 0; k < 5; ++k) e = std::max(e, error(result[k], slerp(to_double(s_qa[base + k]), to_double(s_qb[base + k]), s_t[base + k])));
+		return e;
+	});
+	check("CreateFromRotationMatrix", 8, [](int i) { return error(Quaternion::CreateFromRotationMatrix(Matrix::CreateFromQuaternion(s_qa[i])), to_double(s_qa[i])); });
+}
+
+int main(int argc, char* argv[])
+{
+	bool bench = true;
+	bool accuracy = true;
+	if (argc > 1)
+	{
+		bench = accuracy = false;
+		for (int i = 1; i < argc; ++i)
+		{
+			if (std::strcmp(argv[i], "--bench") == 0) bench = true;
+			else if (std::strcmp(argv[i], "--accuracy") == 0) accuracy = true;
+			else
+			{
+				std::printf("usage: math_bench [--bench] [--accuracy]\n");
+				return 2;
+			}
+		}
+	}
+
+	Random random(1);
+	make_inputs(random, InputCount);
+
+	if (bench) run_bench();
+	if (accuracy)
+	{
+		run_accuracy();
+		std::printf("%d check(s) failed\n", s_failures);
+	}
+	return (s_failures == 0) ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,292 @@
+#include "../src/Graphic/ParticleSystem.h"
+#include "../src/Graphic/WorkerPool.h"
+#include "../src/Math/MathSIMD.h"
+#include "../src/Math/Random.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+// パーティクルシステムのベンチマークと検証
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// 10万個のパーティクルをParticleSystem（属性ごとの配列、SIMDで4個ずつ）で更新する時間を、
+// 同じ計算を1パーティクル1構造体の配列（AoS）で行う参照の実装と比較する。
+// 寿命の尽きたパーティクルをエミッターが毎tick補充し続ける場合の、発生を含めた1tickの時間も計測する。
+// 検証では、参照の実装と結果が一致すること、スレッド数で結果が変わらないこと、上限を超えて発生しないこと、
+// テクスチャとブレンドモードごとにバッファ（描画回数）がまとまることを確かめる。
+// 使い方：particle_bench [--bench] [--test]（省略時は両方、検証に失敗すると終了コード1）
+
+// パーティクル数
+static const int ParticleCount{ 100000 };
+// 計測するフレーム数
+static const int FrameCount{ 200 };
+// 1tickの時間（フレーム）
+static const float DeltaTime{ 1.0f };
+
+// 失敗した検証の数
+static int s_failures{ 0 };
+// 最適化で消されないようにするための出力先
+static volatile float s_sink{ 0.0f };
+
+// 検証結果の表示
+static void check(const char* name, bool passed)
+{
+	std::printf("  %-52s %s\n", name, passed ? "ok" : "FAILED");
+	s_failures += passed ? 0 : 1;
+}
+
+// 計測の経過時間（ナノ秒）
+using Clock = std::chrono::steady_clock;
+static double elapsed_ns(Clock::time_point start)
+{
+	return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+}
+
+// 被弾時のエフェクトと同じ設定（ParticleEmitterのHit、lifeを指定すると寿命を固定する）
+static ParticleEmitterDesc hit_desc(int texture, bool additive, float life = 0.0f)
+{
+	ParticleEmitterDesc desc;
+	desc.texture = texture;
+	desc.additive = additive;
+	desc.spread = 60.0f;
+	desc.speed_min = 0.8f;
+	desc.speed_max = 1.8f;
+	desc.life_min = (life > 0.0f) ? life : 12.0f;
+	desc.life_max = (life > 0.0f) ? life : 22.0f;
+	desc.size_min = 1.5f;
+	desc.size_max = 3.0f;
+	desc.grow = -0.08f;
+	desc.color = Color(1.0f, 0.6f, 0.2f, 1.0f);
+	return desc;
+}
+
+// 構造体：参照の実装のパーティクル（AoS）
+struct Particle
+{
+	Vector3			position;	// 座標
+	Vector3			velocity;	// 速度
+	float			life;		// 残りの寿命（フレーム）
+	float			inv_life;	// 寿命の逆数
+	float			size;		// 大きさ
+	float			grow;		// 1フレームあたりの大きさの変化量
+	float			weight;		// 重力の倍率
+	unsigned int	color;		// 色（ARGB）
+};
+
+// バッファの内容を参照の実装の配列に変換
+static std::vector<Particle> to_particles(const ParticleBuffer& buffer)
+{
+	std::vector<Particle> result(buffer.count);
+	for (int i = 0; i < buffer.count; ++i)
+	{
+		result[i] = Particle{ Vector3(buffer.x[i], buffer.y[i], buffer.z[i]), Vector3(buffer.vx[i], buffer.vy[i], buffer.vz[i]),
+			buffer.life[i], buffer.inv_life[i], buffer.size[i], buffer.grow[i], buffer.weight[i], buffer.color[i] };
+	}
+	return result;
+}
+
+// 参照の実装の更新（ParticleSystemと同じ計算と、末尾のパーティクルで穴を埋める削除）
+static void update_reference(std::vector<Particle>& particles, const Vector3& gravity_per_frame, float drag, float delta_time)
+{
+	const float damp = std::max(1.0f - drag * delta_time, 0.0f);
+	const Vector3 gravity = gravity_per_frame * delta_time;
+	for (auto& particle : particles)
+	{
+		particle.velocity.x = (particle.velocity.x + gravity.x * particle.weight) * damp;
+		particle.velocity.y = (particle.velocity.y + gravity.y * particle.weight) * damp;
+		particle.velocity.z = (particle.velocity.z + gravity.z * particle.weight) * damp;
+		particle.position.x += particle.velocity.x * delta_time;
+		particle.position.y += particle.velocity.y * delta_time;
+		particle.position.z += particle.velocity.z * delta_time;
+		particle.life -= delta_time;
+		particle.size = std::max(particle.size + particle.grow * delta_time, 0.0f);
+	}
+	for (std::size_t i = 0; i < particles.size(); )
+	{
+		if (particles[i].life > 0.0f)
+		{
+			++i;
+			continue;
+		}
+		particles[i] = particles.back();
+		particles.pop_back();
+	}
+}
+
+// バッファと参照の実装の配列が一致するか
+static bool same_particles(const ParticleBuffer& buffer, const std::vector<Particle>& particles)
+{
+	if (buffer.count != (int)particles.size()) return false;
+	for (int i = 0; i < buffer.count; ++i)
+	{
+		const auto& p = particles[i];
+		if (buffer.x[i] != p.position.x || buffer.y[i] != p.position.y || buffer.z[i] != p.position.z
+			|| buffer.vx[i] != p.velocity.x || buffer.vy[i] != p.velocity.y || buffer.vz[i] != p.velocity.z
+			|| buffer.life[i] != p.life || buffer.size[i] != p.size || buffer.color[i] != p.color) return false;
+	}
+	return true;
+}
+
+// 2つのシステムのバッファが一致するか
+static bool same_buffers(const ParticleSystem& s1, const ParticleSystem& s2)
+{
+	if (s1.buffers().size() != s2.buffers().size()) return false;
+	for (std::size_t b = 0; b < s1.buffers().size(); ++b)
+	{
+		const auto& b1 = s1.buffers()[b];
+		const auto& b2 = s2.buffers()[b];
+		if (b1.count != b2.count) return false;
+		for (auto array : { &ParticleBuffer::x, &ParticleBuffer::y, &ParticleBuffer::z, &ParticleBuffer::life, &ParticleBuffer::size })
+		{
+			if (std::memcmp((b1.*array).data(), (b2.*array).data(), sizeof(float) * b1.count) != 0) return false;
+		}
+	}
+	return true;
+}
+
+// 10万個のパーティクルの発生（寿命を変えた2種類の設定で1つのバッファに入れる）
+static void fill(ParticleSystem& system, int count, unsigned int seed)
+{
+	Random random(seed);
+	system.set_budget(count);
+	system.emit(hit_desc(1, true), Vector3::Zero, Vector3::Up, count / 2, random);
+	system.emit(hit_desc(1, true, 1.0e6f), Vector3(10.0f, 0.0f, 0.0f), Vector3::Right, count - count / 2, random);
+}
+
+// 検証
+static void test()
+{
+	std::printf("particle system (%d particles)\n", ParticleCount);
+
+	// AoSの参照の実装と毎フレーム一致する（寿命の尽きたパーティクルの削除を含む）
+	ParticleSystem system;
+	fill(system, ParticleCount, 1);
+	auto particles = to_particles(system.buffers()[0]);
+	bool same = true;
+	for (int frame = 0; frame < 30; ++frame)
+	{
+		system.update(DeltaTime);
+		update_reference(particles, Vector3(0.0f, -0.03f, 0.0f), 0.02f, DeltaTime);
+		same = same && same_particles(system.buffers()[0], particles);
+	}
+	check("SoA update matches the AoS reference", same);
+	check("expired particles are removed", system.size() == ParticleCount - ParticleCount / 2);
+
+	// スレッド数によって結果が変わらない
+	ParticleSystem single, parallel;
+	fill(single, ParticleCount, 2);
+	fill(parallel, ParticleCount, 2);
+	WorkerPool::set_thread_count(1);
+	for (int frame = 0; frame < 10; ++frame) single.update(DeltaTime);
+	WorkerPool::set_thread_count(4);
+	for (int frame = 0; frame < 10; ++frame) parallel.update(DeltaTime);
+	WorkerPool::set_thread_count(0);
+	check("four threads match a single thread", same_buffers(single, parallel));
+
+	// 上限を超える分は発生せず、数が記録される
+	ParticleSystem limited;
+	Random random(3);
+	limited.set_budget(100);
+	const int emitted = limited.emit(hit_desc(1, true), Vector3::Zero, Vector3::Up, 60, random)
+		+ limited.emit(hit_desc(1, true), Vector3::Zero, Vector3::Up, 60, random);
+	check("the budget caps emission and counts dropped ones", emitted == 100 && limited.size() == 100 && limited.stats().dropped == 20);
+
+	// テクスチャとブレンドモードごとに1つのバッファ（1回の描画）にまとまる
+	ParticleSystem batched;
+	batched.set_budget(1000);
+	for (int i = 0; i < 12; ++i)
+	{
+		batched.emit(hit_desc(i % 2, i % 3 == 0), Vector3::Zero, Vector3::Up, 10, random);
+	}
+	batched.update(DeltaTime);
+	check("one buffer per texture and blend mode", batched.stats().buffers == 4 && batched.buffers().size() == 4);
+}
+
+// 1フレームあたりの時間の計測（ミリ秒）
+template <class Update>
+static double measure(Update update)
+{
+	update();
+	const auto start = Clock::now();
+	for (int frame = 0; frame < FrameCount; ++frame)
+	{
+		update();
+	}
+	return elapsed_ns(start) / FrameCount / 1.0e6;
+}
+
+// 計測
+static void bench()
+{
+#ifdef MATH_USE_SSE
+	const char* simd = "SSE";
+#else
+	const char* simd = "scalar";
+#endif
+	std::printf("particle update (%d particles, %s, ms per frame)\n", ParticleCount, simd);
+	std::printf("  %-8s %12s %12s %10s %14s\n", "threads", "SoA update", "AoS", "speedup", "emit + update");
+
+	const int max_threads = std::max((int)std::thread::hardware_concurrency(), 1);
+	for (int threads = 1; threads <= max_threads; threads *= 2)
+	{
+		WorkerPool::set_thread_count(threads);
+
+		// 寿命を固定したパーティクルの更新のみ（途中で数が変わらないよう、計測中は寿命が尽きない）
+		ParticleSystem system;
+		Random random(4);
+		system.set_budget(ParticleCount);
+		system.emit(hit_desc(1, true, 1.0e6f), Vector3::Zero, Vector3::Up, ParticleCount, random);
+		const double soa_ms = measure([&]() { system.update(DeltaTime); });
+		s_sink = system.buffers()[0].y[ParticleCount / 2];
+
+		auto particles = to_particles(system.buffers()[0]);
+		const double aos_ms = measure([&]() { update_reference(particles, Vector3(0.0f, -0.03f, 0.0f), 0.02f, DeltaTime); });
+		s_sink = particles[ParticleCount / 2].position.y;
+
+		// 上限まで発生させ続ける場合（Hitの寿命は12から22フレーム、寿命の尽きた分を毎tick補充する）
+		ParticleSystem churn;
+		churn.set_budget(ParticleCount);
+		const auto desc = hit_desc(1, true);
+		const auto tick = [&]()
+		{
+			churn.reset_stats();
+			churn.emit(desc, Vector3::Zero, Vector3::Up, ParticleCount - churn.size(), random);
+			churn.update(DeltaTime);
+		};
+		for (int frame = 0; frame < 30; ++frame) tick();
+		const double churn_ms = measure(tick);
+		s_sink = (float)churn.size();
+
+		std::printf("  %-8d %12.3f %12.3f %9.2fx %14.3f\n", threads, soa_ms, aos_ms, aos_ms / soa_ms, churn_ms);
+	}
+	WorkerPool::set_thread_count(0);
+}
+
+int main(int argc, char* argv[])
+{
+	bool run_bench = false;
+	bool run_test = false;
+	for (int i = 1; i < argc; ++i)
+	{
+		if (std::strcmp(argv[i], "--bench") == 0) run_bench = true;
+		else if (std::strcmp(argv[i], "--test") == 0) run_test = true;
+		else
+		{
+			std::printf("usage: particle_bench [--bench] [--test]\n");
+			return 2;
+		}
+	}
+	if (!run_bench && !run_test) run_bench = run_test = true;
+
+	WorkerPool::initialize();
+	if (run_test)
+	{
+		test();
+		std::printf("%d check(s) failed\n", s_failures);
+	}
+	if (run_bench) bench();
+	WorkerPool::finalize();
+	return (s_failures == 0) ? 0 : 1;
+}
\ No newline at end of file
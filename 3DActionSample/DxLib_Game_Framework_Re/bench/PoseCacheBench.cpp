@@ -0,0 +1,278 @@
+#include "SyntheticAnimation.h"
+#include "../src/Graphic/CompressedAnimationClip.h"
+#include "../src/Graphic/AnimationPose.h"
+#include "../src/Graphic/PoseCache.h"
+#include "../src/Math/Random.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+// ポーズキャッシュのベンチマーク
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// 200体のGhoulが50体ずつ出現するウェーブを、Animation::update_fullと同じ手順（再生状態の量子化、検索、
+// サンプリングと登録）で再現し、ヒット率と1tickあたりの時間をキャッシュなしの場合と比較する。
+// Ghoulの行動（接近、攻撃、待機、被弾）はアクターIDごとの乱数ストリームで決める。
+// 使い方：pose_cache_bench [--bench] [--test]（省略時は両方、検証に失敗すると終了コード1）
+
+// Ghoulの数
+static const int GhoulCount{ 200 };
+// 1回のウェーブで出現する数
+static const int WaveSize{ 50 };
+// ウェーブの間隔（tick）
+static const int WaveInterval{ 30 };
+// シミュレーションするtick数
+static const int TickCount{ 600 };
+// クロスフェードの時間（Animation::LerpTimeと同じ）
+static const float LerpTime{ 10.0f };
+// モーション番号（GhoulMotionと同じ）
+enum GhoulMotion { MOTION_IDLE, MOTION_WALK, MOTION_TURN_LEFT, MOTION_TURN_RIGHT, MOTION_WINCE, MOTION_ATTACK, MOTION_DEATH, MOTION_COUNT };
+// 各モーションの長さ（フレーム）
+static const float MotionLengths[MOTION_COUNT]{ 60.0f, 40.0f, 30.0f, 30.0f, 20.0f, 50.0f, 60.0f };
+
+// 失敗した検証の数
+static int s_failures{ 0 };
+// 最適化で消されないようにするための出力先
+static volatile float s_sink{ 0.0f };
+
+// 検証結果の表示
+static void check(const char* name, bool passed)
+{
+	std::printf("  %-52s %s\n", name, passed ? "ok" : "FAILED");
+	s_failures += passed ? 0 : 1;
+}
+
+// 構造体：Ghoulの再生状態（Animationのメンバーと同じ）
+struct GhoulAnimation
+{
+	int			spawn_tick{ 0 };		// 出現するtick
+	int			motion{ MOTION_WALK };	// 再生中のモーション
+	int			prev_motion{ MOTION_WALK };	// 補間元のモーション
+	float		motion_timer{ 0.0f };	// 再生時間
+	float		prev_motion_timer{ 0.0f };	// 補間元の再生時間
+	float		lerp_timer{ LerpTime };	// 補間タイマー
+	int			state_timer{ 0 };		// 次の行動までのtick数
+	Random		random;					// 乱数ストリーム（アクターID）
+};
+
+// モーションの変更（Animation::change_motionのクロスフェードと同じ）
+static void change_motion(GhoulAnimation& ghoul, int motion)
+{
+	if (motion == ghoul.motion) return;
+	ghoul.prev_motion = ghoul.motion;
+	ghoul.prev_motion_timer = ghoul.motion_timer;
+	ghoul.motion = motion;
+	ghoul.motion_timer = 0.0f;
+	ghoul.lerp_timer = 0.0f;
+}
+
+// 行動の更新（接近してから攻撃と待機を繰り返し、まれに被弾して接近に戻る）
+static void update_behavior(GhoulAnimation& ghoul, int tick)
+{
+	ghoul.random.set_tick(tick);
+	if (ghoul.motion != MOTION_WINCE && ghoul.random.rand_int(0, 199) == 0)
+	{
+		change_motion(ghoul, MOTION_WINCE);
+		ghoul.state_timer = (int)(MotionLengths[MOTION_WINCE] * 2.0f);
+		return;
+	}
+	if (--ghoul.state_timer > 0) return;
+
+	switch (ghoul.motion)
+	{
+	case MOTION_WALK:
+		change_motion(ghoul, MOTION_ATTACK);
+		ghoul.state_timer = (int)(MotionLengths[MOTION_ATTACK] * 2.0f);
+		break;
+	case MOTION_ATTACK:
+		change_motion(ghoul, MOTION_IDLE);
+		ghoul.state_timer = ghoul.random.rand_int(20, 60);
+		break;
+	case MOTION_WINCE:
+		change_motion(ghoul, MOTION_WALK);
+		ghoul.state_timer = ghoul.random.rand_int(30, 90);
+		break;
+	default:
+		change_motion(ghoul, MOTION_ATTACK);
+		ghoul.state_timer = (int)(MotionLengths[MOTION_ATTACK] * 2.0f);
+		break;
+	}
+}
+
+// 構造体：シミュレーションの結果
+struct WaveResult
+{
+	int		hits{ 0 };			// ヒット数
+	int		misses{ 0 };		// ミス数
+	double	tick_ms{ 0.0 };		// 1tickあたりの姿勢の更新時間（ミリ秒）
+	bool	in_range{ true };	// サンプリングした時間が全てクリップの範囲内か
+	float	max_shared_error{ 0.0f };	// 共有した姿勢と、各アクター自身の量子化した状態でサンプリングした姿勢の差
+};
+
+// ウェーブのシミュレーション（use_cacheがfalseの場合は全アクターが毎tickサンプリングする）
+static WaveResult simulate(const std::vector<CompressedAnimationClip>& clips, bool use_cache, bool verify)
+{
+	WaveResult result;
+	const int bone_count = clips[0].bone_count();
+	std::vector<GhoulAnimation> ghouls(GhoulCount);
+	for (int i = 0; i < GhoulCount; ++i)
+	{
+		ghouls[i].spawn_tick = i / WaveSize * WaveInterval;
+		ghouls[i].random.randomize(i);
+		ghouls[i].state_timer = 60 + i % 7 * 10;
+	}
+	AnimationPose pose;
+	AnimationPose prev_pose;
+	std::vector<AffineMatrix> local_matrices(bone_count);
+	std::vector<AffineMatrix> reference(bone_count);
+	PoseCache::reset_stats();
+
+	double elapsed = 0.0;
+	for (int tick = 0; tick < TickCount; ++tick)
+	{
+		PoseCache::clear();
+		const auto start = BenchClock::now();
+		for (auto& ghoul : ghouls)
+		{
+			if (tick < ghoul.spawn_tick) continue;
+
+			// Animation::update_fullと同じ手順で姿勢を更新
+			const float end_time = clips[ghoul.motion].end_time();
+			if (!use_cache)
+			{
+				clips[ghoul.motion].sample(ghoul.motion_timer, pose);
+				if (ghoul.lerp_timer < LerpTime)
+				{
+					clips[ghoul.prev_motion].sample(ghoul.prev_motion_timer, prev_pose);
+					AnimationPose::blend(prev_pose, pose, ghoul.lerp_timer / LerpTime, pose);
+				}
+				pose.to_matrices(local_matrices.data());
+			}
+			else
+			{
+				const auto state = PoseCache::make_state(0, ghoul.prev_motion, ghoul.prev_motion_timer, clips[ghoul.prev_motion].end_time(),
+					ghoul.motion, ghoul.motion_timer, end_time, ghoul.lerp_timer / LerpTime);
+				result.in_range = result.in_range && state.time >= 0.0f && state.time <= end_time
+					&& state.prev_time >= 0.0f && state.prev_time <= clips[ghoul.prev_motion].end_time();
+				const bool hit = PoseCache::find(state.key, local_matrices.data(), bone_count);
+				if (!hit || verify)
+				{
+					clips[ghoul.motion].sample(state.time, pose);
+					if (state.amount < 1.0f)
+					{
+						clips[ghoul.prev_motion].sample(state.prev_time, prev_pose);
+						AnimationPose::blend(prev_pose, pose, state.amount, pose);
+					}
+					pose.to_matrices((hit ? reference : local_matrices).data());
+				}
+				if (!hit)
+				{
+					PoseCache::add(state.key, local_matrices.data(), bone_count);
+				}
+				else if (verify)
+				{
+					// 共有した姿勢は、このアクターの量子化した状態でサンプリングした姿勢と一致する
+					for (int bone = 0; bone < bone_count; ++bone)
+					{
+						for (int k = 0; k < 12; ++k)
+						{
+							result.max_shared_error = std::max(result.max_shared_error, std::fabs((&local_matrices[bone].m[0][0])[k] - (&reference[bone].m[0][0])[k]));
+						}
+					}
+				}
+			}
+			s_sink = local_matrices[bone_count / 2].m[0][3];
+
+			// タイマーの更新（Animation::updateと同じ）
+			ghoul.motion_timer = std::fmod(ghoul.motion_timer + 0.5f, end_time);
+			ghoul.lerp_timer = std::min(ghoul.lerp_timer + 1.0f, LerpTime);
+			update_behavior(ghoul, tick);
+		}
+		elapsed += elapsed_ns(start);
+	}
+
+	result.hits = PoseCache::hit_count();
+	result.misses = PoseCache::miss_count();
+	result.tick_ms = elapsed / TickCount / 1.0e6;
+	return result;
+}
+
+// 再生状態の量子化の検証
+static void test_make_state()
+{
+	std::printf("PoseCache::make_state\n");
+	PoseCache::set_time_quantum(0.5f);
+
+	// 四捨五入で終了時間を超える段階はクリップの終了時間に丸める
+	auto state = PoseCache::make_state(0, 1, 10.3f, 10.3f, 0, 10.3f, 10.3f, 0.5f);
+	check("quantized time is clamped to the end time", state.time == 10.3f && state.prev_time == 10.3f);
+	state = PoseCache::make_state(0, 1, 0.0f, 10.0f, 0, 2.2f, 10.0f, 1.0f);
+	check("time is rounded to the quantum", state.time == 2.0f && state.key.time == 4);
+
+	// 補間が終わっていれば補間元はキーに含めない
+	const auto a = PoseCache::make_state(0, 1, 3.0f, 10.0f, 0, 2.0f, 10.0f, 1.0f);
+	const auto b = PoseCache::make_state(0, 2, 7.0f, 10.0f, 0, 2.0f, 10.0f, 1.2f);
+	check("finished crossfade drops the previous motion", a.key == b.key && a.amount == 1.0f);
+
+	// 量子化しない場合は値をそのまま使う
+	PoseCache::set_time_quantum(0.0f);
+	state = PoseCache::make_state(0, 1, 3.3f, 10.0f, 0, 2.2f, 10.0f, 0.3f);
+	check("zero quantum keeps exact values", state.time == 2.2f && state.prev_time == 3.3f && state.amount == 0.3f);
+	PoseCache::set_time_quantum(0.5f);
+}
+
+int main(int argc, char* argv[])
+{
+	bool bench = false;
+	bool test = false;
+	for (int i = 1; i < argc; ++i)
+	{
+		if (std::strcmp(argv[i], "--bench") == 0) bench = true;
+		else if (std::strcmp(argv[i], "--test") == 0) test = true;
+		else
+		{
+			std::printf("usage: pose_cache_bench [--bench] [--test]\n");
+			return 2;
+		}
+	}
+	if (!bench && !test) bench = test = true;
+
+	// Ghoulのモーションを合成して圧縮
+	const Skeleton skeleton(synthetic_parents(SyntheticBoneCount));
+	const auto tolerances = synthetic_tolerances(skeleton);
+	std::vector<CompressedAnimationClip> clips;
+	for (int motion = 0; motion < MOTION_COUNT; ++motion)
+	{
+		clips.emplace_back(synthetic_clip(SyntheticBoneCount, MotionLengths[motion], motion + 1), tolerances.data());
+	}
+
+	if (test)
+	{
+		test_make_state();
+		std::printf("%d-Ghoul wave (verify)\n", GhoulCount);
+		const auto result = simulate(clips, true, true);
+		check("sampled times stay within the clips", result.in_range);
+		check("shared poses match the actor's own quantized state", result.max_shared_error <= 1.0e-5f);
+		check("wave shares poses", result.hits > 0);
+		std::printf("%d check(s) failed\n", s_failures);
+	}
+
+	if (bench)
+	{
+		std::printf("%d-Ghoul wave (%d per wave every %d ticks, %d ticks, %d bones)\n", GhoulCount, WaveSize, WaveInterval, TickCount, SyntheticBoneCount);
+		std::printf("  %-24s %9s %9s %9s %10s\n", "time quantum", "hits", "misses", "hit rate", "ms/tick");
+		const auto baseline = simulate(clips, false, false);
+		std::printf("  %-24s %9s %9s %9s %10.3f\n", "no cache", "-", "-", "-", baseline.tick_ms);
+		const float quanta[]{ 0.0f, 0.25f, 0.5f, 1.0f };
+		for (const auto quantum : quanta)
+		{
+			PoseCache::set_time_quantum(quantum);
+			const auto result = simulate(clips, true, false);
+			const int total = std::max(result.hits + result.misses, 1);
+			std::printf("  %-24.2f %9d %9d %8.1f%% %10.3f\n", quantum, result.hits, result.misses, 100.0 * result.hits / total, result.tick_ms);
+		}
+		PoseCache::set_time_quantum(0.5f);
+	}
+	return (s_failures == 0) ? 0 : 1;
+}
\ No newline at end of file
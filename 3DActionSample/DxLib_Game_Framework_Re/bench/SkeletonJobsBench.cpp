@@ -0,0 +1,208 @@
+#include "SyntheticAnimation.h"
+#include "../src/Graphic/AnimationPose.h"
+#include "../src/Graphic/SkeletonJobs.h"
+#include "../src/Graphic/WorkerPool.h"
+#include "../src/Math/Matrix.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+// スケルトン変換ジョブのスレッド数による性能のベンチマーク
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// 多数のアクターのワールド変換行列とAABBをSkeletonJobsで計算し、WorkerPoolのスレッド数を1からNまで変えて
+// 1フレームあたりの時間と、1スレッドに対する速度向上率・並列化効率を比較する。
+// 検証では、どのスレッド数でも1スレッドと同じ結果になることと、変化したボーンの記録を確認する。
+// 使い方：skeleton_jobs_bench [--bench] [--test] [--threads N]（Nの省略時はCPUのコア数と4の大きい方）
+
+// アクター数（計測するもの）
+static const int ActorCounts[]{ 200, 1000 };
+// 1アクターあたりの頂点数（ボーンごと）
+static const int VerticesPerBone{ 16 };
+// 計測するフレーム数
+static const int FrameCount{ 100 };
+
+// 失敗した検証の数
+static int s_failures{ 0 };
+// 最適化で消されないようにするための出力先
+static volatile float s_sink{ 0.0f };
+
+// 検証結果の表示
+static void check(const char* name, bool passed)
+{
+	std::printf("  %-52s %s\n", name, passed ? "ok" : "FAILED");
+	s_failures += passed ? 0 : 1;
+}
+
+// 構造体：アクター群（Animationが毎tick保持する配列と同じ）
+struct Actors
+{
+	std::vector<AffineMatrix>	local_matrices;	// 各アクターのローカル変換行列
+	std::vector<Matrix>			worlds;			// 各アクターのワールド変換行列
+	std::vector<AffineMatrix>	world_matrices;	// 各アクターのボーンのワールド変換行列（計算結果）
+	std::vector<BoundingBox>	boxes;			// 各アクターのAABB（計算結果）
+};
+
+// アクター群の作成（クリップの異なる時刻の姿勢を、異なる位置に配置）
+static Actors make_actors(const AnimationClip& clip, int actor_count)
+{
+	const int bone_count = clip.bone_count();
+	Actors actors;
+	actors.local_matrices.resize((std::size_t)actor_count * bone_count);
+	actors.world_matrices.resize((std::size_t)actor_count * bone_count);
+	actors.boxes.resize(actor_count);
+	AnimationPose pose;
+	for (int actor = 0; actor < actor_count; ++actor)
+	{
+		clip.sample(clip.end_time() * actor / actor_count, pose);
+		pose.to_matrices(&actors.local_matrices[(std::size_t)actor * bone_count]);
+		actors.worlds.push_back(Matrix::CreateRotationY(actor * 7.0f) * Matrix::CreateTranslation(Vector3((float)(actor % 20) * 50.0f, 0.0f, (float)(actor / 20) * 50.0f)));
+	}
+	return actors;
+}
+
+// 全アクターのジョブを登録して実行（changed_bonesを指定すると変化したボーンも記録する）
+static void run_jobs(const Skeleton& skeleton, const BoneBounds& bounds, Actors& actors, unsigned long long changed_bones[] = nullptr)
+{
+	const int bone_count = skeleton.bone_count();
+	const int words = (bone_count + 63) / 64;
+	for (int actor = 0; actor < (int)actors.worlds.size(); ++actor)
+	{
+		const std::size_t offset = (std::size_t)actor * bone_count;
+		SkeletonJobs::add(skeleton, &actors.local_matrices[offset], actors.worlds[actor], &actors.world_matrices[offset],
+			&bounds, &actors.boxes[actor], (changed_bones != nullptr) ? &changed_bones[actor * words] : nullptr);
+	}
+	SkeletonJobs::run();
+}
+
+// 1フレームあたりの時間の計測（ミリ秒）
+static double measure(const Skeleton& skeleton, const BoneBounds& bounds, Actors& actors, int thread_count)
+{
+	WorkerPool::set_thread_count(thread_count);
+	run_jobs(skeleton, bounds, actors);
+	const auto start = BenchClock::now();
+	for (int frame = 0; frame < FrameCount; ++frame)
+	{
+		run_jobs(skeleton, bounds, actors);
+	}
+	s_sink = actors.world_matrices.back().m[1][3];
+	return elapsed_ns(start) / FrameCount / 1.0e6;
+}
+
+// スレッド数ごとの計測
+static void bench(const Skeleton& skeleton, const BoneBounds& bounds, const AnimationClip& clip, int max_threads)
+{
+	std::printf("skeleton jobs (%d bones, %d bone spheres, %u hardware threads)\n", skeleton.bone_count(), (int)bounds.spheres().size(),
+		std::thread::hardware_concurrency());
+	std::printf("  %-8s %-8s %10s %10s %10s %12s\n", "actors", "threads", "ms/frame", "speedup", "efficiency", "us/actor");
+	for (const auto actor_count : ActorCounts)
+	{
+		auto actors = make_actors(clip, actor_count);
+		double single = 0.0;
+		for (int threads = 1; threads <= max_threads; ++threads)
+		{
+			const double ms = measure(skeleton, bounds, actors, threads);
+			if (threads == 1) single = ms;
+			std::printf("  %-8d %-8d %10.3f %9.2fx %9.1f%% %12.2f\n", actor_count, threads, ms, single / ms, 100.0 * single / ms / threads,
+				ms * 1000.0 / actor_count);
+		}
+	}
+}
+
+// 並列実行の結果の検証
+static void test(const Skeleton& skeleton, const BoneBounds& bounds, const BindPoseMesh& mesh, const AnimationClip& clip, int max_threads)
+{
+	std::printf("skeleton jobs (1..%d threads)\n", max_threads);
+	const int bone_count = skeleton.bone_count();
+	const int actor_count = ActorCounts[0];
+
+	// 1スレッドの結果を基準にする
+	auto reference = make_actors(clip, actor_count);
+	WorkerPool::set_thread_count(1);
+	run_jobs(skeleton, bounds, reference);
+
+	bool same = true;
+	for (int threads = 2; threads <= max_threads; ++threads)
+	{
+		auto actors = make_actors(clip, actor_count);
+		WorkerPool::set_thread_count(threads);
+		run_jobs(skeleton, bounds, actors);
+		same = same && std::memcmp(actors.world_matrices.data(), reference.world_matrices.data(), sizeof(AffineMatrix) * actors.world_matrices.size()) == 0
+			&& std::memcmp(actors.boxes.data(), reference.boxes.data(), sizeof(BoundingBox) * actors.boxes.size()) == 0;
+	}
+	check("every thread count matches a single thread", same);
+
+	// スキニングした頂点（剛体の頂点は1ボーン）はAABBに含まれる
+	bool contained = true;
+	for (int actor = 0; actor < actor_count; ++actor)
+	{
+		const auto* world_matrices = &reference.world_matrices[(std::size_t)actor * bone_count];
+		const auto& box = reference.boxes[actor];
+		for (std::size_t i = 0; i < mesh.positions.size(); ++i)
+		{
+			const int bone = mesh.bones[i];
+			const Vector3 position = mesh.positions[i] * AffineMatrix::Invert(mesh.bone_matrices[bone]) * world_matrices[bone];
+			contained = contained && position.x >= box.minimum.x - 1.0e-3f && position.x <= box.maximum.x + 1.0e-3f
+				&& position.y >= box.minimum.y - 1.0e-3f && position.y <= box.maximum.y + 1.0e-3f
+				&& position.z >= box.minimum.z - 1.0e-3f && position.z <= box.maximum.z + 1.0e-3f;
+		}
+	}
+	check("posed vertices stay inside the actor's box", contained);
+
+	// 変化したボーンの記録（同じ入力では何も記録されず、1ボーンを動かすとそのボーンと子孫だけが記録される）
+	const int words = (bone_count + 63) / 64;
+	std::vector<unsigned long long> changed((std::size_t)actor_count * words, 0);
+	WorkerPool::set_thread_count(max_threads);
+	run_jobs(skeleton, bounds, reference, changed.data());
+	check("unchanged input records no bones", std::all_of(changed.begin(), changed.end(), [](unsigned long long bits) { return bits == 0; }));
+
+	const int moved = 3;
+	reference.local_matrices[moved] *= AffineMatrix::CreateWorld(Vector3::One, Quaternion(Vector3::UnitX, 10.0f), Vector3::Zero);
+	run_jobs(skeleton, bounds, reference, changed.data());
+	bool descendants = std::all_of(changed.begin() + words, changed.end(), [](unsigned long long bits) { return bits == 0; });
+	for (int bone = 0; bone < bone_count; ++bone)
+	{
+		int ancestor = bone;
+		while (ancestor >= 0 && ancestor != moved) ancestor = skeleton.parent(ancestor);
+		const bool recorded = (changed[bone / 64] >> (bone % 64) & 1) != 0;
+		descendants = descendants && recorded == (ancestor == moved);
+	}
+	check("a moved bone records itself and its descendants only", descendants);
+}
+
+int main(int argc, char* argv[])
+{
+	bool run_bench = false;
+	bool run_test = false;
+	int max_threads = std::max((int)std::thread::hardware_concurrency(), 4);
+	for (int i = 1; i < argc; ++i)
+	{
+		if (std::strcmp(argv[i], "--bench") == 0) run_bench = true;
+		else if (std::strcmp(argv[i], "--test") == 0) run_test = true;
+		else if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc) max_threads = std::max(std::atoi(argv[++i]), 1);
+		else
+		{
+			std::printf("usage: skeleton_jobs_bench [--bench] [--test] [--threads N]\n");
+			return 2;
+		}
+	}
+	if (!run_bench && !run_test) run_bench = run_test = true;
+
+	const Skeleton skeleton(synthetic_parents(SyntheticBoneCount));
+	const BindPoseMesh mesh = synthetic_bind_pose(skeleton, VerticesPerBone);
+	const BoneBounds bounds(mesh);
+	const AnimationClip clip = synthetic_clip(SyntheticBoneCount, SyntheticClipLength, 1);
+
+	WorkerPool::initialize(1);
+	if (run_test)
+	{
+		test(skeleton, bounds, mesh, clip, max_threads);
+		std::printf("%d check(s) failed\n", s_failures);
+	}
+	if (run_bench) bench(skeleton, bounds, clip, max_threads);
+	SkeletonJobs::finalize();
+	WorkerPool::finalize();
+	return (s_failures == 0) ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,118 @@
+#ifndef SYNTHETIC_ANIMATION_H_
+#define SYNTHETIC_ANIMATION_H_
+
+#include "../src/Graphic/AnimationClip.h"
+#include "../src/Graphic/BoneBounds.h"
+#include "../src/Graphic/CompressedAnimationClip.h"
+#include "../src/Graphic/Skeleton.h"
+#include "../src/Math/Random.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+// アニメーションのベンチマーク用の合成データ
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// DxLibでモデルを読み込めない環境でも計測できるように、人型に近い階層と滑らかに動くクリップを生成する。
+// 実際のモデルから書き出したクリップ（SkeletalMesh::save_clip）があれば、各ベンチマークの引数で指定して使う。
+
+// 人型モデルのボーン数（Ghoulと同程度）
+static const int SyntheticBoneCount{ 64 };
+// クリップの長さ（フレーム）
+static const float SyntheticClipLength{ 60.0f };
+
+// 経過時間（ナノ秒）
+using BenchClock = std::chrono::steady_clock;
+inline double elapsed_ns(BenchClock::time_point start)
+{
+	return std::chrono::duration<double, std::nano>(BenchClock::now() - start).count();
+}
+
+// 人型に近いスケルトンの親番号（背骨から頭と四肢の鎖が分岐し、指などの末端が続く）
+inline std::vector<int> synthetic_parents(int bone_count)
+{
+	std::vector<int> parents(bone_count);
+	for (int i = 0; i < bone_count; ++i)
+	{
+		// 先頭の4ボーンは背骨、以降は6本の鎖を順に伸ばす
+		parents[i] = (i < 4) ? i - 1 : (i < 10) ? 3 : i - 6;
+	}
+	return parents;
+}
+
+// 滑らかに動くクリップの生成（ボーンごとに異なる周期と振幅で回転し、ルートは平行移動もする）
+inline AnimationClip synthetic_clip(int bone_count, float end_time, unsigned int stream)
+{
+	Random random(stream);
+	AnimationClip clip(bone_count, end_time);
+	std::vector<Vector3> axes(bone_count);
+	std::vector<float> periods(bone_count);
+	std::vector<float> amplitudes(bone_count);
+	for (int bone = 0; bone < bone_count; ++bone)
+	{
+		axes[bone] = Vector3::Normalize(Vector3(random.rand_float(-1.0f, 1.0f), random.rand_float(-1.0f, 1.0f), random.rand_float(-1.0f, 1.0f)) + Vector3(0.0f, 0.0f, 0.1f));
+		periods[bone] = random.rand_float(15.0f, 60.0f);
+		amplitudes[bone] = random.rand_float(5.0f, 60.0f);
+	}
+	for (int key = 0; key < clip.key_count(); ++key)
+	{
+		const float time = clip.key_time(key);
+		for (int bone = 0; bone < bone_count; ++bone)
+		{
+			const float phase = time / periods[bone] * 6.2831853f;
+			const Quaternion rotation(axes[bone], amplitudes[bone] * std::sin(phase));
+			const Vector3 translation = (bone == 0) ? Vector3(0.0f, 2.0f * std::sin(phase * 2.0f), time * 0.5f) : Vector3(0.0f, 10.0f, 0.0f);
+			clip.set_key(key, bone, Vector3::One, rotation, translation);
+		}
+	}
+	return clip;
+}
+
+// キー削減の許容誤差（SkeletalMesh::bake_clipsと同じく、根元に近いボーンほど厳しくする）
+inline std::vector<ClipTolerance> synthetic_tolerances(const Skeleton& skeleton)
+{
+	const float ToleranceDepthMax = 4.0f;
+	std::vector<ClipTolerance> tolerances(skeleton.bone_count());
+	for (int bone = 0; bone < skeleton.bone_count(); ++bone)
+	{
+		const float scale = std::min(1.0f + skeleton.depth(bone), ToleranceDepthMax) / ToleranceDepthMax;
+		tolerances[bone].rotation *= scale;
+		tolerances[bone].translation *= scale;
+		tolerances[bone].scale *= scale;
+	}
+	return tolerances;
+}
+
+// バインドポーズのメッシュの生成（各ボーンから子の方向に伸びる円柱状の頂点、4頂点に1つは親ボーンにも登録する）
+inline BindPoseMesh synthetic_bind_pose(const Skeleton& skeleton, int vertices_per_bone)
+{
+	const int bone_count = skeleton.bone_count();
+	std::vector<AffineMatrix> local_matrices(bone_count);
+	for (int bone = 0; bone < bone_count; ++bone)
+	{
+		local_matrices[bone] = AffineMatrix::CreateWorld(Vector3::One, Quaternion::Identity, (bone == 0) ? Vector3::Zero : Vector3(0.0f, 10.0f, 0.0f));
+	}
+	BindPoseMesh mesh;
+	mesh.bone_matrices.resize(bone_count);
+	skeleton.transform(local_matrices.data(), AffineMatrix::Identity, mesh.bone_matrices.data());
+
+	Random random(SyntheticBoneCount);
+	for (int bone = 0; bone < bone_count; ++bone)
+	{
+		for (int i = 0; i < vertices_per_bone; ++i)
+		{
+			const Vector3 local(random.rand_float(-3.0f, 3.0f), random.rand_float(0.0f, 10.0f), random.rand_float(-3.0f, 3.0f));
+			const Vector3 position = local * mesh.bone_matrices[bone];
+			mesh.positions.push_back(position);
+			mesh.bones.push_back(bone);
+			if (i % 4 == 0 && skeleton.parent(bone) >= 0)
+			{
+				mesh.positions.push_back(position);
+				mesh.bones.push_back(skeleton.parent(bone));
+			}
+		}
+	}
+	return mesh;
+}
+
+#endif // !SYNTHETIC_ANIMATION_H_
\ No newline at end of file
@@ -0,0 +1,227 @@
+#include "SyntheticAnimation.h"
+#include "../src/Graphic/AnimationPose.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+// モーション遷移（クロスフェードと慣性補間）のベンチマーク
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// Animationと同じ手順で、補間中の1tickあたりの姿勢の計算時間を比較する。
+// クロスフェードは補間中に前後のモーションを両方サンプリングし、慣性補間は遷移時に差分を1回求めて、
+// 補間中は新しいモーションのみサンプリングして差分を減衰させながら加える。
+// 使い方：transition_bench [--bench] [--test]（省略時は両方、検証に失敗すると終了コード1）
+
+// アクター数
+static const int ActorCount{ 200 };
+// 補間フレーム数（Animation::LerpTime、InertializationTimeと同じ）
+static const float TransitionTime{ 10.0f };
+// 計測する遷移の回数
+static const int TransitionCount{ 50 };
+
+// 失敗した検証の数
+static int s_failures{ 0 };
+// 最適化で消されないようにするための出力先
+static volatile float s_sink{ 0.0f };
+
+// 検証結果の表示
+static void check(const char* name, bool passed)
+{
+	std::printf("  %-52s %s\n", name, passed ? "ok" : "FAILED");
+	s_failures += passed ? 0 : 1;
+}
+
+// 慣性補間の減衰（Animation::apply_inertializationと同じ5次の多項式）
+static float decay(float timer)
+{
+	const float s = std::fmin(timer / TransitionTime, 1.0f);
+	return 1.0f - s * s * s * (10.0f + s * (-15.0f + s * 6.0f));
+}
+
+// 構造体：アクターの再生状態
+struct Actor
+{
+	float			prev_time{ 0.0f };	// 遷移元の再生時間
+	float			time{ 0.0f };		// 遷移先の再生時間
+	ClipCursor		prev_cursor;		// 遷移元のサンプリング位置
+	ClipCursor		cursor;				// 遷移先のサンプリング位置
+	AnimationPose	offset;				// 慣性補間の差分
+};
+
+// 構造体：計測結果（アクター1体のtickあたりナノ秒）
+struct TransitionResult
+{
+	double	steady_ns{ 0.0 };		// 遷移していない場合
+	double	crossfade_ns{ 0.0 };	// クロスフェード中
+	double	inertialize_ns{ 0.0 };	// 慣性補間中（遷移時の差分の計算を含む）
+	double	start_ns{ 0.0 };		// 慣性補間の開始時の差分の計算（遷移1回あたり）
+};
+
+// 全ボーンのサンプリング（Animationのカーソル付きサンプリングと同じ）
+static void sample(const CompressedAnimationClip& clip, float time, AnimationPose& pose, const std::vector<int>& bones, ClipCursor& cursor)
+{
+	clip.sample(time, pose, bones.data(), (int)bones.size(), &cursor);
+}
+
+// 計測
+static TransitionResult measure(const CompressedAnimationClip& from, const CompressedAnimationClip& to)
+{
+	const int bone_count = to.bone_count();
+	std::vector<int> bones(bone_count);
+	for (int i = 0; i < bone_count; ++i) bones[i] = i;
+	std::vector<Actor> actors(ActorCount);
+	for (int i = 0; i < ActorCount; ++i)
+	{
+		actors[i].prev_time = from.end_time() * i / ActorCount;
+	}
+	AnimationPose pose(bone_count);
+	AnimationPose prev_pose(bone_count);
+	AnimationPose target(bone_count);
+	std::vector<AffineMatrix> matrices(bone_count);
+	const double ticks = (double)TransitionCount * TransitionTime * ActorCount;
+	TransitionResult result;
+
+	// 遷移していない場合（1モーションのみサンプリング）
+	auto start = BenchClock::now();
+	for (int transition = 0; transition < TransitionCount; ++transition)
+	{
+		for (int tick = 0; tick < (int)TransitionTime; ++tick)
+		{
+			for (auto& actor : actors)
+			{
+				sample(to, std::fmod(actor.prev_time + tick * 0.5f, to.end_time()), pose, bones, actor.cursor);
+				pose.to_matrices(matrices.data());
+			}
+		}
+	}
+	result.steady_ns = elapsed_ns(start) / ticks;
+
+	// クロスフェード（補間中は前後のモーションをサンプリングして補間）
+	start = BenchClock::now();
+	for (int transition = 0; transition < TransitionCount; ++transition)
+	{
+		for (int tick = 0; tick < (int)TransitionTime; ++tick)
+		{
+			for (auto& actor : actors)
+			{
+				sample(from, actor.prev_time, prev_pose, bones, actor.prev_cursor);
+				sample(to, tick * 0.5f, pose, bones, actor.cursor);
+				AnimationPose::blend(prev_pose, pose, tick / TransitionTime, pose);
+				pose.to_matrices(matrices.data());
+			}
+		}
+	}
+	result.crossfade_ns = elapsed_ns(start) / ticks;
+	s_sink = matrices[bone_count / 2].m[1][3];
+
+	// 慣性補間（遷移時に現在の姿勢と遷移先の最初の姿勢の差分を求め、補間中は遷移先のみサンプリング）
+	double start_total = 0.0;
+	start = BenchClock::now();
+	for (int transition = 0; transition < TransitionCount; ++transition)
+	{
+		for (auto& actor : actors)
+		{
+			const auto begin = BenchClock::now();
+			sample(from, actor.prev_time, prev_pose, bones, actor.prev_cursor);
+			to.sample(0.0f, target);
+			AnimationPose::difference(prev_pose, target, actor.offset);
+			start_total += elapsed_ns(begin);
+		}
+		for (int tick = 0; tick < (int)TransitionTime; ++tick)
+		{
+			for (auto& actor : actors)
+			{
+				sample(to, tick * 0.5f, pose, bones, actor.cursor);
+				AnimationPose::add_offset(actor.offset, decay((float)tick), pose);
+				pose.to_matrices(matrices.data());
+			}
+		}
+	}
+	result.inertialize_ns = elapsed_ns(start) / ticks;
+	result.start_ns = start_total / ((double)TransitionCount * ActorCount);
+	s_sink = matrices[bone_count / 2].m[1][3];
+	return result;
+}
+
+// 2つの姿勢の最大の差（回転は成分の差、拡大縮小と平行移動は距離）
+static float pose_difference(const AnimationPose& p1, const AnimationPose& p2)
+{
+	float result = 0.0f;
+	for (int i = 0; i < p1.bone_count(); ++i)
+	{
+		const float sign = (Quaternion::Dot(p1.rotations[i], p2.rotations[i]) < 0.0f) ? -1.0f : 1.0f;
+		const Quaternion d = p1.rotations[i] - p2.rotations[i] * sign;
+		result = std::max(result, std::sqrt(Quaternion::Dot(d, d)));
+		result = std::max(result, Vector3::Distance(p1.scales[i], p2.scales[i]));
+		result = std::max(result, Vector3::Distance(p1.translations[i], p2.translations[i]));
+	}
+	return result;
+}
+
+// 慣性補間の検証
+static void test(const CompressedAnimationClip& from, const CompressedAnimationClip& to)
+{
+	std::printf("inertialization\n");
+	AnimationPose source, target, offset, pose;
+	from.sample(from.end_time() * 0.4f, source);
+	to.sample(0.0f, target);
+	AnimationPose::difference(source, target, offset);
+
+	// 遷移の瞬間は遷移元の姿勢と一致し、減衰し終わると遷移先の姿勢になる
+	pose = target;
+	AnimationPose::add_offset(offset, decay(0.0f), pose);
+	check("starts at the source pose", pose_difference(pose, source) <= 1.0e-5f);
+	pose = target;
+	AnimationPose::add_offset(offset, decay(TransitionTime), pose);
+	check("ends at the target pose", pose_difference(pose, target) == 0.0f);
+
+	// 差分の回転は短い方の回り
+	bool shortest = true;
+	for (const auto& rotation : offset.rotations) shortest = shortest && rotation.w >= 0.0f;
+	check("rotation offsets take the short way round", shortest);
+
+	// 減衰は単調に0へ向かう
+	bool monotonic = true;
+	for (int tick = 1; tick <= (int)TransitionTime; ++tick) monotonic = monotonic && decay((float)tick) <= decay(tick - 1.0f);
+	check("decay falls monotonically to zero", monotonic && decay(TransitionTime) == 0.0f);
+}
+
+int main(int argc, char* argv[])
+{
+	bool run_bench = false;
+	bool run_test = false;
+	for (int i = 1; i < argc; ++i)
+	{
+		if (std::strcmp(argv[i], "--bench") == 0) run_bench = true;
+		else if (std::strcmp(argv[i], "--test") == 0) run_test = true;
+		else
+		{
+			std::printf("usage: transition_bench [--bench] [--test]\n");
+			return 2;
+		}
+	}
+	if (!run_bench && !run_test) run_bench = run_test = true;
+
+	const Skeleton skeleton(synthetic_parents(SyntheticBoneCount));
+	const auto tolerances = synthetic_tolerances(skeleton);
+	const CompressedAnimationClip from(synthetic_clip(SyntheticBoneCount, SyntheticClipLength, 1), tolerances.data());
+	const CompressedAnimationClip to(synthetic_clip(SyntheticBoneCount, SyntheticClipLength, 2), tolerances.data());
+
+	if (run_test)
+	{
+		test(from, to);
+		std::printf("%d check(s) failed\n", s_failures);
+	}
+	if (run_bench)
+	{
+		const auto result = measure(from, to);
+		std::printf("motion transition (%d actors, %d bones, %.0f-frame transitions)\n", ActorCount, SyntheticBoneCount, TransitionTime);
+		std::printf("  %-32s %12s %12s\n", "", "ns/actor", "ms/200 actors");
+		std::printf("  %-32s %12.0f %12.3f\n", "no transition", result.steady_ns, result.steady_ns * ActorCount / 1.0e6);
+		std::printf("  %-32s %12.0f %12.3f\n", "crossfade", result.crossfade_ns, result.crossfade_ns * ActorCount / 1.0e6);
+		std::printf("  %-32s %12.0f %12.3f\n", "inertialization", result.inertialize_ns, result.inertialize_ns * ActorCount / 1.0e6);
+		std::printf("  %-32s %12.0f\n", "inertialization start (once)", result.start_ns);
+	}
+	return (s_failures == 0) ? 0 : 1;
+}
\ No newline at end of file
@@ -1,6 +1,17 @@
 #include "src/Game/ActionSample.h"
+#include <cstdlib>
+#include <cstring>
 
-int main()
+int main(int argc, char* argv[])
 {
-	return ActionSample().run();
+	ActionSample game;
+	// 「--seed 値」で乱数シードを固定する（前回のプレイを再現する場合）
+	for (int i = 1; i + 1 < argc; ++i)
+	{
+		if (std::strcmp(argv[i], "--seed") == 0)
+		{
+			game.set_seed((unsigned int)std::strtoul(argv[i + 1], nullptr, 10));
+		}
+	}
+	return game.run();
 }
\ No newline at end of file
@@ -1,7 +1,7 @@
 #ifndef BLOOM_CB_HLSLI_
 #define BLOOM_CB_HLSLI_
 
-// u[GtFNgp萔obt@
+// ブルームエフェクト用定数バッファ
 cbuffer BloomCB : register(b4)
 {
     float   g_BrightPassThreshold;
@@ -3,51 +3,51 @@
 
 #include "DxLibShaderCommon.hlsli"
 
-#define DX_PIXELLIGHTING_LIGHT_NUM          (6)     // sNZPʃCeBOœɎgpł郉Cg̍ő吔
-#define DX_D3D11_PS_CONST_FILTER_SIZE       (256)   // tB^[p萔obt@̃TCY
+#define DX_PIXELLIGHTING_LIGHT_NUM          (6)     // ピクセル単位ライティングで同時に使用できるライトの最大数
+#define DX_D3D11_PS_CONST_FILTER_SIZE       (256)   // フィルター用定数バッファのサイズ
 
-// f[^^` ---------------------------------
+// データ型定義 ---------------------------------
 
-// VhE}bvp[^
+// シャドウマップパラメータ
 struct DX_D3D11_PS_CONST_SHADOWMAP
 {
-    float       AdjustDepth;            // 臒l[x␳l
-    float       GradationParam;         // Of[V͈
-    float       Enable_Light0;          // CgOւ̓Kp
-    float       Enable_Light1;          // CgPւ̓Kp
+    float       AdjustDepth;            // 閾値深度補正値
+    float       GradationParam;         // グラデーション範囲
+    float       Enable_Light0;          // ライト０への適用情報
+    float       Enable_Light1;          // ライト１への適用情報
 
-    float       Enable_Light2;          // CgQւ̓Kp
-    float3      Padding;                // pfBO
+    float       Enable_Light2;          // ライト２への適用情報
+    float3      Padding;                // パディング
 };
 
-// 萔obt@sNZVF[_[{p[^
+// 定数バッファピクセルシェーダー基本パラメータ
 struct DX_D3D11_PS_CONST_BUFFER_BASE
 {
-    float4      FactorColor;            // At@l
+    float4      FactorColor;            // アルファ値等
 
-    float       MulAlphaColor;          // J[ɃAt@lZ邩ǂ( 0.0f:ZȂ  1.0f:Z )
-    float       AlphaTestRef;           // At@eXgŎgprl
+    float       MulAlphaColor;          // カラーにアルファ値を乗算するかどうか( 0.0f:乗算しない  1.0f:乗算する )
+    float       AlphaTestRef;           // アルファテストで使用する比較値
     float2      Padding1;
 
-    int         AlphaTestCmpMode;       // At@eXgr[h( DX_CMP_NEVER Ȃ )
+    int         AlphaTestCmpMode;       // アルファテスト比較モード( DX_CMP_NEVER など )
     int3        Padding2;
 };
 
-// 萔obt@VhE}bvp[^
+// 定数バッファシャドウマップパラメータ
 struct DX_D3D11_PS_CONST_BUFFER_SHADOWMAP
 {
     DX_D3D11_PS_CONST_SHADOWMAP Data[3];
 };
 
-// 萔` ----------------------------------------------------------------------
+// 定数定義 ----------------------------------------------------------------------
 
-// {p[^
+// 基本パラメータ
 cbuffer cbD3D11_CONST_BUFFER_PS_BASE : register(b1)
 {
     DX_D3D11_PS_CONST_BUFFER_BASE       g_Base;
 };
 
-// VhE}bvp[^
+// シャドウマップパラメータ
 cbuffer cbD3D11_CONST_BUFFER_PS_SHADOWMAP : register(b2)
 {
     DX_D3D11_PS_CONST_BUFFER_SHADOWMAP  g_ShadowMap;
@@ -1,65 +1,65 @@
 #ifndef DX_LIB_SHADER_COMMON_HLSLI_
 #define DX_LIB_SHADER_COMMON_HLSLI_
 
-#define DX_D3D11_COMMON_CONST_LIGHT_NUM         (6)     // ʃp[^̃Cg̍ő吔
+#define DX_D3D11_COMMON_CONST_LIGHT_NUM         (6)     // 共通パラメータのライトの最大数
 
-// \̒` --------------------------------------------------------------------
+// 構造体定義 --------------------------------------------------------------------
 
-// }eAp[^
+// マテリアルパラメータ
 struct DX_D3D11_CONST_MATERIAL
 {
-    float4      Diffuse;                // fBt[YJ[
-    float4      Specular;               // XyLJ[
-    float4      Ambient_Emissive;       // }eAG~bVuJ[ + }eAArGgJ[ * O[oArGgJ[
-    float       Power;                  // XyL̋
-    float3      Padding;                // pfBO
+    float4      Diffuse;                // ディフューズカラー
+    float4      Specular;               // スペキュラカラー
+    float4      Ambient_Emissive;       // マテリアルエミッシブカラー + マテリアルアンビエントカラー * グローバルアンビエントカラー
+    float       Power;                  // スペキュラの強さ
+    float3      Padding;                // パディング
 };
 
-// tHOp[^
+// フォグパラメータ
 struct DX_D3D11_VS_CONST_FOG
 {
-    float       LinearAdd;              // tHOpp[^ end / ( end - start )
-    float       LinearDiv;              // tHOpp[^ -1  / ( end - start )
-    float       Density;                // tHOpp[^ density
-    float       E;                      // tHOpp[^ Rΐ̒
-    float4      Color;                  // J[
+    float       LinearAdd;              // フォグ用パラメータ end / ( end - start )
+    float       LinearDiv;              // フォグ用パラメータ -1  / ( end - start )
+    float       Density;                // フォグ用パラメータ density
+    float       E;                      // フォグ用パラメータ 自然対数の低
+    float4      Color;                  // カラー
 };
 
-// Cgp[^
+// ライトパラメータ
 struct DX_D3D11_CONST_LIGHT
 {
-    int         Type;                   // Cg^Cv( DX_LIGHTTYPE_POINT Ȃ )
-    int3        Padding1;               // pfBOP
+    int         Type;                   // ライトタイプ( DX_LIGHTTYPE_POINT など )
+    int3        Padding1;               // パディング１
 
-    float3      Position;               // W( r[ )
-    float       RangePow2;              // L̂Q
+    float3      Position;               // 座標( ビュー空間 )
+    float       RangePow2;              // 有効距離の２乗
 
-    float3      Direction;              // ( r[ )
-    float       FallOff;                // X|bgCgpFallOff
+    float3      Direction;              // 方向( ビュー空間 )
+    float       FallOff;                // スポットライト用FallOff
 
-    float3      Diffuse;                // fBt[YJ[
-    float       SpotParam0;             // X|bgCgpp[^O( cos( Phi / 2.0f ) )
+    float3      Diffuse;                // ディフューズカラー
+    float       SpotParam0;             // スポットライト用パラメータ０( cos( Phi / 2.0f ) )
 
-    float3      Specular;               // XyLJ[
-    float       SpotParam1;             // X|bgCgpp[^P( 1.0f / ( cos( Theta / 2.0f ) - cos( Phi / 2.0f ) ) )
+    float3      Specular;               // スペキュラカラー
+    float       SpotParam1;             // スポットライト用パラメータ１( 1.0f / ( cos( Theta / 2.0f ) - cos( Phi / 2.0f ) ) )
 
-    float4      Ambient;                // ArGgJ[ƃ}eÃArGgJ[Z
+    float4      Ambient;                // アンビエントカラーとマテリアルのアンビエントカラーを乗算したもの
 
-    float       Attenuation0;           // ɂ錸pp[^O
-    float       Attenuation1;           // ɂ錸pp[^P
-    float       Attenuation2;           // ɂ錸pp[^Q
-    float       Padding2;               // pfBOQ
+    float       Attenuation0;           // 距離による減衰処理用パラメータ０
+    float       Attenuation1;           // 距離による減衰処理用パラメータ１
+    float       Attenuation2;           // 距離による減衰処理用パラメータ２
+    float       Padding2;               // パディング２
 };
 
-// sNZVF[_[E_VF[_[ʃp[^
+// ピクセルシェーダー・頂点シェーダー共通パラメータ
 struct DX_D3D11_CONST_BUFFER_COMMON
 {
-    DX_D3D11_CONST_LIGHT        Light[DX_D3D11_COMMON_CONST_LIGHT_NUM];         // Cgp[^
-    DX_D3D11_CONST_MATERIAL     Material;                                       // }eAp[^
-    DX_D3D11_VS_CONST_FOG       Fog;                                            // tHOp[^
+    DX_D3D11_CONST_LIGHT        Light[DX_D3D11_COMMON_CONST_LIGHT_NUM];         // ライトパラメータ
+    DX_D3D11_CONST_MATERIAL     Material;                                       // マテリアルパラメータ
+    DX_D3D11_VS_CONST_FOG       Fog;                                            // フォグパラメータ
 };
 
-// _VF[_[EsNZVF[_[ʃp[^
+// 頂点シェーダー・ピクセルシェーダー共通パラメータ
 cbuffer cbD3D11_CONST_BUFFER_COMMON : register(b0)
 {
     DX_D3D11_CONST_BUFFER_COMMON    g_Common;
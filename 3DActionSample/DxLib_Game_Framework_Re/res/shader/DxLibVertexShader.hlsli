@@ -3,55 +3,55 @@
 
 #include "DxLibShaderCommon.hlsli"
 
-// }N` -----------------------------------
+// マクロ定義 -----------------------------------
 
-#define DX_VERTEXLIGHTING_LIGHT_NUM                     3           // _PʃCeBOœɎgpł郉Cg̍ő吔
-#define DX_D3D11_VS_CONST_TEXTURE_MATRIX_NUM            3           // eNX`Wϊs̓]us̐
-#define DX_D3D11_VS_CONST_WORLD_MAT_NUM                 54          // gCAOXgœɎgp郍[J[hs̍ő吔
+#define DX_VERTEXLIGHTING_LIGHT_NUM                     3           // 頂点単位ライティングで同時に使用できるライトの最大数
+#define DX_D3D11_VS_CONST_TEXTURE_MATRIX_NUM            3           // テクスチャ座標変換行列の転置行列の数
+#define DX_D3D11_VS_CONST_WORLD_MAT_NUM                 54          // トライアングルリスト一つで同時に使用するローカル→ワールド行列の最大数
 
-// f[^^` ---------------------------------
+// データ型定義 ---------------------------------
 
-// {p[^
+// 基本パラメータ
 struct DX_D3D11_VS_CONST_BUFFER_BASE
 {
-    float4      AntiViewportMatrix[4];              // A`r[|[gs
-    float4      ProjectionMatrix[4];                // r[@@vWFNVs
-    float4      ViewMatrix[3];                      // [h@@r[s
-    float4      LocalWorldMatrix[3];                // [J@@[hs
-
-    float4      ToonOutLineSize;                    // gD[̗֊s̑傫
-    float       DiffuseSource;                      // fBt[YJ[( 0.0f:}eA  1.0f:_ )
-    float       SpecularSource;                     // XyLJ[(   0.0f:}eA  1.0f:_ )
-    float       MulSpecularColor;                   // XyLJ[lɏZl( XyLŎgp )
+    float4      AntiViewportMatrix[4];              // アンチビューポート行列
+    float4      ProjectionMatrix[4];                // ビュー　→　プロジェクション行列
+    float4      ViewMatrix[3];                      // ワールド　→　ビュー行列
+    float4      LocalWorldMatrix[3];                // ローカル　→　ワールド行列
+
+    float4      ToonOutLineSize;                    // トゥーンの輪郭線の大きさ
+    float       DiffuseSource;                      // ディフューズカラー( 0.0f:マテリアル  1.0f:頂点 )
+    float       SpecularSource;                     // スペキュラカラー(   0.0f:マテリアル  1.0f:頂点 )
+    float       MulSpecularColor;                   // スペキュラカラー値に乗算する値( スペキュラ無効処理で使用 )
     float       Padding;
 };
 
-// ̑̍s
+// その他の行列
 struct DX_D3D11_VS_CONST_BUFFER_OTHERMATRIX
 {
-    float4      ShadowMapLightViewProjectionMatrix[3][4];                   // VhE}bvp̃Cgr[sƃCgˉesZ
-    float4      TextureMatrix[DX_D3D11_VS_CONST_TEXTURE_MATRIX_NUM][2]; // eNX`Wps
+    float4      ShadowMapLightViewProjectionMatrix[3][4];                   // シャドウマップ用のライトビュー行列とライト射影行列を乗算したもの
+    float4      TextureMatrix[DX_D3D11_VS_CONST_TEXTURE_MATRIX_NUM][2]; // テクスチャ座標操作用行列
 };
 
-// XLjObVṕ@[J@@[hs
+// スキニングメッシュ用の　ローカル　→　ワールド行列
 struct DX_D3D11_VS_CONST_BUFFER_LOCALWORLDMATRIX
 {
-    float4      Matrix[DX_D3D11_VS_CONST_WORLD_MAT_NUM * 3];                    // [J@@[hs
+    float4      Matrix[DX_D3D11_VS_CONST_WORLD_MAT_NUM * 3];                    // ローカル　→　ワールド行列
 };
 
-// {p[^
+// 基本パラメータ
 cbuffer cbD3D11_CONST_BUFFER_VS_BASE : register(b1)
 {
     DX_D3D11_VS_CONST_BUFFER_BASE               g_Base;
 };
 
-// ̑̍s
+// その他の行列
 cbuffer cbD3D11_CONST_BUFFER_VS_OTHERMATRIX : register(b2)
 {
     DX_D3D11_VS_CONST_BUFFER_OTHERMATRIX        g_OtherMatrix;
 };
 
-// XLjObVṕ@[J@@[hs
+// スキニングメッシュ用の　ローカル　→　ワールド行列
 cbuffer cbD3D11_CONST_BUFFER_VS_LOCALWORLDMATRIX : register(b3)
 {
     DX_D3D11_VS_CONST_BUFFER_LOCALWORLDMATRIX   g_LocalWorldMatrix;
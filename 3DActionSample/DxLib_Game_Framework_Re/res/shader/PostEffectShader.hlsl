@@ -1,6 +1,6 @@
 #include "DxLibPixelShader.hlsli"
 
-// sNZVF[_[̓
+// ピクセルシェーダーの入力
 struct PS_INPUT
 {
     float4 Position     : SV_POSITION;
@@ -9,7 +9,7 @@ struct PS_INPUT
     float2 TexCoords1   : TEXCOORD1;
 };
 
-// sNZVF[_[̏o
+// ピクセルシェーダーの出力
 struct PS_OUTPUT
 {
     float4 Color0       : SV_TARGET0;
@@ -21,11 +21,11 @@ Texture2D       g_BaseMapTexture : register(t0);
 PS_OUTPUT main(PS_INPUT PSInput)
 {
     PS_OUTPUT PSOutput;
-    // gU˃J[̓_[^[Qbgp̃eNX`Q
+    // 拡散反射カラーはレンダーターゲット用のテクスチャを参照
     float4 TextureDiffuseColor = g_BaseMapTexture.Sample(g_BaseMapSampler, PSInput.TexCoords0.xy);
-    // O[XP[ɕϊ
+    // グレースケールに変換
     float intensity = dot(TextureDiffuseColor.rgb, float3(0.299f, 0.587f, 0.114f));
-    // o̓J[ݒ
+    // 出力カラーを設定
     PSOutput.Color0.rgb = intensity;
     PSOutput.Color0.a = 1.0f;
 
@@ -1,6 +1,6 @@
 #include "DxLibPixelShader.hlsli"
 
-// sNZVF[_[̓
+// ピクセルシェーダーの入力
 struct PS_INPUT
 {
 	float4 Position     : SV_POSITION;
@@ -9,7 +9,7 @@ struct PS_INPUT
 	float2 TexCoords1   : TEXCOORD1;
 };
 
-// sNZVF[_[̏o
+// ピクセルシェーダーの出力
 struct PS_OUTPUT
 {
 	float4 Color0       : SV_TARGET0;
@@ -19,8 +19,8 @@ SamplerState    g_BaseMapSampler : register(s0);
 Texture2D       g_BaseMapTexture : register(t0);
 
 cbuffer RadialCB:register(b6){
-	float _Strength;	// ڂ̋
-	int _SampleCount;	// R}
+	float _Strength;	// ぼかしの強さ
+	int _SampleCount;	// 分割コマ数
 	float Dummy;
 	float Dummy2;
 };
@@ -28,9 +28,9 @@ cbuffer RadialCB:register(b6){
 PS_OUTPUT main(PS_INPUT PSInput)
 {
 	PS_OUTPUT PSOutput;
-	// gU˃J[̓_[^[Qbgp̃eNX`Q
+	// 拡散反射カラーはレンダーターゲット用のテクスチャを参照
 	float4 TextureDiffuseColor = g_BaseMapTexture.Sample(g_BaseMapSampler, PSInput.TexCoords0.xy);
-	// u[
+	// ブラー処理
 	float4 col = 0;
 	float2 symmetryUv = PSInput.TexCoords0 - 0.5;
 	
@@ -45,7 +45,7 @@ PS_OUTPUT main(PS_INPUT PSInput)
 
 	col /= _SampleCount;
 
-	// o̓J[ݒ
+	// 出力カラーを設定
 	PSOutput.Color0 =col;
 	
 	return PSOutput;
@@ -1,39 +1,40 @@
 #include "Actor.h"
+#include "../World/IWorld.h"
 
-// NXFAN^[
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：アクター
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
-// RXgN^
+// コンストラクタ
 Actor::Actor() :
-	world_{ nullptr }, name_{ "null" }, position_{ Vector3::Zero }, body_{ std::shared_ptr<DummyBody>() }
+	world_{ nullptr }, id_{ 0 }, name_{ "null" }, position_{ Vector3::Zero }, body_{ std::shared_ptr<DummyBody>() }
 { }
 
-// RXgN^
+// コンストラクタ
 Actor::Actor(IWorld* world, const std::string& name, const Vector3& position, const IBodyPtr& body) :
-	world_{ world }, name_{ name }, position_{ position }, body_{ body }
+	world_{ world }, id_{ (world != nullptr) ? world->issue_actor_id() : 0 }, name_{ name }, position_{ position }, body_{ body }
 { }
 
-// zfXgN^
+// 仮想デストラクタ
 Actor::~Actor()
 { }
 
-// XV
+// 更新
 void Actor::update(float delta_time)
 { }
 
-// `
+// 描画
 void Actor::draw() const
 { }
 
-// Փ˃ANV
+// 衝突リアクション
 void Actor::react(Actor& other)
 { }
 
-// bZ[W
+// メッセージ処理
 void Actor::handle_message(EventMessage message, void* param)
 { }
 
-// Փ˔
+// 衝突判定
 void Actor::collide(Actor& other)
 {
 	if (is_collided(other))
@@ -43,61 +44,67 @@ void Actor::collide(Actor& other)
 	}
 }
 
-// S
+// 死亡
 void Actor::die()
 {
 	is_dead_ = true;
 }
 
-// Փ˂Ă邩
+// 衝突しているか
 bool Actor::is_collided(const Actor& other) const
 {
 	return body()->is_collided(*other.body());
 }
 
-// SĂ邩
+// 死亡しているか
 bool Actor::is_dead() const
 {
 	return is_dead_;
 }
 
-// Öړw
+// 外部からの移動指令
 void Actor::move_order(Vector3 vector)
 {
 	position_ += vector;
 }
 
-// O̎擾
+// IDの取得
+unsigned int Actor::id() const
+{
+	return id_;
+}
+
+// 名前の取得
 const std::string& Actor::name() const
 {
 	return name_;
 }
 
-// W̎擾
+// 座標の取得
 Vector3 Actor::position() const
 {
 	return position_;
 }
 
-// ]s̎擾
+// 回転行列の取得
 Matrix Actor::rotation() const
 {
 	return rotation_;
 }
 
-// ϊs̎擾
+// 変換行列の取得
 Matrix Actor::pose() const
 {
 	return Matrix(rotation_).Translation(position_);
 }
 
-// Փ˔f[^̎擾
+// 衝突判定データの取得
 IBodyPtr Actor::body() const
 {
 	return body_->transform(pose());
 }
 
-// ̗͂̎擾
+// 体力の取得
 int Actor::get_HP()
 {
 	return 0;
@@ -105,6 +112,12 @@ int Actor::get_HP()
 
 Vector3 Actor::get_velocity()
 {
-	// ړʂ̎擾
+	// 移動量の取得
 	return Vector3();
 }
+
+// 描画範囲の境界球の取得（持たない場合はfalseを返し、カリングされない）
+bool Actor::bounding_sphere(Vector3& center, float& radius) const
+{
+	return false;
+}
\ No newline at end of file
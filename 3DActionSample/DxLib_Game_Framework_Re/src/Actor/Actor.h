@@ -7,8 +7,8 @@
 #include "../Actor/Body/IBodyPtr.h"
 #include "../Actor/Body/DummyBody.h"
 
-// NXFAN^[
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：アクター
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
 class IWorld;
 enum class EventMessage;
@@ -16,68 +16,74 @@ enum class EventMessage;
 class Actor
 {
 public:
-	// RXgN^
+	// コンストラクタ
 	Actor();
-	// RXgN^
+	// コンストラクタ
 	Actor(IWorld* world, const std::string& name, const Vector3& position = Vector3::Zero, const IBodyPtr& body = std::shared_ptr<DummyBody>());
-	// zfXgN^
+	// 仮想デストラクタ
 	virtual ~Actor();
 
 public:
-	// XV
+	// 更新
 	virtual void update(float delta_time);
-	// `
+	// 描画
 	virtual void draw() const;
-	// Փ˃ANV
+	// 衝突リアクション
 	virtual void react(Actor& other);
-	// bZ[W
+	// メッセージ処理
 	virtual void handle_message(EventMessage message, void* param = nullptr);
-	// Փ˔
+	// 衝突判定
 	void collide(Actor& other);
-	// S
+	// 死亡
 	void die();
-	// Փ˂Ă邩
+	// 衝突しているか
 	bool is_collided(const Actor& other) const;
-	// SĂ邩
+	// 死亡しているか
 	bool is_dead() const;
 
-	// Öړw
+	// 外部からの移動指令
 	void move_order(Vector3 vector);
 
-	// O̎擾
+	// IDの取得
+	unsigned int id() const;
+	// 名前の取得
 	const std::string& name() const;
-	// W̎擾
+	// 座標の取得
 	Vector3 position() const;
-	// ]s̎擾
+	// 回転行列の取得
 	Matrix rotation() const;
-	// ϊs̎擾
+	// 変換行列の取得
 	Matrix pose() const;
-	// Փ˔f[^̎擾
+	// 衝突判定データの取得
 	IBodyPtr body() const;
 
-	// ̗͂̎擾
+	// 体力の取得
 	virtual int get_HP();
-	// ړʂ̎擾
+	// 移動量の取得
 	virtual Vector3 get_velocity();
+	// 描画範囲の境界球の取得（持たない場合はfalseを返し、カリングされない）
+	virtual bool bounding_sphere(Vector3& center, float& radius) const;
 
-	// Rs[֎~
+	// コピー禁止
 	Actor(const Actor& other) = delete;
 	Actor& operator = (const Actor& other) = delete;
 
 protected:
-	// [h
+	// ワールド
 	IWorld*			world_{ nullptr };
-	// O
+	// ID（ワールドへの生成順に採番、ワールドなしは0）
+	unsigned int	id_{ 0 };
+	// 名前
 	std::string		name_;
-	// W
+	// 座標
 	Vector3			position_{ Vector3::Zero };
-	// ]s
+	// 回転行列
 	Matrix			rotation_{ Matrix::Identity };
-	// ړ
+	// 移動量
 	Vector3			velocity_{ Vector3::Zero };
-	// Փ˔f[^
+	// 衝突判定データ
 	IBodyPtr		body_;
-	// StO
+	// 死亡フラグ
 	bool			is_dead_{ false };
 };
 
@@ -1,16 +1,16 @@
 #ifndef ACTOR_GROUP_H_
 #define ACTOR_GROUP_H_
 
-// 񋓌^FAN^[O[v
-// ҁF Qi"Jacky" Ho Siu Kij
+// 列挙型：アクターグループ
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 enum class ActorGroup
 {
-	None,			// 
-	Player,			// vC[
-	PlayerAttack,	// vC[̍U
-	Enemy,			// G
-	EnemyAttack,	// G̍U
-	Effect,			// GtFNg
+	None,			// 所属無し
+	Player,			// プレイヤー
+	PlayerAttack,	// プレイヤーの攻撃
+	Enemy,			// 敵
+	EnemyAttack,	// 敵の攻撃
+	Effect,			// エフェクト
 	UI,				// UI
 };
 
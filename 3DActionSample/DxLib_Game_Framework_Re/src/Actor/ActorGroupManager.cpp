@@ -1,21 +1,21 @@
 #include "ActorGroupManager.h"
 
-// NXFAN^[O[vǗ
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：アクターグループ管理
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
-// O[v̒ǉ
+// グループの追加
 void ActorGroupManager::add_group(ActorGroup group)
 {
 	actor_group_map_[group].clear();
 }
 
-// AN^[̒ǉ
+// アクターの追加
 void ActorGroupManager::add_actor(ActorGroup group, const ActorPtr& actor)
 {
 	actor_group_map_[group].add(actor);
 }
 
-// XV
+// 更新
 void ActorGroupManager::update(float delta_time)
 {
 	for (auto& pair : actor_group_map_)
@@ -24,7 +24,7 @@ void ActorGroupManager::update(float delta_time)
 	}
 }
 
-// `
+// 描画
 void ActorGroupManager::draw() const
 {
 	for (auto& pair : actor_group_map_)
@@ -33,49 +33,55 @@ void ActorGroupManager::draw() const
 	}
 }
 
-// `
+// 描画
 void ActorGroupManager::draw(ActorGroup group) const
 {
 	actor_group_map_.at(group).draw();
 }
 
-// 
+// 視錐台カリングして描画
+void ActorGroupManager::draw(ActorGroup group, FrustumCulling& culling) const
+{
+	actor_group_map_.at(group).draw(culling);
+}
+
+// 消去
 void ActorGroupManager::clear()
 {
 	actor_group_map_.clear();
 }
 
-// AN^[̎擾
+// アクターの取得
 ActorPtr ActorGroupManager::find(ActorGroup group, const std::string& name) const
 {
 	return actor_group_map_.at(group).find(name);
 }
 
-// AN^[̎擾
+// アクター数の取得
 unsigned int ActorGroupManager::count(ActorGroup group) const
 {
 	return actor_group_map_.at(group).count();
 }
 
-// AN^[Xg̏
+// アクターリストの巡回
 void ActorGroupManager::each(ActorGroup group, std::function<void(const ActorPtr&)> fn) const
 {
 	actor_group_map_.at(group).each(fn);
 }
 
-// Փ˔
+// 衝突判定
 void ActorGroupManager::collide(ActorGroup group1, ActorGroup group2)
 {
 	actor_group_map_[group1].collide(actor_group_map_[group2]);
 }
 
-// O[v̏Փ˔
+// 同じグループ内の衝突判定
 void ActorGroupManager::collide(ActorGroup group)
 {
 	actor_group_map_[group].collide();
 }
 
-// 폜
+// 削除
 void ActorGroupManager::remove()
 {
 	for (auto& pair : actor_group_map_)
@@ -84,7 +90,7 @@ void ActorGroupManager::remove()
 	}
 }
 
-// bZ[W
+// メッセージ処理
 void ActorGroupManager::handle_message(EventMessage message, void* param)
 {
 	for (auto& pair : actor_group_map_)
@@ -5,53 +5,56 @@
 #include <map>
 #include <functional>
 
-// NXFAN^[O[vǗ
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：アクターグループ管理
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
 enum class ActorGroup;
+class FrustumCulling;
 
 class ActorGroupManager
 {
 private:
-	// AN^[O[v}bv
+	// アクターグループマップ
 	using ActorGroupMap = std::map<ActorGroup, ActorManager>;
 
 public:
-	// ftHgRXgN^
+	// デフォルトコンストラクタ
 	ActorGroupManager() = default;
-	// O[v̒ǉ
+	// グループの追加
 	void add_group(ActorGroup group);
-	// AN^[̒ǉ
+	// アクターの追加
 	void add_actor(ActorGroup group, const ActorPtr& actor);
-	// XV
+	// 更新
 	void update(float delta_time);
-	// `
+	// 描画
 	void draw() const;
-	// `
+	// 描画
 	void draw(ActorGroup group) const;
-	// 
+	// 視錐台カリングして描画
+	void draw(ActorGroup group, FrustumCulling& culling) const;
+	// 消去
 	void clear();
-	// AN^[̎擾
+	// アクターの取得
 	ActorPtr find(ActorGroup group, const std::string& name) const;
-	// AN^[̎擾
+	// アクター数の取得
 	unsigned int count(ActorGroup group) const;
-	// AN^[Xg̏
+	// アクターリストの巡回
 	void each(ActorGroup group, std::function<void(const ActorPtr&)> fn) const;
-	// Փ˔
+	// 衝突判定
 	void collide(ActorGroup group1, ActorGroup group2);
-	// O[v̏Փ˔
+	// 同じグループ内の衝突判定
 	void collide(ActorGroup group);
-	// 폜
+	// 削除
 	void remove();
-	// bZ[W
+	// メッセージ処理
 	void handle_message(EventMessage message, void* param);
 
-	// Rs[֎~
+	// コピー禁止
 	ActorGroupManager(const ActorGroupManager& other) = delete;
 	ActorGroupManager& operator = (const ActorGroupManager& other) = delete;
 
 private:
-	// AN^[O[v}bv
+	// アクターグループマップ
 	ActorGroupMap actor_group_map_;
 };
 
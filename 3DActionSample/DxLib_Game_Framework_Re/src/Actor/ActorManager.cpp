@@ -1,15 +1,16 @@
 #include "ActorManager.h"
+#include "../Graphic/FrustumCulling.h"
 
-// NXFAN^[Ǘ
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：アクター管理
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
-// AN^[̒ǉ
+// アクターの追加
 void ActorManager::add(const ActorPtr& actor)
 {
 	actors_.push_front(actor);
 }
 
-// XV
+// 更新
 void ActorManager::update(float delta_time)
 {
 	for (const auto& actor : actors_)
@@ -18,7 +19,7 @@ void ActorManager::update(float delta_time)
 	}
 }
 
-// `
+// 描画
 void ActorManager::draw() const
 {
 	for (const auto& actor : actors_)
@@ -27,7 +28,35 @@ void ActorManager::draw() const
 	}
 }
 
-// Փ˔
+// 視錐台カリングして描画
+void ActorManager::draw(FrustumCulling& culling) const
+{
+	// 境界球を持つアクターを判定対象に登録し、持たないアクターはそのまま描画
+	culling.clear();
+	candidates_.clear();
+	for (const auto& actor : actors_)
+	{
+		Vector3 center;
+		float radius;
+		if (actor->bounding_sphere(center, radius))
+		{
+			culling.add(center, radius);
+			candidates_.push_back(actor.get());
+		}
+		else
+		{
+			actor->draw();
+		}
+	}
+
+	// 視錐台と交差するアクターのみ描画
+	for (const auto index : culling.cull())
+	{
+		candidates_[index]->draw();
+	}
+}
+
+// 衝突判定
 void ActorManager::collide()
 {
 	for (auto i = actors_.begin(); i != actors_.end(); ++i)
@@ -39,7 +68,7 @@ void ActorManager::collide()
 	}
 }
 
-// Փ˔
+// 衝突判定
 void ActorManager::collide(Actor& other)
 {
 	for (const auto& actor : actors_)
@@ -48,7 +77,7 @@ void ActorManager::collide(Actor& other)
 	}
 }
 
-// Փ˔
+// 衝突判定
 void ActorManager::collide(ActorManager& other)
 {
 	for (const auto& actor : actors_)
@@ -57,14 +86,14 @@ void ActorManager::collide(ActorManager& other)
 	}
 }
 
-// 폜
+// 削除
 void ActorManager::remove()
 {
-	// SAN^[폜
+	// 死亡したアクターを削除
 	actors_.remove_if([](const ActorPtr& actor) {return actor->is_dead(); });
 }
 
-// AN^[̎擾
+// アクターの取得
 ActorPtr ActorManager::find(const std::string& name) const
 {
 	for (const auto& actor : actors_)
@@ -78,13 +107,13 @@ ActorPtr ActorManager::find(const std::string& name) const
 	return nullptr;
 }
 
-// AN^[̎擾
+// アクター数の取得
 unsigned int ActorManager::count() const
 {
 	return actors_.size();
 }
 
-// AN^[Xg̏
+// アクターリストの巡回
 void ActorManager::each(std::function<void(const ActorPtr&)> fn) const
 {
 	for (const auto& actor : actors_)
@@ -93,7 +122,7 @@ void ActorManager::each(std::function<void(const ActorPtr&)> fn) const
 	}
 }
 
-// bZ[W
+// メッセージ処理
 void ActorManager::handle_message(EventMessage message, void* param)
 {
 	for (const auto& actor : actors_)
@@ -102,9 +131,9 @@ void ActorManager::handle_message(EventMessage message, void* param)
 	}
 }
 
-// 
+// 消去
 void ActorManager::clear()
 {
-	// AN^[Xg̓eSď
+	// アクターリストの内容を全て消去
 	actors_.clear();
 }
\ No newline at end of file
@@ -4,54 +4,60 @@
 #include "Actor.h"
 #include "ActorPtr.h"
 #include <list>
+#include <vector>
 #include <functional>
 
-// NXFAN^[Ǘ
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：アクター管理
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
 enum class EventMessage;
+class FrustumCulling;
 
 class ActorManager
 {
 private:
-	// AN^[Xg
+	// アクターリスト
 	using ActorList = std::list<ActorPtr>;
 
 public:
-	// ftHgRXgN^
+	// デフォルトコンストラクタ
 	ActorManager() = default;
-	// AN^[̒ǉ
+	// アクターの追加
 	void add(const ActorPtr& actor);
-	// XV
+	// 更新
 	void update(float delta_time);
-	// `
+	// 描画
 	void draw() const;
-	// Փ˔
+	// 視錐台カリングして描画
+	void draw(FrustumCulling& culling) const;
+	// 衝突判定
 	void collide();
-	// Փ˔
+	// 衝突判定
 	void collide(Actor& other);
-	// Փ˔
+	// 衝突判定
 	void collide(ActorManager& other);
-	// 폜
+	// 削除
 	void remove();
-	// AN^[̎擾
+	// アクターの取得
 	ActorPtr find(const std::string& name) const;
-	// AN^[̎擾
+	// アクター数の取得
 	unsigned int count() const;
-	// AN^[Xg̏
+	// アクターリストの巡回
 	void each(std::function<void(const ActorPtr&)>fn) const;
-	// bZ[W
+	// メッセージ処理
 	void handle_message(EventMessage message, void* param);
-	// 
+	// 消去
 	void clear();
 
-	// Rs[֎~
+	// コピー禁止
 	ActorManager(const ActorManager& other) = delete;
 	ActorManager& operator = (const ActorManager& other) = delete;
 
 private:
-	// AN^[Xg
+	// アクターリスト
 	ActorList actors_;
+	// カリングの判定対象のアクター
+	mutable std::vector<const Actor*> candidates_;
 };
 
 #endif // !ACTOR_MANAGER_H_
\ No newline at end of file
@@ -3,12 +3,12 @@
 
 #include <memory>
 
-// |C^FAN^[
-// ҁF Qi"Jacky" Ho Siu Kij
+// ポインタ：アクター
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 class Actor;
 using ActorPtr = std::shared_ptr<Actor>;
 
-// AN^[̐
+// アクターの生成
 template<class T, class... Args>
 inline ActorPtr new_actor(Args&&... args)
 {
@@ -3,14 +3,14 @@
 
 #include "../Math/Vector3.h"
 
-// \́FUp[^
-// ҁF Qi"Jacky" Ho Siu Kij
+// 構造体：攻撃パラメータ
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 struct AttackParameter
 {
-	Vector3	position{ Vector3::Zero };	// RC_[̈ʒu
-	int		power{ 0 };					// U
-	int		impact{ 0 };				// ݒlivC[̂ݎgpj
-	float	hit_stop{ 0.0f };			// qbgXgbvivC[̂ݎgpj
+	Vector3	position{ Vector3::Zero };	// コライダーの位置
+	int		power{ 0 };					// 攻撃力
+	int		impact{ 0 };				// 怯み値（プレイヤーのみ使用）
+	float	hit_stop{ 0.0f };			// ヒットストップ（プレイヤーのみ使用）
 };
 
 #endif // !ATTACK_PARAMETER_H_
\ No newline at end of file
@@ -5,52 +5,52 @@
 #include "../../Math/Vector3.h"
 #include "../../Math/Matrix.h"
 
-// NXFՓ˔
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：衝突判定
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 class Body : public IBody
 {
 public:
-	// RXgN^
+	// コンストラクタ
 	Body();
-	// ̂̃RXgN^
+	// 球体のコンストラクタ
 	Body(const ShapeType& type, const Vector3& position, const float radius);
-	// JvZ̃RXgN^
+	// カプセルのコンストラクタ
 	Body(const ShapeType& type, const Vector3& position, const Matrix& matrix, const float radius, const float length);
-	// fXgN^
+	// デストラクタ
 	~Body();
 
-	// ڐGOn,Off
+	// 接触判定のOn,Off
 	virtual void set_active(bool active) override;
-	// ڐG͗Lł邩
+	// 接触判定は有効であるか
 	virtual bool is_enable() const override;
-	// `̎擾
+	// 形状の取得
 	virtual ShapeType type() const override;
-	// SW̎擾
+	// 中心座標の取得
 	virtual Vector3 position() const override;
-	// ϊs̎擾
+	// 変換行列の取得
 	virtual Matrix matrix() const override;
-	// a̎擾
+	// 半径の取得
 	virtual float radius() const override;
-	// ̎擾
+	// 長さの取得
 	virtual float length() const override;
 
-	// _̎擾
+	// 頂点の取得
 	virtual Vector3 points(const int index) const override;
 
 protected:
-	// Փ˔̌`
+	// 衝突判定の形状
 	ShapeType	type_;
-	// SW
+	// 中心座標
 	Vector3		position_;
-	// ϊs
+	// 変換行列
 	Matrix		matrix_;
-	// a
+	// 半径
 	float		radius_;
-	// 
+	// 長さ
 	float		length_;
-	// _
+	// 頂点
 	Vector3		points_[4];
-	// ڐG͗Lł邩
+	// 接触判定は有効であるか
 	bool		is_enable_;
 };
 
@@ -2,10 +2,10 @@
 #include "BoundingSphere.h"
 #include "../../Math/Collision/Collision.h"
 
-// NXFՓ˔pJvZ
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：衝突判定用カプセル
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
-// RXgN^
+// コンストラクタ
 BoundingCapsule::BoundingCapsule(const Vector3& position, const Matrix& matrix, const float radius, const float length) :
 	Body(ShapeType::Capsule, position, matrix, radius, length)
 {
@@ -13,43 +13,43 @@ BoundingCapsule::BoundingCapsule(const Vector3& position, const Matrix& matrix,
 	points_[1] = position - Vector3::Up * (length * 0.5f);
 }
 
-// sړ
+// 平行移動
 IBodyPtr BoundingCapsule::translate(const Vector3& position) const
 {
 	return std::make_shared<BoundingCapsule>(translate_e(position));
 }
 
-// Wϊ
+// 座標変換
 IBodyPtr BoundingCapsule::transform(const Matrix& matrix) const
 {
 	return std::make_shared<BoundingCapsule>(transform_e(matrix));
 }
 
-// Փ˔
+// 衝突判定
 bool BoundingCapsule::is_collided(const IBody& other) const
 {
-	// ǂ炩̔肪ł΁AfalseԂ
+	// どちらかの判定が無効であれば、falseを返す
 	if (!is_enable() || !other.is_enable()) return false;
 
 	return other.intersects(*this);
 }
 
-// JvZƂ̏Փ˔
+// カプセルとの衝突判定
 bool BoundingCapsule::intersects(const BoundingCapsule& other) const
 {
 	return Collision::capsule_to_capsule(position_, matrix_, length_, radius_, other.position_, other.matrix_, other.length_, other.radius_);
 }
 
-// ̂Ƃ̏Փ˔
+// 球体との衝突判定
 bool BoundingCapsule::intersects(const BoundingSphere& other) const
 {
 	return Collision::sphere_to_capsule(other.position(), other.radius(), position_, matrix_, length_, radius_);
 }
 
-// `
+// 描画
 void BoundingCapsule::draw() const
 {
-	// fobOł`悵Ȃ
+	// デバッグ中でしか描画しない
 #ifdef _DEBUG
 
 	Vector3 p[2];
@@ -60,14 +60,16 @@ void BoundingCapsule::draw() const
 #endif
 }
 
-// sړ
+// 平行移動
 BoundingCapsule BoundingCapsule::translate_e(const Vector3& position) const
 {
 	return BoundingCapsule(position_ + position, matrix_, length_, radius_);
 }
 
-// Wϊ
+// 座標変換
 BoundingCapsule BoundingCapsule::transform_e(const Matrix& matrix) const
 {
-	return BoundingCapsule(position_ + matrix.Translation(), matrix_ * matrix.RotationMatrix(), length_ * matrix.Scale().y, radius_ * matrix.Scale().x);
+	const Vector3 scale = matrix.Scale();
+
+	return BoundingCapsule(position_ + matrix.Translation(), matrix_ * matrix.RotationMatrix(), length_ * scale.y, radius_ * scale.x);
 }
\ No newline at end of file
@@ -5,29 +5,29 @@
 #include "../../Math/Vector3.h"
 #include "../../Math/Matrix.h"
 
-// NXFՓ˔pJvZ
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：衝突判定用カプセル
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 class BoundingCapsule : public Body
 {
 public:
-	// RXgN^
+	// コンストラクタ
 	BoundingCapsule(const Vector3& position, const Matrix& matrix, const float radius, const float length);
-	// sړ
+	// 平行移動
 	virtual IBodyPtr translate(const Vector3& position) const override;
-	// Wϊ
+	// 座標変換
 	virtual IBodyPtr transform(const Matrix& matrix) const override;
-	// Փ˔
+	// 衝突判定
 	virtual bool is_collided(const IBody& other) const override;
-	// JvZƂ̏Փ˔
+	// カプセルとの衝突判定
 	virtual bool intersects(const BoundingCapsule& other) const override;
-	// ̂Ƃ̏Փ˔
+	// 球体との衝突判定
 	virtual bool intersects(const BoundingSphere& other) const override;
-	// `
+	// 描画
 	virtual void draw() const override;
 
-	// sړ
+	// 平行移動
 	BoundingCapsule translate_e(const Vector3& position) const;
-	// Wϊ
+	// 座標変換
 	BoundingCapsule transform_e(const Matrix& matrix) const;
 };
 
@@ -4,29 +4,29 @@
 #include "Body.h"
 #include "../../Math/Vector3.h"
 
-// NXFՓ˔p
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：衝突判定用球体
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 class BoundingSphere : public Body
 {
 public:
-	// RXgN^
+	// コンストラクタ
 	BoundingSphere(const Vector3& position, const float radius);
-	// sړ
+	// 平行移動
 	virtual IBodyPtr translate(const Vector3& position) const override;
-	// Wϊ
+	// 座標変換
 	virtual IBodyPtr transform(const Matrix& matrix) const override;
-	// Փ˔
+	// 衝突判定
 	virtual bool is_collided(const IBody& other) const override;
-	// ̂Ƃ̏Փ˔
+	// 球体との衝突判定
 	virtual bool intersects(const BoundingSphere& other) const override;
-	// JvZƂ̏Փ˔
+	// カプセルとの衝突判定
 	virtual bool intersects(const BoundingCapsule& other) const override;
-	// `
+	// 描画
 	virtual void draw() const override;
 
-	// sړ
+	// 平行移動
 	BoundingSphere translate_e(const Vector3& position) const;
-	// Wϊ
+	// 座標変換
 	BoundingSphere transform_e(const Matrix& matrix) const;
 };
 
@@ -3,24 +3,24 @@
 
 #include "Body.h"
 
-// NXF_~[̏Փ˔
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：ダミーの衝突判定
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 class DummyBody : public Body
 {
 public:
-	// RXgN^
+	// コンストラクタ
 	DummyBody() { }
-	// sړ
+	// 平行移動
 	virtual IBodyPtr translate(const Vector3& position) const override { return std::make_shared<DummyBody>(); }
-	// Wϊ
+	// 座標変換
 	virtual IBodyPtr transform(const Matrix& matrix) const override { return std::make_shared<DummyBody>(); }
-	// Փ˔
+	// 衝突判定
 	virtual bool is_collided(const IBody& other) const override { return false; }
-	// ̂Ƃ̏Փ˔
+	// 球体との衝突判定
 	virtual bool intersects(const BoundingSphere& other) const override { return false; }
-	// JvZƂ̏Փ˔
+	// カプセルとの衝突判定
 	virtual bool intersects(const BoundingCapsule& other) const override { return false; }
-	// `
+	// 描画
 	virtual void draw() const override { }
 };
 
@@ -4,8 +4,8 @@
 #include "IBodyPtr.h"
 #include "ShapeType.h"
 
-// C^[tF[XFՓ˔
-// ҁF Qi"Jacky" Ho Siu Kij
+// インターフェース：衝突判定
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
 struct Vector3;
 struct Matrix;
@@ -16,40 +16,40 @@ class BoundingCapsule;
 class IBody
 {
 public:
-	// RXgN^
+	// コンストラクタ
 	IBody() { };
-	// zfXgN^
+	// 仮想デストラクタ
 	virtual ~IBody() = default;
 
-	// sړ
+	// 平行移動
 	virtual IBodyPtr translate(const Vector3& position) const = 0;
-	// Wϊ
+	// 座標変換
 	virtual IBodyPtr transform(const Matrix& matrix) const = 0;
-	// Փ˔
+	// 衝突判定
 	virtual bool is_collided(const IBody& other) const = 0;
-	// ̂Ƃ̏Փ˔
+	// 球体との衝突判定
 	virtual bool intersects(const BoundingSphere& other) const = 0;
-	// JvZƂ̏Փ˔
+	// カプセルとの衝突判定
 	virtual bool intersects(const BoundingCapsule& other) const = 0;
 
-	// ڐGOn,Off
+	// 接触判定のOn,Off
 	virtual void set_active(bool active) = 0;
-	// ڐG͗Lł邩
+	// 接触判定は有効であるか
 	virtual bool is_enable() const = 0;
-	// `
+	// 描画
 	virtual void draw() const = 0;
-	// `̎擾
+	// 形状の取得
 	virtual ShapeType type() const = 0;
-	// SW̎擾
+	// 中心座標の取得
 	virtual Vector3 position() const = 0;
-	// ϊs̎擾
+	// 変換行列の取得
 	virtual Matrix matrix() const = 0;
-	// a̎擾
+	// 半径の取得
 	virtual float radius() const = 0;
-	// ̎擾
+	// 長さの取得
 	virtual float length() const = 0;
 
-	// _̎擾
+	// 頂点の取得
 	virtual Vector3 points(const int index) const = 0;
 
 };
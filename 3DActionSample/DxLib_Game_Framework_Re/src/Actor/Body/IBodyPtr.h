@@ -3,8 +3,8 @@
 
 #include <memory>
 
-// |C^FՓ˔C^[tF[X
-// ҁF Qi"Jacky" Ho Siu Kij
+// ポインタ：衝突判定インターフェース
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 class IBody;
 using IBodyPtr = std::shared_ptr<IBody>;
 
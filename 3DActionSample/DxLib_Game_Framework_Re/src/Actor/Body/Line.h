@@ -3,19 +3,19 @@
 
 #include "../../Math/Vector3.h"
 
-// NXF
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：線分
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 class Line
 {
 public:
-	// ftHgRXgN^
+	// デフォルトコンストラクタ
 	Line() = default;
-	// RXgN^
+	// コンストラクタ
 	Line(const Vector3& start, const Vector3& end) :
 		start{ start }, end{ end } { }
-	// n_
+	// 始点
 	Vector3 start{ 0.0f,0.0f,0.0f };
-	// I_
+	// 終点
 	Vector3 end{ 0.0f,0.0f,0.0f };
 };
 
@@ -3,19 +3,19 @@
 
 #include "../../Math/Vector3.h"
 
-// NXFC
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：レイ
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 class Ray
 {
 public:
-	// ftHgRXgN^
+	// デフォルトコンストラクタ
 	Ray() = default;
-	// RXgN^
+	// コンストラクタ
 	Ray(const Vector3& position, Vector3& direction) :
 		position{ position }, direction{ direction } { }
-	// W
+	// 座標
 	Vector3 position{ 0.0f, 0.0f, 0.0f };
-	// 
+	// 方向
 	Vector3 direction{ 0.0f, 0.0f, 0.0f };
 };
 
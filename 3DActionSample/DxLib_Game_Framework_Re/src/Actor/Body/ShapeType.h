@@ -1,13 +1,13 @@
 #ifndef SHAPE_TYPE_H_
 #define SHAPE_TYPE_H_
 
-// 񋓌^FՓ˔`
-// ҁF Qi"Jacky" Ho Siu Kij
+// 列挙型：衝突判定形状
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 enum class ShapeType
 {
-	None,		// 
-	Sphere,		// 
-	Capsule,	// JvZ
+	None,		// 無し
+	Sphere,		// 球体
+	Capsule,	// カプセル
 };
 
 #endif // !SHAPE_TYPE_H_
\ No newline at end of file
@@ -2,23 +2,23 @@
 #include "../../World/IWorld.h"
 #include "../../Graphic/Graphics3D.h"
 
-// RXgN^
+// コンストラクタ
 FreeCamera::FreeCamera(IWorld* world, const Vector3& position, const Matrix& rotation) :
 	Actor(world, "Camera", position)
 {
 	rotation_ = rotation;
 }
 
-// XV
+// 更新
 void FreeCamera::update(float delta_time)
 {
 
 }
 
-// `
+// 描画
 void FreeCamera::draw() const
 {
-	// Jݒ
+	// カメラを設定
 	Graphics3D::set_view_matrix(Matrix::CreateLookAt(pose().Translation(), pose().Translation() + pose().Forward(), { 0.0f, 1.0f, 0.0f }));
 	Graphics3D::set_projection_matrix(Matrix::CreatePerspectiveFieldOfView(45.0f, 640.0f / 480.0f, 0.3f, 1000.0f));
 }
\ No newline at end of file
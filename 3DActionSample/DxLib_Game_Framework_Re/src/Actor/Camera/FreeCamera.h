@@ -3,18 +3,18 @@
 
 #include "../Actor.h"
 
-// NXFJiRɓj
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：カメラ（自由に動かせる）
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 class FreeCamera : public Actor
 {
 public:
-	// RXgN^
+	// コンストラクタ
 	FreeCamera(IWorld* world, const Vector3& position, const Matrix& rotation);
 
 private:
-	// XV
+	// 更新
 	void update(float delta_time) override;
-	// `
+	// 描画
 	void draw() const override;
 };
 
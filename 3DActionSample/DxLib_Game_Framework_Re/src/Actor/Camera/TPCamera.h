@@ -6,83 +6,83 @@
 #include "../../Math/CountdownTimer.h"
 #include "../../Math/Random.h"
 
-// NXFOl̃J
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：三人称カメラ
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
-// J̏ԗ
+// カメラの状態列挙
 enum TPCameraState
 {
-	Normal,		// ʏ
-	Reset,		// Zbg
+	Normal,		// 通常
+	Reset,		// リセット
 };
 
 class TPCamera : public Actor
 {
 private:
-	// e萔
-	const float YawSpeed{ 3.0f };			// J̍E]x
-	const float PitchSpeed{ 1.5f };			// J̏㉺]x
-	const float CameraHeight{ 22.0f };		// _̍
-	const float CameraDistance{ 60.0f };	// _Ƃ̋
-	const float PitchMax{ 15.0f };			// pől
-	const float PitchMin{ -20.0f };			// pŏl
-	const float VibrationTime{ 20.0f };		// J̐U
-	const float VibrationPower{ 0.3f };		// J̐U
+	// 各種定数
+	const float YawSpeed{ 3.0f };			// カメラの左右回転速度
+	const float PitchSpeed{ 1.5f };			// カメラの上下回転速度
+	const float CameraHeight{ 22.0f };		// 注視点の高さ
+	const float CameraDistance{ 60.0f };	// 注視点との距離
+	const float PitchMax{ 15.0f };			// 仰角最大値
+	const float PitchMin{ -20.0f };			// 仰角最小値
+	const float VibrationTime{ 20.0f };		// カメラの振動時間
+	const float VibrationPower{ 0.3f };		// カメラの振動力
 
 public:
-	// RXgN^
+	// コンストラクタ
 	TPCamera(IWorld* world);
-	// bZ[W
+	// メッセージ処理
 	virtual void handle_message(EventMessage message, void* param = nullptr) override;
 
 private:
-	// XV
+	// 更新
 	void update(float delta_time) override;
-	// `
+	// 描画
 	void draw() const override;
 
 private:
-	// Ԃ̍XV
+	// 状態の更新
 	void update_state(float delta_time);
-	// ʏԂł̍XV
+	// 通常状態での更新
 	void normal(float delta_time);
-	// JZbg̍XV
+	// カメラリセット中の更新
 	void reset(float delta_time);
-	// vC[Ǐ]Ĉړ
+	// プレイヤーを追従して移動
 	void move();
-	// ]
+	// 回転処理
 	void rotate(float delta_time);
-	// ǂƂ̐ڐG
+	// 壁との接触処理
 	void intersect_wall();
-	// J̏㉺U
+	// カメラの上下振動
 	void camera_vibration_V(float delta_time);
-	// UJn
+	// 振動開始
 	void start_vibration();
 
-	// JZbgJn
+	// カメラリセット開始
 	void start_reset();
 
-	// vC[̎QƂ̎擾
+	// プレイヤーの参照の取得
 	ActorPtr get_player();
-	// vC[̊px̎擾itj
+	// プレイヤー向きの角度の取得（符号付き）
 	float get_angle_to_target(Vector3 target) const;
-	// vC[̊px̎擾ij
+	// プレイヤー向きの角度の取得（符号無し）
 	float get_unsigned_angle_to_target(Vector3 target) const;
 
 
 private:
-	TPCameraState	state_{ TPCameraState::Normal };		// J̏
-	Vector3			target_;								// _ivC[j
-	float			yaw_angle_{ 0.0f };						// ypx
-	float			pitch_angle_{ 0.0f };					// xpx
+	TPCameraState	state_{ TPCameraState::Normal };		// カメラの状態
+	Vector3			target_;								// 注視点（プレイヤー）
+	float			yaw_angle_{ 0.0f };						// y軸角度
+	float			pitch_angle_{ 0.0f };					// x軸角度
 
-	CountdownTimer	vibration_timer_{ VibrationTime };		// JU^C}[
-	float			current_power_{ VibrationPower };		// ݂̐U
-	float			min_pos_y_{ 0.0f };						// UyŏW
-	float			max_pos_y_{ 0.0f };						// UyőW
-	Random			rand_;									// 
+	CountdownTimer	vibration_timer_{ VibrationTime };		// カメラ振動タイマー
+	float			current_power_{ VibrationPower };		// 現在の振動力
+	float			min_pos_y_{ 0.0f };						// 振動時のy軸最小座標
+	float			max_pos_y_{ 0.0f };						// 振動時のy軸最大座標
+	Random			rand_;									// 乱数生成器
 
-	Vector3			target_backward_;						// vC[̔wW
+	Vector3			target_backward_;						// プレイヤーの背後座標
 };
 
 #endif // !T_P_CAMERA_H_
\ No newline at end of file
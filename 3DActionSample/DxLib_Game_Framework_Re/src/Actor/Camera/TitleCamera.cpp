@@ -3,45 +3,45 @@
 #include "../../Graphic/Graphics3D.h"
 #include "../../Game/WindowSetting.h"
 
-// RXgN^
+// コンストラクタ
 TitleCamera::TitleCamera(IWorld* world, const Vector3& position) :
 	Actor(world, "Camera", position)
 {
 	rotation_ = Matrix::Identity;
 }
 
-// XV
+// 更新
 void TitleCamera::update(float delta_time)
 {
-	// J̈ʒuݒ
+	// カメラの位置を設定
 	position_ = Vector3(0.0f, CameraHeight, CameraDistance) + target_;
-	// ړA]
+	// 移動、回転処理
 	rotate(delta_time);
 }
 
-// `
+// 描画
 void TitleCamera::draw() const
 {
-	// Jݒ
+	// カメラを設定
 	Graphics3D::set_view_matrix(Matrix::CreateLookAt(pose().Translation(), pose().Translation() + rotation_.Forward(), rotation_.Up()));
 	float width = WindowSetting::WindowWidth;
 	float height = WindowSetting::WindowHeight;
 	Graphics3D::set_projection_matrix(Matrix::CreatePerspectiveFieldOfView(45.0f, width / height, 0.3f, 1000.0f));
 }
 
-// J̈ړA]
+// カメラの移動、回転
 void TitleCamera::rotate(float delta_time)
 {
-	// J̊{WƉ]pxݒ
+	// カメラの基本座標と回転角度を設定
 	auto position = Vector3{ 0.0f, 0.0f, CameraDistance } *(Matrix::CreateRotationX(pitch_angle_) * Matrix::CreateRotationY(yaw_angle_));
 	
-	// J̍WɍZ
+	// カメラの座標に高さを加算
 	position_ = position + target_ + Vector3(0.0f, CameraHeight, 0.0f);
-	// J̒_ivC[̍WjɍZ
+	// カメラの注視点（プレイヤーの座標）に高さを加算
 	auto view_point = target_ + Vector3(0.0f, CameraHeight, 0.0f);
-	// J̉]𔽉f
+	// カメラの回転を反映
 	rotation_ = Matrix::CreateWorld(Vector3::Zero, view_point - position_, Vector3::Up);
 
-	// J]
+	// カメラを回転させる
 	yaw_angle_ += RotateSpeed * delta_time;
 }
\ No newline at end of file
@@ -3,14 +3,14 @@
 
 #include "../Math/Vector3.h"
 
-// _[W\
-// ҁF Qi"Jacky" Ho Siu Kij
+// ダメージ構造体
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
 struct Damage
 {
-	Vector3 position{ Vector3::Zero };	// Üʒu
-	int power{ 0 };						// U
-	int impact{ 0 };					// ݒliGɂ̂ݎgj
+	Vector3 position{ Vector3::Zero };	// 攻撃判定の位置
+	int power{ 0 };						// 攻撃力
+	int impact{ 0 };					// 怯み値（敵にのみ使う）
 };
 
 #endif // !DAMAGE_H_
\ No newline at end of file
@@ -0,0 +1,115 @@
+#include "ParticleEmitter.h"
+#include "../../World/IWorld.h"
+#include "../../Graphic/ParticleSystem.h"
+#include "../../ID/SourceID.h"
+
+// クラス：パーティクルエミッター
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+
+// 構造体：エフェクトごとの発生設定
+struct ParticleEffectPreset
+{
+	ParticleEmitterDesc	desc;				// パーティクルの設定
+	int					burst{ 0 };			// 生成時に発生させる数
+	float				rate{ 0.0f };		// 1フレームあたりに発生させる数
+	float				duration{ 0.0f };	// 持続時間（フレーム）
+};
+
+// エフェクトごとの発生設定を作成
+static ParticleEffectPreset make_preset(ParticleEffect effect)
+{
+	ParticleEffectPreset preset;
+	auto& desc = preset.desc;
+	desc.texture = BILLBOARD_PARTICLE;
+	switch (effect)
+	{
+	case ParticleEffect::Hit:
+		desc.additive = true;
+		desc.spread = 60.0f;
+		desc.speed_min = 0.8f;
+		desc.speed_max = 1.8f;
+		desc.life_min = 12.0f;
+		desc.life_max = 22.0f;
+		desc.size_min = 1.5f;
+		desc.size_max = 3.0f;
+		desc.grow = -0.08f;
+		desc.color = Color(1.0f, 0.6f, 0.2f, 1.0f);
+		preset.burst = 24;
+		break;
+	case ParticleEffect::Block:
+		desc.additive = true;
+		desc.spread = 45.0f;
+		desc.speed_min = 1.0f;
+		desc.speed_max = 2.2f;
+		desc.life_min = 8.0f;
+		desc.life_max = 16.0f;
+		desc.size_min = 1.0f;
+		desc.size_max = 2.0f;
+		desc.grow = -0.06f;
+		desc.color = Color(0.7f, 0.85f, 1.0f, 1.0f);
+		preset.burst = 32;
+		break;
+	case ParticleEffect::Roar:
+		desc.additive = false;
+		desc.spread = 85.0f;
+		desc.speed_min = 0.3f;
+		desc.speed_max = 0.7f;
+		desc.life_min = 40.0f;
+		desc.life_max = 60.0f;
+		desc.size_min = 8.0f;
+		desc.size_max = 14.0f;
+		desc.grow = 0.15f;
+		desc.weight = -0.1f;
+		desc.color = Color(0.55f, 0.5f, 0.45f, 0.5f);
+		preset.burst = 16;
+		preset.rate = 4.0f;
+		preset.duration = 60.0f;
+		break;
+	}
+	return preset;
+}
+
+// エフェクトごとの発生設定の取得（他の翻訳単位の定数を使うため、初回の呼び出し時に作成する）
+static const ParticleEffectPreset& find_preset(ParticleEffect effect)
+{
+	static const ParticleEffectPreset presets[]
+	{
+		make_preset(ParticleEffect::Hit),
+		make_preset(ParticleEffect::Block),
+		make_preset(ParticleEffect::Roar),
+	};
+	return presets[(int)effect];
+}
+
+// コンストラクタ（directionは発生方向）
+ParticleEmitter::ParticleEmitter(IWorld* world, ParticleEffect effect, const Vector3& position, const Vector3& direction) :
+	Actor(world, "ParticleEmitter", position),
+	effect_{ effect },
+	direction_{ direction }
+{
+	rand_.randomize(id());
+	rand_.set_tick(world_->tick());
+
+	// 生成時に一度に発生させる
+	const auto& preset = find_preset(effect_);
+	world_->particles().emit(preset.desc, position_, direction_, preset.burst, rand_);
+}
+
+// 更新
+void ParticleEmitter::update(float delta_time)
+{
+	const auto& preset = find_preset(effect_);
+	timer_ += delta_time;
+	if (timer_ >= preset.duration)
+	{
+		die();
+		return;
+	}
+
+	// 持続時間の間は毎フレーム発生させる（上限で発生しなかった分は繰り越さない）
+	rand_.set_tick(world_->tick());
+	carry_ += preset.rate * delta_time;
+	const int count = (int)carry_;
+	carry_ -= (float)count;
+	world_->particles().emit(preset.desc, position_, direction_, count, rand_);
+}
\ No newline at end of file
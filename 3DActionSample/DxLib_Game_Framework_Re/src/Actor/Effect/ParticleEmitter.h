@@ -0,0 +1,41 @@
+#ifndef PARTICLE_EMITTER_H_
+#define PARTICLE_EMITTER_H_
+
+#include "../Actor.h"
+#include "../../Math/Random.h"
+
+// 列挙型：パーティクルエフェクトの種類
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+enum class ParticleEffect
+{
+	Hit,		// 攻撃命中の火花
+	Block,		// ガード成立の火花
+	Roar,		// 咆哮の砂煙
+};
+
+// クラス：パーティクルエミッター
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// エフェクトグループのアクター。生成時に一度に発生させ、持続時間の間は毎フレーム発生させてから消滅する。
+// パーティクル自体はワールドのパーティクルシステムがまとめて更新・描画する。
+class ParticleEmitter : public Actor
+{
+public:
+	// コンストラクタ（directionは発生方向）
+	ParticleEmitter(IWorld* world, ParticleEffect effect, const Vector3& position, const Vector3& direction = Vector3::Up);
+	// 更新
+	virtual void update(float delta_time) override;
+
+private:
+	// エフェクトの種類
+	ParticleEffect	effect_;
+	// 発生方向
+	Vector3			direction_;
+	// 経過時間
+	float			timer_{ 0.0f };
+	// 発生数の端数（次のフレームに繰り越す）
+	float			carry_{ 0.0f };
+	// 乱数生成器
+	Random			rand_;
+};
+
+#endif // !PARTICLE_EMITTER_H_
\ No newline at end of file
@@ -4,27 +4,28 @@
 #include "../../Damage.h"
 #include "../EnemyAttack.h"
 #include "../../ActorGroup.h"
+#include "../../Effect/ParticleEmitter.h"
 #include "../../../Sound/Sound.h"
 #include "../../../ID/SourceID.h"
 
-// NXFGiCmVVj
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：敵（イノシシ）
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
 //--------------------------------------------------
 
-const int	IdleTime = 5;				// ҋ@Ԃ̎ԁibj
-const int	BitePower = 15;				// ݕtÜЗ
-const float	BiteRadius = 10.0f;			// ݕtU͈͔̔a
-const int	AngerTime = 2;				// {Ԃ̎ԁij
-const int	TraceTimeBeforeDash = 2;	// {ːiOAvC[Ǝ킹鎞ԁibj
-const int	DashPower = 25;				// ːiÜЗ
+const int	IdleTime = 5;				// 待機状態の持続時間（秒）
+const int	BitePower = 15;				// 噛み付く攻撃の威力
+const float	BiteRadius = 10.0f;			// 噛み付く攻撃判定の範囲半径
+const int	AngerTime = 2;				// 怒り状態の持続時間（分）
+const int	TraceTimeBeforeDash = 2;	// 怒り突進前、プレイヤーと軸合わせする時間（秒）
+const int	DashPower = 25;				// 突進攻撃の威力
 
 //--------------------------------------------------
 
-// RXgN^
+// コンストラクタ
 DragonBoar::DragonBoar(IWorld* world, const Vector3& position, float angle, const IBodyPtr& body) :
 	Enemy(world, "DragonBoar", position, angle, body),
-	mesh_{ MESH_DRAGONBOAR, DragonBoarMotion::MOTION_ROAR },
+	mesh_{ world->animation_arena(), MESH_DRAGONBOAR, DragonBoarMotion::MOTION_ROAR },
 	motion_{ DragonBoarMotion::MOTION_ROAR },
 	state_{ DragonBoarState::Roar },
 	state_timer_{ 0.0f },
@@ -41,49 +42,52 @@ DragonBoar::DragonBoar(IWorld* world, const Vector3& position, float angle, cons
 	current_wince_ = 0;
 	previous_state_ = state_;
 	next_destination_ = Vector3::Zero;
-	rand_.randomize();
+	rand_.randomize(id());
 }
 
-// XV
+// 更新
 void DragonBoar::update(float delta_time)
 {
-	// 
-	velocity_ += Vector3::Down * Gravity;		// d͉xvZ
-	position_.y += velocity_.y * delta_time;	// yWvZ
+	// 乱数ストリームを現在のtickに合わせる
+	rand_.set_tick(world_->tick());
 
-	intersect_ground();		// nʂƂ̐ڐG
-	intersect_wall();		// ǂƂ̐ڐG
-	clamp_position();		// W
+	// 落下処理
+	velocity_ += Vector3::Down * Gravity;		// 重力加速度を計算
+	position_.y += velocity_.y * delta_time;	// y軸座標を計算
 
-	// G̏ԂXV
+	intersect_ground();		// 地面との接触処理
+	intersect_wall();		// 壁との接触処理
+	clamp_position();		// 座標制限
+
+	// 敵の状態を更新
 	update_state(delta_time);
-	// [VύX
+	// モーションを変更
 	mesh_.change_motion(motion_);
-	// bVXV
+	// メッシュを更新
 	mesh_.update(delta_time);
-	// svZ
+	// 行列を計算
 	mesh_.transform(pose());
 
-	// HP0ȉɂȂƁASԂɈڍs
+	// HPが0以下になると、死亡状態に移行
 	if (current_hp_ <= 0 && state_ != DragonBoarState::Death)
 	{
 		change_state(DragonBoarState::Death, MOTION_DEATH);
-		world_->send_message(EventMessage::BossDead);	// SbZ[W𑗐M
+		world_->send_message(EventMessage::BossDead);	// 死亡メッセージを送信
 		return;
 	}
 
-	// ̗͂ȉɂȂA1Kē{Ԃֈڍs
+	// 体力が半分以下になったら、1回咆哮して怒り状態へ移行
 	if (current_hp_ <= HP / 2 && !is_anger_)
 	{
-		current_wince_ /= 2;			// ݐϋݒl𔼕ɂ
+		current_wince_ /= 2;			// 累積怯み値を半分にする
 		is_anger_ = true;
-		anger_timer_ = AngerTime * 60;	// {Ԃ̎Ԃݒi * 60t[j
+		anger_timer_ = AngerTime * 60;	// 怒り状態の持続時間を設定（分 * 60フレーム）
 		change_state(DragonBoarState::Roar, MOTION_ROAR);
 		return;
 	}
 
 
-	// ݗݐϒlʂzAݏԂɈڍs
+	// 怯み累積値が一定量を越えたら、怯み状態に移行
 	if (current_wince_ >= ToWince && state_ != DragonBoarState::Wince)
 	{
 		current_wince_ = 0;
@@ -92,31 +96,43 @@ void DragonBoar::update(float delta_time)
 	}
 }
 
-// `
+// 描画
 void DragonBoar::draw() const
 {
-	mesh_.draw();	// bV`
+	mesh_.draw(world_->render_queue());	// メッシュの描画を記録
 
-	// RC_[`ifobO[ĥ݁Apj
+	// コライダーを描画（デバッグモードのみ、調整用）
 	body_->transform(pose())->draw();
 }
 
-// Փ˃ANV
+// 描画範囲の境界球の取得
+bool DragonBoar::bounding_sphere(Vector3& center, float& radius) const
+{
+	// スキニング後の境界ボックスがまだ計算されていなければカリングしない
+	const auto& bounds = mesh_.bounds();
+	if (bounds.IsEmpty()) return false;
+
+	center = bounds.Center();
+	radius = bounds.Radius();
+	return true;
+}
+
+// 衝突リアクション
 void DragonBoar::react(Actor& other)
 {
-	// SԂł͔Ȃ
+	// 死亡状態では反応しない
 	if (state_ == DragonBoarState::Death) return;
 
-	// {ːiɃvC[𓖂A_[W^
+	// 怒り突進中にプレイヤーを当たったら、ダメージを与える
 	if (state_ == DragonBoarState::Anger && dash_attack_on_)
 	{
-		// vC[ւ̃_[W\̂𐶐
+		// プレイヤーへのダメージ構造体を生成
 		Damage damage = { position_, DashPower };
-		// vC[փ_[WbZ[W𑗂
+		// プレイヤーへダメージメッセージを送る
 		other.handle_message(EventMessage::PlayerDamage, &damage);
-		// SEĐ
+		// SEを再生
 		Sound::play_se(SE_BOSS_TACKLE);
-		// U𖳌
+		// 攻撃判定を無効化
 		dash_attack_on_ = false;
 		return;
 	}
@@ -124,16 +140,16 @@ void DragonBoar::react(Actor& other)
 	Enemy::react(other);
 }
 
-// bZ[W
+// メッセージ処理
 void DragonBoar::handle_message(EventMessage message, void* param)
 {
-	// SԂł͔Ȃ
+	// 死亡状態では反応しない
 	if (state_ == DragonBoarState::Death) return;
 
-	// vC[_[W󂯂
+	// プレイヤーからダメージを受ける
 	if (message == EventMessage::EnemyDamage)
 	{
-		// bZ[WvC[̍U͂Ƌݒl擾A_[WvZs
+		// メッセージからプレイヤーの攻撃力と怯み値を取得し、ダメージ計算を行う
 		Damage* damage = (Damage*)param;
 		if (state_ != DragonBoarState::Death)
 			current_hp_ -= damage->power;
@@ -142,16 +158,16 @@ void DragonBoar::handle_message(EventMessage message, void* param)
 	}
 }
 
-// ̗͂̎擾
+// 体力の取得
 int DragonBoar::get_HP()
 {
 	return current_hp_;
 }
 
-// Ԃ̍XV
+// 状態の更新
 void DragonBoar::update_state(float delta_time)
 {
-	// ݂̏ԂɉāAGXV
+	// 現在の状態に応じて、敵を更新
 	switch (state_)
 	{
 	case(DragonBoarState::Idle):
@@ -179,10 +195,10 @@ void DragonBoar::update_state(float delta_time)
 		break;
 	}
 
-	state_timer_ += delta_time;			// ԃ^C}[Z
+	state_timer_ += delta_time;			// 状態タイマーを加算
 }
 
-// Ԃ̕ύX
+// 状態の変更
 void DragonBoar::change_state(DragonBoarState state, int motion)
 {
 	previous_state_ = state_;
@@ -200,59 +216,61 @@ void DragonBoar::change_state(DragonBoarState state, int motion)
 
 	if (state == DragonBoarState::Anger)
 	{
-		const int min = 2, max = 4;		// {ːi̎Ԃ̍ŏlƍőlibj
+		const int min = 2, max = 4;		// 怒り突進の持続時間の最小値と最大値（秒）
 		dash_timer_ = 60.0f * rand_.rand_int(min, max);
 	}
 }
 
-// ҋ@Ԃł̍XV
+// 待機状態での更新
 void DragonBoar::idle(float delta_time)
 {
-	// 5bAړJniҋ@b * 60t[/bj
+	// 5秒後、移動開始（待機秒数 * 60フレーム/秒）
 	if (state_timer_ >= IdleTime * 60.0f)
 	{
-		// {Ԃł邩ǂɂāAړ@I
+		// 怒り状態であるかどうかによって、移動方法を選択
 		(anger_timer_ > 0.0f) ?
-			change_state(DragonBoarState::Anger, DragonBoarMotion::MOTION_DASH) :	// {ړֈڍs
-			change_state(DragonBoarState::Normal, DragonBoarMotion::MOTION_WALK);	// ʏړֈڍs
+			change_state(DragonBoarState::Anger, DragonBoarMotion::MOTION_DASH) :	// 怒り移動へ移行
+			change_state(DragonBoarState::Normal, DragonBoarMotion::MOTION_WALK);	// 通常移動へ移行
 	}
 }
 
-// K̍XV
+// 咆哮中の更新
 void DragonBoar::roar(float delta_time)
 {
-	// 1񂾂AKSEĐ
+	// 1回だけ、咆哮のSEを再生
 	if (!roar_started_)
 	{
 		Sound::play_se(SE_BOSS_ROAR);
+		// 足元から砂煙を発生させる
+		world_->add_actor(ActorGroup::Effect, new_actor<ParticleEmitter>(world_, ParticleEffect::Roar, position_));
 		roar_started_ = true;
 	}
 
-	// [VIAړJn
+	// モーション終了後、移動開始
 	if (state_timer_ >= mesh_.motion_end_time() * 2.0f)
 	{
-		// {Ԃł邩ǂɂāAړ@I
+		// 怒り状態であるかどうかによって、移動方法を選択
 		(anger_timer_ > 0.0f) ?
-			change_state(DragonBoarState::Anger, DragonBoarMotion::MOTION_DASH) :	// {ړֈڍs
-			change_state(DragonBoarState::Normal, DragonBoarMotion::MOTION_WALK);	// ʏړֈڍs
+			change_state(DragonBoarState::Anger, DragonBoarMotion::MOTION_DASH) :	// 怒り移動へ移行
+			change_state(DragonBoarState::Normal, DragonBoarMotion::MOTION_WALK);	// 通常移動へ移行
 	}
 }
 
-// ʏԂł̈ړ
+// 通常状態での移動
 void DragonBoar::normal(float delta_time)
 {
 	// ============================================================
-	// ȉ͈ړ̏
+	// 以下は移動中の処理
 
-	// ړInivC[̍WjXV
+	// 目的地（プレイヤーの座標）を更新
 	next_destination_ = get_player_position();
 
-	// ړIn̕ɌĂAړInֈړ
-	// ]iƃvC[Ɍ悤Ɂj
+	// 目的地の方向に向いてから、目的地へ移動
+	// 回転処理（ずっとプレイヤーに向けるように）
 	motion_ = MOTION_IDLE;
 	float angle_to_target = get_angle_to_target(next_destination_);
 
-	const float AngleToRotate = 0.5f;		// ړInւ̊px̐l傫ȂA]ĖړInɌ悤ɂ
+	const float AngleToRotate = 0.5f;		// 目的地への角度がこの数値より大きいなら、回転して目的地に向けるようにする
 	if (angle_to_target >= AngleToRotate)
 	{
 		motion_ = MOTION_WALK;
@@ -263,62 +281,62 @@ void DragonBoar::normal(float delta_time)
 		motion_ = MOTION_WALK;
 		rotation_ *= Matrix::CreateRotationY(-RotateSpeed * delta_time);
 	}
-	rotation_ = Matrix::NormalizeRotationMatrix(rotation_);		// ]s
+	rotation_ = Matrix::NormalizeRotationMatrix(rotation_);		// 回転行列を初期化
 
-	// vC[ɌĂꍇAړ
-	const float AngleToMove = 18.0f;		// ړInւ̊px̐l菬ȂAړJn
+	// プレイヤーに向いてる場合、移動する
+	const float AngleToMove = 18.0f;		// 目的地への角度がこの数値より小さいなら、移動開始
 	if (is_moving_ && get_unsigned_angle_to_target(next_destination_) <= AngleToMove)
 	{
 		motion_ = MOTION_WALK;
 
-		// ړ
-		velocity_ = Vector3::Zero;						// ړʂZbg
-		velocity_ += rotation_.Forward() * WalkSpeed;	// ړxZ
-		position_ += velocity_ * delta_time;			// ̈ʒuvZ
+		// 移動処理
+		velocity_ = Vector3::Zero;						// 移動量をリセット
+		velocity_ += rotation_.Forward() * WalkSpeed;	// 移動速度を加算
+		position_ += velocity_ * delta_time;			// 次の位置を計算
 	}
 
-	// vC[ɐڋ߂ƁA݂
+	// プレイヤーに接近すると、噛みつく
 	if (is_moving_)
 	{
 		if (can_attack_player())
 		{
-			interval_ = state_timer_ + 12.0f;	// ̍s0.2bi12t[jɎs
-			is_moving_ = false;					// ړ
+			interval_ = state_timer_ + 12.0f;	// 次の行動は0.2秒（12フレーム）後に実行
+			is_moving_ = false;					// 移動完了
 		}
 	}
 
-	// ړ̏I
+	// 移動中の処理終了
 	// ============================================================
 
 	// ============================================================
-	// ȉ͈ړ̏
+	// 以下は移動完了後の処理
 
-	// UԂֈڍs
+	// 攻撃状態へ移行
 	if (!is_moving_ && state_timer_ >= interval_)
 	{
 		change_state(DragonBoarState::Bite, DragonBoarMotion::MOTION_BITE);
 	}
 
-	// ړ̏I
+	// 移動完了後の処理終了
 	// ============================================================
 }
 
-// ݂̍XV
+// 噛みつき中の更新
 void DragonBoar::bite(float delta_time)
 {
-	// U𔭐
+	// 攻撃判定を発生
 	if (state_timer_ >= 40.0f && !attack_on_)
 	{
 		attack_on_ = true;
-		float distance = 40.0f;				// U̔iOǂꂮ炢j
-		float height = 12.5f;				// U̍
+		float distance = 40.0f;				// 攻撃判定の発生距離（前方からどれぐらい）
+		float height = 12.5f;				// 攻撃判定の高さ
 		Vector3 attack_position = position_ + pose().Forward() * distance + Vector3(0.0f, height, 0.0f);
 		world_->add_actor(ActorGroup::EnemyAttack, new_actor<EnemyAttack>(world_, attack_position, BitePower, BiteRadius));
-		Sound::play_se(SE_ENEMY_ATK_HEAVY);	// SEĐ
-		interval_ = state_timer_ + 40.0f;	// 40t[A̍sֈڍs
+		Sound::play_se(SE_ENEMY_ATK_HEAVY);	// SEを再生
+		interval_ = state_timer_ + 40.0f;	// 40フレーム後、次の行動へ移行
 	}
 
-	// ̏Ԃֈڍs
+	// 次の状態へ移行
 	if (state_timer_ >= mesh_.motion_end_time() * 2.0f)
 	{
 		motion_ = MOTION_IDLE;
@@ -326,18 +344,18 @@ void DragonBoar::bite(float delta_time)
 	}
 }
 
-// {Ԃł̈ړ
+// 怒り状態での移動
 void DragonBoar::anger(float delta_time)
 {
 	motion_ = MOTION_IDLE;
 
-	// 2bԁAvC[Ǝ킹i킹b * 60t[/bj
+	// 2秒間、プレイヤーと軸合わせ（軸合わせ秒数 * 60フレーム/秒）
 	if (state_timer_ <= TraceTimeBeforeDash * 60.0f)
 	{
-		next_destination_ = get_player_position();						// ړInivC[̍WjXV
-		float angle_to_target = get_angle_to_target(next_destination_);	// vC[̊px߂
-		// vC[Ɍĉ]
-		const float AngleToRotate = 0.5f;		// vC[ւ̊px̐l傫ȂA]ĖړInɌ悤ɂ
+		next_destination_ = get_player_position();						// 目的地（プレイヤーの座標）を更新
+		float angle_to_target = get_angle_to_target(next_destination_);	// プレイヤー向きの角度を求める
+		// プレイヤーに向けて回転
+		const float AngleToRotate = 0.5f;		// プレイヤーへの角度がこの数値より大きいなら、回転して目的地に向けるようにする
 		if (angle_to_target >= AngleToRotate)
 		{
 			motion_ = MOTION_WALK;
@@ -348,78 +366,78 @@ void DragonBoar::anger(float delta_time)
 			motion_ = MOTION_WALK;
 			rotation_ *= Matrix::CreateRotationY(-RotateSpeed * 1.5f * delta_time);
 		}
-		rotation_ = Matrix::NormalizeRotationMatrix(rotation_);			// ]s
+		rotation_ = Matrix::NormalizeRotationMatrix(rotation_);			// 回転行列を初期化
 		return;
 	}
 
-	// ړInɌēːi
+	// 目的地に向かって突進
 	else
 	{
-		// ːȉ
+		// 突進中の処理
 		if (is_moving_)
 		{
 			motion_ = MOTION_DASH;
 
-			// UL
+			// 攻撃判定を有効化
 			if (!attack_on_)
 			{
 				dash_attack_on_ = true;
 				attack_on_ = true;
 			}
 
-			// ړ
-			velocity_ = Vector3::Zero;						// ړʂZbg
-			velocity_ += rotation_.Forward() * DashSpeed;	// ړxZ
-			position_ += velocity_ * delta_time;			// ̈ʒuvZ
+			// 移動処理
+			velocity_ = Vector3::Zero;						// 移動量をリセット
+			velocity_ += rotation_.Forward() * DashSpeed;	// 移動速度を加算
+			position_ += velocity_ * delta_time;			// 次の位置を計算
 
 			if (dash_timer_ <= 0.0f)
 			{
 				is_moving_ = false;
-				interval_ = state_timer_ + 60.0f;			// 60t[i1bjA̍sֈڍs
+				interval_ = state_timer_ + 60.0f;			// 60フレーム（1秒）後、次の行動へ移行
 			}
 			dash_timer_ -= delta_time;
 		}
-		// ːȉ
+		// 突進後の処理
 		else
 		{
-			dash_attack_on_ = false;						// U𖳌
+			dash_attack_on_ = false;						// 攻撃判定を無効化
 			motion_ = MOTION_IDLE;
-			if (state_timer_ >= interval_)	next_action();	// ̍s𒊑I
+			if (state_timer_ >= interval_)	next_action();	// 次の行動を抽選
 		}
 	}
 }
 
-// ݏԂł̍XV
+// 怯み状態での更新
 void DragonBoar::wince(float delta_time)
 {
-	// [VIA̍s𒊑I
+	// モーション終了後、次の行動を抽選
 	if (state_timer_ >= mesh_.motion_end_time() * 2.0f)
 	{
 		next_action();
 	}
 }
 
-// SԂł̍XV
+// 死亡状態での更新
 void DragonBoar::death(float delta_time)
 {
-	// [VIƁASL
+	// モーションが終了すると、死亡判定を有効に
 	if (state_timer_ >= mesh_.motion_end_time() * 2.0f)
 	{
 		die();
 	}
 }
 
-// ̍s𒊑I
+// 次の行動を抽選
 void DragonBoar::next_action()
 {
-	// Ŏ̍siŏlF0AőlF3j
+	// 乱数で次の行動を決定（最小値：0、最大値：3）
 	int i = rand_.rand_int(0, 3);
 
-	// ҋ@Aړւ̈ڍsm1/4A3/4ɂȂĂ
-	// ҋ@Ԃւ̈ڍs
+	// 待機、移動への移行確率は1/4、3/4になっている
+	// 待機状態への移行
 	if (i == 0)
 	{
-		// ҋ@s͘AɔȂ
+		// 待機行動は連続に発生しない
 		if (previous_state_ == DragonBoarState::Idle)
 		{
 			next_action();
@@ -428,27 +446,27 @@ void DragonBoar::next_action()
 		change_state(DragonBoarState::Idle, DragonBoarMotion::MOTION_IDLE);
 		return;
 	}
-	// ړԂւ̈ڍs
+	// 移動状態への移行
 	else
 	{
 		(anger_timer_ > 0.0f) ?
-			change_state(DragonBoarState::Anger, DragonBoarMotion::MOTION_DASH) :	// {ړֈڍs
-			change_state(DragonBoarState::Normal, DragonBoarMotion::MOTION_WALK);	// ʏړֈڍs
+			change_state(DragonBoarState::Anger, DragonBoarMotion::MOTION_DASH) :	// 怒り移動へ移行
+			change_state(DragonBoarState::Normal, DragonBoarMotion::MOTION_WALK);	// 通常移動へ移行
 	}
 }
 
-// vC[Uł邩
+// プレイヤーを攻撃できるか
 bool DragonBoar::can_attack_player()
 {
-	// vC[݂ȂꍇAfalseԂ
+	// プレイヤーが存在しない場合、falseを返す
 	if (!player_exists()) return false;
-	// vC[OɂȂ΁AAFalseԂ
+	// プレイヤーが前にいなければ、、Falseを返す
 	if (!player_in_forward()) return false;
-	// vC[Uł鋗ɂȂ΁AFalseԂ
+	// プレイヤーが攻撃できる距離内にいなければ、Falseを返す
 	if (!player_in_range_distance(Range)) return false;
-	// vC[UłpxɂȂ΁AFalseԂ
+	// プレイヤーが攻撃できる角度内にいなければ、Falseを返す
 	if (!player_in_range_angle(Angle)) return false;
 
-	// SĖĂ΁ATrueԂ
+	// 条件を全て満たしていれば、Trueを返す
 	return true;
 }
\ No newline at end of file
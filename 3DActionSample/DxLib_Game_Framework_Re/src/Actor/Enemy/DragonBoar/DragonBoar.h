@@ -8,123 +8,125 @@
 #include "../../../ID/SourceID.h"
 #include "../../../Math/Random.h"
 
-// NXFGiCmVVj
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：敵（イノシシ）
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 class DragonBoar : public Enemy
 {
 private:
-	// 񋓌^FG̏
+	// 列挙型：敵の状態
 	enum class DragonBoarState
 	{
-		Idle,		// Î~ҋ@
-		Roar,		// K
-		Normal,		// ʏ
-		Bite,		// ݂
-		Anger,		// {
-		Wince,		// 
-		Death,		// S
+		Idle,		// 静止待機
+		Roar,		// 咆哮
+		Normal,		// 通常
+		Bite,		// 噛みつく
+		Anger,		// 怒り
+		Wince,		// 怯む
+		Death,		// 死亡
 	};
 
-	// 񋓌^FG̃[V
+	// 列挙型：敵のモーション
 	enum DragonBoarMotion
 	{
-		MOTION_IDLE = 4,	// Î~
-		MOTION_ROAR = 2,	// K
-		MOTION_WALK = 6,	// s
-		MOTION_BITE = 3,	// ݂
-		MOTION_DASH = 5,	// ːi
-		MOTION_WINCE = 1,	// 
-		MOTION_DEATH = 0,	// S
+		MOTION_IDLE = 4,	// 静止
+		MOTION_ROAR = 2,	// 咆哮
+		MOTION_WALK = 6,	// 歩行
+		MOTION_BITE = 3,	// 噛みつく
+		MOTION_DASH = 5,	// 突進
+		MOTION_WINCE = 1,	// 怯む
+		MOTION_DEATH = 0,	// 死亡
 	};
 
 public:
-	// RXgN^
+	// コンストラクタ
 	DragonBoar(IWorld* world, const Vector3& position, float angle = 0.0f, const IBodyPtr& body = std::make_shared<BoundingSphere>(Vector3(0.0f, 14.0f, 0.0f), 10.5f));
-	// XV
+	// 更新
 	virtual void update(float delta_time) override;
-	// `
+	// 描画
 	virtual void draw() const override;
-	// Փ˃ANV
+	// 描画範囲の境界球の取得
+	virtual bool bounding_sphere(Vector3& center, float& radius) const override;
+	// 衝突リアクション
 	virtual void react(Actor& other) override;
-	// bZ[W
+	// メッセージ処理
 	virtual void handle_message(EventMessage message, void* param = nullptr) override;
-	// ̗͂̎擾
+	// 体力の取得
 	virtual int get_HP() override;
 
 private:
-	// Ԃ̍XV
+	// 状態の更新
 	void update_state(float delta_time);
-	// Ԃ̕ύX
+	// 状態の変更
 	void change_state(DragonBoarState state, int motion);
 
-	// ҋ@Ԃł̍XV
+	// 待機状態での更新
 	void idle(float delta_time);
-	// K̍XV
+	// 咆哮中の更新
 	void roar(float delta_time);
-	// ʏԂł̈ړ
+	// 通常状態での移動
 	void normal(float delta_time);
-	// ݂̍XV
+	// 噛みつき中の更新
 	void bite(float delta_time);
-	// {Ԃł̈ړ
+	// 怒り状態での移動
 	void anger(float delta_time);
-	// ݏԂł̍XV
+	// 怯み状態での更新
 	void wince(float delta_time);
-	// SԂł̍XV
+	// 死亡状態での更新
 	void death(float delta_time);
 
-	// ̍s𒊑I
+	// 次の行動を抽選
 	void next_action();
 
-	// vC[Uł邩
+	// プレイヤーを攻撃できるか
 	virtual bool can_attack_player() override;
 
 private:
-	// Aj[VbV
-	AnimatedMesh		mesh_{ MESH_DRAGONBOAR };
-	// [Vԍ
+	// アニメーションメッシュ
+	AnimatedMesh		mesh_;
+	// モーション番号
 	int					motion_{ DragonBoarMotion::MOTION_IDLE };
-	// G̏
+	// 敵の状態
 	DragonBoarState		state_{ DragonBoarState::Idle };
-	// Ȍ
+	// 前の状態
 	DragonBoarState		previous_state_;
-	// ԃ^C}[
+	// 状態タイマー
 	float				state_timer_{ 0.0f };
-	// 
+	// 乱数生成器
 	Random				rand_;
 
-	// U𔭐̂
+	// 攻撃判定を発生したのか
 	bool				attack_on_{ false };
-	// ːiU̔𔭐̂
+	// 突進攻撃の判定を発生したのか
 	bool				dash_attack_on_{ false };
-	// ̖ړIn
+	// 次の目的地
 	Vector3				next_destination_;
-	// KSEĐ
+	// 咆哮のSEを再生したか
 	bool				roar_started_{ false };
-	// ړȂ̂
+	// 移動中なのか
 	bool				is_moving_{ false };
-	// {ԂȂ̂
+	// 怒り状態なのか
 	bool				is_anger_{ false };
-	// {ԃ^C}[
+	// 怒り状態タイマー
 	float				anger_timer_{ 0.0f };
-	// {ːi̎
+	// 怒り突進の持続時間
 	float				dash_timer_{ 0.0f };
 
-	// ő̗
+	// 最大体力
 	const int			HP{ 100 };
-	// sx
+	// 歩行速度
 	const float			WalkSpeed{ 0.28f };
-	// ːix
+	// 突進速度
 	const float			DashSpeed{ 0.5f };
-	// ]x
+	// 回転速度
 	const float			RotateSpeed{ 0.8f };
-	// d
+	// 重力
 	const float			Gravity{ 0.03f };
 
-	// ݑϐ
+	// 怯み耐性
 	const int			ToWince{ 15 };
-	// G
+	// 索敵距離
 	const float			Range{ 45.0f };
-	// Gpx
+	// 索敵角度
 	const float			Angle{ 10.0f };
 };
 
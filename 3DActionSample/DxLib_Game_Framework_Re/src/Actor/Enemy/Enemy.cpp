@@ -6,7 +6,7 @@
 #include "../ActorGroup.h"
 #include "../../Math/MathHelper.h"
 
-// RXgN^
+// コンストラクタ
 Enemy::Enemy(IWorld* world, const std::string& name, const Vector3& position, float angle, const IBodyPtr& body) :
 	Actor(world, name, position, body),
 	interval_{ 0.0f }
@@ -14,67 +14,67 @@ Enemy::Enemy(IWorld* world, const std::string& name, const Vector3& position, fl
 	rotation_ = Matrix::CreateRotationY(angle);
 }
 
-// Փ˃ANV
+// 衝突リアクション
 void Enemy::react(Actor& other)
 {
-	// ̃LN^[ɐڐGƁAo
-	Vector3 direction = other.position() - position_;	// ւ̕xNg擾
-	direction.Normalize();								// xNg𐳋K
+	// 他のキャラクターに接触すると、相手を押し出す
+	Vector3 direction = other.position() - position_;	// 相手への方向ベクトルを取得
+	direction.Normalize();								// 方向ベクトルを正規化
 
-	// öړ
+	// 押し出しの移動量
 	float move = 0.5f;
-	direction *= move;				// xNgɈړʂ
+	direction *= move;				// 方向ベクトルに移動量をかける
 
-	other.move_order(direction);	// ړ
+	other.move_order(direction);	// 相手を移動させる
 }
 
-// nʂƂ̐ڐG
+// 地面との接触処理
 void Enemy::intersect_ground()
 {
-	// tB[h擾
+	// フィールドを取得
 	auto& field = world_->field();
-	// nʂƂ̐ڐG_
+	// 地面との接触点
 	Vector3 intersect;
-	// ڐGp
+	// 接触判定用線分
 	Line line = Line(position_ + Vector3(0.0f, 2.5f, 0.0f), position_ - Vector3(0.0f, 1.0f, 0.0f));
 
-	// nʂƂ̐ڐG_擾
+	// 地面との接触点を取得
 	if (field.collide_line(line.start, line.end, &intersect))
 	{
-		// ڒnꍇAyW␳inʂɂ߂荞܂Ȃj
+		// 接地した場合、y軸座標を補正する（地面にめり込まない）
 		if (intersect.y >= position_.y)
 		{
-			velocity_.y = 0;			// yړʂ0ɂ
-			position_.y = intersect.y;	// yʒu␳
+			velocity_.y = 0;			// y軸移動量を0にする
+			position_.y = intersect.y;	// y軸位置を補正
 		}
 	}
 }
 
-// ǂƂ̐ڐG
+// 壁との接触処理
 void Enemy::intersect_wall()
 {
-	// tB[h擾
+	// フィールドを取得
 	auto& field = world_->field();
-	// ǂƂ̐ڐG_
+	// 壁との接触点
 	Vector3 intersect;
-	// ڐGp
+	// 接触判定用球体
 	BoundingSphere sphere = BoundingSphere(position_ + Vector3(0.0f, 2.5f, 0.0f), 2.5f);
 
-	// ǂƂ̐ڐG_擾
+	// 壁との接触点を取得
 	if (field.collide_sphere(sphere.position(), sphere.radius(), &intersect))
 	{
-		// vC[̍W␳
+		// プレイヤーの座標を補正
 		position_.x = intersect.x;
 		position_.z = intersect.z;
 	}
 }
 
-// W̐
+// 座標の制限
 void Enemy::clamp_position()
 {
-	// tB[h擾
+	// フィールドを取得
 	auto& field = world_->field();
-	// tB[h̍őƍŏW擾
+	// フィールドの最大と最小座標を取得
 	auto max_pos = field.max_position();
 	auto min_pos = field.min_position();
 
@@ -82,77 +82,77 @@ void Enemy::clamp_position()
 	position_.z = MathHelper::clamp(position_.z, min_pos.z, max_pos.z);
 }
 
-// vC[擾
+// プレイヤーを取得
 ActorPtr Enemy::get_player()
 {
 	return world_->find_actor(ActorGroup::Player, "Player");
 }
 
-// vC[̈ʒu擾
+// プレイヤーの位置を取得
 Vector3 Enemy::get_player_position()
 {
-	// vC[݂ȂꍇAݎ̍WԂ
+	// プレイヤーが存在しない場合、現在自分の座標を返す
 	if (get_player() == nullptr) return position_;
 
-	// vC[݂ꍇA̍WԂiy͖j
+	// プレイヤーが存在する場合、その座標を返す（y成分は無視する）
 	auto pos = get_player()->position();
 	pos.y = 0.0f;
 
 	return pos;
 }
 
-// ڕWւ̊px擾itj
+// 目標への角度を取得（符号付き）
 float Enemy::get_angle_to_target(Vector3 target) const
 {
-	// ړInւ̃xNg
+	// 目的地方向へのベクトル
 	Vector3 to_target = target - position_;
-	// Oƃ^[Qbg̊O
+	// 前方向とターゲットの外積
 	Vector3 forward_cross_target = Vector3::Cross(rotation_.Forward(), to_target);
 
-	// OςŖڕWւ̊pxvZApx̒lԂ
+	// 外積で目標への角度を計算し、角度の値を返す
 	float angle = (forward_cross_target.y >= 0.0f) ? Vector3::Angle(pose().Forward(), to_target) : -Vector3::Angle(pose().Forward(), to_target);
 
 	return angle;
 }
 
-// ڕWւ̊px擾ij
+// 目標への角度を取得（符号無し）
 float Enemy::get_unsigned_angle_to_target(Vector3 target) const
 {
 	return std::abs(get_angle_to_target(target));
 }
 
-// vC[݂͑邩
+// プレイヤーは存在するか
 bool Enemy::player_exists()
 {
 	return get_player() != nullptr;
 }
 
-// vC[͑Oɂ邩
+// プレイヤーは前にいるか
 bool Enemy::player_in_forward()
 {
-	// vC[݂ȂꍇAFalseԂ
+	// プレイヤーが存在しない場合、Falseを返す
 	if (get_player() == nullptr) return false;
 
-	// vC[ւ̊px90ȓǂԂ
+	// プレイヤーへの角度は90°以内かどうかを返す
 	return (get_unsigned_angle_to_target(get_player_position()) <= 90.0f);
 }
 
-// vC[͍Uɂ邩
+// プレイヤーは攻撃距離内にいるか
 bool Enemy::player_in_range_distance(float distance)
 {
-	// vC[݂ȂꍇAFalseԂ
+	// プレイヤーが存在しない場合、Falseを返す
 	if (get_player() == nullptr) return false;
 
-	// gvC[܂ł̋߁AUłTrueԂ
+	// 自身からプレイヤーまでの距離を求め、攻撃距離内であればTrueを返す
 	return (Vector3::Distance(position_, get_player_position()) <= distance);
 }
 
-// vC[͍Ułpxɂ邩
+// プレイヤーは攻撃できる角度にいるか
 bool Enemy::player_in_range_angle(float angle)
 {
-	// vC[݂ȂꍇAFalseԂ
+	// プレイヤーが存在しない場合、Falseを返す
 	if (get_player() == nullptr) return false;
 
-	// gvC[܂ł̊px߁AUpxłTrueԂ
+	// 自身からプレイヤーまでの角度を求め、攻撃角度内であればTrueを返す
 	return (get_unsigned_angle_to_target(get_player_position()) <= angle);
 }
\ No newline at end of file
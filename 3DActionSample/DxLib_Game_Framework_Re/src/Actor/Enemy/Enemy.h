@@ -4,52 +4,52 @@
 #include "../Actor.h"
 #include "../ActorPtr.h"
 
-// NXFGL
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：敵キャラ共通
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
 class Enemy : public Actor
 {
 public:
-	// RXgN^
+	// コンストラクタ
 	Enemy(IWorld* world, const std::string& name, const Vector3& position, float angle = 0.0f, const IBodyPtr& body = std::shared_ptr<DummyBody>());
 
-	// Փ˃ANV
+	// 衝突リアクション
 	virtual void react(Actor& other) override;
 
-	// nʂƂ̐ڐG
+	// 地面との接触処理
 	void intersect_ground();
-	// ǂƂ̐ڐG
+	// 壁との接触処理
 	void intersect_wall();
-	// W̐
+	// 座標の制限
 	void clamp_position();
 
-	// vC[擾
+	// プレイヤーを取得
 	ActorPtr get_player();
-	// vC[̈ʒu擾
+	// プレイヤーの位置を取得
 	Vector3 get_player_position();
-	// ڕWւ̊px擾itj
+	// 目標への角度を取得（符号付き）
 	float get_angle_to_target(Vector3 target) const;
-	// ڕWւ̊px擾ij
+	// 目標への角度を取得（符号無し）
 	float get_unsigned_angle_to_target(Vector3 target) const;
 
-	// vC[݂͑邩
+	// プレイヤーは存在するか
 	bool player_exists();
-	// vC[͑Oɂ邩
+	// プレイヤーは前にいるか
 	bool player_in_forward();
-	// vC[͍Uɂ邩
+	// プレイヤーは攻撃距離内にいるか
 	bool player_in_range_distance(float distance);
-	// vC[͍Ułpxɂ邩
+	// プレイヤーは攻撃できる角度にいるか
 	bool player_in_range_angle(float angle);
 
-	// vC[Uł邩
+	// プレイヤーを攻撃できるか
 	virtual bool can_attack_player() = 0;
 
 protected:
-	// ݂̗̑
+	// 現在の体力
 	int				current_hp_;
-	// ݗݐϒl
+	// 怯み累積値
 	int				current_wince_{ 0 };
-	// sҋ@
+	// 行動待機時間
 	float			interval_{ 0.0f };
 
 };
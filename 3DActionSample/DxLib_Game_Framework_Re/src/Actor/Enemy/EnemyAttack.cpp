@@ -4,42 +4,42 @@
 #include "../../ID/EventMessage.h"
 #include "../Damage.h"
 
-// NXFG̍U̓蔻
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：敵の攻撃の当たり判定
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
-// RXgN^
+// コンストラクタ
 EnemyAttack::EnemyAttack(IWorld* world, const Vector3& position, int power, float radius) :
 	Actor(world, "EnemyAttack", position, std::make_shared<BoundingSphere>(Vector3::Zero, radius)),
 	destroy_counter_{ 0.0f }
 {
-	power_ = power;		// З͂ݒ
+	power_ = power;		// 威力を設定
 }
 
-// XV
+// 更新
 void EnemyAttack::update(float delta_time)
 {
-	// 0.2b
+	// 0.2秒後消滅
 	if (destroy_counter_ >= 12.0f)
 	{
 		die();
 	}
 
-	destroy_counter_ += delta_time;		// ŃJE^[Z
+	destroy_counter_ += delta_time;		// 消滅カウンターを加算
 }
 
-// `
+// 描画
 void EnemyAttack::draw() const
 {
-	body_->transform(pose())->draw();	// RC_[`ifobO[ĥ݁Apj
+	body_->transform(pose())->draw();	// コライダーを描画（デバッグモードのみ、調整用）
 }
 
-// Փ˃ANV
+// 衝突リアクション
 void EnemyAttack::react(Actor& other)
 {
-	// vC[ւ̃_[W\̂𐶐
+	// プレイヤーへのダメージ構造体を生成
 	Damage damage = { position_, power_ };
-	// vC[փ_[WbZ[W𑗂
+	// プレイヤーへダメージメッセージを送る
 	other.handle_message(EventMessage::PlayerDamage, &damage);
-	// vC[ɓƏ
+	// プレイヤーに当たると消滅
 	die();
 }
\ No newline at end of file
@@ -4,23 +4,23 @@
 #include "../Actor.h"
 
 
-// NXFG̍U̓蔻
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：敵の攻撃の当たり判定
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 class EnemyAttack : public Actor
 {
 public:
-	// RXgN^
+	// コンストラクタ
 	EnemyAttack(IWorld* world, const Vector3& position, int power = 0, float radius = 6.0f);
-	// XV
+	// 更新
 	virtual void update(float delta_time) override;
-	// `
+	// 描画
 	virtual void draw() const override;
-	// Փ˃ANV
+	// 衝突リアクション
 	virtual void react(Actor& other) override;
 
 private:
-	float destroy_counter_{ 0.0f };	// ŃJE^[
-	int power_{ 0 };				// З
+	float destroy_counter_{ 0.0f };	// 消滅カウンター
+	int power_{ 0 };				// 威力
 };
 
 #endif // !ENEMY_ATTACK_H_
\ No newline at end of file
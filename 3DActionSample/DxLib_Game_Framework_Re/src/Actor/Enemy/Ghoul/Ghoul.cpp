@@ -9,21 +9,21 @@
 #include "../../../Sound/Sound.h"
 #include "../../../ID/SourceID.h"
 
-// NXFO[
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：グール
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
 //--------------------------------------------------
 
-const float	AtkReady = 30.0f;			// UO̗\ԁit[j
-const int	Power = 8;					// U
-const float AttackInterval = 120.0f;	// UԊu
+const float	AtkReady = 30.0f;			// 攻撃前の予備時間（フレーム）
+const int	Power = 8;					// 攻撃力
+const float AttackInterval = 120.0f;	// 攻撃間隔
 
 //--------------------------------------------------
 
-// RXgN^
+// コンストラクタ
 Ghoul::Ghoul(IWorld* world, const Vector3& position, float angle, const IBodyPtr& body) :
 	Enemy(world, "Ghoul", position, angle, body),
-	mesh_{ MESH_GHOUL, GhoulMotion::MOTION_IDLE },
+	mesh_{ world->animation_arena(), MESH_GHOUL, GhoulMotion::MOTION_IDLE },
 	motion_{ GhoulMotion::MOTION_IDLE },
 	state_{ GhoulState::Idle },
 	state_timer_{ 0.0f },
@@ -37,42 +37,45 @@ Ghoul::Ghoul(IWorld* world, const Vector3& position, float angle, const IBodyPtr
 	current_wince_ = 0;
 	previous_state_ = state_;
 	next_destination_ = Vector3::Zero;
-	rand_.randomize();
+	rand_.randomize(id());
 
-	const int min = 1, max = 3;	// ̏ԎԂ̍ŏlƍőlibj
+	const int min = 1, max = 3;	// 次の状態持続時間の最小値と最大値（秒）
 	ready_to_next_state(min, max);
 }
 
-// XV
+// 更新
 void Ghoul::update(float delta_time)
 {
-	// 
-	velocity_ += Vector3::Down * Gravity;		// d͉xvZ
-	position_.y += velocity_.y * delta_time;	// yWvZ
+	// 乱数ストリームを現在のtickに合わせる
+	rand_.set_tick(world_->tick());
 
-	intersect_ground();		// nʂƂ̐ڐG
-	intersect_wall();		// ǂƂ̐ڐG
-	clamp_position();		// W
+	// 落下処理
+	velocity_ += Vector3::Down * Gravity;		// 重力加速度を計算
+	position_.y += velocity_.y * delta_time;	// y軸座標を計算
 
-	// G̏ԂXV
+	intersect_ground();		// 地面との接触処理
+	intersect_wall();		// 壁との接触処理
+	clamp_position();		// 座標制限
+
+	// 敵の状態を更新
 	update_state(delta_time);
-	// [VύX
+	// モーションを変更
 	mesh_.change_motion(motion_);
-	// bVXV
+	// メッシュを更新
 	mesh_.update(delta_time);
-	// svZ
+	// 行列を計算
 	mesh_.transform(pose());
 
-	// HP0ȉɂȂƁASԂɈڍs
+	// HPが0以下になると、死亡状態に移行
 	if (current_hp_ <= 0)
 	{
 		if (state_ == GhoulState::Death) return;
 		change_state(GhoulState::Death, MOTION_DEATH);
-		world_->send_message(EventMessage::EnemyDead);	// SbZ[W𑗐M
+		world_->send_message(EventMessage::EnemyDead);	// 死亡メッセージを送信
 		return;
 	}
 
-	// ݗݐϒlʂzAݏԂɈڍs
+	// 怯み累積値が一定量を越えたら、怯み状態に移行
 	if (current_wince_ >= ToWince && state_ != GhoulState::Wince)
 	{
 		current_wince_ = 0;
@@ -80,39 +83,51 @@ void Ghoul::update(float delta_time)
 		return;
 	}
 
-	// UԊuJE^[Z
+	// 攻撃間隔カウンターを減算
 	if (attack_interval_ > 0.0f)
 		attack_interval_ -= delta_time;
 }
 
-// `
+// 描画
 void Ghoul::draw() const
 {
-	mesh_.draw();	// bV`
+	mesh_.draw(world_->render_queue());	// メッシュの描画を記録
 
-	// RC_[`ifobO[ĥ݁Apj
+	// コライダーを描画（デバッグモードのみ、調整用）
 	body_->transform(pose())->draw();
 }
 
-// Փ˃ANV
+// 描画範囲の境界球の取得
+bool Ghoul::bounding_sphere(Vector3& center, float& radius) const
+{
+	// スキニング後の境界ボックスがまだ計算されていなければカリングしない
+	const auto& bounds = mesh_.bounds();
+	if (bounds.IsEmpty()) return false;
+
+	center = bounds.Center();
+	radius = bounds.Radius();
+	return true;
+}
+
+// 衝突リアクション
 void Ghoul::react(Actor& other)
 {
-	// SԂł͔Ȃ
+	// 死亡状態では反応しない
 	if (state_ == GhoulState::Death) return;
 
 	Enemy::react(other);
 }
 
-// bZ[W
+// メッセージ処理
 void Ghoul::handle_message(EventMessage message, void* param)
 {
-	// SԂł͔Ȃ
+	// 死亡状態では反応しない
 	if (state_ == GhoulState::Death) return;
 
-	// vC[_[W󂯂
+	// プレイヤーからダメージを受ける
 	if (message == EventMessage::EnemyDamage)
 	{
-		// bZ[WvC[̍U͂Ƌݒl擾A_[WvZs
+		// メッセージからプレイヤーの攻撃力と怯み値を取得し、ダメージ計算を行う
 		Damage* damage = (Damage*)param;
 		if (state_ != GhoulState::Death)
 			current_hp_ -= damage->power;
@@ -120,7 +135,7 @@ void Ghoul::handle_message(EventMessage message, void* param)
 			current_wince_ += damage->impact;
 	}
 
-	// bZ[W󂯂
+	// 即死メッセージを受ける
 	if (message == EventMessage::EnemyDestroy)
 	{
 		if (state_ != GhoulState::Death)
@@ -128,10 +143,10 @@ void Ghoul::handle_message(EventMessage message, void* param)
 	}
 }
 
-// Ԃ̍XV
+// 状態の更新
 void Ghoul::update_state(float delta_time)
 {
-	// ݂̏ԂɉāAGXV
+	// 現在の状態に応じて、敵を更新
 	switch (state_)
 	{
 	case(GhoulState::Idle):
@@ -153,10 +168,10 @@ void Ghoul::update_state(float delta_time)
 		break;
 	}
 
-	state_timer_ += delta_time;			// ԃ^C}[Z
+	state_timer_ += delta_time;			// 状態タイマーを加算
 }
 
-// Ԃ̕ύX
+// 状態の変更
 void Ghoul::change_state(GhoulState state, int motion)
 {
 	previous_state_ = state_;
@@ -169,25 +184,25 @@ void Ghoul::change_state(GhoulState state, int motion)
 	interval_ = 0.0f;
 }
 
-// ҋ@Ԃł̍XV
+// 待機状態での更新
 void Ghoul::idle(float delta_time)
 {
-	// 莞ԌA̍s𒊑Iiҋ@Ԃ̈ێԂ͗Ō߂j
+	// 一定時間後、次の行動を抽選（待機状態の維持時間は乱数で決める）
 	if (state_timer_ >= state_time_)
 		next_action();
 }
 
-// ړԂł̍XV
+// 移動状態での更新
 void Ghoul::move(float delta_time)
 {
 	// ============================================================
-	// ȉ͈ړ̏
+	// 以下は移動中の処理
 
-	// vC[Ǐ]Ă΁A펞ړIn̍WXV
+	// プレイヤーを追従していれば、常時目的地の座標を更新
 	if (is_following_player_)	next_destination_ = get_player_position();
 
-	// ړIn̕ɌĂAړInֈړ
-	// ]ivC[ɒǏ]ĂꍇAړłvC[Ɍ悤ɂȂĂj
+	// 目的地の方向に向いてから、目的地へ移動
+	// 回転処理（プレイヤーに追従している場合、移動完了後でもプレイヤーに向けるようになっている）
 	motion_ = MOTION_IDLE;
 	float angle_to_target = get_angle_to_target(next_destination_);
 
@@ -202,7 +217,7 @@ void Ghoul::move(float delta_time)
 		rotation_ *= Matrix::CreateRotationY(-RotateSpeed * delta_time);
 	}
 
-	// vC[Ƃ̊px傫ꍇA][VĐA]Ăړ
+	// プレイヤーとの角度差が大きい場合、回転モーションを再生し、回転してから移動する
 	if (angle_to_target >= 135.0f)
 	{
 		rotation_ *= Matrix::CreateRotationY(RotateSpeed * 2 * delta_time);
@@ -212,28 +227,28 @@ void Ghoul::move(float delta_time)
 		rotation_ *= Matrix::CreateRotationY(RotateSpeed * 2 * delta_time);
 	}
 
-	rotation_ = Matrix::NormalizeRotationMatrix(rotation_);		// ]s
+	rotation_ = Matrix::NormalizeRotationMatrix(rotation_);		// 回転行列を初期化
 
 	if (is_moving_ && get_unsigned_angle_to_target(next_destination_) <= 18.0f)
 	{
 		motion_ = MOTION_WALK;
 
-		// ړ
-		velocity_ = Vector3::Zero;						// ړʂZbg
-		velocity_ += rotation_.Forward() * WalkSpeed;	// ړxZ
-		position_ += velocity_ * delta_time;			// ̈ʒuvZ
+		// 移動処理
+		velocity_ = Vector3::Zero;						// 移動量をリセット
+		velocity_ += rotation_.Forward() * WalkSpeed;	// 移動速度を加算
+		position_ += velocity_ * delta_time;			// 次の位置を計算
 	}
 
 	if (is_moving_)
 	{
-		// ړInɒƁAړ
+		// 目的地に着くと、移動完了
 		if (can_attack_player() || Vector3::Distance(position_, next_destination_) <= 12.0f)
 		{
-			interval_ = state_timer_ + AtkReady;	// ̍s0.2bɎs
-			is_moving_ = false;						// ړ
+			interval_ = state_timer_ + AtkReady;	// 次の行動は0.2秒後に実行
+			is_moving_ = false;						// 移動完了
 		}
 
-		// s̈ێԂ𒴂A̍s𒊑I
+		// 行動の維持時間を超えたら、次の行動を抽選
 		if (move_timer_ >= state_time_)
 		{
 			next_action();
@@ -242,18 +257,18 @@ void Ghoul::move(float delta_time)
 		move_timer_ += delta_time;
 	}
 
-	// ړ̏I
+	// 移動中の処理終了
 	// ============================================================
 
 	// ============================================================
-	// ȉ͈ړ̏
+	// 以下は移動完了後の処理
 
 	if (!is_moving_)
 	{
-		// ̍ss
+		// 次の行動を実行
 		if (state_timer_ >= interval_)
 		{
-			// vC[͋߂ɂꍇAUsɈڍs
+			// プレイヤーは近くにいる場合、攻撃行動に移行
 			if (can_attack_player())
 			{
 				attack_interval_ = AttackInterval;
@@ -261,42 +276,42 @@ void Ghoul::move(float delta_time)
 			}
 			else
 			{
-				next_action();	// ̍s𒊑I
+				next_action();	// 次の行動を抽選
 			}
 		}
 	}
 
-	// ړ̏I
+	// 移動完了後の処理終了
 	// ============================================================
 }
 
-// ݏԂł̍XV
+// 怯み状態での更新
 void Ghoul::wince(float delta_time)
 {
-	// [VIA̍s𒊑I
+	// モーション終了後、次の行動を抽選
 	if (state_timer_ >= mesh_.motion_end_time() * 2.0f)
 	{
 		next_action();
 	}
 }
 
-// UԂł̍XV
+// 攻撃状態での更新
 void Ghoul::attack(float delta_time)
 {
-	// U𔭐
+	// 攻撃判定を発生
 	if (state_timer_ >= 9.0f && !attack_on_)
 	{
 		attack_on_ = true;
 
-		float distance = 8.0f;					// U̔iOǂꂮ炢j
-		float height = 12.5f;					// U̍
+		float distance = 8.0f;					// 攻撃判定の発生距離（前方からどれぐらい）
+		float height = 12.5f;					// 攻撃判定の高さ
 		Vector3 attack_position = position_ + pose().Forward() * distance + Vector3(0.0f, height, 0.0f);
 		world_->add_actor(ActorGroup::EnemyAttack, new_actor<EnemyAttack>(world_, attack_position, Power));
-		Sound::play_se(SE_ENEMY_ATK_LIGHT);		// SEĐ
+		Sound::play_se(SE_ENEMY_ATK_LIGHT);		// SEを再生
 		interval_ = state_timer_ + 40.0f;
 	}
 
-	// [VIA̍s𒊑I
+	// モーション終了後、次の行動を抽選
 	if (state_timer_ >= 26.0f)
 	{
 		motion_ = MOTION_IDLE;
@@ -304,52 +319,52 @@ void Ghoul::attack(float delta_time)
 	}
 }
 
-// SԂł̍XV
+// 死亡状態での更新
 void Ghoul::death(float delta_time)
 {
-	// [VIƁASL
+	// モーションが終了すると、死亡判定を有効に
 	if (state_timer_ >= mesh_.motion_end_time() * 2.0f)
 	{
 		die();
 	}
 }
 
-// ̍s
+// 次の行動を決定
 void Ghoul::next_action()
 {
-	// Ŏ̍siŏlF0AőlF6j
+	// 乱数で次の行動を決定（最小値：0、最大値：6）
 	int i = rand_.rand_int(0, 6);
 
-	// ҋ@AړAUԂւ̈ڍsm1/6A2/3A1/6ɂȂĂ
-	// ҋ@Ԃւ̈ڍs
+	// 待機、移動、攻撃状態への移行確率は1/6、2/3、1/6になっている
+	// 待機状態への移行
 	if (i == 0)
 	{
-		// ҋ@s͘AɔȂ
+		// 待機行動は連続に発生しない
 		if (previous_state_ == GhoulState::Idle)
 		{
 			next_action();
 			return;
 		}
 
-		const int min = 2, max = 4;		// ̏ԎԂ̍ŏlƍőlibj
+		const int min = 2, max = 4;		// 次の状態持続時間の最小値と最大値（秒）
 		ready_to_next_state(min, max);
 		change_state(GhoulState::Idle, GhoulMotion::MOTION_IDLE);
 		return;
 	}
-	// ړԂւ̈ڍs
+	// 移動状態への移行
 	else if (i <= 5)
 	{
-		next_destination();			// ̖ړIn
-		// ړԂ4`8bԈێ
-		const int min = 4, max = 8;		// ̏ԎԂ̍ŏlƍőlibj
+		next_destination();			// 次の目的地を決定
+		// 移動状態は4～8秒間維持
+		const int min = 4, max = 8;		// 次の状態持続時間の最小値と最大値（秒）
 		ready_to_next_state(min, max);
 
-		move_timer_ = 0.0f;			// ړԃ^C}[Zbg
+		move_timer_ = 0.0f;			// 移動状態タイマーをリセット
 		is_moving_ = true;
 		change_state(GhoulState::Move, GhoulMotion::MOTION_WALK);
 		return;
 	}
-	// UԂւ̈ڍs
+	// 攻撃状態への移行
 	else
 	{
 		attack_interval_ = AttackInterval;
@@ -358,65 +373,65 @@ void Ghoul::next_action()
 	}
 }
 
-// ̖ړIn
+// 次の目的地を決定
 void Ghoul::next_destination()
 {
 	int i = rand_.rand_int(0, 2);
 
-	// vC[̎QƂ擾
+	// プレイヤーの参照を取得
 	auto player = world_->find_actor(ActorGroup::Player, "Player");
-	// tB[h̎QƂ擾
+	// フィールドの参照を取得
 	auto& field = world_->field();
-	// tB[h̍őƍŏW擾
+	// フィールドの最大と最小座標を取得
 	auto max_pos = field.max_position();
 	auto min_pos = field.min_position();
 
-	// i = 0A܂̓vC[݂͑ȂꍇA_ōW𐶐
+	// i = 0、またはプレイヤーは存在しない場合、ランダムで座標を生成する
 	if (i == 0 || player == nullptr)
 	{
-		// vC[Ǐ]
+		// プレイヤー追従を解除
 		is_following_player_ = false;
 
-		// x̍W𐶐;
+		// x軸の座標を生成;
 		float x = rand_.rand_float(min_pos.x, max_pos.x);
-		// z̍W𐶐
+		// z軸の座標を生成
 		float z = rand_.rand_float(min_pos.z, max_pos.z);
-		// WړInɂ
+		// 生成した座標を目的地にする
 		Vector3 new_dest = Vector3(x, 0.0f, z);
 		next_destination_ = new_dest;
 	}
 	else
 	{
-		// vC[Ǐ]Jn
+		// プレイヤー追従開始
 		is_following_player_ = true;
 
-		// vC[̈ʒu擾AړInɂ
+		// プレイヤーの位置を取得し、そこを目的地にする
 		next_destination_ = get_player_position();
 	}
 }
 
-// vC[Uł邩
+// プレイヤーを攻撃できるか
 bool Ghoul::can_attack_player()
 {
-	// vC[݂ȂꍇAfalseԂ
+	// プレイヤーが存在しない場合、falseを返す
 	if (!player_exists()) return false;
-	// vC[OɂȂ΁AAFalseԂ
+	// プレイヤーが前にいなければ、、Falseを返す
 	if (!player_in_forward()) return false;
-	// vC[Uł鋗ɂȂ΁AFalseԂ
+	// プレイヤーが攻撃できる距離内にいなければ、Falseを返す
 	if (!player_in_range_distance(Range)) return false;
-	// vC[UłpxɂȂ΁AFalseԂ
+	// プレイヤーが攻撃できる角度内にいなければ、Falseを返す
 	if (!player_in_range_angle(Angle)) return false;
-	// UԊu0傫ꍇAFalseԂ
+	// 攻撃間隔が0より大きい場合、Falseを返す
 	if (attack_interval_ > 0.0f) return false;
 
-	// SĖĂ΁ATrueԂ
+	// 条件を全て満たしていれば、Trueを返す
 	return true;
 }
 
-// ̏Ԃւ̈ڍs
+// 次の状態への移行準備
 void Ghoul::ready_to_next_state(int min, int max)
 {
-	// Ŏ̏ԎԂ߂
+	// 乱数で次の状態持続時間を決める
 	int i = rand_.rand_int(min, max);
 	state_time_ = 60 * (float)i;
 }
\ No newline at end of file
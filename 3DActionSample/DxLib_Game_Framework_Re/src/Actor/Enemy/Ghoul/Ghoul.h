@@ -8,23 +8,23 @@
 #include "../../../ID/SourceID.h"
 #include "../../../Math/Random.h"
 
-// NXFO[
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：グール
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
 class Ghoul : public Enemy
 {
 private:
-	// 񋓌^FG̏
+	// 列挙型：敵の状態
 	enum class GhoulState
 	{
-		Idle,	// Î~ҋ@
-		Move,	// ړ
-		Attack,	// U
-		Wince,	// 
-		Death,	// S
+		Idle,	// 静止待機
+		Move,	// 移動
+		Attack,	// 攻撃
+		Wince,	// 怯む
+		Death,	// 死亡
 	};
 
-	// 񋓌^FG̃[V
+	// 列挙型：敵のモーション
 	enum GhoulMotion
 	{
 		MOTION_IDLE = 0,
@@ -37,88 +37,90 @@ private:
 	};
 
 public:
-	// RXgN^
+	// コンストラクタ
 	Ghoul(IWorld* world, const Vector3& position, float angle = 0.0f, const IBodyPtr& body = std::make_shared<BoundingCapsule>(Vector3(0.0f, 9.2f, 0.0f), Matrix::Identity, 13.5f, 2.5f));
-	// XV
+	// 更新
 	virtual void update(float delta_time) override;
-	// `
+	// 描画
 	virtual void draw() const override;
-	// Փ˃ANV
+	// 描画範囲の境界球の取得
+	virtual bool bounding_sphere(Vector3& center, float& radius) const override;
+	// 衝突リアクション
 	virtual void react(Actor& other) override;
-	// bZ[W
+	// メッセージ処理
 	virtual void handle_message(EventMessage message, void* param = nullptr) override;
 
 private:
-	// Ԃ̍XV
+	// 状態の更新
 	void update_state(float delta_time);
-	// Ԃ̕ύX
+	// 状態の変更
 	void change_state(GhoulState state, int motion);
 
-	// ҋ@Ԃł̍XV
+	// 待機状態での更新
 	void idle(float delta_time);
-	// ړԂł̍XV
+	// 移動状態での更新
 	void move(float delta_time);
-	// ݏԂł̍XV
+	// 怯み状態での更新
 	void wince(float delta_time);
-	// UԂł̍XV
+	// 攻撃状態での更新
 	void attack(float delta_time);
-	// SԂł̍XV
+	// 死亡状態での更新
 	void death(float delta_time);
 
-	// ̍s
+	// 次の行動を決定
 	void next_action();
-	// ̖ړIn
+	// 次の目的地を決定
 	void next_destination();
 
-	// vC[Uł邩
+	// プレイヤーを攻撃できるか
 	virtual bool can_attack_player() override;
 
-	// ̏Ԃւ̈ڍs
+	// 次の状態への移行準備
 	void ready_to_next_state(int min, int max);
 
 private:
-	// Aj[VbV
-	AnimatedMesh	mesh_{ MESH_GHOUL };
-	// [Vԍ
+	// アニメーションメッシュ
+	AnimatedMesh	mesh_;
+	// モーション番号
 	int				motion_{ GhoulMotion::MOTION_IDLE };
-	// G̏
+	// 敵の状態
 	GhoulState		state_{ GhoulState::Idle };
-	// Ȍ
+	// 前の状態
 	GhoulState		previous_state_;
-	// ԃ^C}[
+	// 状態タイマー
 	float			state_timer_{ 0.0f };
-	// ړԃ^C}[iړԒAvC[U͈͂ɂȂΉZj
+	// 移動状態タイマー（移動状態中、プレイヤーが攻撃範囲にいなければ加算）
 	float			move_timer_{ 0.0f };
-	// 
+	// 乱数生成器
 	Random			rand_;
 
-	// U𔭐̂
+	// 攻撃判定を発生したのか
 	bool			attack_on_{ false };
-	// ̖ړIn
+	// 次の目的地
 	Vector3			next_destination_;
-	// vC[ɒǏ]Ȃ̂
+	// プレイヤーに追従中なのか
 	bool			is_following_player_{ false };
-	// ړȂ̂
+	// 移動中なのか
 	bool			is_moving_{ false };
-	// ̏Ԉێ
+	// 次の状態維持時間
 	float			state_time_{ 60.0f };
-	// ŮԊu
+	// 攻撃の間隔時間
 	float			attack_interval_{ 0.0f };
 
-	// ő̗
+	// 最大体力
 	const int		HP{ 15 };
-	// ړx
+	// 移動速度
 	const float		WalkSpeed{ 0.28f };
-	// ]x
+	// 回転速度
 	const float		RotateSpeed{ 1.0f };
-	// d
+	// 重力
 	const float		Gravity{ 0.03f };
 
-	// ݑϐ
+	// 怯み耐性
 	const int		ToWince{ 1 };
-	// G
+	// 索敵距離
 	const float		Range{ 12.0f };
-	// Gpx
+	// 索敵角度
 	const float		Angle{ 10.0f };
 };
 
@@ -12,69 +12,70 @@
 #include "../Damage.h"
 #include "PlayerInput.h"
 #include "../../Sound/Sound.h"
+#include "../Effect/ParticleEmitter.h"
 
-// NXFvC[
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：プレイヤー
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
 // ============================================================
-// ȉ͊e[V֘Ãt[
-
-const float FrameInOneSecond = 60.0f;		// 1b = 60t[
-
-const float Atk1_Speed = 2.0f;				// U1iڂ̃[Vx
-const float Atk1_Active = 15.0f;			// U1iڂ̔蔭t[
-const float Atk1_InputValid = 25.0f;		// U1iڂ̎̍s͂̊Jnt[
-const float Atk1_InputInvalid = 45.0f;		// U1iڂ̎̍s͂̏It[
-const float Atk1_End = 45.0f;				// U1iڂ̃[VIt[
-
-const float Atk2_Speed = 1.2f;				// U2iڂ̃[Vx
-const float Atk2_Active = 10.0f;			// U2iڂ̔蔭t[
-const float Atk2_InputValid = 31.0f;		// U2iڂ̎̍s͂̊Jnt[
-const float Atk2_InputInvalid = 45.0f;		// U2iڂ̎̍s͂̏It[
-const float Atk2_End = 45.0f;				// U2iڂ̃[VIt[
-
-const float Atk3_Speed = 1.65f;				// U3iڂ̃[Vx
-const float Atk3_MoveTime = 50.0f;			// U3iڂ̈ړt[
-const float Atk3_MoveSpeed = 0.24f;			// U3iڂ̈ړx
-const float Atk3_Active = 25.0f;			// U3iڂ̔蔭t[
-const float Atk3_InputValid = 50.0f;		// U3iڂ̎̍s͂̊Jnt[
-const float Atk3_InputInvalid = 60.0f;		// U3iڂ̎̍s͂̏It[
-const float Atk3_End = 60.0f;				// U3iڂ̃[VIt[
-
-const float JumpAtk1_Speed = 1.7f;			// WvU1iڂ̃[Vx
-const float JumpAtk1_MoveTime = 40.0f;		// WvU1iڂ̈ړt[
-const float JumpAtk1_MoveSpeed = 0.6f;		// WvU1iڂ̈ړx
-const float JumpAtk1_Active = 38.0f;		// WvU1iڂ̔蔭t[
-const float JumpAtk1_InputValid = 50.0f;	// WvU1iڂ̎̍s͂̊Jnt[
-const float JumpAtk1_InputInvalid = 65.0f;	// WvU1iڂ̎̍s͂̏It[
-const float JumpAtk1_End = 65.0f;			// WvU1iڂ̃[VIt[
-
-const float JumpAtk2_Speed = 1.3f;			// WvU2iڂ̃[Vx
-const float JumpAtk2_Active = 9.0f;			// WvU2iڂ̔蔭t[
-const float JumpAtk2_InputValid = 28.0f;	// WvU2iڂ̎̍s͂̊Jnt[
-const float JumpAtk2_InputInvalid = 43.0f;	// WvU2iڂ̎̍s͂̏It[
-const float JumpAtk2_End = 43.0f;			// WvU2iڂ̃[VIt[
-
-const float Damage_End = 31.0f;				// e[V̏It[
-const float Block_End = 34.0f;				// K[hɂmbNobN[V̏It[
-
-const float GuardBegin_Speed = 1.6f;		// K[hJn[V̑x
-const float GuardEnd_Speed = 1.6f;			// K[hI[V̑x
-
-const float GuardAtk_Speed = 2.0f;			// K[hŨ[Vx
-const float GuardAtk_Active = 23.0f;		// K[hU̔蔭t[
-const float GuardAtk_InputValid = 30.0f;	// K[hU̎̍s͂̊Jnt[
-const float GuardAtk_InputInvalid = 43.0f;	// K[hU̎̍s͂̏It[
-const float GuardAtk_End = 43.0f;			// K[hŨ[VIt[
-
-const float EvasionSpeed = 0.0f;			// [V̑x
+// 以下は各モーション処理関連のフレーム数
+
+const float FrameInOneSecond = 60.0f;		// 1秒 = 60フレーム
+
+const float Atk1_Speed = 2.0f;				// 攻撃1段目のモーション速度
+const float Atk1_Active = 15.0f;			// 攻撃1段目の判定発生フレーム数
+const float Atk1_InputValid = 25.0f;		// 攻撃1段目の次の行動入力の開始フレーム数
+const float Atk1_InputInvalid = 45.0f;		// 攻撃1段目の次の行動入力の終了フレーム数
+const float Atk1_End = 45.0f;				// 攻撃1段目のモーション終了フレーム数
+
+const float Atk2_Speed = 1.2f;				// 攻撃2段目のモーション速度
+const float Atk2_Active = 10.0f;			// 攻撃2段目の判定発生フレーム数
+const float Atk2_InputValid = 31.0f;		// 攻撃2段目の次の行動入力の開始フレーム数
+const float Atk2_InputInvalid = 45.0f;		// 攻撃2段目の次の行動入力の終了フレーム数
+const float Atk2_End = 45.0f;				// 攻撃2段目のモーション終了フレーム数
+
+const float Atk3_Speed = 1.65f;				// 攻撃3段目のモーション速度
+const float Atk3_MoveTime = 50.0f;			// 攻撃3段目の移動持続フレーム数
+const float Atk3_MoveSpeed = 0.24f;			// 攻撃3段目の移動速度
+const float Atk3_Active = 25.0f;			// 攻撃3段目の判定発生フレーム数
+const float Atk3_InputValid = 50.0f;		// 攻撃3段目の次の行動入力の開始フレーム数
+const float Atk3_InputInvalid = 60.0f;		// 攻撃3段目の次の行動入力の終了フレーム数
+const float Atk3_End = 60.0f;				// 攻撃3段目のモーション終了フレーム数
+
+const float JumpAtk1_Speed = 1.7f;			// ジャンプ攻撃1段目のモーション速度
+const float JumpAtk1_MoveTime = 40.0f;		// ジャンプ攻撃1段目の移動持続フレーム数
+const float JumpAtk1_MoveSpeed = 0.6f;		// ジャンプ攻撃1段目の移動速度
+const float JumpAtk1_Active = 38.0f;		// ジャンプ攻撃1段目の判定発生フレーム数
+const float JumpAtk1_InputValid = 50.0f;	// ジャンプ攻撃1段目の次の行動入力の開始フレーム数
+const float JumpAtk1_InputInvalid = 65.0f;	// ジャンプ攻撃1段目の次の行動入力の終了フレーム数
+const float JumpAtk1_End = 65.0f;			// ジャンプ攻撃1段目のモーション終了フレーム数
+
+const float JumpAtk2_Speed = 1.3f;			// ジャンプ攻撃2段目のモーション速度
+const float JumpAtk2_Active = 9.0f;			// ジャンプ攻撃2段目の判定発生フレーム数
+const float JumpAtk2_InputValid = 28.0f;	// ジャンプ攻撃2段目の次の行動入力の開始フレーム数
+const float JumpAtk2_InputInvalid = 43.0f;	// ジャンプ攻撃2段目の次の行動入力の終了フレーム数
+const float JumpAtk2_End = 43.0f;			// ジャンプ攻撃2段目のモーション終了フレーム数
+
+const float Damage_End = 31.0f;				// 被弾モーションの終了フレーム数
+const float Block_End = 34.0f;				// ガードによるノックバックモーションの終了フレーム数
+
+const float GuardBegin_Speed = 1.6f;		// ガード開始モーションの速度
+const float GuardEnd_Speed = 1.6f;			// ガード終了モーションの速度
+
+const float GuardAtk_Speed = 2.0f;			// ガード攻撃のモーション速度
+const float GuardAtk_Active = 23.0f;		// ガード攻撃の判定発生フレーム数
+const float GuardAtk_InputValid = 30.0f;	// ガード攻撃の次の行動入力の開始フレーム数
+const float GuardAtk_InputInvalid = 43.0f;	// ガード攻撃の次の行動入力の終了フレーム数
+const float GuardAtk_End = 43.0f;			// ガード攻撃のモーション終了フレーム数
+
+const float EvasionSpeed = 0.0f;			// 回避モーションの速度
 
 // ============================================================
 
-// RXgN^
+// コンストラクタ
 Player::Player(IWorld* world, const Vector3& position, float angle, const IBodyPtr& body) :
 	Actor(world, "Player", position, body),
-	mesh_{ MESH_PALADIN, MOTION_IDLE },
+	mesh_{ world->animation_arena(), MESH_PALADIN, MOTION_IDLE },
 	motion_{ MOTION_IDLE },
 	state_{ PlayerState::Normal },
 	is_ground_{ false },
@@ -94,103 +95,119 @@ Player::Player(IWorld* world, const Vector3& position, float angle, const IBodyP
 	recovery_timer_.reset();
 }
 
-// XV
+// 更新
 void Player::update(float delta_time)
 {
-	// HP0ȉɂȂƁASԂɈڍs
+	// HPが0以下になると、死亡状態に移行
 	if (current_hp_ <= 0 && state_ != PlayerState::Death)
 	{
 		change_state(PlayerState::Death, MOTION_DEATH);
 		return;
 	}
 
-	// Gԃ^C}[XV
+	// 無敵時間タイマーを更新
 	invincible_timer_.update(delta_time);
 
-	// qbgXgbv^C}[XV
+	// ヒットストップタイマーを更新
 	hit_stop_timer_.update(delta_time);
-	// qbgXgbvĂ΁Aȍ~̍XV͂Ȃ
+	// ヒットストップしていれば、以降の更新はしない
 	if (is_hit_stop()) return;
 
-	// 񕜏
+	// 自動回復処理
 	recovery(delta_time);
 
-	// 
-	velocity_ += Vector3::Down * PlayerParameter::Gravity;	// d͉xvZ
-	position_.y += velocity_.y * delta_time;				// yWvZ
+	// 落下処理
+	velocity_ += Vector3::Down * PlayerParameter::Gravity;	// 重力加速度を計算
+	position_.y += velocity_.y * delta_time;				// y軸座標を計算
 
-	intersect_ground();		// nʂƂ̐ڐG
-	intersect_wall();		// ǂƂ̐ڐG
-	clamp_position();		// W
+	intersect_ground();		// 地面との接触処理
+	intersect_wall();		// 壁との接触処理
+	clamp_position();		// 座標制限
 
-	// K[hԂZbg
+	// ガード状態をリセット
 	is_guard_ = false;
 
-	// v[[̏ԂXV
+	// プレーヤーの状態を更新
 	update_state(delta_time);
-	// [VύX
-	mesh_.change_motion(motion_);
-	// bVXV
+	// モーションを変更（連続攻撃で頻繁に切り替わるため、慣性補間で遷移）
+	mesh_.change_motion(motion_, MotionTransition::Inertialization);
+	// メッシュを更新
 	mesh_.update(delta_time);
-	// svZ
+	// 行列を計算
 	mesh_.transform(pose());
 }
 
-// `
+// 描画
 void Player::draw() const
 {
-	mesh_.draw();	// bV`
+	mesh_.draw(world_->render_queue());	// メッシュの描画を記録
 
-	// RC_[`ifobO[ĥ݁Apj
+	// コライダーを描画（デバッグモードのみ、調整用）
 	body_->transform(pose())->draw();
 }
 
-// Փ˃ANV
+// 描画範囲の境界球の取得
+bool Player::bounding_sphere(Vector3& center, float& radius) const
+{
+	// スキニング後の境界ボックスがまだ計算されていなければカリングしない
+	const auto& bounds = mesh_.bounds();
+	if (bounds.IsEmpty()) return false;
+
+	center = bounds.Center();
+	radius = bounds.Radius();
+	return true;
+}
+
+// 衝突リアクション
 void Player::react(Actor& other)
 {
-	// SԂł͔Ȃ
+	// 死亡状態では反応しない
 	if (state_ == PlayerState::Death) return;
-	// GԂł͔Ȃ
+	// 無敵状態では反応しない
 	if (is_invincible()) return;
 }
 
-// bZ[W
+// メッセージ処理
 void Player::handle_message(EventMessage message, void* param)
 {
-	// GԒA݂⎀SԂł͔Ȃ
+	// 無敵時間中、怯みや死亡状態では反応しない
 	if (is_invincible() || state_ == PlayerState::Death) return;
 
-	// G_[W󂯂
+	// 敵からダメージを受ける
 	if (message == EventMessage::PlayerDamage)
 	{
-		// JU
+		// カメラを振動させる
 		world_->send_message(EventMessage::Camera_Vibration);
-		// 񕜊ԊuZbg
+		// 回復間隔をリセット
 		recovery_timer_.reset();
 
-		// bZ[WG̍U擾
+		// メッセージから敵の攻撃を取得
 		Damage* damage = (Damage*)param;
 		Vector3 atk_pos = damage->position;
 
-		// K[h
+		// ガード判定
 		if (is_guard_ && can_block(atk_pos))
 		{
-			// ÜʒuvC[ȌꍇAK[h
-			Sound::play_se(SE_BLOCK);	// SE炷
+			// 攻撃判定の位置がプレイヤーより前の場合、ガードが成立する
+			Sound::play_se(SE_BLOCK);	// SEを鳴らす
+			// 攻撃を受け止めた位置から敵の方向へ火花を発生させる
+			world_->add_actor(ActorGroup::Effect, new_actor<ParticleEmitter>(world_, ParticleEffect::Block, atk_pos, atk_pos - position_));
 			change_state(PlayerState::Blocking, MOTION_GUARD_BLOCK);
 			return;
 		}
 
-		// K[hȂꍇA_[WvZ
-		current_hp_ -= damage->power;	// _[WvZ
-		// X[p[A[}[ԂłȂ΁AݏԂֈڍs
+		// ガードが成立しない場合、ダメージを計算する
+		current_hp_ -= damage->power;	// ダメージ計算
+		// 攻撃を受けた位置から火花を発生させる
+		world_->add_actor(ActorGroup::Effect, new_actor<ParticleEmitter>(world_, ParticleEffect::Hit, atk_pos, atk_pos - position_));
+		// スーパーアーマー状態でなければ、怯み状態へ移行
 		if (!is_super_armor())
 		{
 			change_state(PlayerState::Damage, MOTION_IMPACT);
 		}
 	}
 
-	// qbgXgbv
+	// ヒットストップ発生
 	if (message == EventMessage::HitStop)
 	{
 		float* hit_stop_time = (float*)param;
@@ -198,26 +215,26 @@ void Player::handle_message(EventMessage message, void* param)
 	}
 }
 
-// ̗͂̎擾
+// 体力の取得
 int Player::get_HP()
 {
 	return current_hp_;
 }
 
-// ړʂ̎擾
+// 移動量の取得
 Vector3 Player::get_velocity()
 {
 	return velocity_;
 }
 
-// Ԃ̍XV
+// 状態の更新
 void Player::update_state(float delta_time)
 {
-	// ݂̏ԂɉāAvC[XV
+	// 現在の状態に応じて、プレイヤーを更新
 	switch (state_)
 	{
 	case PlayerState::Normal:
-		mesh_.reset_speed();	// [V̑x𒲐
+		mesh_.reset_speed();	// モーションの速度を調節
 		normal(delta_time);
 		break;
 	case PlayerState::Slash1:
@@ -280,10 +297,10 @@ void Player::update_state(float delta_time)
 		break;
 	}
 
-	state_timer_.update(delta_time);		// ԃ^C}[Z
+	state_timer_.update(delta_time);		// 状態タイマーを加算
 }
 
-// Ԃ̕ύX
+// 状態の変更
 void Player::change_state(PlayerState state, int motion)
 {
 	motion_ = motion;
@@ -294,27 +311,27 @@ void Player::change_state(PlayerState state, int motion)
 	jump_attack_started_ = false;
 }
 
-// ʏԂł̍XV
+// 通常状態での更新
 void Player::normal(float delta_time)
 {
-	// UAK[h̍s͐ڒnԂłڍsłȂ
+	// 攻撃、ガードの行動は接地状態でしか移行できない
 	if (is_ground_)
 	{
-		// WvUԂւ̈ڍs
+		// ジャンプ攻撃状態への移行
 		if (PlayerInput::jump_attack())
 		{
 			change_state(PlayerState::JumpAttack1, MOTION_JUMP_ATTACK);
 			return;
 		}
 
-		// UԂւ̈ڍs
+		// 攻撃状態への移行
 		if (PlayerInput::attack())
 		{
 			change_state(PlayerState::Slash1, MOTION_SLASH_1);
 			return;
 		}
 
-		// K[hԂւ̈ڍs
+		// ガード状態への移行
 		if (PlayerInput::guard())
 		{
 			change_state(PlayerState::Guard, MOTION_GUARD_BEGIN);
@@ -323,55 +340,55 @@ void Player::normal(float delta_time)
 	}
 
 	// ============================================================
-	// ȉ͈ړ
-	int motion{ MOTION_IDLE };		// Ȃ΁Aҋ@[VɕύX
+	// 以下は移動処理
+	int motion{ MOTION_IDLE };		// 何もしなければ、待機モーションに変更
 
-	// J擾
+	// カメラを取得
 	auto camera = world_->camera()->pose();
-	// J̐ʃxNg擾
+	// カメラの正面ベクトルを取得
 	auto camera_forward = camera.Forward();
-	// Jy𖳎
+	// カメラのy軸成分を無視する
 	camera_forward.y = 0;
-	// K
+	// 正規化
 	camera_forward.Normalize();
 
-	// x,zړʂZbg
+	// x,z軸移動量をリセット
 	velocity_.x = 0;
 	velocity_.z = 0;
-	float forward_speed{ 0.0f };	// Ox
-	float left_speed{ 0.0f };		// x
+	float forward_speed{ 0.0f };	// 前向き速度
+	float left_speed{ 0.0f };		// 左向き速度
 
-	// ړ͐ڒnԂłłȂ
+	// 移動は接地状態でしかできない
 	if (is_ground_)
 	{
-		// ړ͂擾
-		forward_speed = PlayerParameter::DashSpeed * PlayerInput::move_input().y;	// O
-		left_speed = -PlayerParameter::DashSpeed * PlayerInput::move_input().x;		// E
+		// 移動入力を取得
+		forward_speed = PlayerParameter::DashSpeed * PlayerInput::move_input().y;	// 前後
+		left_speed = -PlayerParameter::DashSpeed * PlayerInput::move_input().x;		// 左右
 	}
-	// ړĂ΁As[VɕύX
+	// 移動していれば、歩行モーションに変更
 	if (forward_speed != 0.0f || left_speed != 0.0f)
 		motion = MOTION_DASH;
 
-	// ԂXV
+	// 状態を更新
 	change_state(PlayerState::Normal, motion);
 
-	// ړʂvZAvC[ړ
-	velocity_ += camera_forward * forward_speed;	// O㑬xZ
-	velocity_ += camera.Left() * left_speed;		// ExZ
-	velocity_.Normalize();							// ړx𐳋K
-	position_ += velocity_ * delta_time;			// ̈ʒuvZ
+	// 移動量を計算し、プレイヤーを移動させる
+	velocity_ += camera_forward * forward_speed;	// 前後速度を加算
+	velocity_ += camera.Left() * left_speed;		// 左右速度を加算
+	velocity_.Normalize();							// 移動速度を正規化
+	position_ += velocity_ * delta_time;			// 次の位置を計算
 
-	// vC[]
-	if (velocity_.x != 0.0f || velocity_.z != 0.0f)		// ړĂ
+	// プレイヤーを回転させる
+	if (velocity_.x != 0.0f || velocity_.z != 0.0f)		// 移動していれば
 	{
-		Matrix new_rotation = Matrix::CreateWorld(Vector3::Zero, Vector3(velocity_.x, 0.0f, velocity_.z).Normalize(), Vector3::Up);	// Vݒ
-		rotation_ = Matrix::Lerp(rotation_, new_rotation, PlayerParameter::RotateSpeed);	// Ԃŕ]
+		Matrix new_rotation = Matrix::CreateWorld(Vector3::Zero, Vector3(velocity_.x, 0.0f, velocity_.z).Normalize(), Vector3::Up);	// 新しい方向を設定
+		rotation_ = Matrix::Lerp(rotation_, new_rotation, PlayerParameter::RotateSpeed);	// 補間で方向を転換する
 	}
 
-	// ړI
+	// 移動処理終了
 	// ============================================================
 
-	// 
+	// 回避
 	if (PlayerInput::evasion() && is_ground_)
 	{
 		ready_for_evasion();
@@ -380,278 +397,278 @@ void Player::normal(float delta_time)
 	}
 }
 
-// Ui1iځjł̍XV
+// 攻撃（1段目）での更新
 void Player::slash1(float delta_time)
 {
-	// U𔭐
+	// 攻撃判定を発生
 	
 	if (state_timer_.get_time() >= Atk1_Active && !attack_on_)
 	{
-		attack_on_ = true;	// U1񂵂Ȃ
+		attack_on_ = true;	// 攻撃判定は1回しか発生しない
 
-		// Up[^\̂𐶐
-		const float distance = 12.0f;						// U̔iOǂꂮ炢j
-		const float height = 9.5f;							// U̍
-		Vector3 atk_pos = position_ + pose().Forward() * distance + Vector3(0.0f, height, 0.0f);	// Üʒu
-		int		power = PlayerParameter::Power_Atk1;		// З
-		int		wince = PlayerParameter::Wince_Atk1;		// ݒl
-		float	hit_stop = PlayerParameter::HitStop_Short;	// qbgXgbv
+		// 攻撃パラメータ構造体を生成
+		const float distance = 12.0f;						// 攻撃判定の発生距離（前方からどれぐらい）
+		const float height = 9.5f;							// 攻撃判定の高さ
+		Vector3 atk_pos = position_ + pose().Forward() * distance + Vector3(0.0f, height, 0.0f);	// 攻撃判定の位置
+		int		power = PlayerParameter::Power_Atk1;		// 威力
+		int		wince = PlayerParameter::Wince_Atk1;		// 怯み値
+		float	hit_stop = PlayerParameter::HitStop_Short;	// ヒットストップ
 		AttackParameter atk_para{ atk_pos, power, wince, hit_stop };
-		// U𐶐
+		// 攻撃判定を生成
 		world_->add_actor(ActorGroup::PlayerAttack, new_actor<PlayerAttack>(world_, atk_para));
-		Sound::play_se(SE_SLASH);		// SEĐ
+		Sound::play_se(SE_SLASH);		// SEを再生
 	}
 	
-	// [VȊOɁA̍Uւ̈ڍs
+	// モーション終了の前に、次の攻撃や回避への移行
 	if (state_timer_.get_time() > Atk1_InputValid && state_timer_.get_time() <= Atk1_InputInvalid && is_ground_)
 	{
-		// U2iKڂւ̈ڍs
+		// 攻撃の2段階目への移行
 		if (PlayerInput::attack())
 		{
 			change_state(PlayerState::Slash2, MOTION_SLASH_2);
 			return;
 		}
 
-		// ւ̈ڍs
+		// 回避への移行
 		if (PlayerInput::evasion())
 		{
 			attack_to_evasion();
 		}
 	}
 	
-	// [VIAʏԂɖ߂
+	// モーション終了後、通常状態に戻る
 	if (state_timer_.get_time() >= Atk1_End)
 	{
 		normal(delta_time);
 	}
 }
 
-// Ui2iځjł̍XV
+// 攻撃（2段目）での更新
 void Player::slash2(float delta_time)
 {
-	// U𔭐
+	// 攻撃判定を発生
 	if (state_timer_.get_time() >= Atk2_Active && !attack_on_)
 	{
-		attack_on_ = true;	// U1񂵂Ȃ
+		attack_on_ = true;	// 攻撃判定は1回しか発生しない
 
-		// Up[^\̂𐶐
-		const float distance = 12.0f;						// U̔iOǂꂮ炢j
-		const float height = 9.5f;							// U̍
-		Vector3 atk_pos = position_ + pose().Forward() * distance + Vector3(0.0f, height, 0.0f);	// Üʒu
-		int		power = PlayerParameter::Power_Atk2;		// З
-		int		wince = PlayerParameter::Wince_Atk2;		// ݒl
-		float	hit_stop = PlayerParameter::HitStop_Short;	// qbgXgbv
+		// 攻撃パラメータ構造体を生成
+		const float distance = 12.0f;						// 攻撃判定の発生距離（前方からどれぐらい）
+		const float height = 9.5f;							// 攻撃判定の高さ
+		Vector3 atk_pos = position_ + pose().Forward() * distance + Vector3(0.0f, height, 0.0f);	// 攻撃判定の位置
+		int		power = PlayerParameter::Power_Atk2;		// 威力
+		int		wince = PlayerParameter::Wince_Atk2;		// 怯み値
+		float	hit_stop = PlayerParameter::HitStop_Short;	// ヒットストップ
 		AttackParameter atk_para{ atk_pos, power, wince, hit_stop };
-		// U𐶐
+		// 攻撃判定を生成
 		world_->add_actor(ActorGroup::PlayerAttack, new_actor<PlayerAttack>(world_, atk_para));
-		Sound::play_se(SE_SLASH);	// SEĐ
+		Sound::play_se(SE_SLASH);	// SEを再生
 	}
 
-	// [VȊOɁA̍Uւ̈ڍs
+	// モーション終了の前に、次の攻撃や回避への移行
 	if (state_timer_.get_time() > Atk2_InputValid && state_timer_.get_time() < Atk2_InputInvalid && is_ground_)
 	{
-		// U3iKڂւ̈ڍs
+		// 攻撃の3段階目への移行
 		if (PlayerInput::attack())
 		{
 			change_state(PlayerState::Slash3, MOTION_SLASH_3);
 			return;
 		}
 
-		// ւ̈ڍs
+		// 回避への移行
 		if (PlayerInput::evasion())
 		{
 			attack_to_evasion();
 		}
 	}
 
-	// [VIAʏԂɖ߂
+	// モーション終了後、通常状態に戻る
 	if (state_timer_.get_time() >= Atk2_End)
 	{
 		normal(delta_time);
 	}
 }
 
-// Ui3iځjł̍XV
+// 攻撃（3段目）での更新
 void Player::slash3(float delta_time)
 {
-	// nʂɗꂽAʏԂɖ߂
+	// 地面に離れたら、通常状態に戻る
 	if (!is_ground_)
 	{
 		normal(delta_time);
 	}
 
-	// [VĐ̊ԁALN^[Oi
+	// モーション再生の間、キャラクターを前進させる
 	if (state_timer_.get_time() <= Atk3_MoveTime)
 	{
 		velocity_ = rotation_.Forward() * Atk3_MoveSpeed;
 		position_ += velocity_ * delta_time;
 	}
 
-	// U𔭐
+	// 攻撃判定を発生
 	if (state_timer_.get_time() >= Atk3_Active && !attack_on_)
 	{
-		attack_on_ = true;	// U1񂵂Ȃ
+		attack_on_ = true;	// 攻撃判定は1回しか発生しない
 
-		// Up[^\̂𐶐
-		const float distance = 15.0f;						// U̔iOǂꂮ炢j
-		const float height = 9.5f;							// U̍
-		Vector3 atk_pos = position_ + pose().Forward() * distance + Vector3(0.0f, height, 0.0f);	// Üʒu
-		int		power = PlayerParameter::Power_Atk3;		// З
-		int		wince = PlayerParameter::Wince_Atk3;		// ݒl
-		float	hit_stop = PlayerParameter::HitStop_Long;	// qbgXgbv
+		// 攻撃パラメータ構造体を生成
+		const float distance = 15.0f;						// 攻撃判定の発生距離（前方からどれぐらい）
+		const float height = 9.5f;							// 攻撃判定の高さ
+		Vector3 atk_pos = position_ + pose().Forward() * distance + Vector3(0.0f, height, 0.0f);	// 攻撃判定の位置
+		int		power = PlayerParameter::Power_Atk3;		// 威力
+		int		wince = PlayerParameter::Wince_Atk3;		// 怯み値
+		float	hit_stop = PlayerParameter::HitStop_Long;	// ヒットストップ
 		AttackParameter atk_para{ atk_pos, power, wince, hit_stop };
-		// U𐶐
+		// 攻撃判定を生成
 		world_->add_actor(ActorGroup::PlayerAttack, new_actor<PlayerAttack>(world_, atk_para));
-		Sound::play_se(SE_SLASH);	// SEĐ
+		Sound::play_se(SE_SLASH);	// SEを再生
 	}
 
-	// [VȊOɁAւ̈ڍs
+	// モーション終了の前に、回避への移行
 	if (state_timer_.get_time() > Atk3_InputValid && state_timer_.get_time() < Atk3_InputInvalid && is_ground_)
 	{
-		// +͂ƁAԂɈڍs
+		// 方向+回避入力されると、回避状態に移行
 		if (PlayerInput::evasion())
 		{
 			attack_to_evasion();
 		}
 	}
 
-	// [VIAʏԂɖ߂
+	// モーション終了後、通常状態に戻る
 	if (state_timer_.get_time() >= Atk3_End)
 	{
 		normal(delta_time);
 	}
 }
 
-// WvUi1iځjł̍XV
+// ジャンプ攻撃（1段目）での更新
 void Player::jump_attack1(float delta_time)
 {
-	// [VĐ̊ԁALN^[Oi
+	// モーション再生の間、キャラクターを前進させる
 	if (state_timer_.get_time() < JumpAtk1_MoveTime)
 	{
 		velocity_ = rotation_.Forward() * JumpAtk1_MoveSpeed;
 		position_ += velocity_ * delta_time;
 	}
 
-	// U𔭐
+	// 攻撃判定を発生
 	if (state_timer_.get_time() >= JumpAtk1_Active && !attack_on_)
 	{
-		attack_on_ = true;	// U1񂵂Ȃ
+		attack_on_ = true;	// 攻撃判定は1回しか発生しない
 
-		// Up[^\̂𐶐
-		const float distance = 13.0f;						// U̔iOǂꂮ炢j
-		const float height = 9.5f;							// U̍
-		Vector3 atk_pos = position_ + pose().Forward() * distance + Vector3(0.0f, height, 0.0f);	// Üʒu
-		int		power = PlayerParameter::Power_JumpAtk1;	// З
-		int		wince = PlayerParameter::Wince_JumpAtk1;	// ݒl
-		float	hit_stop = PlayerParameter::HitStop_Long;	// qbgXgbv
+		// 攻撃パラメータ構造体を生成
+		const float distance = 13.0f;						// 攻撃判定の発生距離（前方からどれぐらい）
+		const float height = 9.5f;							// 攻撃判定の高さ
+		Vector3 atk_pos = position_ + pose().Forward() * distance + Vector3(0.0f, height, 0.0f);	// 攻撃判定の位置
+		int		power = PlayerParameter::Power_JumpAtk1;	// 威力
+		int		wince = PlayerParameter::Wince_JumpAtk1;	// 怯み値
+		float	hit_stop = PlayerParameter::HitStop_Long;	// ヒットストップ
 		AttackParameter atk_para{ atk_pos, power, wince, hit_stop };
-		// U𐶐
+		// 攻撃判定を生成
 		world_->add_actor(ActorGroup::PlayerAttack, new_actor<PlayerAttack>(world_, atk_para));
-		Sound::play_se(SE_SLASH);	// SEĐ
+		Sound::play_se(SE_SLASH);	// SEを再生
 	}
 
-	// [VȊOɁA̍Uւ̈ڍs
+	// モーション終了の前に、次の攻撃や回避への移行
 	if (state_timer_.get_time() > JumpAtk1_InputValid && state_timer_.get_time() < JumpAtk1_InputInvalid && is_ground_)
 	{
-		// WvU2iKւ̈ڍs
+		// ジャンプ攻撃の2段階への移行
 		if (PlayerInput::attack())
 		{
 			change_state(PlayerState::JumpAttack2, MOTION_SLASH_2);
 			return;
 		}
 
-		// ւ̈ڍs
+		// 回避への移行
 		if (PlayerInput::evasion())
 		{
 			attack_to_evasion();
 		}
 	}
 
-	// [VIAʏԂɖ߂
+	// モーション終了後、通常状態に戻る
 	if (state_timer_.get_time() >= JumpAtk1_End)
 	{
 		normal(delta_time);
 	}
 }
 
-// WvUi2iځjł̍XV
+// ジャンプ攻撃（2段目）での更新
 void Player::jump_attack2(float delta_time)
 {
-	// U𔭐
+	// 攻撃判定を発生
 	if (state_timer_.get_time() >= JumpAtk2_Active && !attack_on_)
 	{
-		attack_on_ = true;	// U1񂵂Ȃ
+		attack_on_ = true;	// 攻撃判定は1回しか発生しない
 
-		// Up[^\̂𐶐
-		const float distance = 12.0f;						// U̔iOǂꂮ炢j
-		const float height = 9.5f;							// U̍
-		Vector3 atk_pos = position_ + pose().Forward() * distance + Vector3(0.0f, height, 0.0f);	// Üʒu
-		int		power = PlayerParameter::Power_JumpAtk2;	// З
-		int		wince = PlayerParameter::Wince_JumpAtk2;	// ݒl
-		float	hit_stop = PlayerParameter::HitStop_Short;	// qbgXgbv
+		// 攻撃パラメータ構造体を生成
+		const float distance = 12.0f;						// 攻撃判定の発生距離（前方からどれぐらい）
+		const float height = 9.5f;							// 攻撃判定の高さ
+		Vector3 atk_pos = position_ + pose().Forward() * distance + Vector3(0.0f, height, 0.0f);	// 攻撃判定の位置
+		int		power = PlayerParameter::Power_JumpAtk2;	// 威力
+		int		wince = PlayerParameter::Wince_JumpAtk2;	// 怯み値
+		float	hit_stop = PlayerParameter::HitStop_Short;	// ヒットストップ
 		AttackParameter atk_para{ atk_pos, power, wince, hit_stop };
-		// U𐶐
+		// 攻撃判定を生成
 		world_->add_actor(ActorGroup::PlayerAttack, new_actor<PlayerAttack>(world_, atk_para));
-		Sound::play_se(SE_SLASH);	// SEĐ
+		Sound::play_se(SE_SLASH);	// SEを再生
 
-		mesh_.reset_speed();		// ȍ~̃[Vxxɂ
+		mesh_.reset_speed();		// 以降のモーション速度を少し遅くにする
 	}
 
-	// [VȊOɁA̍Uւ̈ڍs
+	// モーション終了の前に、次の攻撃や回避への移行
 	if (state_timer_.get_time() > JumpAtk2_InputValid && state_timer_.get_time() < JumpAtk2_InputInvalid && is_ground_)
 	{
-		// ʏU1iKڂւ̈ڍs
+		// 通常攻撃の1段階目への移行
 		if (PlayerInput::attack())
 		{
 			change_state(PlayerState::Slash1, MOTION_SLASH_1);
 			return;
 		}
 
-		// ւ̈ڍs
+		// 回避への移行
 		if (PlayerInput::evasion())
 		{
 			attack_to_evasion();
 		}
 	}
 
-	// [VIAʏԂɖ߂
+	// モーション終了後、通常状態に戻る
 	if (state_timer_.get_time() >= JumpAtk2_End)
 	{
 		normal(delta_time);
 	}
 }
 
-// eԂł̍XV
+// 被弾状態での更新
 void Player::damage(float delta_time)
 {
-	// [VIAʏԂɖ߂
+	// モーション終了後、通常状態に戻る
 	if (state_timer_.get_time() >= Damage_End)
 	{
 		normal(delta_time);
 	}
 }
 
-// K[h̍XV
+// ガード時の更新
 void Player::guard(float delta_time)
 {
-	// K[h𔭐
+	// ガード判定を発生
 	is_guard_ = true;
 
-	// K[hUւ̈ڍs
+	// ガード攻撃への移行
 	if (PlayerInput::attack())
 	{
 		change_state(PlayerState::GuardAttack, MOTION_GUARD_SLASH);
 		return;
 	}
 
-	// K[hJñ[VIAK[hҋ@[VɈڍs
+	// ガード開始のモーション終了後、ガード待機モーションに移行
 	if (state_timer_.get_time() >= mesh_.motion_end_time())
 	{
 		mesh_.reset_speed();
 		motion_ = MOTION_GUARD_IDLE;
 	}
 
-	// RL[ꂽAK[hIԂɈڍs
+	// Rキーが離れたら、ガード終了状態に移行
 	if (PlayerInput::guard_end())
 	{
 		mesh_.reset_speed();
@@ -659,12 +676,12 @@ void Player::guard(float delta_time)
 	}
 }
 
-// K[hɂmbNobN̍XV
+// ガードによるノックバック中の更新
 void Player::blocking(float delta_time)
 {
-	is_guard_ = true;				// K[hԂL
+	is_guard_ = true;				// ガード状態を有効化
 
-	// [VIAK[hԂɖ߂
+	// モーション終了後、ガード状態に戻る
 	if (state_timer_.get_time() >= Block_End)
 	{
 
@@ -673,192 +690,192 @@ void Player::blocking(float delta_time)
 	}
 }
 
-// K[hUł̍XV
+// ガード攻撃での更新
 void Player::guard_attack(float delta_time)
 {
-	// U𔭐
+	// 攻撃判定を発生
 	if (state_timer_.get_time() >= GuardAtk_Active && !attack_on_)
 	{
-		attack_on_ = true;	// U1񂵂Ȃ
+		attack_on_ = true;	// 攻撃判定は1回しか発生しない
 
-		// Up[^\̂𐶐
-		const float distance = 15.0f;						// U̔iOǂꂮ炢j
-		const float height = 9.5f;							// U̍
-		Vector3 atk_pos = position_ + pose().Forward() * distance + Vector3(0.0f, height, 0.0f);	// Üʒu
-		int		power = PlayerParameter::Power_GuardAtk;	// З
-		int		wince = PlayerParameter::Wince_GuardAtk;	// ݒl
-		float	hit_stop = PlayerParameter::HitStop_Short;	// qbgXgbv
+		// 攻撃パラメータ構造体を生成
+		const float distance = 15.0f;						// 攻撃判定の発生距離（前方からどれぐらい）
+		const float height = 9.5f;							// 攻撃判定の高さ
+		Vector3 atk_pos = position_ + pose().Forward() * distance + Vector3(0.0f, height, 0.0f);	// 攻撃判定の位置
+		int		power = PlayerParameter::Power_GuardAtk;	// 威力
+		int		wince = PlayerParameter::Wince_GuardAtk;	// 怯み値
+		float	hit_stop = PlayerParameter::HitStop_Short;	// ヒットストップ
 		AttackParameter atk_para{ atk_pos, power, wince, hit_stop };
-		// U𐶐
+		// 攻撃判定を生成
 		world_->add_actor(ActorGroup::PlayerAttack, new_actor<PlayerAttack>(world_, atk_para));
-		Sound::play_se(SE_SLASH);	// SEĐ
+		Sound::play_se(SE_SLASH);	// SEを再生
 	}
 
-	// [VȊOɁA̍Uւ̈ڍs
+	// モーション終了の前に、次の攻撃や回避への移行
 	if (state_timer_.get_time() > GuardAtk_InputValid && state_timer_.get_time() < GuardAtk_InputInvalid)
 	{
-		// ʏU1iKڂւ̈ڍs
+		// 通常攻撃の1段階目への移行
 		if (PlayerInput::attack())
 		{
 			change_state(PlayerState::Slash1, MOTION_SLASH_1);
 			return;
 		}
 
-		// ւ̈ڍs
+		// 回避への移行
 		if (PlayerInput::evasion())
 		{
 			attack_to_evasion();
 		}
 	}
 
-	// ʏԂւ̈ڍs
+	// 通常状態への移行
 	if (state_timer_.get_time() >= GuardAtk_End)
 	{
 		normal(delta_time);
 	}
 }
 
-// K[hI̍XV
+// ガード終了時の更新
 void Player::guard_end(float delta_time)
 {
-	// [VIAʏԂɖ߂
+	// モーション終了後、通常状態に戻る
 	if (state_timer_.get_time() >= mesh_.motion_end_time() + 4.0f)
 	{
 		normal(delta_time);
 	}
 }
 
-// SԂł̍XV
+// 死亡状態での更新
 void Player::death(float delta_time)
 {
-	// vC[SbZ[W𑗂i1񂾂j
+	// プレイヤー死亡メッセージを送る（1回だけ）
 	if (!is_defeated_)
 	{
 		world_->send_message(EventMessage::PlayerDead);
 		is_defeated_ = true;
 	}
 
-	// [VIƁASL
+	// モーションが終了すると、死亡判定を有効に
 	if (state_timer_.get_time() >= mesh_.motion_end_time() * 2.0f)
 	{
 		die();
 	}
 }
 
-// OԂł̍XV
+// 前回避状態での更新
 void Player::forward_evasion(float delta_time)
 {
-	// nʂɗꂽAʏԂɖ߂
+	// 地面に離れたら、通常状態に戻る
 	if (!is_ground_)
 	{
-		invincible_timer_.shut();	// GԂI
+		invincible_timer_.shut();	// 無敵時間を強制終了
 		normal(delta_time);
 	}
 
-	// vC[̍Wړ
+	// プレイヤーの座標を移動
 	velocity_ = rotation_.Forward() * PlayerParameter::EvasionSpeed;
 	position_ += velocity_ * delta_time;
 
-	// IAʏԂɖ߂
+	// 回避終了後、通常状態に戻る
 	if (evasion_timer_.is_time_out())
 	{
 		normal(delta_time);
 		return;
 	}
 
-	// ^C}[XV
+	// 回避タイマーを更新
 	evasion_timer_.update(delta_time);
 }
 
-// Ԃł̍XV
+// 左回避状態での更新
 void Player::left_evasion(float delta_time)
 {
-	// nʂɗꂽAʏԂɖ߂
+	// 地面に離れたら、通常状態に戻る
 	if (!is_ground_)
 	{
-		invincible_timer_.shut();	// GԂI
+		invincible_timer_.shut();	// 無敵時間を強制終了
 		normal(delta_time);
 	}
 
-	// vC[̍Wړ
+	// プレイヤーの座標を移動
 	velocity_ = rotation_.Left() * PlayerParameter::EvasionSpeed;
 	position_ += velocity_ * delta_time;
 
-	// IAʏԂɖ߂
+	// 回避終了後、通常状態に戻る
 	if (evasion_timer_.is_time_out())
 	{
 		normal(delta_time);
 		return;
 	}
 
-	// ^C}[XV
+	// 回避タイマーを更新
 	evasion_timer_.update(delta_time);
 }
 
-// EԂł̍XV
+// 右回避状態での更新
 void Player::right_evasion(float delta_time)
 {
-	// nʂɗꂽAʏԂɖ߂
+	// 地面に離れたら、通常状態に戻る
 	if (!is_ground_)
 	{
-		invincible_timer_.shut();	// GԂI
+		invincible_timer_.shut();	// 無敵時間を強制終了
 		normal(delta_time);
 	}
 
-	// vC[̍Wړ
+	// プレイヤーの座標を移動
 	velocity_ = rotation_.Right() * PlayerParameter::EvasionSpeed;
 	position_ += velocity_ * delta_time;
 
-	// IAʏԂɖ߂
+	// 回避終了後、通常状態に戻る
 	if (evasion_timer_.is_time_out())
 	{
 		normal(delta_time);
 		return;
 	}
 
-	// ^C}[XV
+	// 回避タイマーを更新
 	evasion_timer_.update(delta_time);
 }
 
-// Ủsڍs
+// 攻撃後の回避行動移行
 void Player::attack_to_evasion()
 {
-	// vC[͂̕擾
+	// プレイヤーの方向入力を取得
 	auto input = PlayerInput::move_input();
 
-	// J擾
+	// カメラを取得
 	auto camera = world_->camera()->pose();
-	// J̐ʃxNg擾
+	// カメラの正面ベクトルを取得
 	auto camera_forward = camera.Forward();
-	// Jy𖳎
+	// カメラのy軸成分を無視する
 	camera_forward.y = 0;
-	// K
+	// 正規化
 	camera_forward.Normalize();
 
-	// ͂AJ̃xNgɕϊ
+	// 入力した方向を、カメラからのベクトルに変換
 	Vector3 direction = Vector3::Zero;
 	direction += camera_forward * input.y;
 	direction += camera.Left() * -input.x;
 	direction.Normalize();
 
-	// ͂ƃvC[̕xNg̍45ȉ̏ꍇAsɈڂ
+	// 入力した方向とプレイヤーの方向ベクトルの差が45°以下の場合、回避行動に移る
 	float angle = 45.0f;
 
-	// 
+	// 左回避
 	if (Vector3::Angle(rotation_.Left(), direction) <= angle)
 	{
 		ready_for_evasion();
 		change_state(PlayerState::LeftEvasion, PlayerMotion::MOTION_STRAFE_LEFT);
 		return;
 	}
-	// E
+	// 右回避
 	else if (Vector3::Angle(rotation_.Right(), direction) <= angle)
 	{
 		ready_for_evasion();
 		change_state(PlayerState::RightEvasion, PlayerMotion::MOTION_STRAFE_RIGHT);
 		return;
 	}
-	// O
+	// 前回避
 	else
 	{
 		ready_for_evasion();
@@ -867,58 +884,58 @@ void Player::attack_to_evasion()
 	}
 }
 
-// nʂƂ̐ڐG
+// 地面との接触処理
 void Player::intersect_ground()
 {
-	// tB[h擾
+	// フィールドを取得
 	auto& field = world_->field();
-	// nʂƂ̐ڐG_
+	// 地面との接触点
 	Vector3 intersect;
-	// ڐGp
+	// 接触判定用線分
 	Line line = Line(position_ + Vector3(0.0f, 10.0f, 0.0f), position_ - Vector3(0.0f, 1.0f, 0.0f));
 
-	// nʂƂ̐ڐG_擾
+	// 地面との接触点を取得
 	if (field.collide_line(line.start, line.end, &intersect))
 	{
-		// ڒnꍇAyW␳inʂɂ߂荞܂Ȃj
+		// 接地した場合、y軸座標を補正する（地面にめり込まない）
 		if (intersect.y >= position_.y)
 		{
-			velocity_.y = 0;			// yړʂ0ɂ
-			position_.y = intersect.y;	// yʒu␳
-			is_ground_ = true;			// ڒntrueɂ
+			velocity_.y = 0;			// y軸移動量を0にする
+			position_.y = intersect.y;	// y軸位置を補正
+			is_ground_ = true;			// 接地判定をtrueにする
 		}
 	}
 	else
 	{
-		is_ground_ = false;				// ڒnfalseɂiڒnĂȂj
+		is_ground_ = false;				// 接地判定をfalseにする（接地していない）
 	}
 }
 
-// ǂƂ̐ڐG
+// 壁との接触処理
 void Player::intersect_wall()
 {
-	// tB[h擾
+	// フィールドを取得
 	auto& field = world_->field();
-	// ǂƂ̐ڐG_
+	// 壁との接触点
 	Vector3 intersect;
-	// ڐGp
+	// 接触判定用球体
 	BoundingSphere sphere = BoundingSphere(position_ + Vector3(0.0f, 8.5f, 0.0f), 4.5f);
 
-	// ǂƂ̐ڐG_擾
+	// 壁との接触点を取得
 	if (field.collide_sphere(sphere.position(), sphere.radius(), &intersect))
 	{
-		// vC[̍W␳
+		// プレイヤーの座標を補正
 		position_.x = intersect.x;
 		position_.z = intersect.z;
 	}
 }
 
-// W
+// 座標制限
 void Player::clamp_position()
 {
-	// tB[h擾
+	// フィールドを取得
 	auto& field = world_->field();
-	// tB[h̍őƍŏW擾
+	// フィールドの最大と最小座標を取得
 	auto max_pos = field.max_position();
 	auto min_pos = field.min_position();
 
@@ -926,29 +943,29 @@ void Player::clamp_position()
 	position_.z = MathHelper::clamp(position_.z, min_pos.z, max_pos.z);
 }
 
-// 
+// 回避準備
 void Player::ready_for_evasion()
 {
-	// ԂƖGԂZbg
+	// 回避時間と無敵時間をリセット
 	evasion_timer_.reset();
 	invincible_timer_.reset();
 }
 
-// qbgXgbv^C}[̃Zbg
+// ヒットストップタイマーのリセット
 void Player::reset_hit_stop(float time)
 {
 	hit_stop_timer_.reset_time(time);
 }
 
-// 
+// 自動回復
 void Player::recovery(float delta_time)
 {
-	// ̗͖^͏Ȃ
+	// 体力満タン時は処理しない
 	if (current_hp_ >= PlayerParameter::HP)	return;
-	// ݒ͏Ȃ
+	// 怯み中は処理しない
 	if (state_ == PlayerState::Damage)	return;
 
-	// 莞ԂƂɑ̗͂񕜂
+	// 一定時間ごとに体力が回復する
 	if (recovery_timer_.is_time_out())
 	{
 		current_hp_ += PlayerParameter::RecoveryAmount;
@@ -956,34 +973,34 @@ void Player::recovery(float delta_time)
 		recovery_timer_.reset();
 	}
 
-	// 񕜃^C}[XV
+	// 回復タイマーを更新
 	recovery_timer_.update(delta_time);
 }
 
-// K[h͐邩
+// ガードは成立するか
 bool Player::can_block(Vector3 atk_pos) const
 {
-	// ςōÛ𔻒
-	Vector3 to_attack = atk_pos - position_;									// ŨxNg
-	float forward_dot_target = Vector3::Dot(rotation_.Forward(), to_attack);	// OƍU̓
+	// 内積で攻撃判定のある方向を判定
+	Vector3 to_attack = atk_pos - position_;									// 攻撃判定方向のベクトル
+	float forward_dot_target = Vector3::Dot(rotation_.Forward(), to_attack);	// 前方向と攻撃判定の内積
 
-	// OƃvC[̓ς0ȏł΁ATrueԂ
+	// 前方向とプレイヤーの内積が0以上であれば、Trueを返す
 	return (forward_dot_target >= 0.0f);
 }
 
-// Gԓł邩
+// 無敵時間内であるか
 bool Player::is_invincible() const
 {
 	return (!invincible_timer_.is_time_out() || state_ == PlayerState::Damage);
 }
 
-// X[p[A[}[Ԃł邩
+// スーパーアーマー状態であるか
 bool Player::is_super_armor() const
 {
 	return state_ == PlayerState::Slash3;
 }
 
-// qbgXgbvȂ̂
+// ヒットストップ中なのか
 bool Player::is_hit_stop() const
 {
 	return !hit_stop_timer_.is_time_out();
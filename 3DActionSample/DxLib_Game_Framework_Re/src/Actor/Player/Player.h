@@ -10,169 +10,171 @@
 #include "../../Math/CountdownTimer.h"
 #include "PlayerParameter.h"
 
-// NXFvC[
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：プレイヤー
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 class Player : public Actor
 {
 private:
-	// 񋓌^FvC[̏
+	// 列挙型：プレイヤーの状態
 	enum class PlayerState
 	{
-		Normal,			// ʏ
-		Slash1,			// Ui1iځj
-		Slash2,			// Ui2iځj
-		Slash3,			// Ui3iځj
-		JumpAttack1,	// WvUi1iځj
-		JumpAttack2,	// WvUi2iځj
-		Damage,			// 
-		Guard,			// K[h
-		Blocking,		// K[hɂmbNobN
-		GuardAttack,	// K[hU
-		GuardEnd,		// K[hI
-		Death,			// S
-		ForwardEvasion,	// O
-		LeftEvasion,	// 
-		RightEvasion,	// E
+		Normal,			// 通常
+		Slash1,			// 攻撃（1段目）
+		Slash2,			// 攻撃（2段目）
+		Slash3,			// 攻撃（3段目）
+		JumpAttack1,	// ジャンプ攻撃（1段目）
+		JumpAttack2,	// ジャンプ攻撃（2段目）
+		Damage,			// 怯み
+		Guard,			// ガード
+		Blocking,		// ガードによるノックバック
+		GuardAttack,	// ガード攻撃
+		GuardEnd,		// ガード終了
+		Death,			// 死亡
+		ForwardEvasion,	// 前回避
+		LeftEvasion,	// 左回避
+		RightEvasion,	// 右回避
 	};
 
-	// 񋓌^FvC[̃[V
+	// 列挙型：プレイヤーのモーション
 	enum PlayerMotion
 	{
-		MOTION_IDLE = 16,				// Î~ҋ@
-		MOTION_WALK = 25,				// O֕s
-		MOTION_DASH = 9,				// Oփ_bV
-		MOTION_JUMP = 18,				// Wv
-		MOTION_SLASH_1 = 20,			// Ui1iځj
-		MOTION_SLASH_2 = 21,			// Ui2iځj
-		MOTION_SLASH_3 = 22,			// Ui3iځj
-		MOTION_JUMP_ATTACK = 19,		// WvU
-		MOTION_IMPACT = 17,				// 
-		MOTION_GUARD_BEGIN = 11,		// K[hJn
-		MOTION_GUARD_IDLE = 14,			// K[h
-		MOTION_GUARD_BLOCK = 12,		// K[hɂmbNobN
-		MOTION_GUARD_SLASH = 15,		// K[hU
-		MOTION_GUARD_END = 13,			// K[hI
-		MOTION_CROUCH_BEGIN = 0,		// Ⴊ݊Jn
-		MOTION_CROUCH_IDLE = 6,			// Ⴊݒҋ@
-		MOITON_CROUCH_IMPACT = 7,		// Ⴊݒe
-		MOTION_CROUCH_ATTACK = 8,		// ႪݒU
-		MOTION_CROUCH_GUARD_BEGIN = 2,	// Ⴊ݃K[hJn
-		MOTION_CROUCH_GUARD_IDLE = 5,	// Ⴊ݃K[h
-		MOTION_CROUCH_GUARD_BLOCK = 3,	// Ⴊ݃K[hɂmbNobN
-		MOTION_CROUCH_GUARD_ATTACK = 8,	// Ⴊ݃K[hUiႪݒUƓj
-		MOTION_CROUCH_GUARD_END = 4,	// Ⴊ݃K[hI
-		MOTION_CROUCH_END = 1,			// ႪݏI
-		MOTION_DEATH = 10,				// S
-		MOTION_STRAFE_LEFT = 23,		// _bV
-		MOTION_STRAFE_RIGHT = 24,		// E_bV
+		MOTION_IDLE = 16,				// 静止待機
+		MOTION_WALK = 25,				// 前方へ歩行
+		MOTION_DASH = 9,				// 前方へダッシュ
+		MOTION_JUMP = 18,				// ジャンプ
+		MOTION_SLASH_1 = 20,			// 攻撃（1段目）
+		MOTION_SLASH_2 = 21,			// 攻撃（2段目）
+		MOTION_SLASH_3 = 22,			// 攻撃（3段目）
+		MOTION_JUMP_ATTACK = 19,		// ジャンプ攻撃
+		MOTION_IMPACT = 17,				// 怯み
+		MOTION_GUARD_BEGIN = 11,		// ガード開始
+		MOTION_GUARD_IDLE = 14,			// ガード中
+		MOTION_GUARD_BLOCK = 12,		// ガードによるノックバック
+		MOTION_GUARD_SLASH = 15,		// ガード攻撃
+		MOTION_GUARD_END = 13,			// ガード終了
+		MOTION_CROUCH_BEGIN = 0,		// しゃがみ開始
+		MOTION_CROUCH_IDLE = 6,			// しゃがみ中待機
+		MOITON_CROUCH_IMPACT = 7,		// しゃがみ中被弾
+		MOTION_CROUCH_ATTACK = 8,		// しゃがみ中攻撃
+		MOTION_CROUCH_GUARD_BEGIN = 2,	// しゃがみガード開始
+		MOTION_CROUCH_GUARD_IDLE = 5,	// しゃがみガード中
+		MOTION_CROUCH_GUARD_BLOCK = 3,	// しゃがみガードによるノックバック
+		MOTION_CROUCH_GUARD_ATTACK = 8,	// しゃがみガード攻撃（しゃがみ中攻撃と同じ）
+		MOTION_CROUCH_GUARD_END = 4,	// しゃがみガード終了
+		MOTION_CROUCH_END = 1,			// しゃがみ終了
+		MOTION_DEATH = 10,				// 死亡
+		MOTION_STRAFE_LEFT = 23,		// 左ダッシュ
+		MOTION_STRAFE_RIGHT = 24,		// 右ダッシュ
 	};
 
 public:
-	// RXgN^
+	// コンストラクタ
 	Player(IWorld* world, const Vector3& position, float angle = 0.0f, const IBodyPtr& body = std::make_shared<BoundingCapsule>(Vector3(0.0f, 8.5f, 0.0f), Matrix::Identity, 11.0f, 2.5f));
-	// XV
+	// 更新
 	virtual void update(float delta_time) override;
-	// `
+	// 描画
 	virtual void draw() const override;
-	// Փ˃ANV
+	// 描画範囲の境界球の取得
+	virtual bool bounding_sphere(Vector3& center, float& radius) const override;
+	// 衝突リアクション
 	virtual void react(Actor& other) override;
-	// bZ[W
+	// メッセージ処理
 	virtual void handle_message(EventMessage message, void* param = nullptr) override;
-	// ̗͂̎擾
+	// 体力の取得
 	virtual int get_HP() override;
-	// ړʂ̎擾
+	// 移動量の取得
 	virtual Vector3 get_velocity() override;
 
 private:
-	// Ԃ̍XV
+	// 状態の更新
 	void update_state(float delta_time);
-	// Ԃ̕ύX
+	// 状態の変更
 	void change_state(PlayerState state, int motion);
 
-	// ʏԂł̍XV
+	// 通常状態での更新
 	void normal(float delta_time);
-	// Ui1iځjł̍XV
+	// 攻撃（1段目）での更新
 	void slash1(float delta_time);
-	// Ui2iځjł̍XV
+	// 攻撃（2段目）での更新
 	void slash2(float delta_time);
-	// Ui3iځjł̍XV
+	// 攻撃（3段目）での更新
 	void slash3(float delta_time);
-	// WvUi1iځjł̍XV
+	// ジャンプ攻撃（1段目）での更新
 	void jump_attack1(float delta_time);
-	// WvUi2iځjł̍XV
+	// ジャンプ攻撃（2段目）での更新
 	void jump_attack2(float delta_time);
-	// eԂł̍XV
+	// 被弾状態での更新
 	void damage(float delta_time);
-	// K[h̍XV
+	// ガード時の更新
 	void guard(float delta_time);
-	// K[hɂmbNobN̍XV
+	// ガードによるノックバック中の更新
 	void blocking(float delta_time);
-	// K[hUł̍XV
+	// ガード攻撃での更新
 	void guard_attack(float delta_time);
-	// K[hI̍XV
+	// ガード終了時の更新
 	void guard_end(float delta_time);
-	// SԂł̍XV
+	// 死亡状態での更新
 	void death(float delta_time);
-	// OԂł̍XV
+	// 前回避状態での更新
 	void forward_evasion(float delta_time);
-	// Ԃł̍XV
+	// 左回避状態での更新
 	void left_evasion(float delta_time);
-	// EԂł̍XV
+	// 右回避状態での更新
 	void right_evasion(float delta_time);
-	// Ủsڍs
+	// 攻撃後の回避行動移行
 	void attack_to_evasion();
 
-	// nʂƂ̐ڐG
+	// 地面との接触処理
 	void intersect_ground();
-	// ǂƂ̐ڐG
+	// 壁との接触処理
 	void intersect_wall();
-	// W
+	// 座標制限
 	void clamp_position();
-	// 
+	// 回避準備
 	void ready_for_evasion();
-	// qbgXgbv^C}[̃Zbg
+	// ヒットストップタイマーのリセット
 	void reset_hit_stop(float time);
 
-	// 
+	// 自動回復
 	void recovery(float delta_time);
 
-	// K[h͐邩
+	// ガードは成立するか
 	bool can_block(Vector3 atk_pos) const;
-	// Gԓł邩
+	// 無敵時間内であるか
 	bool is_invincible() const;
-	// X[p[A[}[Ԃł邩
+	// スーパーアーマー状態であるか
 	bool is_super_armor() const;
-	// qbgXgbvȂ̂
+	// ヒットストップ中なのか
 	bool is_hit_stop() const;
 
 private:
-	// Aj[VbV
-	AnimatedMesh	mesh_{ MESH_PALADIN };
-	// [Vԍ
+	// アニメーションメッシュ
+	AnimatedMesh	mesh_;
+	// モーション番号
 	int				motion_{ PlayerMotion::MOTION_IDLE };
-	// v[[̏
+	// プレーヤーの状態
 	PlayerState		state_{ PlayerState::Normal };
-	// ԃ^C}[
+	// 状態タイマー
 	Timer			state_timer_;
-	// Gԃ^C}[
+	// 無敵時間タイマー
 	CountdownTimer	invincible_timer_{ PlayerParameter::InvincibleTime };
-	// ^C}[
+	// 回避タイマー
 	CountdownTimer	evasion_timer_{ PlayerParameter::EvasionTime };
-	// qbgXgbv^C}[
+	// ヒットストップタイマー
 	CountdownTimer	hit_stop_timer_{ 0.0f };
-	// 񕜃^C}[
+	// 自動回復タイマー
 	CountdownTimer	recovery_timer_{ PlayerParameter::RecoveryInterval * 60.0f };
-	// ڒnĂ邩
+	// 接地しているか
 	bool			is_ground_{ false };
-	// K[hĂ邩
+	// ガードしているか
 	bool			is_guard_{ false };
-	// U𔭐̂
+	// 攻撃判定を発生したのか
 	bool			attack_on_{ false };
-	// WvU͊Jn
+	// ジャンプ攻撃は開始したか
 	bool			jump_attack_started_{ false };
-	// ݂̗̑
+	// 現在の体力
 	int				current_hp_;
-	// vC[͓|ꂽiS=łƂ͕ʔj
+	// プレイヤーは倒れたか（死亡=消滅とは別判定）
 	bool			is_defeated_{ false };
 };
 
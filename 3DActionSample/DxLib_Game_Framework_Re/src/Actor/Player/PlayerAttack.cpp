@@ -4,59 +4,65 @@
 #include "../../World/IWorld.h"
 #include "../../Sound/Sound.h"
 #include "../../ID/SourceID.h"
+#include "../ActorGroup.h"
+#include "../Effect/ParticleEmitter.h"
 
-// NXFvC[̍U̓蔻
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：プレイヤーの攻撃の当たり判定
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
-// RXgN^
+// コンストラクタ
 PlayerAttack::PlayerAttack(IWorld* world, const Vector3& position, int power, int impact, float hit_stop, const IBodyPtr& body) :
 	Actor(world, "PlayerAttack", position, body),
 	destroy_counter_{ 0.0f }
 {
-	power_ = power;			// З͂ݒ
-	impact_ = impact;		// ݒlݒ
-	hit_stop_ = hit_stop;	// qbgXgbvݒ
+	power_ = power;			// 威力を設定
+	impact_ = impact;		// 怯み値を設定
+	hit_stop_ = hit_stop;	// ヒットストップを設定
 }
 
-// RXgN^iUp[^\̂gpj
+// コンストラクタ（攻撃パラメータ構造体を使用）
 PlayerAttack::PlayerAttack(IWorld* world, AttackParameter parameter, const IBodyPtr& body) :
 	Actor(world, "PlayerAttack", parameter.position, body),
 	destroy_counter_{ 0.0f }
 {
-	power_ = parameter.power;		// З͂ݒ
-	impact_ = parameter.impact;		// ݒlݒ
-	hit_stop_ = parameter.hit_stop;	// qbgXgbvݒ
+	power_ = parameter.power;		// 威力を設定
+	impact_ = parameter.impact;		// 怯み値を設定
+	hit_stop_ = parameter.hit_stop;	// ヒットストップを設定
 }
 
-// XV
+// 更新
 void PlayerAttack::update(float delta_time)
 {
-	// 0.2b
+	// 0.2秒後消滅
 	if (destroy_counter_ >= 12.0f)
 	{
 		die();
 	}
 
-	destroy_counter_ += delta_time;		// ŃJE^[Z
+	destroy_counter_ += delta_time;		// 消滅カウンターを加算
 }
 
-// `
+// 描画
 void PlayerAttack::draw() const
 {
-	body_->transform(pose())->draw();	// RC_[`ifobO[ĥ݁Apj
+	body_->transform(pose())->draw();	// コライダーを描画（デバッグモードのみ、調整用）
 }
 
-// Փ˃ANV
+// 衝突リアクション
 void PlayerAttack::react(Actor& other)
 {
-	// SEĐ
+	// SEを再生
 	Sound::play_se(SE_PLAYER_ATK_HIT);
-	// Gւ̃_[W\̂𐶐
+	// 命中位置から敵の外側へ火花を発生させる
+	Vector3 direction = position_ - other.position();
+	direction.y = 0.0f;
+	world_->add_actor(ActorGroup::Effect, new_actor<ParticleEmitter>(world_, ParticleEffect::Hit, position_, direction));
+	// 敵へのダメージ構造体を生成
 	Damage damage{ position_, power_, impact_ };
-	// Gփ_[WbZ[W𑗂
+	// 敵へダメージメッセージを送る
 	other.handle_message(EventMessage::EnemyDamage, &damage);
-	// vC[ɃqbgXgbvbZ[W𑗂
+	// プレイヤーにヒットストップメッセージを送る
 	world_->send_message(EventMessage::HitStop, &hit_stop_);
-	// GɓƏ
+	// 敵に当たると消滅
 	die();
 }
\ No newline at end of file
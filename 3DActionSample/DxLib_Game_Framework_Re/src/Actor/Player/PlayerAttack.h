@@ -6,27 +6,27 @@
 #include "../Body/BoundingSphere.h"
 #include "../AttackParameter.h"
 
-// NXFvC[̍U̓蔻
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：プレイヤーの攻撃の当たり判定
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 class PlayerAttack : public Actor
 {
 public:
-	// RXgN^
+	// コンストラクタ
 	PlayerAttack(IWorld* world, const Vector3& position, int power = 0, int impact = 0, float hit_stop = 0.0f, const IBodyPtr& body = std::make_shared<BoundingSphere>(Vector3::Zero, 9.0f));
-	// RXgN^iUp[^\̂gpj
+	// コンストラクタ（攻撃パラメータ構造体を使用）
 	PlayerAttack(IWorld* world, AttackParameter parameter, const IBodyPtr& body = std::make_shared<BoundingSphere>(Vector3::Zero, 9.0f));
-	// XV
+	// 更新
 	virtual void update(float delta_time) override;
-	// `
+	// 描画
 	virtual void draw() const override;
-	// Փ˃ANV
+	// 衝突リアクション
 	virtual void react(Actor& other) override;
 
 private:
-	float destroy_counter_{ 0.0f };	// ŃJE^[
-	int power_{ 0 };				// З
-	int impact_{ 0 };				// ݒl
-	float hit_stop_{ 0.0f };		// qbgXgbv
+	float destroy_counter_{ 0.0f };	// 消滅カウンター
+	int power_{ 0 };				// 威力
+	int impact_{ 0 };				// 怯み値
+	float hit_stop_{ 0.0f };		// ヒットストップ
 };
 
 #endif // !PLAYER_ATTACK_H_
\ No newline at end of file
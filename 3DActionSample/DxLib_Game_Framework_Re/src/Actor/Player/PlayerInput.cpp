@@ -2,27 +2,27 @@
 #include "../../Input/GamePad.h"
 #include "../../Input/Keyboard.h"
 
-// NXFvC[
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：プレイヤー入力
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
-// Q[X^[g͂
+// ゲームスタート入力をしたか
 bool PlayerInput::game_start()
 {
-	// Q[pbh̃X^[g{^ƁATrueԂ
+	// ゲームパッドのスタートボタンが押されると、Trueを返す
 	if (GamePad::getInstance().ButtonTriggerDown(PadButton::Start)) return true;
-	// L[{[h̃Xy[XL[ƁATrueԂ
+	// キーボードのスペースキーが押されると、Trueを返す
 	if (Keyboard::getInstance().KeyTriggerDown(Keycode::Space)) return true;
 
 	return false;
 }
 
-// U͂
+// 攻撃入力をしたか
 bool PlayerInput::attack()
 {
 	return (GamePad::getInstance().ButtonTriggerDown(PadButton::Y) || Keyboard::getInstance().KeyTriggerDown(Keycode::Space));
 }
 
-// WvU͂
+// ジャンプ攻撃入力をしたか
 bool PlayerInput::jump_attack()
 {
 	if (GamePad::getInstance().ButtonTriggerDown(PadButton::Y) && GamePad::getInstance().ButtonTriggerDown(PadButton::B))
@@ -33,103 +33,103 @@ bool PlayerInput::jump_attack()
 	return false;
 }
 
-// K[h͂
+// ガード入力をしたか
 bool PlayerInput::guard()
 {
 	return (GamePad::getInstance().ButtonStateDown(PadButton::R) || Keyboard::getInstance().KeyStateDown(Keycode::M));
 }
 
-// K[h͂I
+// ガード入力を終了したか
 bool PlayerInput::guard_end()
 {
 	return (GamePad::getInstance().ButtonStateUp(PadButton::R) && Keyboard::getInstance().KeyStateUp(Keycode::M));
 }
 
-// ͂
+// 回避入力をしたか
 bool PlayerInput::evasion()
 {
 	return (GamePad::getInstance().ButtonTriggerDown(PadButton::A) || Keyboard::getInstance().KeyTriggerDown(Keycode::N));
 }
 
-// Oړ
+// 前移動
 bool PlayerInput::move_forward()
 {
 	return Keyboard::getInstance().KeyStateDown(Keycode::W);
 }
 
-// ړ
+// 後移動
 bool PlayerInput::move_backward()
 {
 	return Keyboard::getInstance().KeyStateDown(Keycode::S);
 }
 
-// ړ
+// 左移動
 bool PlayerInput::move_left()
 {
 	return Keyboard::getInstance().KeyStateDown(Keycode::A);
 }
 
-// Eړ
+// 右移動
 bool PlayerInput::move_right()
 {
 	return Keyboard::getInstance().KeyStateDown(Keycode::D);
 }
 
-// L[{[hňړĂ邩
+// キーボードで移動しているか
 bool PlayerInput::keyboard_move()
 {
-	// ꂩ͂̕΁ATrueԂ
+	// いずれかの方向入力があれば、Trueを返す
 	return (move_forward() || move_backward() || move_left() || move_right());
 }
 
-// ړ̓
+// 移動方向の入力
 Vector2 PlayerInput::move_input()
 {
-	Vector2 input = Vector2::Zero;	// ͏Ԃϐ錾Ă
+	Vector2 input = Vector2::Zero;	// 入力情報を返す変数を宣言しておく
 
-	// L[{[h̓͂擾
-	input.y = (move_forward()) ? 1.0f : (move_backward()) ? -1.0f : 0.0f;	// O
-	input.x = (move_left()) ? -1.0f : (move_right()) ? 1.0f : 0.0f;			// E
+	// キーボードの入力を取得
+	input.y = (move_forward()) ? 1.0f : (move_backward()) ? -1.0f : 0.0f;	// 前後
+	input.x = (move_left()) ? -1.0f : (move_right()) ? 1.0f : 0.0f;			// 左右
 
-	// L[{[h̓͂Ȃ΁AQ[pbh̓͂擾
+	// キーボードの入力がなければ、ゲームパッドの入力を取得
 	if (!keyboard_move()) input = GamePad::getInstance().L_Stick();
 
-	// K͂Ԃ
+	// 正規化した方向入力を返す
 	return input.Normalize();
 }
 
-// XeBbNňړĂ邩
+// 左スティックで移動しているか
 bool PlayerInput::gamepad_move()
 {
-	// XeBbN̓͂0łȂ΁ATrueԂ
+	// 左スティックの入力は0でなければ、Trueを返す
 	return move_input() != Vector2::Zero;
 }
 
-// J]
+// カメラ左回転
 bool PlayerInput::camera_turn_left()
 {
 	return (GamePad::getInstance().GetCurrent_R_Stick().x < 0.0f || Keyboard::getInstance().KeyStateDown(Keycode::Left));
 }
 
-// JE]
+// カメラ右回転
 bool PlayerInput::camera_turn_right()
 {
 	return (GamePad::getInstance().GetCurrent_R_Stick().x > 0.0f || Keyboard::getInstance().KeyStateDown(Keycode::Right));
 }
 
-// J]
+// カメラ上回転
 bool PlayerInput::camera_turn_up()
 {
 	return (GamePad::getInstance().GetCurrent_R_Stick().y > 0.0f || Keyboard::getInstance().KeyStateDown(Keycode::Up));
 }
 
-// J]
+// カメラ下回転
 bool PlayerInput::camera_turn_down()
 {
 	return (GamePad::getInstance().GetCurrent_R_Stick().y < 0.0f || Keyboard::getInstance().KeyStateDown(Keycode::Down));
 }
 
-// JZbg
+// カメラリセット
 bool PlayerInput::camera_reset()
 {
 	if (GamePad::getInstance().ButtonTriggerDown(PadButton::L))		return true;
@@ -138,24 +138,24 @@ bool PlayerInput::camera_reset()
 	return false;
 }
 
-// GXLbv
+// 雑魚戦スキップ
 bool PlayerInput::skip_phase1()
 {
 	return (Keyboard::getInstance().KeyTriggerDown(Keycode::T));
 }
 
-// |[Y
+// ポーズ
 bool PlayerInput::pause()
 {
-	// Q[pbh̃X^[g{^ƁATrueԂ
+	// ゲームパッドのスタートボタンが押されると、Trueを返す
 	if (GamePad::getInstance().ButtonTriggerDown(PadButton::Start)) return true;
-	// L[{[hYƁATrueԂ
+	// キーボードのYが押されると、Trueを返す
 	if (Keyboard::getInstance().KeyTriggerDown(Keycode::Y)) return true;
 
 	return false;
 }
 
-// Q[I
+// ゲーム終了
 bool PlayerInput::game_end()
 {
 	return (GamePad::getInstance().ButtonTriggerDown(PadButton::Back) || Keyboard::getInstance().KeyTriggerDown(Keycode::Escape));
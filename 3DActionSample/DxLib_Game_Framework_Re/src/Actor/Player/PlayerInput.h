@@ -3,58 +3,58 @@
 
 #include "../../Math/Vector2.h"
 
-// NXFvC[
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：プレイヤー入力
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
 class PlayerInput
 {
 public:
-	// Q[X^[g͂
+	// ゲームスタート入力をしたか
 	static bool game_start();
 
-	// U͂
+	// 攻撃入力をしたか
 	static bool attack();
-	// WvU͂
+	// ジャンプ攻撃入力をしたか
 	static bool jump_attack();
-	// K[h͂
+	// ガード入力をしたか
 	static bool guard();
-	// K[h͂I
+	// ガード入力を終了したか
 	static bool guard_end();
-	// ͂
+	// 回避入力をしたか
 	static bool evasion();
 
-	// Oړ
+	// 前移動
 	static bool move_forward();
-	// ړ
+	// 後移動
 	static bool move_backward();
-	// ړ
+	// 左移動
 	static bool move_left();
-	// Eړ
+	// 右移動
 	static bool move_right();
-	// L[{[hňړĂ邩
+	// キーボードで移動しているか
 	static bool keyboard_move();
 
-	// ړ̓
+	// 移動方向の入力
 	static Vector2 move_input();
-	// XeBbNňړĂ邩
+	// 左スティックで移動しているか
 	static bool gamepad_move();
 
-	// J]
+	// カメラ左回転
 	static bool camera_turn_left();
-	// JE]
+	// カメラ右回転
 	static bool camera_turn_right();
-	// J]
+	// カメラ上回転
 	static bool camera_turn_up();
-	// J]
+	// カメラ下回転
 	static bool camera_turn_down();
-	// JZbg
+	// カメラリセット
 	static bool camera_reset();
 
-	// GXLbv
+	// 雑魚戦スキップ
 	static bool skip_phase1();
-	// |[Y
+	// ポーズ
 	static bool pause();
-	// Q[I
+	// ゲーム終了
 	static bool game_end();
 };
 
@@ -2,30 +2,30 @@
 #include "../Math/Collision/CollisionMesh.h"
 #include "Skybox.h"
 
-// NXFtB[h
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：フィールド
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
-// RXgN^
+// コンストラクタ
 Field::Field(int stage, int skybox) :
 	stage_{ stage }, skybox_{ skybox }
 {
-	//fݒ肳ĂȂԂ
+	//モデルが設定されていなかったら返す
 	if (stage_ < 0 || skybox_ < 0)	return;
 }
 
-// `
+// 描画
 void Field::draw() const
 {
-	// XJC{bNX`
+	// スカイボックスを描画
 	Skybox::bind(skybox_);
 	Skybox::draw();
 
-	// Xe[W`
+	// ステージを描画
 	CollisionMesh::bind(stage_);
 	CollisionMesh::draw();
 }
 
-// Ƃ̏Փ˔
+// 線分との衝突判定
 bool Field::collide_line(const Vector3& start, const Vector3& end, Vector3* point, Vector3* normal)
 {
 	CollisionMesh::bind(stage_);
@@ -33,7 +33,7 @@ bool Field::collide_line(const Vector3& start, const Vector3& end, Vector3* poin
 	return CollisionMesh::collide_line(start, end, point, normal);
 }
 
-// ̂Ƃ̏Փ˔
+// 球体との衝突判定
 bool Field::collide_sphere(const Vector3& center, float radius, Vector3* result)
 {
 	CollisionMesh::bind(stage_);
@@ -41,7 +41,7 @@ bool Field::collide_sphere(const Vector3& center, float radius, Vector3* result)
 	return CollisionMesh::collide_sphere(center, radius, result);
 }
 
-// JvZƂ̏Փ˔
+// カプセルとの衝突判定
 bool Field::collide_capsule(const Vector3& start, const Vector3& end, float radius, Vector3* result)
 {
 	CollisionMesh::bind(stage_);
@@ -49,19 +49,25 @@ bool Field::collide_capsule(const Vector3& start, const Vector3& end, float radi
 	return CollisionMesh::collide_capsule(start, end, radius, result);
 }
 
-// tB[h̍őW̎擾
+// 遮蔽カリング用の遮蔽物の取得
+const OccluderMesh& Field::occluders() const
+{
+	return CollisionMesh::occluders(stage_);
+}
+
+// フィールドの最大座標の取得
 Vector3 Field::max_position() const
 {
 	return CollisionMesh::max_position();
 }
 
-// tB[h̍ŏW̎擾
+// フィールドの最小座標の取得
 Vector3 Field::min_position() const
 {
 	return CollisionMesh::min_position();
 }
 
-// tB[h
+// フィールド内判定
 bool Field::is_inside(const Vector3& position) const
 {
 	CollisionMesh::bind(stage_);
@@ -72,9 +78,8 @@ bool Field::is_inside(const Vector3& position) const
 	return true;
 }
 
-// tB[hO
+// フィールド外判定
 bool Field::is_outside(const Vector3& position) const
 {
 	return !is_inside(position);
 }
-
@@ -2,42 +2,46 @@
 #define FIELD_H_
 
 #include "../Math/Vector3.h"
+#include "../Graphic/OcclusionBuffer.h"
 
-// NXFtB[h
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：フィールド
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 class Field
 {
 public:
-	// RXgN^
+	// コンストラクタ
 	Field(int stage, int skybox);
-	// `
+	// 描画
 	void draw() const;
 
-	// Ƃ̏Փ˔
+	// 線分との衝突判定
 	bool collide_line(const Vector3& start, const Vector3& end, Vector3* point = nullptr, Vector3* normal = nullptr);
-	// ̂Ƃ̏Փ˔
+	// 球体との衝突判定
 	bool collide_sphere(const Vector3& center, float radius, Vector3* result = nullptr);
-	// JvZƂ̏Փ˔
+	// カプセルとの衝突判定
 	bool collide_capsule(const Vector3& start, const Vector3& end, float radius, Vector3* result = nullptr);
 
-	// tB[h̍őW̎擾
+	// 遮蔽カリング用の遮蔽物の取得
+	const OccluderMesh& occluders() const;
+
+	// フィールドの最大座標の取得
 	Vector3 max_position() const;
-	// tB[h̍ŏW̎擾
+	// フィールドの最小座標の取得
 	Vector3 min_position() const;
 
-	// tB[h
+	// フィールド内判定
 	bool is_inside(const Vector3& position) const;
-	// tB[hO
+	// フィールド外判定
 	bool is_outside(const Vector3& position) const;
 
-	// Rs[֎~
+	// コピー禁止
 	Field(const Field& other) = delete;
 	Field& operator = (const Field& other) = delete;
 
 private:
-	// Xe[Wf
+	// ステージモデル
 	int stage_;
-	// XJC{bNXf
+	// スカイボックスモデル
 	int skybox_;
 };
 
@@ -3,12 +3,12 @@
 
 #include <memory>
 
-// |C^FtB[h
-// ҁF Qi"Jacky" Ho Siu Kij
+// ポインタ：フィールド
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 class Field;
 using FieldPtr = std::shared_ptr<Field>;
 
-// tB[h̐
+// フィールドの生成
 template <class T, class... Args>
 inline FieldPtr new_field(Args... args)
 {
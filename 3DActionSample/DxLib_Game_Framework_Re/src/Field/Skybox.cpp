@@ -3,69 +3,69 @@
 
 #include "../ID/SourceID.h"
 
-// NXFX^eBbNbV
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：スタティックメッシュ
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
-// oCh̃f
+// バインド中のモデル
 int Skybox::model_{ -1 };
-// fAZbg
+// モデルアセット
 ModelAsset Skybox::asset_;
 
-// 
+// 初期化
 void Skybox::initialize()
 {
-	// IƓ
+	// 終了処理と同じ
 	finalize();
 }
 
-// I
+// 終了処理
 void Skybox::finalize()
 {
-	// fAZbg
+	// モデルアセットを消去
 	asset_.clear();
-	// f
+	// モデルを消去
 	model_ = -1;
 }
 
-// ǂݍ
+// 読み込み
 bool Skybox::load(int id, const std::string& file_name)
 {
 	return asset_.load(id, file_name);
 }
 
-// 폜
+// 削除
 void Skybox::erase(int id)
 {
 	model_ = (model_ == asset_[id]) ? -1 : model_;
 	asset_.erase(id);
 }
 
-// bṼoCh
+// メッシュのバインド
 void Skybox::bind(int id)
 {
 	model_ = asset_[id];
 }
 
-// `
+// 描画
 void Skybox::draw()
 {
-	// ϊs擾
+	// 視野変換行列を取得
 	MATRIX view_matrix = GetCameraViewMatrix();
-	// ϊs̕sړʂNA
+	// 視野変換行列の平行移動量をクリア
 	MATRIX skybox_matrix = view_matrix;
 	skybox_matrix.m[3][0] = 0.0f;
 	skybox_matrix.m[3][1] = 0.0f;
 	skybox_matrix.m[3][2] = 0.0f;
-	// ϊsݒ
+	// 視野変換行列を設定
 	SetCameraViewMatrix(skybox_matrix);
-	// CeBO𖳌
+	// ライティングを無効化
 	SetUseLighting(FALSE);
-	// Zobt@ɏ݂sȂ
+	// Zバッファに書き込みを行わない
 	MV1SetWriteZBuffer(model_, FALSE);
-	// f\
+	// モデルを表示
 	MV1DrawModel(model_);
-	// ϊsɖ߂
+	// 視野変換行列を元に戻す
 	SetCameraViewMatrix(view_matrix);
-	// CeBOL
+	// ライティングを有効化
 	SetUseLighting(TRUE);
 }
\ No newline at end of file
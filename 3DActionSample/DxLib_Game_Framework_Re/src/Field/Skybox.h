@@ -4,28 +4,28 @@
 #include <string>
 #include "../Graphic/ModelAsset.h"
 
-// NXFXJC{bNX
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：スカイボックス
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 class Skybox
 {
 public:
-	// 
+	// 初期化
 	static void initialize();
-	// I
+	// 終了処理
 	static void finalize();
-	// ǂݍ
+	// 読み込み
 	static bool load(int id, const std::string& file_name);
-	// 폜
+	// 削除
 	static void erase(int id);
-	// bṼoCh
+	// メッシュのバインド
 	static void bind(int id);
-	// `
+	// 描画
 	static void draw();
 
 private:
-	// oCh̃f
+	// バインドのモデル
 	static int			model_;
-	// fAZbg
+	// モデルアセット
 	static ModelAsset	asset_;
 };
 
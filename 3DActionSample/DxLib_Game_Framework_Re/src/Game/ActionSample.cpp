@@ -12,44 +12,58 @@
 #include "../Scene/SceneGamePlay.h"
 
 #include "WindowSetting.h"
+#include "../Math/Random.h"
+#include <random>
+#include <cstdio>
 
-// NXF3DANVQ[TviAvP[VNXj
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：3Dアクションゲームサンプル（アプリケーションクラス）
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
-// RXgN^
+// コンストラクタ
 ActionSample::ActionSample() :
 	Game{ WindowSetting::WindowWidth, WindowSetting::WindowHeight, false }
 { }
 
-// Jn
+// 乱数シードの固定（指定しなければ起動ごとに異なるシードを使う）
+void ActionSample::set_seed(unsigned int seed)
+{
+	seed_ = seed;
+	fixed_seed_ = true;
+}
+
+// 開始
 void ActionSample::start()
 {
-	// V[NX̏
+	// 乱数シードを決定（同じシードを指定すればゲームの乱数列を再現できる）
+	Random::set_seed(fixed_seed_ ? seed_ : std::random_device()());
+	// 再現できるように使用したシードを出力
+	std::printf("random seed: %u\n", Random::seed());
+	// シーンクラスの初期化
 	scene_manager_.initialize();
-	// V[ǂݍ
-	scene_manager_.add(Scene::Loading, new_scene<SceneLoading>());		// ǂݍ
-	scene_manager_.add(Scene::Title, new_scene<SceneTitle>());			// ^Cg
-	scene_manager_.add(Scene::GamePlay, new_scene<SceneGamePlay>());	// Q[vCV[
+	// シーンを読み込む
+	scene_manager_.add(Scene::Loading, new_scene<SceneLoading>());		// 読み込み
+	scene_manager_.add(Scene::Title, new_scene<SceneTitle>());			// タイトル
+	scene_manager_.add(Scene::GamePlay, new_scene<SceneGamePlay>());	// ゲームプレイシーン
 
-	// ŏ̃V[ֈڍs
+	// 最初のシーンへ移行
 	scene_manager_.change(Scene::Loading);
 }
 
-// XV
+// 更新
 void ActionSample::update(float delta_time)
 {
 	scene_manager_.update(delta_time);
 }
 
-// `
+// 描画
 void ActionSample::draw()
 {
 	scene_manager_.draw();
 }
 
-// I
+// 終了
 void ActionSample::end()
 {
-	// V[}l[W[I
+	// シーンマネージャーを終了
 	scene_manager_.end();
 }
\ No newline at end of file
@@ -4,29 +4,35 @@
 #include "Game.h"
 #include "../Scene/SceneManager.h"
 
-// NXF3DANVQ[TviAvP[VNXj
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：3Dアクションゲームサンプル（アプリケーションクラス）
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 class ActionSample : public Game
 {
 public:
-	// RXgN^
+	// コンストラクタ
 	ActionSample();
+	// 乱数シードの固定（指定しなければ起動ごとに異なるシードを使う）
+	void set_seed(unsigned int seed);
 
 private:
-	// Jn
+	// 開始
 	void start() override;
-	// XV
+	// 更新
 	void update(float delta_time) override;
-	// `
+	// 描画
 	void draw() override;
-	// I
+	// 終了
 	void end() override;
 
 private:
-	// V[}l[W[
+	// シーンマネージャー
 	SceneManager	scene_manager_;
-	// |[YȂ̂
+	// ポーズ中なのか
 	bool			pause_{ false };
+	// 固定する乱数シード
+	unsigned int	seed_{ 0 };
+	// 乱数シードを固定するか
+	bool			fixed_seed_{ false };
 };
 
 #endif // !ACTION_SAMPLE_H_
\ No newline at end of file
@@ -4,110 +4,127 @@
 #include "../Graphic/Graphics2D.h"
 #include "../Graphic/Graphics3D.h"
 #include "../Graphic/SkeletalMesh.h"
+#include "../Graphic/PoseCache.h"
+#include "../Graphic/WorkerPool.h"
+#include "../Graphic/SkeletonJobs.h"
+#include "../Graphic/AnimationLOD.h"
 #include "../Math/Collision/CollisionMesh.h"
 #include "../Field/Skybox.h"
 #include "../Graphic/Billboard.h"
 #include "../Graphic/Shader/ShaderManager.h"
+#include "../Graphic/Shader/RenderTargetPool.h"
+#include "../Graphic/Shader/PostEffect.h"
 #include "../Sound/Sound.h"
 #include "../Input/GamePad.h"
 #include "../Input/Keyboard.h"
 #include "../Input/Mouse.h"
 #include "../Actor/Player/PlayerInput.h"
 
-// NXFQ[AvP[V
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：ゲームアプリケーション
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
 //------------------------------------------------------------
-// EBhE̐ݒ萔
+// ウィンドウの設定定数
 //------------------------------------------------------------
 
-const char *WindowName = "X^[RVA";	// EBhE
+const char *WindowName = "モンスターコロシアム";	// ウィンドウ名
 
 //------------------------------------------------------------
 
-// RXgN^
+// コンストラクタ
 Game::Game(int width, int height, bool full_screen) :
 	window_width_{ width }, window_height_{ height }, is_full_screen_{ full_screen }
 { }
 
-// s
+// 実行
 int Game::run()
 {
 	//------------------------------------------------------------
-	// EBhE̊{ݒ
+	// ウィンドウの基本設定
 	//------------------------------------------------------------
 
-	// Oo͂Ȃ悤
+	// ログを出力しないように
 	SetOutApplicationLogValidFlag(FALSE);
-	// EBhÊݒ
+	// ウィンドウ名称を設定
 	SetMainWindowText(WindowName);
-	// EBhETCYݒ
+	// ウィンドウサイズを設定
 	SetWindowSize(window_width_, window_height_);
-	// OtBbN[hݒ
+	// グラフィックモードを設定
 	SetGraphMode(window_width_, window_height_, 32);
-	// EChE[hǂ
+	// ウインドウモードかどうかを決定
 	ChangeWindowMode(is_full_screen_ ? FALSE : TRUE);
-	// DXCu
-	if (DxLib_Init() == -1) return -1;	// Ɏs
-	// `𗠉ʂɂ
+	// DXライブラリを初期化
+	if (DxLib_Init() == -1) return -1;	// 初期化に失敗
+	// 描画先を裏画面にする
 	SetDrawScreen(DX_SCREEN_BACK);
-	// oCjAtB^[L
+	// バイリニアフィルターを有効化
 	SetDrawMode(DX_DRAWMODE_BILINEAR);
-	// }EXJ[\B
+	// マウスカーソルを隠す
 	Mouse::getInstance().hide_cursor();
 
 	//------------------------------------------------------------
 
 	//------------------------------------------------------------
-	// evf̏
+	// 各要素の初期化
 	//------------------------------------------------------------
 
 	Graphics2D::initialize();
 	Graphics3D::initialize();
 	SkeletalMesh::initialize();
+	PoseCache::initialize();
+	WorkerPool::initialize();
+	AnimationLOD::initialize();
 	CollisionMesh::initialize();
 	Skybox::initialize();
 	Billboard::initialize();
 	ShaderManager::initialize();
+	RenderTargetPool::initialize();
+	PostEffect::initialize();
 	Sound::initialize();
 
 	//------------------------------------------------------------
 
-	// Jn
+	// 開始
 	start();
 
 	//------------------------------------------------------------
-	// C[v
+	// メインループ
 	//------------------------------------------------------------
 
 	while (ProcessMessage() == 0 && fps_.update() && is_running())
 	{
-		// Q[pbh̏ԂXV
+		// ゲームパッドの状態を更新
 		GamePad::getInstance().update();
-		// L[{[h̏ԂXV
+		// キーボードの状態を更新
 		Keyboard::getInstance().update();
-		// }EX̏ԂXV
+		// マウスの状態を更新
 		Mouse::getInstance().update();
 
-		update(1.0f);		// Q[XV
-		ClearDrawScreen();	// ʂNA
-		draw();				// ʂ`
-		ScreenFlip();		// ʂ̓e\ʂɔf
+		update(1.0f);		// ゲームを更新
+		ClearDrawScreen();	// 画面をクリア
+		draw();				// 画面を描画
+		ScreenFlip();		// 裏画面の内容を表画面に反映
 		fps_.wait();
 	}
 
 	//------------------------------------------------------------
 
-	// I
+	// 終了
 	end();
 
 	//------------------------------------------------------------
-	// evf̏I
+	// 各要素の終了処理
 	//------------------------------------------------------------
 
-	// I
+	// 終了処理
+	PostEffect::finalize();
+	RenderTargetPool::finalize();
 	ShaderManager::finalize();
 	Billboard::finalize();
+	AnimationLOD::finalize();
+	SkeletonJobs::finalize();
+	WorkerPool::finalize();
+	PoseCache::finalize();
 	SkeletalMesh::finalize();
 	CollisionMesh::finalize();
 	Skybox::finalize();
@@ -117,32 +134,32 @@ int Game::run()
 
 	//------------------------------------------------------------
 
-	// DxLibI
+	// DxLibを終了
 	DxLib_End();
 
-	// vOI
+	// プログラムを終了
 	return 0;
 }
 
-// Jn
+// 開始
 void Game::start()
 { }
 
-// XV
+// 更新
 void Game::update(float delta_time)
 { }
 
-// `
+// 描画
 void Game::draw()
 { }
 
-// I
+// 終了
 void Game::end()
 { }
 
-// sȂ̂
+// 実行中なのか
 bool Game::is_running() const
 {
-	// EscapeL[ŋI
+	// Escapeキーで強制終了
 	return PlayerInput::game_end() == 0;
 }
\ No newline at end of file
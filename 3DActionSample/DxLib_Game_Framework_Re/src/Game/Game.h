@@ -1,48 +1,48 @@
 #ifndef GAME_H_
 #define GAME_H_
 
-// main֐Gg[|Cgɂ
+// main関数をエントリーポイントにする
 #pragma comment(linker, "/entry:mainCRTStartup")
 
 #include "fpsController.h"
 
-// NXFQ[AvP[V
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：ゲームアプリケーション
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 class Game
 {
 public:
-	// ftHgRXgN^
+	// デフォルトコンストラクタ
 	Game() = default;
-	// RXgN^
+	// コンストラクタ
 	Game(int width, int height, bool full_screen);
-	// s
+	// 実行
 	int run();
 
-	// Rs[֎~
+	// コピー禁止
 	Game(const Game& other) = delete;
 	Game& operator = (const Game& other) = delete;
 
 private:
-	// Jn
+	// 開始
 	virtual void start();
-	// XV
+	// 更新
 	virtual void update(float delta_time);
-	// `
+	// 描画
 	virtual void draw();
-	// I
+	// 終了
 	virtual void end();
-	// sȂ̂
+	// 実行中なのか
 	virtual bool is_running() const;
 
 private:
-	// EBhE̕
+	// ウィンドウの幅
 	int window_width_{ 640 };
-	// EBhE̍
+	// ウィンドウの高さ
 	int window_height_{ 480 };
-	// tXN[[h
+	// フルスクリーンモード
 	bool is_full_screen_{ false };
 
-	// fps
+	// fps制御
 	fpsController fps_;
 };
 
@@ -1,76 +1,78 @@
 #include "MyGame.h"
 #include "../Graphic/Graphics3D.h"
 #include "../Graphic/SkeletalMesh.h"
+#include "../Graphic/SkeletonJobs.h"
 #include "../Math/Collision/CollisionMesh.h"
 #include "../Field/Skybox.h"
 #include "../Graphic/Billboard.h"
 #include "../Math/Matrix.h"
 #include "../Math/Vector3.h"
 
-// NXF3DQ[t[[NeXg
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：3Dゲームフレームワークテスト
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
-// RXgN^
+// コンストラクタ
 MyGame::MyGame() :
 	Game{ 1024, 768, false }
 { }
 
-// Jn
+// 開始
 void MyGame::start()
 {
-	// 3Dfǂݍ
+	// 3Dモデルを読み込む
 	SkeletalMesh::load(0, "test_assets/player.mv1");
-	// Xe[Wfǂݍ
+	// ステージモデルを読み込む
 	CollisionMesh::load(0, "test_assets/castle/SampleStage_Castle.mv1");
-	// XJC{bNXfǂݍ
+	// スカイボックスモデルを読み込む
 	Skybox::load(0, "test_assets/skybox/skydome.mv1");
-	// r{[hǂݍ
+	// ビルボードを読み込む
 	Billboard::load(0, "test_assets/Particle02.png");
 	
-	// tB[h𐶐
+	// フィールドを生成
 	field_ = new Field(0, 0);
-	// LN^[𐶐
-	mesh_ = new AnimatedMesh{ 0, 0 };
+	// キャラクターを生成
+	mesh_ = new AnimatedMesh{ arena_, 0, 0 };
 }
 
-// XV
+// 更新
 void MyGame::update(float delta_time)
 {
 	mesh_->update(delta_time);
 	mesh_->transform(Matrix::Identity);
+	SkeletonJobs::run();
 }
 
-// `
+// 描画
 void MyGame::draw()
 {
-	// ʂNA
+	// 画面をクリア
 	Graphics3D::clear();
 
-	// Jݒ
+	// カメラを設定
 	Graphics3D::set_view_matrix(Matrix::CreateLookAt({ -70.0f, 20.0f,-70.0f }, { 0.0f, 20.0f, 0.0f }, { 0.0f, 1.0f, 0.0f }));
 	Graphics3D::set_projection_matrix(Matrix::CreatePerspectiveFieldOfView(45.0f, 640.0f / 480.0f, 0.3f, 1000.0f));
 
-	// tB[h`
+	// フィールドを描画
 	field_->draw();
 
-	// LN^[`
+	// キャラクターを描画
 	mesh_->draw();
 
-	// r{[h`
+	// ビルボードを描画
 	Graphics3D::blend_mode(BlendMode::Add);
 	Billboard::bind(0);
 	Billboard::draw({ 0.0f, 30.0f, 0.0f }, 10.0f);
 	Graphics3D::blend_mode(BlendMode::None);
 }
 
-// I
+// 終了
 void MyGame::end()
 {
-	// LN^[폜
+	// キャラクターを削除
 	delete mesh_;
 	SkeletalMesh::erase(0);
 
-	// tB[h폜
+	// フィールドを削除
 	delete field_;
 	CollisionMesh::erase(0);
 	Skybox::erase(0);
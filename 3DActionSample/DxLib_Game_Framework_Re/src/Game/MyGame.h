@@ -5,28 +5,30 @@
 #include "../Field/Field.h"
 #include "../Graphic/AnimatedMesh.h"
 
-// NXF3DQ[t[[NeXgiAvP[VNXj
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：3Dゲームフレームワークテスト（アプリケーションクラス）
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 class MyGame : public Game
 {
 private:
-	// Xe[W
+	// ステージ
 	Field*			field_{ nullptr };
-	// LN^[
+	// アニメーション用メモリアリーナ
+	AnimationArena	arena_;
+	// キャラクター
 	AnimatedMesh*	mesh_{ nullptr };
 
 public:
-	// RXgN^
+	// コンストラクタ
 	MyGame();
 
 private:
-	// Jn
+	// 開始
 	void start() override;
-	// XV
+	// 更新
 	void update(float delta_time) override;
-	// `
+	// 描画
 	void draw() override;
-	// I
+	// 終了
 	void end() override;
 
 };
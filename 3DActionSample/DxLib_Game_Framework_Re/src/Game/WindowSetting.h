@@ -1,11 +1,11 @@
 #ifndef WINDOW_SETTING_H_
 #define WINDOW_SETTING_H_
 
-// EBhE̐ݒ
+// ウィンドウの設定
 namespace WindowSetting
 {
-	const int WindowWidth{ 1280 };	// EBhE̕
-	const int WindowHeight{ 720 };	// EBhE̍
+	const int WindowWidth{ 1280 };	// ウィンドウの幅
+	const int WindowHeight{ 720 };	// ウィンドウの高さ
 };
 
 #endif // !WINDOW_SETTING_H_
\ No newline at end of file
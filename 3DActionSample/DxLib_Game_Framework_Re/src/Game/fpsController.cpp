@@ -1,9 +1,9 @@
 #include "fpsController.h"
 #include <DxLib.h>
 
-// fpsNX
+// fps制御クラス
 
-// XV
+// 更新
 bool fpsController::update()
 {
 	if (count_ == 0)	start_time_ = GetNowCount();
@@ -20,13 +20,13 @@ bool fpsController::update()
 	return true;
 }
 
-// `
+// 描画
 void fpsController::draw()
 {
 	DrawFormatString(0, 0, GetColor(255, 255, 255), "%.1f", fps_);
 }
 
-// ҋ@
+// 待機
 void fpsController::wait()
 {
 	int took_time = GetNowCount() - start_time_;
@@ -1,63 +1,132 @@
 #include "AnimatedMesh.h"
 #include "SkeletalMesh.h"
+#include "SkeletonJobs.h"
+#include "AnimationLOD.h"
 
-// NXFAj[VtbV
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：アニメーション付きメッシュ
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
-// RXgN^
-AnimatedMesh::AnimatedMesh(int mesh, int motion) :
-	mesh_{ mesh }, animation_{ mesh, motion }
-{ }
+// コンストラクタ
+AnimatedMesh::AnimatedMesh(AnimationArena& arena, int mesh, int motion) :
+	mesh_{ mesh }, model_{ SkeletalMesh::duplicate(mesh) }, arena_{ &arena }, animation_{ arena, mesh, motion },
+	world_matrices_{ arena.allocate(animation_.bone_count()) },
+	changed_bones_((animation_.bone_count() + 63) / 64, ~0ull)
+{
+	// 最初の描画で全ボーンをアップロードする（ボーン数を超えるビットは立てない）
+	const int tail = animation_.bone_count() % 64;
+	if (tail != 0)
+	{
+		changed_bones_.back() = (1ull << tail) - 1;
+	}
+}
+
+// デストラクタ
+AnimatedMesh::~AnimatedMesh()
+{
+	arena_->deallocate(world_matrices_, animation_.bone_count());
+	SkeletalMesh::release(model_);
+}
 
-// XV
+// 更新
 void AnimatedMesh::update(float delta_time)
 {
+	// 前回のAABBからLOD段階を選択
+	if (bounds_.IsEmpty())
+	{
+		animation_.set_lod(AnimationLOD::select(position_, LODRadius));
+	}
+	else
+	{
+		animation_.set_lod(AnimationLOD::select(bounds_.Center(), bounds_.Radius()));
+	}
 	animation_.update(delta_time);
 }
 
-// `
+// 描画
 void AnimatedMesh::draw() const
 {
 	SkeletalMesh::bind(mesh_);
-	SkeletalMesh::set_world_matrices(world_matrices_.data());
-	SkeletalMesh::draw();
+	SkeletalMesh::draw(world_matrices_, changed_bones_.data(), model_);
 }
 
-// [V̕ύX
-void AnimatedMesh::change_motion(int motion)
+// 描画コマンドの記録
+void AnimatedMesh::draw(RenderQueue& queue) const
 {
-	animation_.change_motion(motion);
+	queue.submit(mesh_, world_matrices_, animation_.bone_count(), -1, changed_bones_.data(), model_);
 }
 
-// XPg̕ϊšvZ
-void AnimatedMesh::transform(const Matrix& world)
+// モーションの変更
+void AnimatedMesh::change_motion(int motion, MotionTransition transition)
 {
-	SkeletalMesh::bind(mesh_);
-	SkeletalMesh::set_local_matrices(animation_.local_matrices().data());
-	SkeletalMesh::transform(world);
-	SkeletalMesh::get_world_matrices(world_matrices_.data());
+	animation_.change_motion(motion, transition);
 }
 
-// ϊs̎擾
-const Matrix& AnimatedMesh::bone_matrix(int no) const
+// スケルトンの変換行列の計算
+void AnimatedMesh::transform(const Matrix& world)
 {
-	return world_matrices_[no];
+	position_ = world.Translation();
+	// 計算はジョブとして登録し、SkeletonJobs::run()で全アクター分をまとめて実行する
+	// 値が変わったボーンを記録し、描画時にそのボーンだけをアップロードする
+	SkeletonJobs::add(SkeletalMesh::skeleton(mesh_), animation_.local_matrices(), world, world_matrices_, &SkeletalMesh::bounds(mesh_), &bounds_,
+		changed_bones_.data());
 }
 
-// [V̏IԂ̎擾
+// モーションの終了時間の取得
 float AnimatedMesh::motion_end_time() const
 {
 	return animation_.end_time();
 }
 
-// [V̍Đx̕ύX
+// 前回計算したAABBの取得（ボーンの境界球から計算）
+const BoundingBox& AnimatedMesh::bounds() const
+{
+	return bounds_;
+}
+
+// ボーンの境界球の取得（境界球がなければfalse）
+bool AnimatedMesh::bone_sphere(int no, Vector3& center, float& radius) const
+{
+	return SkeletalMesh::bounds(mesh_).bone_sphere(no, world_matrices_, center, radius);
+}
+
+// モーションの再生速度の変更
 void AnimatedMesh::change_speed(float speed)
 {
 	animation_.change_speed(speed);
 }
 
-// [V̍Đx̃Zbg
+// モーションの再生速度のリセット
 void AnimatedMesh::reset_speed()
 {
 	animation_.reset_speed();
+}
+
+// 指定したボーンとその子孫のマスクを作成（上半身のレイヤーなど）
+BoneMask AnimatedMesh::create_mask(const std::string& bone_name, float weight) const
+{
+	return BoneMask::create(SkeletalMesh::skeleton(mesh_), SkeletalMesh::find_bone(mesh_, bone_name), weight);
+}
+
+// レイヤーの追加（レイヤー番号を返す、maskは呼び出し側で保持しておくこと）
+int AnimatedMesh::add_layer(int motion, float weight, const BoneMask* mask, BlendLayerMode mode)
+{
+	return animation_.add_layer(motion, weight, mask, mode);
+}
+
+// レイヤーのモーションの変更
+void AnimatedMesh::change_layer_motion(int index, int motion)
+{
+	animation_.change_layer_motion(index, motion);
+}
+
+// レイヤーの重みの設定
+void AnimatedMesh::set_layer_weight(int index, float weight)
+{
+	animation_.set_layer_weight(index, weight);
+}
+
+// 全レイヤーの削除
+void AnimatedMesh::clear_layers()
+{
+	animation_.clear_layers();
 }
\ No newline at end of file
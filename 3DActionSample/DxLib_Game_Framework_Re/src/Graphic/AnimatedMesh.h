@@ -1,46 +1,79 @@
 #ifndef ANIMATED_MESH_H_
 #define ANIMATED_MESH_H_
 
-#include <array>
-#include "../Math/Matrix.h"
+#include <string>
+#include <vector>
+#include "../Math/AffineMatrix.h"
+#include "../Math/Vector3.h"
+#include "../Math/BoundingBox.h"
 #include "Animation.h"
+#include "AnimationArena.h"
+#include "RenderQueue.h"
 
-// NXFAj[VtbV
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：アニメーション付きメッシュ
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 class AnimatedMesh
 {
-private:
-	// XPg̕ϊs
-	using BoneMatrices = std::array<Matrix, 256>;
-
 public:
-	// RXgN^
-	AnimatedMesh(int mesh, int motion = 0);
-	// XV
+	// コンストラクタ（変換行列はarenaから割り当てる）
+	AnimatedMesh(AnimationArena& arena, int mesh, int motion = 0);
+	// デストラクタ
+	~AnimatedMesh();
+	// 更新
 	void update(float delta_time);
-	// `
+	// 描画
 	void draw() const;
-	// [V̕ύX
-	void change_motion(int motion);
-	// XPg̕ϊšvZ
+	// 描画コマンドの記録
+	void draw(RenderQueue& queue) const;
+	// モーションの変更
+	void change_motion(int motion, MotionTransition transition = MotionTransition::Crossfade);
+	// スケルトンの変換行列の計算
 	void transform(const Matrix& world);
-	// ϊs̎擾
-	const Matrix& bone_matrix(int no) const;
-	// [V̏IԂ̎擾
+	// モーションの終了時間の取得
 	float motion_end_time() const;
+	// 前回計算したAABBの取得（ボーンの境界球から計算）
+	const BoundingBox& bounds() const;
+	// ボーンの境界球の取得（境界球がなければfalse）
+	bool bone_sphere(int no, Vector3& center, float& radius) const;
 
-	// [V̍Đx̕ύX
+	// モーションの再生速度の変更
 	void change_speed(float speed);
-	// [V̍Đx̃Zbg
+	// モーションの再生速度のリセット
 	void reset_speed();
+	// 指定したボーンとその子孫のマスクを作成（上半身のレイヤーなど）
+	BoneMask create_mask(const std::string& bone_name, float weight = 1.0f) const;
+	// レイヤーの追加（レイヤー番号を返す、maskは呼び出し側で保持しておくこと）
+	int add_layer(int motion, float weight = 1.0f, const BoneMask* mask = nullptr, BlendLayerMode mode = BlendLayerMode::Override);
+	// レイヤーのモーションの変更
+	void change_layer_motion(int index, int motion);
+	// レイヤーの重みの設定
+	void set_layer_weight(int index, float weight);
+	// 全レイヤーの削除
+	void clear_layers();
+
+	// コピー禁止
+	AnimatedMesh(const AnimatedMesh& other) = delete;
+	AnimatedMesh& operator = (const AnimatedMesh& other) = delete;
 
 private:
-	// bV
+	// LOD判定用の半径（AABBが未計算の場合）
+	const float		LODRadius{ 30.0f };
+	// メッシュ
 	int				mesh_;
-	// Aj[V
+	// 描画用に複製したモデルハンドル（ボーン行列とアップロードの記録をアクターごとに持つ、負の値で共有ハンドル）
+	int				model_;
+	// メモリアリーナ
+	AnimationArena*	arena_;
+	// アニメーション
 	Animation		animation_;
-	// XPg̕ϊs
-	BoneMatrices	world_matrices_;
+	// スケルトンの変換行列（ボーン数分）
+	AffineMatrix*	world_matrices_;
+	// 前回のアップロードから値が変わったボーンのビット（描画時にアップロードして消去する）
+	mutable std::vector<unsigned long long>	changed_bones_;
+	// 前回のワールド座標（AABBが未計算の場合にLODの判定に使う）
+	Vector3			position_;
+	// 前回計算したAABB
+	BoundingBox		bounds_;
 };
 
 #endif // !ANIMATED_MESH_H_
\ No newline at end of file
@@ -3,33 +3,33 @@
 #include <cmath>
 #include <DxLib.h>
 
-// NXFAj[VtXvCg
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：アニメーション付きスプライト
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
-// fXgN^
+// デストラクタ
 AnimatedSprite::~AnimatedSprite()
 {
 	clear();
 }
 
-// 摜t@C̓ǂݍ
+// 画像ファイルの読み込み
 void AnimatedSprite::load(const std::string& file_name)
 {
-	// Âf[^폜
+	// 古いデータを削除
 	clear();
-	// 摜ǂݍ
+	// 画像を読み込む
 	graph_ = LoadGraph(file_name.c_str());
 }
 
-// 摜t@C̓ǂݍ݁iw肠j
+// 画像ファイルの読み込み（分割指定あり）
 void AnimatedSprite::load(const std::string& file_name, int row, int column)
 {
-	// 摜f[^ǂݍ
+	// 画像データを読み込む
 	load(file_name);
-	// 摜TCY擾
+	// 画像サイズを取得
 	int size_x = 0, size_y = 0;
 	GetGraphSize(graph_, &size_x, &size_y);
-	// 摜𕪊
+	// 画像を分割
 	int w = size_x / column;
 	int h = size_y / row;
 	for (int y = 0; y < size_y; y += h)
@@ -41,77 +41,89 @@ void AnimatedSprite::load(const std::string& file_name, int row, int column)
 	}
 }
 
-// `i摜Śj
+// 描画（画像全体）
 void AnimatedSprite::draw(const Vector2& position) const
 {
 	DrawGraphF(position.x, position.y, graph_, TRUE);
 }
 
-// `i摜̈ꕔ`j
+// 描画（画像の一部分を描画）
 void AnimatedSprite::draw(const Vector2& position, int x, int y, int w, int h) const
 {
 	DrawRectGraphF(position.x, position.y, x, y, w, h, graph_, TRUE, FALSE);
 }
 
-// `iԍwj
+// 描画（分割番号指定）
 void AnimatedSprite::draw(int graph_no, const Vector2& position, const Vector2& center, const Vector2& scale, float rotation) const
 {
 	DrawRotaGraph3F(position.x, position.y, center.x, center.y, scale.x, scale.y,
 		MathHelper::degree_to_radian(rotation), div_graphs_[graph_no], TRUE, FALSE);
 }
 
-// `iAj[Vwj
+// 描画（アニメーション指定）
 void AnimatedSprite::draw(int animation, float time, const Vector2& position, const Vector2& center, const Vector2& scale, float rotation) const
 {
 	draw(find_key_frame(animation, time).second, position, center, scale, rotation);
 }
 
-// Aj[V̒ǉ
+// アニメーションの追加
 void AnimatedSprite::add_animation(int animation, int start, int end, float time)
 {
-	// Âf[^폜
+	// 古いデータを削除
 	animations_[animation].clear();
-	// Aj[Vf[^ǉ
+	// アニメーションデータを追加
 	for (int frame = 0; frame <= (end - start); ++frame)
 	{
 		add_key_frame(animation, (frame + 1) * time, start + frame);
 	}
 }
 
-// L[t[̒ǉ
+// キーフレームの追加
 void AnimatedSprite::add_key_frame(int animation, float time, int graph_no)
 {
 	animations_[animation].emplace_back(time, graph_no);
 }
 
-// L[t[̒ǉiw肠j
+// キーフレームの追加（分割指定あり）
 void AnimatedSprite::add_key_frame(int animation, float time, int x, int y, int w, int h)
 {
 	div_graphs_.push_back(DerivationGraph(x, y, w, h, graph_));
 	add_key_frame(animation, time, int(div_graphs_.size()) - 1);
 }
 
-// Aj[VIԂ̎擾
+// アニメーション終了時間の取得
 float AnimatedSprite::animation_end_time(int animation) const
 {
 	return animations_.at(animation).back().first;
 }
 
-// 
+// 元画像をスプライトバッチのテクスチャとして取得
+SpriteTexture AnimatedSprite::texture() const
+{
+	SpriteTexture result;
+	result.graph = graph_;
+	if (graph_ != -1)
+	{
+		GetGraphSize(graph_, &result.width, &result.height);
+	}
+	return result;
+}
+
+// 消去
 void AnimatedSprite::clear()
 {
-	// 摜f[^
+	// 画像データを消去
 	if (graph_ != -1)
 	{
 		DeleteSharingGraph(graph_);
 		graph_ = -1;
 		div_graphs_.clear();
 	}
-	// Aj[Vf[^
+	// アニメーションデータを消去
 	animations_.clear();
 }
 
-// L[t[̌
+// キーフレームの検索
 const AnimatedSprite::KeyFrame& AnimatedSprite::find_key_frame(int animation, float timer) const
 {
 	const auto& key_frames = animations_.at(animation);
@@ -4,63 +4,66 @@
 #include <unordered_map>
 #include <vector>
 #include "../Math/Vector2.h"
+#include "SpriteBatch.h"
 
-// NXFAj[VtXvCg
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：アニメーション付きスプライト
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 class AnimatedSprite
 {
 public:
-	// ftHgRXgN^
+	// デフォルトコンストラクタ
 	AnimatedSprite() = default;
-	// fXgN^
+	// デストラクタ
 	~AnimatedSprite();
-	// 摜t@C̓ǂݍ
+	// 画像ファイルの読み込み
 	void load(const std::string& file_name);
-	// 摜t@C̓ǂݍ݁iw肠j
+	// 画像ファイルの読み込み（分割指定あり）
 	void load(const std::string& file_name, int row, int column);
-	// `i摜Śj
+	// 描画（画像全体）
 	void draw(const Vector2& position) const;
-	// `i摜̈ꕔ`j
+	// 描画（画像の一部分を描画）
 	void draw(const Vector2& position, int x, int y, int w, int h) const;
-	// `iԍwj
+	// 描画（分割番号指定）
 	void draw(int graph_no, const Vector2& position, const Vector2& center, const Vector2& scale, float rotation) const;
-	// `iAj[Vwj
+	// 描画（アニメーション指定）
 	void draw(int animation, float time, const Vector2& position, const Vector2& center, const Vector2& scale, float rotation) const;
-	// Aj[V̒ǉ
+	// アニメーションの追加
 	void add_animation(int animation, int start, int end, float time);
-	// L[t[̒ǉ
+	// キーフレームの追加
 	void add_key_frame(int animation, float time, int graph_no);
-	// L[t[̒ǉiw肠j
+	// キーフレームの追加（分割指定あり）
 	void add_key_frame(int animation, float time, int x, int y, int w, int h);
-	// Aj[VIԂ̎擾
+	// アニメーション終了時間の取得
 	float animation_end_time(int animation) const;
-	// 
+	// 元画像をスプライトバッチのテクスチャとして取得
+	SpriteTexture texture() const;
+	// 消去
 	void clear();
 
-	// Rs[֎~
+	// コピー禁止
 	AnimatedSprite(const AnimatedSprite& other) = delete;
 	AnimatedSprite& operator = (const AnimatedSprite& other) = delete;
 
 private:
-	// 摜
+	// 分割画像
 	using DivGraphs = std::vector<int>;
-	// L[t[
+	// キーフレーム
 	using KeyFrame = std::pair<float, int>;
-	// L[t[z
+	// キーフレーム配列
 	using KeyFrames = std::vector<KeyFrame>;
-	// Aj[Vz
+	// アニメーション配列
 	using Animations = std::unordered_map<int, KeyFrames>;
 
 private:
-	// L[t[̌
+	// キーフレームの検索
 	const KeyFrame& find_key_frame(int animation, float timer) const;
 
 private:
-	// 摜
+	// 元画像
 	int graph_{ -1 };
-	// 摜
+	// 分割画像
 	DivGraphs div_graphs_;
-	// Aj[Vf[^
+	// アニメーションデータ
 	Animations animations_;
 };
 
@@ -1,71 +1,265 @@
 #include "Animation.h"
 #include "SkeletalMesh.h"
+#include "PoseCache.h"
+#include "AnimationLOD.h"
+#include "AnimationArena.h"
+#include <algorithm>
+#include <utility>
 
-// NXFAj[V
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：アニメーション制御
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
-// RXgN^
-Animation::Animation(int model, int motion) :
+// コンストラクタ
+Animation::Animation(AnimationArena& arena, int model, int motion) :
+	arena_{ &arena },
 	model_{ model },
 	motion_{ motion },
 	prev_motion_{ motion },
 	animation_speed_{ 1.0f }
 {
-	SkeletalMesh::bind(model_);									// bVoCh
-	SkeletalMesh::bind_animation(motion_, motion_timer_);		// Aj[VoCh
-	SkeletalMesh::get_local_matrices(local_matrices_.data());	// [Jϊs擾
+	SkeletalMesh::bind(model_);												// メッシュをバインド
+	bone_count_ = SkeletalMesh::bone_count();								// ボーン数を取得
+	local_matrices_ = arena_->allocate(bone_count_);						// ボーン数分の変換行列を割り当て
+	SkeletalMesh::sample_animation(motion_, motion_timer_, local_matrices_);	// ローカル変換行列をサンプリング
 }
 
-// XV
+// デストラクタ
+Animation::~Animation()
+{
+	arena_->deallocate(local_matrices_, bone_count_);
+}
+
+// 更新
 void Animation::update(float delta_time)
 {
-	// bVoCh
+	// メッシュをバインド
 	SkeletalMesh::bind(model_);
-	// Aj[VoCh
-	SkeletalMesh::bind_animation(prev_motion_, prev_motion_timer_, motion_, motion_timer_, lerp_timer_ / LerpTime);
-	// [Jϊs擾
-	SkeletalMesh::get_local_matrices(local_matrices_.data());
+	// LOD段階に応じて姿勢を更新
+	if (lod_ == 0)
+	{
+		update_full();
+	}
+	else
+	{
+		update_lod();
+	}
 
-	// Aj[V^C}[XV
+	// アニメーションタイマーを更新
 	motion_timer_ = std::fmod(motion_timer_ + 0.5f * delta_time * animation_speed_, end_time());
-	// ԃ^C}[XV
+	for (int i = 0; i < blend_tree_.layer_count(); ++i)
+	{
+		auto& layer = blend_tree_.layer(i);
+		layer.time = std::fmod(layer.time + 0.5f * delta_time * animation_speed_, layer.clip->end_time());
+	}
+	// 補間タイマーを更新
 	lerp_timer_ = std::fmin(lerp_timer_ + delta_time, LerpTime);
+	// 慣性補間タイマーを更新
+	if (inertializing_)
+	{
+		inertialization_timer_ += delta_time;
+		inertializing_ = inertialization_timer_ < InertializationTime;
+	}
+}
+
+// 全ボーンを毎tick更新
+void Animation::update_full()
+{
+	const int bone_count = bone_count_;
+
+	// 慣性補間中やレイヤーがある場合は姿勢を加工するため、キャッシュを使わずにサンプリング
+	if (inertializing_ || blend_tree_.layer_count() > 0)
+	{
+		inertialization_pose_ = SkeletalMesh::sample_pose(prev_motion_, prev_motion_timer_, motion_, motion_timer_, lerp_timer_ / LerpTime, nullptr, bone_count,
+			&prev_cursor_, &cursor_);
+		if (inertializing_) apply_inertialization(inertialization_pose_);
+		if (blend_tree_.layer_count() > 0) blend_tree_.evaluate(inertialization_pose_);
+		inertialization_pose_.to_matrices(local_matrices_);
+		AnimationLOD::count(0, bone_count, bone_count);
+		return;
+	}
+
+	// 再生状態を量子化し、同じtickに同じ状態でサンプリングされたポーズがあれば再利用する
+	const auto state = PoseCache::make_state(model_, prev_motion_, prev_motion_timer_, SkeletalMesh::end_time(prev_motion_),
+		motion_, motion_timer_, end_time(), lerp_timer_ / LerpTime);
+	if (PoseCache::find(state.key, local_matrices_, bone_count))
+	{
+		AnimationLOD::count(0, 0, bone_count);
+		return;
+	}
+
+	// ローカル変換行列をサンプリング（キャッシュを共有する全アクターが同じ値になるように、量子化した状態でサンプリング）
+	SkeletalMesh::sample_pose(prev_motion_, state.prev_time, motion_, state.time, state.amount, nullptr, bone_count, &prev_cursor_, &cursor_)
+		.to_matrices(local_matrices_);
+	PoseCache::add(state.key, local_matrices_, bone_count);
+	AnimationLOD::count(0, bone_count, bone_count);
 }
 
-// [V̕ύX
-void Animation::change_motion(int motion)
+// LOD段階に応じて更新
+void Animation::update_lod()
 {
-	// ݂Ɠ[V̏ꍇ͉Ȃ
+	const auto& band = AnimationLOD::band(lod_);
+	const auto& skeleton = SkeletalMesh::skeleton(model_);
+	const int bone_count = skeleton.bone_count();
+	const float amount = lerp_timer_ / LerpTime;
+	int evaluated = 0;
+
+	if (!lod_ready_)
+	{
+		// LODに切り替わった直後は全ボーンをサンプリング
+		lod_to_ = SkeletalMesh::sample_pose(prev_motion_, prev_motion_timer_, motion_, motion_timer_, amount, nullptr, bone_count, &prev_cursor_, &cursor_);
+		lod_from_ = lod_to_;
+		lod_tick_ = 0;
+		lod_ready_ = true;
+		evaluated += bone_count;
+	}
+	else if (!band.freeze && ++lod_tick_ >= band.interval)
+	{
+		// サンプリング間隔ごとに、階層の浅いボーンから指定された深さまでをサンプリング
+		lod_tick_ = 0;
+		const int count = (band.depth_limit < 0) ? bone_count : skeleton.bone_count_within_depth(band.depth_limit);
+		const auto& bones = skeleton.order();
+		const auto& pose = SkeletalMesh::sample_pose(prev_motion_, prev_motion_timer_, motion_, motion_timer_, amount, bones.data(), count, &prev_cursor_, &cursor_);
+		lod_from_ = lod_to_;
+		for (int i = 0; i < count; ++i)
+		{
+			const int bone = bones[i];
+			lod_to_.scales[bone] = pose.scales[bone];
+			lod_to_.rotations[bone] = pose.rotations[bone];
+			lod_to_.translations[bone] = pose.translations[bone];
+		}
+		evaluated += count;
+	}
+
+	// 前回と今回のサンプリング結果を補間（遅延はサンプリング間隔分）
+	const float t = band.freeze ? 1.0f : std::min((lod_tick_ + 1.0f) / band.interval, 1.0f);
+	AnimationPose::blend(lod_from_, lod_to_, t, lod_pose_);
+
+	// 慣性補間の差分を加える
+	if (inertializing_)
+	{
+		apply_inertialization(lod_pose_);
+	}
+
+	// レイヤーを重ねる（補間元の姿勢として使うlod_pose_は変更しない）
+	if (blend_tree_.layer_count() > 0)
+	{
+		layered_pose_ = lod_pose_;
+		blend_tree_.evaluate(layered_pose_);
+		layered_pose_.to_matrices(local_matrices_);
+		AnimationLOD::count(lod_, evaluated, bone_count);
+		return;
+	}
+
+	lod_pose_.to_matrices(local_matrices_);
+	AnimationLOD::count(lod_, evaluated, bone_count);
+}
+
+// 慣性補間の差分を姿勢に加える
+void Animation::apply_inertialization(AnimationPose& pose) const
+{
+	// 差分を5次の多項式で0まで減衰させる（開始時と終了時の速度と加速度が0になる）
+	const float s = std::fmin(inertialization_timer_ / InertializationTime, 1.0f);
+	const float decay = 1.0f - s * s * s * (10.0f + s * (-15.0f + s * 6.0f));
+	AnimationPose::add_offset(inertialization_offset_, decay, pose);
+}
+
+// モーションの変更
+void Animation::change_motion(int motion, MotionTransition transition)
+{
+	// 現在と同じモーションの場合は何もしない
 	if (motion == motion_) return;
 
-	prev_motion_ = motion_;				// Õ[VԍL^
-	prev_motion_timer_ = motion_timer_;	// ŏIAj[V^C}[L^
-	motion_ = motion;					// [VύX
-	motion_timer_ = 0.0f;				// Aj[V^C}[Zbg
-	lerp_timer_ = 0.0f;					// ԃ^C}[Zbg
+	if (transition == MotionTransition::Inertialization)
+	{
+		SkeletalMesh::bind(model_);
+		const int bone_count = bone_count_;
+
+		// 遷移元の姿勢（現在出力している姿勢）
+		if (lod_ != 0 && lod_ready_)
+		{
+			inertialization_pose_ = lod_pose_;
+		}
+		else
+		{
+			inertialization_pose_ = SkeletalMesh::sample_pose(prev_motion_, prev_motion_timer_, motion_, motion_timer_, lerp_timer_ / LerpTime, nullptr, bone_count, &prev_cursor_, &cursor_);
+			if (inertializing_) apply_inertialization(inertialization_pose_);
+		}
+
+		// 遷移先の最初の姿勢との差分を記録
+		const auto& target = SkeletalMesh::sample_pose(motion, 0.0f, motion, 0.0f, 1.0f, nullptr, bone_count);
+		AnimationPose::difference(inertialization_pose_, target, inertialization_offset_);
+		inertializing_ = true;
+		inertialization_timer_ = 0.0f;
+
+		prev_motion_ = motion;				// 前のモーションはサンプリングしない
+		prev_motion_timer_ = 0.0f;
+		motion_ = motion;					// モーションを変更
+		motion_timer_ = 0.0f;				// アニメーションタイマーをリセット
+		lerp_timer_ = LerpTime;				// クロスフェードは行わない
+		lod_ready_ = false;					// LOD用の姿勢を取り直す
+		return;
+	}
+
+	std::swap(prev_cursor_, cursor_);	// サンプリング位置を引き継ぐ
+	prev_motion_ = motion_;				// 前回のモーション番号を記録
+	prev_motion_timer_ = motion_timer_;	// 最終アニメーションタイマーを記録
+	motion_ = motion;					// モーションを変更
+	motion_timer_ = 0.0f;				// アニメーションタイマーをリセット
+	lerp_timer_ = 0.0f;					// 補間タイマーをリセット
+}
+
+// レイヤーの追加（レイヤー番号を返す）
+int Animation::add_layer(int motion, float weight, const BoneMask* mask, BlendLayerMode mode)
+{
+	SkeletalMesh::bind(model_);
+	BlendLayer layer;
+	layer.clip = &SkeletalMesh::clip(motion);
+	layer.weight = weight;
+	layer.mask = mask;
+	layer.mode = mode;
+	return blend_tree_.add_layer(layer);
+}
+
+// レイヤーのモーションの変更（再生時間は先頭に戻る）
+void Animation::change_layer_motion(int index, int motion)
+{
+	SkeletalMesh::bind(model_);
+	auto& layer = blend_tree_.layer(index);
+	layer.clip = &SkeletalMesh::clip(motion);
+	layer.time = 0.0f;
+}
+
+// レイヤーの重みの設定
+void Animation::set_layer_weight(int index, float weight)
+{
+	blend_tree_.layer(index).weight = weight;
 }
 
-// ݍĐ̃[V̎擾
+// 全レイヤーの削除
+void Animation::clear_layers()
+{
+	blend_tree_.clear();
+}
+
+// 現在再生中のモーションの取得
 int Animation::motion() const
 {
 	return motion_;
 }
 
-// ϊs̎擾
-const Animation::Matrices& Animation::local_matrices() const
+// 変換行列の取得
+const AffineMatrix* Animation::local_matrices() const
 {
 	return local_matrices_;
 }
 
-// {[̎擾
+// ボーン数の取得
 int Animation::bone_count() const
 {
-	SkeletalMesh::bind(model_);
-
-	return SkeletalMesh::bone_count();
+	return bone_count_;
 }
 
-// IԂ̎擾
+// 終了時間の取得
 float Animation::end_time() const
 {
 	SkeletalMesh::bind(model_);
@@ -73,14 +267,28 @@ float Animation::end_time() const
 	return SkeletalMesh::end_time(motion_);
 }
 
-// Aj[V̍Đx̕ύX
+// アニメーションの再生速度の変更
 void Animation::change_speed(float speed)
 {
 	animation_speed_ = speed;
 }
 
-// Aj[V̍Đx̃Zbg
+// アニメーションの再生速度のリセット
 void Animation::reset_speed()
 {
 	animation_speed_ = 1.0f;
+}
+
+// LOD段階の設定
+void Animation::set_lod(int level)
+{
+	// 段階0に戻った場合は次にLODに入る時に姿勢を取り直す
+	lod_ready_ = lod_ready_ && level != 0;
+	lod_ = level;
+}
+
+// LOD段階の取得
+int Animation::lod() const
+{
+	return lod_;
 }
\ No newline at end of file
@@ -1,56 +1,131 @@
 #ifndef ANIMATION_H_
 #define ANIMATION_H_
 
-#include <array>
-#include "../Math/Matrix.h"
+#include <vector>
+#include "../Math/AffineMatrix.h"
+#include "AnimationPose.h"
+#include "CompressedAnimationClip.h"
+#include "BlendTree.h"
 
-// NXFAj[V
-// ҁF Qi"Jacky" Ho Siu Kij
-class Animation
+class AnimationArena;	// アニメーション用メモリアリーナ
+
+// 列挙型：モーションの遷移方法
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+enum class MotionTransition
 {
-public:
-	using Matrices = std::array<Matrix, 256>;
+	Crossfade,			// クロスフェード（補間中は前後のモーションを両方サンプリング）
+	Inertialization,	// 慣性補間（遷移時の姿勢の差を減衰させ、新しいモーションのみサンプリング）
+};
 
+// クラス：アニメーション制御
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+class Animation
+{
 public:
-	// RXgN^
-	Animation(int model, int motion);
-	// XV
+	// コンストラクタ（ローカル変換行列はarenaから割り当てる）
+	Animation(AnimationArena& arena, int model, int motion);
+	// デストラクタ
+	~Animation();
+	// 更新
 	void update(float delta_time);
-	// [V̕ύX
-	void change_motion(int motion);
-	// ݍĐ̃[V̎擾
+	// モーションの変更
+	void change_motion(int motion, MotionTransition transition = MotionTransition::Crossfade);
+	// 現在再生中のモーションの取得
 	int motion() const;
-	// ϊs̎擾
-	const Matrices& local_matrices() const;
-	// {[̎擾
+	// 変換行列の取得
+	const AffineMatrix* local_matrices() const;
+	// ボーン数の取得
 	int bone_count() const;
-	// IԂ̎擾
+	// 終了時間の取得
 	float end_time() const;
 
-	// Aj[V̍Đx̕ύX
+	// アニメーションの再生速度の変更
 	void change_speed(float speed);
-	// Aj[V̍Đx̃Zbg
+	// アニメーションの再生速度のリセット
 	void reset_speed();
 
+	// LOD段階の設定
+	void set_lod(int level);
+	// LOD段階の取得
+	int lod() const;
+
+	// レイヤーの追加（レイヤー番号を返す、maskは呼び出し側で保持しておくこと）
+	int add_layer(int motion, float weight = 1.0f, const BoneMask* mask = nullptr, BlendLayerMode mode = BlendLayerMode::Override);
+	// レイヤーのモーションの変更（再生時間は先頭に戻る）
+	void change_layer_motion(int index, int motion);
+	// レイヤーの重みの設定
+	void set_layer_weight(int index, float weight);
+	// 全レイヤーの削除
+	void clear_layers();
+
+	// コピー禁止
+	Animation(const Animation& other) = delete;
+	Animation& operator = (const Animation& other) = delete;
+
+private:
+	// 全ボーンを毎tick更新
+	void update_full();
+	// LOD段階に応じて更新
+	void update_lod();
+	// 慣性補間の差分を姿勢に加える
+	void apply_inertialization(AnimationPose& pose) const;
+
 private:
-	// ԃt[
+	// 補間フレーム数
 	const float LerpTime{ 10.0f };
-	// Aj[Vԍ
+	// 慣性補間のフレーム数
+	const float InertializationTime{ 10.0f };
+	// メモリアリーナ
+	AnimationArena*	arena_{ nullptr };
+	// アニメーション番号
 	int			model_{ 0 };
-	// Đ̃[Vԍ
+	// 再生中のモーション番号
 	int			motion_{ 0 };
-	// Đ̃Aj[V^C}[
+	// 再生中のアニメーションタイマー
 	float		motion_timer_{ 0.0f };
-	// OĐ[Vԍ
+	// 前回再生したモーション番号
 	int			prev_motion_{ 0 };
-	// OĐŏIAj[V^C}[
+	// 前回再生した最終アニメーションタイマー
 	float		prev_motion_timer_{ 0.0f };
-	// ԃAj[V^C}[
+	// 補間アニメーションタイマー
 	float		lerp_timer_{ 0.0f };
-	// Aj[Vϊs
-	Matrices	local_matrices_;
-	// Aj[V̍Đx{
+	// ボーン数
+	int			bone_count_{ 0 };
+	// アニメーション変換行列（ボーン数分）
+	AffineMatrix*	local_matrices_{ nullptr };
+	// アニメーションの再生速度倍率
 	float		animation_speed_{ 1.0f };
+	// 再生中のモーションのサンプリング位置
+	ClipCursor	cursor_;
+	// 前回再生したモーションのサンプリング位置
+	ClipCursor	prev_cursor_;
+
+	// LOD段階
+	int					lod_{ 0 };
+	// 前回のサンプリングからの経過tick数
+	int					lod_tick_{ 0 };
+	// LOD用の姿勢が有効か
+	bool				lod_ready_{ false };
+	// LODの補間元の姿勢
+	AnimationPose		lod_from_;
+	// LODの補間先の姿勢
+	AnimationPose		lod_to_;
+	// LODの補間結果
+	AnimationPose		lod_pose_;
+
+	// 慣性補間中か
+	bool				inertializing_{ false };
+	// 慣性補間タイマー
+	float				inertialization_timer_{ 0.0f };
+	// 遷移時の姿勢の差分（回転は差分の回転、拡大縮小と平行移動は差）
+	AnimationPose		inertialization_offset_;
+	// 慣性補間用の姿勢
+	AnimationPose		inertialization_pose_;
+
+	// 基本のモーションに重ねるレイヤー
+	BlendTree			blend_tree_;
+	// レイヤーを重ねた姿勢（LOD用）
+	AnimationPose		layered_pose_;
 };
 
 #endif // !ANIMATION_H_
\ No newline at end of file
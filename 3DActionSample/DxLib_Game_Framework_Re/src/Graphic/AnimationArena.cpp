@@ -0,0 +1,64 @@
+#include "AnimationArena.h"
+#include <algorithm>
+
+// クラス：アニメーション用メモリアリーナ
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+
+// 割り当て（単位行列で初期化される）
+AffineMatrix* AnimationArena::allocate(int count)
+{
+	if (count <= 0) return nullptr;
+
+	AffineMatrix* result{ nullptr };
+	auto& free_list = free_lists_[count];
+	if (!free_list.empty())
+	{
+		// 同じボーン数の解放済みバッファを再利用
+		result = free_list.back();
+		free_list.pop_back();
+	}
+	else if (count > ChunkSize)
+	{
+		// チャンクに収まらない場合は専用のチャンクを確保
+		chunks_.insert(chunks_.begin(), std::unique_ptr<AffineMatrix[]>{ new AffineMatrix[count] });
+		reserved_ += count;
+		result = chunks_.front().get();
+	}
+	else
+	{
+		// 最後のチャンクから切り出す（足りなければ新しいチャンクを確保）
+		if (chunk_used_ + count > ChunkSize)
+		{
+			chunks_.emplace_back(new AffineMatrix[ChunkSize]);
+			reserved_ += ChunkSize;
+			chunk_used_ = 0;
+		}
+		result = chunks_.back().get() + chunk_used_;
+		chunk_used_ += count;
+	}
+
+	std::fill(result, result + count, AffineMatrix::Identity);
+	used_ += count;
+	return result;
+}
+
+// 解放
+void AnimationArena::deallocate(AffineMatrix* matrices, int count)
+{
+	if (matrices == nullptr) return;
+
+	free_lists_[count].push_back(matrices);
+	used_ -= count;
+}
+
+// チャンクとして確保済みのバイト数の取得
+int AnimationArena::reserved_bytes() const
+{
+	return reserved_ * (int)sizeof(AffineMatrix);
+}
+
+// 割り当て中のバイト数の取得
+int AnimationArena::used_bytes() const
+{
+	return used_ * (int)sizeof(AffineMatrix);
+}
\ No newline at end of file
@@ -0,0 +1,46 @@
+#ifndef ANIMATION_ARENA_H_
+#define ANIMATION_ARENA_H_
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include "../Math/AffineMatrix.h"
+
+// クラス：アニメーション用メモリアリーナ
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// ボーン数分の変換行列のバッファをまとまったチャンクから切り出して割り当てる。
+// 解放されたバッファはボーン数ごとに保持し、同じボーン数の割り当てに再利用する。
+class AnimationArena
+{
+public:
+	// コンストラクタ
+	AnimationArena() = default;
+	// 割り当て（単位行列で初期化される）
+	AffineMatrix* allocate(int count);
+	// 解放
+	void deallocate(AffineMatrix* matrices, int count);
+	// チャンクとして確保済みのバイト数の取得
+	int reserved_bytes() const;
+	// 割り当て中のバイト数の取得
+	int used_bytes() const;
+
+	// コピー禁止
+	AnimationArena(const AnimationArena& other) = delete;
+	AnimationArena& operator = (const AnimationArena& other) = delete;
+
+private:
+	// チャンクの行列数
+	static const int	ChunkSize{ 2048 };
+	// チャンク
+	std::vector<std::unique_ptr<AffineMatrix[]>>	chunks_;
+	// 最後のチャンクの使用済み行列数
+	int				chunk_used_{ ChunkSize };
+	// チャンクとして確保済みの行列数
+	int				reserved_{ 0 };
+	// 割り当て中の行列数
+	int				used_{ 0 };
+	// ボーン数ごとの解放済みバッファ
+	std::unordered_map<int, std::vector<AffineMatrix*>>	free_lists_;
+};
+
+#endif // !ANIMATION_ARENA_H_
\ No newline at end of file
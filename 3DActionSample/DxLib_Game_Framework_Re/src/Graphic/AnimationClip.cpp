@@ -0,0 +1,182 @@
+#include "AnimationClip.h"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+
+// クラス：アニメーションクリップ
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+
+// ファイル識別子
+static const char	ClipFileMagic[4]{ 'A', 'C', 'L', 'P' };
+// ファイル形式のバージョン
+static const int	ClipFileVersion{ 1 };
+
+// コンストラクタ（キーは単位姿勢で初期化される）
+AnimationClip::AnimationClip(int bone_count, float end_time, float key_interval) :
+	bone_count_{ bone_count },
+	key_count_{ (int)std::ceil(end_time / key_interval) + 1 },
+	key_interval_{ key_interval },
+	end_time_{ end_time }
+{
+	scales_.resize(key_count_ * bone_count_, Vector3::One);
+	rotations_.resize(key_count_ * bone_count_, Quaternion::Identity);
+	translations_.resize(key_count_ * bone_count_, Vector3::Zero);
+}
+
+// キーの設定
+void AnimationClip::set_key(int key, int bone, const Vector3& scale, const Quaternion& rotation, const Vector3& translation)
+{
+	const int index = key * bone_count_ + bone;
+	scales_[index] = scale;
+	translations_[index] = translation;
+
+	// 前のキーと同じ半球に揃える（キー間の補間が最短経路になるように）
+	Quaternion q = rotation;
+	if (key > 0 && Quaternion::Dot(rotations_[index - bone_count_], q) < 0.0f)
+	{
+		q = -q;
+	}
+	rotations_[index] = q;
+}
+
+// 姿勢のサンプリング
+void AnimationClip::sample(float time, AnimationPose& result) const
+{
+	result.resize(bone_count_);
+	if (key_count_ == 0) return;
+
+	// 前後のキーと補間率を求める
+	time = std::min(std::max(time, 0.0f), end_time_);
+	const int key = std::min((int)(time / key_interval_), key_count_ - 1);
+	const int next = std::min(key + 1, key_count_ - 1);
+	const float span = key_time(next) - key_time(key);
+	const float t = (span > 0.0f) ? (time - key_time(key)) / span : 0.0f;
+
+	// 同時刻の全ボーンを一括補間
+	const int k0 = key * bone_count_;
+	const int k1 = next * bone_count_;
+	Quaternion::Blend(&rotations_[k0], &rotations_[k1], t, result.rotations.data(), bone_count_);
+	for (int i = 0; i < bone_count_; ++i)
+	{
+		result.scales[i] = Vector3::Lerp(scales_[k0 + i], scales_[k1 + i], t);
+		result.translations[i] = Vector3::Lerp(translations_[k0 + i], translations_[k1 + i], t);
+	}
+}
+
+// キーの時刻の取得
+float AnimationClip::key_time(int key) const
+{
+	return std::min(key * key_interval_, end_time_);
+}
+
+// 拡大縮小キーの取得
+const Vector3& AnimationClip::key_scale(int key, int bone) const
+{
+	return scales_[key * bone_count_ + bone];
+}
+
+// 回転キーの取得
+const Quaternion& AnimationClip::key_rotation(int key, int bone) const
+{
+	return rotations_[key * bone_count_ + bone];
+}
+
+// 平行移動キーの取得
+const Vector3& AnimationClip::key_translation(int key, int bone) const
+{
+	return translations_[key * bone_count_ + bone];
+}
+
+// ボーン数の取得
+int AnimationClip::bone_count() const
+{
+	return bone_count_;
+}
+
+// キー数の取得
+int AnimationClip::key_count() const
+{
+	return key_count_;
+}
+
+// キーの間隔の取得
+float AnimationClip::key_interval() const
+{
+	return key_interval_;
+}
+
+// 終了時間の取得
+float AnimationClip::end_time() const
+{
+	return end_time_;
+}
+
+// キーデータのメモリサイズの取得（バイト）
+int AnimationClip::memory_size() const
+{
+	return (int)(scales_.size() * sizeof(Vector3) + rotations_.size() * sizeof(Quaternion) + translations_.size() * sizeof(Vector3));
+}
+
+// ファイルへの書き出し
+bool AnimationClip::save(const std::string& file_name) const
+{
+	std::ofstream file(file_name, std::ios::binary);
+	if (!file) return false;
+
+	const int count = key_count_ * bone_count_;
+	file.write(ClipFileMagic, sizeof(ClipFileMagic));
+	file.write((const char*)&ClipFileVersion, sizeof(ClipFileVersion));
+	file.write((const char*)&bone_count_, sizeof(bone_count_));
+	file.write((const char*)&key_count_, sizeof(key_count_));
+	file.write((const char*)&key_interval_, sizeof(key_interval_));
+	file.write((const char*)&end_time_, sizeof(end_time_));
+	file.write((const char*)scales_.data(), sizeof(Vector3) * count);
+	file.write((const char*)rotations_.data(), sizeof(Quaternion) * count);
+	file.write((const char*)translations_.data(), sizeof(Vector3) * count);
+
+	return (bool)file;
+}
+
+// ファイルからの読み込み
+bool AnimationClip::load(const std::string& file_name)
+{
+	std::ifstream file(file_name, std::ios::binary);
+	if (!file) return false;
+
+	// 識別子とバージョンを確認
+	char magic[4];
+	int version = 0;
+	file.read(magic, sizeof(magic));
+	file.read((char*)&version, sizeof(version));
+	if (!file || !std::equal(magic, magic + 4, ClipFileMagic) || version != ClipFileVersion) return false;
+
+	int bone_count = 0;
+	int key_count = 0;
+	float key_interval = 0.0f;
+	float end_time = 0.0f;
+	file.read((char*)&bone_count, sizeof(bone_count));
+	file.read((char*)&key_count, sizeof(key_count));
+	file.read((char*)&key_interval, sizeof(key_interval));
+	file.read((char*)&end_time, sizeof(end_time));
+	if (!file || bone_count < 0 || key_count < 0 || key_interval <= 0.0f) return false;
+
+	const int count = key_count * bone_count;
+	std::vector<Vector3> scales(count);
+	std::vector<Quaternion> rotations(count);
+	std::vector<Vector3> translations(count);
+	file.read((char*)scales.data(), sizeof(Vector3) * count);
+	file.read((char*)rotations.data(), sizeof(Quaternion) * count);
+	file.read((char*)translations.data(), sizeof(Vector3) * count);
+	if (!file) return false;
+
+	// 全て読み込めた場合のみ反映
+	bone_count_ = bone_count;
+	key_count_ = key_count;
+	key_interval_ = key_interval;
+	end_time_ = end_time;
+	scales_.swap(scales);
+	rotations_.swap(rotations);
+	translations_.swap(translations);
+
+	return true;
+}
\ No newline at end of file
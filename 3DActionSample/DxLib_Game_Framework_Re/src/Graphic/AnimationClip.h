@@ -0,0 +1,66 @@
+#ifndef ANIMATION_CLIP_H_
+#define ANIMATION_CLIP_H_
+
+#include <string>
+#include <vector>
+#include "AnimationPose.h"
+
+// クラス：アニメーションクリップ
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// モデル読み込み時に抽出したキーフレームを保持し、DxLibを介さずに姿勢をサンプリングする。
+// キーは時刻ごとに全ボーン分を連続して格納する（同時刻のボーンを一括補間できるように）。
+class AnimationClip
+{
+public:
+	// デフォルトコンストラクタ
+	AnimationClip() = default;
+	// コンストラクタ（キーは単位姿勢で初期化される）
+	AnimationClip(int bone_count, float end_time, float key_interval = 1.0f);
+
+	// キーの設定
+	void set_key(int key, int bone, const Vector3& scale, const Quaternion& rotation, const Vector3& translation);
+	// 姿勢のサンプリング
+	void sample(float time, AnimationPose& result) const;
+
+	// キーの時刻の取得
+	float key_time(int key) const;
+	// 拡大縮小キーの取得
+	const Vector3& key_scale(int key, int bone) const;
+	// 回転キーの取得
+	const Quaternion& key_rotation(int key, int bone) const;
+	// 平行移動キーの取得
+	const Vector3& key_translation(int key, int bone) const;
+	// ボーン数の取得
+	int bone_count() const;
+	// キー数の取得
+	int key_count() const;
+	// キーの間隔の取得
+	float key_interval() const;
+	// 終了時間の取得
+	float end_time() const;
+	// キーデータのメモリサイズの取得（バイト）
+	int memory_size() const;
+
+	// ファイルへの書き出し
+	bool save(const std::string& file_name) const;
+	// ファイルからの読み込み
+	bool load(const std::string& file_name);
+
+private:
+	// ボーン数
+	int						bone_count_{ 0 };
+	// キー数
+	int						key_count_{ 0 };
+	// キーの間隔
+	float					key_interval_{ 1.0f };
+	// 終了時間
+	float					end_time_{ 0.0f };
+	// 拡大縮小キー（[キー番号 * ボーン数 + ボーン番号]）
+	std::vector<Vector3>	scales_;
+	// 回転キー（[キー番号 * ボーン数 + ボーン番号]）
+	std::vector<Quaternion>	rotations_;
+	// 平行移動キー（[キー番号 * ボーン数 + ボーン番号]）
+	std::vector<Vector3>	translations_;
+};
+
+#endif // !ANIMATION_CLIP_H_
\ No newline at end of file
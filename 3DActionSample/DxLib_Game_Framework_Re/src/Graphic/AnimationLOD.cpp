@@ -0,0 +1,161 @@
+#include "AnimationLOD.h"
+#include "Graphics3D.h"
+#include <DxLib.h>
+#include <algorithm>
+#include <cfloat>
+
+// クラス：アニメーションLOD
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+
+// 距離ごとのLOD段階
+std::vector<AnimationLODBand> AnimationLOD::bands_;
+// 視錐台外のLOD段階
+AnimationLODBand AnimationLOD::culled_;
+// カメラの座標
+Vector3 AnimationLOD::eye_;
+// 視錐台
+Frustum AnimationLOD::frustum_;
+// 遮蔽カリング用の深度バッファ
+const OcclusionBuffer* AnimationLOD::occlusion_{ nullptr };
+// カメラの状態が設定されているか
+bool AnimationLOD::has_view_{ false };
+// 有効か
+bool AnimationLOD::enabled_{ true };
+// サンプリングされたボーン数
+int AnimationLOD::evaluated_bones_{ 0 };
+// 更新されたメッシュの総ボーン数
+int AnimationLOD::total_bones_{ 0 };
+// 段階ごとのメッシュ数
+int AnimationLOD::mesh_counts_[AnimationLOD::LevelMax]{ };
+
+// 初期化
+void AnimationLOD::initialize()
+{
+	// 終了処理と同じ
+	finalize();
+}
+
+// 終了処理
+void AnimationLOD::finalize()
+{
+	set_default_bands();
+	has_view_ = false;
+	occlusion_ = nullptr;
+	enabled_ = true;
+}
+
+// カメラの状態を取得し、統計をリセット（tickの開始時に呼び出す、occlusionは前回の描画で作った遮蔽カリング用の深度バッファ）
+void AnimationLOD::update_view(const OcclusionBuffer* occlusion)
+{
+	// 前回の描画で設定されたカメラを使う
+	const auto view = Graphics3D::get_view_matrix();
+	set_view(Matrix::Invert(view).Translation(), view * Graphics3D::get_projection_matrix());
+	occlusion_ = occlusion;
+
+	evaluated_bones_ = 0;
+	total_bones_ = 0;
+	std::fill(mesh_counts_, mesh_counts_ + LevelMax, 0);
+}
+
+// カメラの状態の設定
+void AnimationLOD::set_view(const Vector3& eye, const Matrix& view_projection)
+{
+	eye_ = eye;
+	frustum_ = Frustum::CreateFromMatrix(view_projection);
+	has_view_ = true;
+}
+
+// LOD段階の選択
+int AnimationLOD::select(const Vector3& center, float radius)
+{
+	if (!enabled_ || !has_view_) return 0;
+
+	// 視錐台外、または遮蔽物に隠れている
+	if (!frustum_.Intersects(center, radius)) return (int)bands_.size();
+	if (occlusion_ != nullptr && !occlusion_->is_visible(center, radius)) return (int)bands_.size();
+
+	// 距離が収まる最初の段階（どれにも収まらなければ最後の段階）
+	const float distance = Vector3::Distance(center, eye_) - radius;
+	for (int i = 0; i < (int)bands_.size(); ++i)
+	{
+		if (distance <= bands_[i].distance) return i;
+	}
+	return (int)bands_.size() - 1;
+}
+
+// LOD段階の取得
+const AnimationLODBand& AnimationLOD::band(int level)
+{
+	return (level < (int)bands_.size()) ? bands_[level] : culled_;
+}
+
+// LOD段階の設定（bandsは距離の近い順、culledは視錐台外の段階）
+void AnimationLOD::set_bands(const std::vector<AnimationLODBand>& bands, const AnimationLODBand& culled)
+{
+	if (bands.empty() || (int)bands.size() >= LevelMax) return;
+
+	bands_ = bands;
+	culled_ = culled;
+}
+
+// 有効化の設定
+void AnimationLOD::set_enabled(bool enabled)
+{
+	enabled_ = enabled;
+}
+
+// 有効か
+bool AnimationLOD::enabled()
+{
+	return enabled_;
+}
+
+// 統計の記録
+void AnimationLOD::count(int level, int evaluated_bones, int total_bones)
+{
+	evaluated_bones_ += evaluated_bones;
+	total_bones_ += total_bones;
+	++mesh_counts_[std::min(level, LevelMax - 1)];
+}
+
+// 今回のtickでサンプリングされたボーン数の取得
+int AnimationLOD::evaluated_bones()
+{
+	return evaluated_bones_;
+}
+
+// 今回のtickで更新されたメッシュの総ボーン数の取得
+int AnimationLOD::total_bones()
+{
+	return total_bones_;
+}
+
+// 統計の描画
+void AnimationLOD::draw_stats(int x, int y)
+{
+	const auto color = GetColor(255, 255, 255);
+	DrawFormatString(x, y, color, "Anim bones: %d / %d", evaluated_bones_, total_bones_);
+	for (int i = 0; i <= (int)bands_.size(); ++i)
+	{
+		if (i < (int)bands_.size())
+		{
+			DrawFormatString(x, y + 16 * (i + 1), color, "  LOD%d: %d", i, mesh_counts_[i]);
+		}
+		else
+		{
+			DrawFormatString(x, y + 16 * (i + 1), color, "  Culled: %d", mesh_counts_[i]);
+		}
+	}
+}
+
+// 既定のLOD段階の設定
+void AnimationLOD::set_default_bands()
+{
+	bands_ =
+	{
+		{ 100.0f, 1, -1, false },		// 近距離：毎tick全ボーン
+		{ 200.0f, 2, -1, false },		// 中距離：2tickごとに全ボーン
+		{ FLT_MAX, 4, 4, false },		// 遠距離：4tickごとに深さ4までのボーン
+	};
+	culled_ = { FLT_MAX, 4, -1, true };	// 視錐台外：姿勢を固定
+}
\ No newline at end of file
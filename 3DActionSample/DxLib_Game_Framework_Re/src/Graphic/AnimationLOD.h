@@ -0,0 +1,85 @@
+#ifndef ANIMATION_LOD_H_
+#define ANIMATION_LOD_H_
+
+#include <vector>
+#include "../Math/Vector3.h"
+#include "../Math/Matrix.h"
+#include "../Math/Frustum.h"
+#include "OcclusionBuffer.h"
+
+// 構造体：アニメーションLODの段階
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+struct AnimationLODBand
+{
+	float	distance;		// この段階を適用するカメラからの最大距離
+	int		interval;		// サンプリング間隔（tick、間は前回までの姿勢を補間する）
+	int		depth_limit;	// サンプリングするボーンの階層の深さの上限（負の値で全ボーン）
+	bool	freeze;			// 姿勢を固定するか
+};
+
+// クラス：アニメーションLOD
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// カメラからの距離と視錐台の判定から、各アニメーションの更新頻度と更新するボーンを決める。
+// 段階0は毎tick全ボーンを更新し、視錐台外や遮蔽物に隠れたメッシュは視錐台外用の段階を使う。
+class AnimationLOD
+{
+public:
+	// 初期化
+	static void initialize();
+	// 終了処理
+	static void finalize();
+	// カメラの状態を取得し、統計をリセット（tickの開始時に呼び出す、occlusionは前回の描画で作った遮蔽カリング用の深度バッファ）
+	static void update_view(const OcclusionBuffer* occlusion = nullptr);
+	// カメラの状態の設定
+	static void set_view(const Vector3& eye, const Matrix& view_projection);
+
+	// LOD段階の選択
+	static int select(const Vector3& center, float radius);
+	// LOD段階の取得
+	static const AnimationLODBand& band(int level);
+	// LOD段階の設定（bandsは距離の近い順、culledは視錐台外の段階）
+	static void set_bands(const std::vector<AnimationLODBand>& bands, const AnimationLODBand& culled);
+	// 有効化の設定
+	static void set_enabled(bool enabled);
+	// 有効か
+	static bool enabled();
+
+	// 統計の記録
+	static void count(int level, int evaluated_bones, int total_bones);
+	// 今回のtickでサンプリングされたボーン数の取得
+	static int evaluated_bones();
+	// 今回のtickで更新されたメッシュの総ボーン数の取得
+	static int total_bones();
+	// 統計の描画
+	static void draw_stats(int x, int y);
+
+private:
+	// 既定のLOD段階の設定
+	static void set_default_bands();
+
+private:
+	// 段階数の最大値（視錐台外の段階を含む）
+	static const int						LevelMax{ 8 };
+	// 距離ごとのLOD段階
+	static std::vector<AnimationLODBand>	bands_;
+	// 視錐台外のLOD段階
+	static AnimationLODBand					culled_;
+	// カメラの座標
+	static Vector3							eye_;
+	// 視錐台
+	static Frustum							frustum_;
+	// 遮蔽カリング用の深度バッファ
+	static const OcclusionBuffer*			occlusion_;
+	// カメラの状態が設定されているか
+	static bool								has_view_;
+	// 有効か
+	static bool								enabled_;
+	// サンプリングされたボーン数
+	static int								evaluated_bones_;
+	// 更新されたメッシュの総ボーン数
+	static int								total_bones_;
+	// 段階ごとのメッシュ数
+	static int								mesh_counts_[LevelMax];
+};
+
+#endif // !ANIMATION_LOD_H_
\ No newline at end of file
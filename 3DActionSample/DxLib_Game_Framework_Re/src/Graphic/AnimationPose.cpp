@@ -0,0 +1,78 @@
+#include "AnimationPose.h"
+#include <algorithm>
+
+// 構造体：アニメーション姿勢
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+
+// コンストラクタ
+AnimationPose::AnimationPose(int bone_count)
+{
+	resize(bone_count);
+}
+
+// ボーン数の変更
+void AnimationPose::resize(int bone_count)
+{
+	scales.resize(bone_count, Vector3::One);
+	rotations.resize(bone_count, Quaternion::Identity);
+	translations.resize(bone_count, Vector3::Zero);
+}
+
+// ボーン数の取得
+int AnimationPose::bone_count() const
+{
+	return (int)rotations.size();
+}
+
+// ローカル変換行列に変換
+void AnimationPose::to_matrices(AffineMatrix result[]) const
+{
+	for (int i = 0; i < bone_count(); ++i)
+	{
+		result[i] = AffineMatrix::CreateWorld(scales[i], rotations[i], translations[i]);
+	}
+}
+
+// 2つの姿勢を補間（t = 0でp1、t = 1でp2）
+void AnimationPose::blend(const AnimationPose& p1, const AnimationPose& p2, float t, AnimationPose& result)
+{
+	const int count = p1.bone_count();
+	result.resize(count);
+
+	// 回転は一括補間
+	Quaternion::Blend(p1.rotations.data(), p2.rotations.data(), t, result.rotations.data(), count);
+	// 拡大縮小と平行移動は線形補間
+	for (int i = 0; i < count; ++i)
+	{
+		result.scales[i] = Vector3::Lerp(p1.scales[i], p2.scales[i], t);
+		result.translations[i] = Vector3::Lerp(p1.translations[i], p2.translations[i], t);
+	}
+}
+
+// 2つの姿勢の差分（慣性補間用、回転はp2からp1への回転、拡大縮小と平行移動はp1 - p2）
+void AnimationPose::difference(const AnimationPose& p1, const AnimationPose& p2, AnimationPose& result)
+{
+	const int count = p1.bone_count();
+	result.resize(count);
+	for (int i = 0; i < count; ++i)
+	{
+		// 回転の差分は短い方の回りにそろえる
+		const auto& q = p2.rotations[i];
+		const auto offset = p1.rotations[i] * Quaternion(-q.x, -q.y, -q.z, q.w);
+		result.scales[i] = p1.scales[i] - p2.scales[i];
+		result.rotations[i] = (offset.w < 0.0f) ? -offset : offset;
+		result.translations[i] = p1.translations[i] - p2.translations[i];
+	}
+}
+
+// 差分に重みを掛けて姿勢に加える（慣性補間用、weight = 0で変化なし）
+void AnimationPose::add_offset(const AnimationPose& offset, float weight, AnimationPose& pose)
+{
+	const int count = std::min(pose.bone_count(), offset.bone_count());
+	for (int i = 0; i < count; ++i)
+	{
+		pose.scales[i] += offset.scales[i] * weight;
+		pose.rotations[i] = Quaternion::Nlerp(Quaternion::Identity, offset.rotations[i], weight) * pose.rotations[i];
+		pose.translations[i] += offset.translations[i] * weight;
+	}
+}
\ No newline at end of file
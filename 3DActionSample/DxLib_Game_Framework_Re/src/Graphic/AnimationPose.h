@@ -0,0 +1,38 @@
+#ifndef ANIMATION_POSE_H_
+#define ANIMATION_POSE_H_
+
+#include <vector>
+#include "../Math/Vector3.h"
+#include "../Math/Quaternion.h"
+#include "../Math/AffineMatrix.h"
+
+// 構造体：アニメーション姿勢
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// 全ボーンの拡大縮小・回転・平行移動を成分ごとの配列（SoA）で保持する。
+struct AnimationPose
+{
+	// コンストラクタ
+	explicit AnimationPose(int bone_count = 0);
+	// ボーン数の変更
+	void resize(int bone_count);
+	// ボーン数の取得
+	int bone_count() const;
+	// ローカル変換行列に変換
+	void to_matrices(AffineMatrix result[]) const;
+
+	// 2つの姿勢を補間（t = 0でp1、t = 1でp2）
+	static void blend(const AnimationPose& p1, const AnimationPose& p2, float t, AnimationPose& result);
+	// 2つの姿勢の差分（慣性補間用、回転はp2からp1への回転、拡大縮小と平行移動はp1 - p2）
+	static void difference(const AnimationPose& p1, const AnimationPose& p2, AnimationPose& result);
+	// 差分に重みを掛けて姿勢に加える（慣性補間用、weight = 0で変化なし）
+	static void add_offset(const AnimationPose& offset, float weight, AnimationPose& pose);
+
+	// 各ボーンの拡大縮小
+	std::vector<Vector3>	scales;
+	// 各ボーンの回転
+	std::vector<Quaternion>	rotations;
+	// 各ボーンの平行移動
+	std::vector<Vector3>	translations;
+};
+
+#endif // !ANIMATION_POSE_H_
\ No newline at end of file
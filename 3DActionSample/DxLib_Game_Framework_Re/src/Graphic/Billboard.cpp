@@ -1,48 +1,54 @@
 #include "Billboard.h"
 
-// NXFr{[h
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：ビルボード
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
-// oCh̃C[W
+// バインド中のイメージ
 int Billboard::image_{ -1 };
-// eNX`AZbg
+// テクスチャアセット
 TextureAsset Billboard::asset_;
 
-// 
+// 初期化
 void Billboard::initialize()
 {
-	// IƓ
+	// 終了処理と同じ
 	finalize();
 }
 
-// I
+// 終了処理
 void Billboard::finalize()
 {
 	asset_.clear();
 	image_ = -1;
 }
 
-// ǂݍ
+// 読み込み
 bool Billboard::load(int id, const std::string& file_name)
 {
 	return asset_.load(id, file_name);
 }
 
-// 폜
+// 削除
 void Billboard::erase(int id)
 {
 	image_ = (image_ == asset_[id]) ? -1 : image_;
 	asset_.erase(id);
 }
 
-// oCh
+// バインド
 void Billboard::bind(int id)
 {
 	image_ = asset_[id];
 }
 
-// `
+// グラフィックハンドルの取得（パーティクルのまとめ描画用）
+int Billboard::handle(int id)
+{
+	return asset_[id];
+}
+
+// 描画
 void Billboard::draw(const VECTOR& position, float size, float cx, float cy, float angle)
 {
 	DrawBillboard3D(position, cx, cy, size, angle, image_, TRUE);
-}
+}
\ No newline at end of file
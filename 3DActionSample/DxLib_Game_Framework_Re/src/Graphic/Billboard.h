@@ -5,28 +5,30 @@
 #include <DxLib.h>
 #include "TextureAsset.h"
 
-// NXFr{[h
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：ビルボード
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 class Billboard
 {
 public:
-	// 
+	// 初期化
 	static void initialize();
-	// I
+	// 終了処理
 	static void finalize();
-	// ǂݍ
+	// 読み込み
 	static bool load(int id, const std::string& file_name);
-	// 폜
+	// 削除
 	static void erase(int id);
-	// oCh
+	// バインド
 	static void bind(int id);
-	// `
+	// グラフィックハンドルの取得（パーティクルのまとめ描画用）
+	static int handle(int id);
+	// 描画
 	static void draw(const VECTOR& position, float size, float cx = 0.5f, float cy = 0.5f, float angle = 0.0f);
 
 private:
-	// oCh̃C[W
+	// バインド中のイメージ
 	static int			image_;
-	// eNX`AZbg
+	// テクスチャアセット
 	static TextureAsset asset_;
 };
 
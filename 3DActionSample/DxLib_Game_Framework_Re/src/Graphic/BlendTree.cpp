@@ -0,0 +1,198 @@
+#include "BlendTree.h"
+#include "../Math/MathSIMD.h"
+#include <algorithm>
+
+// クラス：ブレンドツリー
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+
+// ベクトル配列の補間（要素ごとの補間率、resultはv1と同じ配列でもよい）
+static void blend_vectors(const Vector3 v1[], const Vector3 v2[], const float t[], Vector3 result[], int count)
+{
+	int i = 0;
+#ifdef MATH_USE_SSE
+	// 4要素（12成分）ずつ、補間率を各成分に展開して補間
+	const float* a = &v1[0].x;
+	const float* b = &v2[0].x;
+	float* r = &result[0].x;
+	for (; i + 4 <= count; i += 4, a += 12, b += 12, r += 12)
+	{
+		const __m128 w = _mm_loadu_ps(&t[i]);
+		const __m128 w0 = _mm_shuffle_ps(w, w, _MM_SHUFFLE(1, 0, 0, 0));
+		const __m128 w1 = _mm_shuffle_ps(w, w, _MM_SHUFFLE(2, 2, 1, 1));
+		const __m128 w2 = _mm_shuffle_ps(w, w, _MM_SHUFFLE(3, 3, 3, 2));
+		const __m128 a0 = _mm_loadu_ps(a);
+		const __m128 a1 = _mm_loadu_ps(a + 4);
+		const __m128 a2 = _mm_loadu_ps(a + 8);
+		_mm_storeu_ps(r, _mm_add_ps(a0, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(b), a0), w0)));
+		_mm_storeu_ps(r + 4, _mm_add_ps(a1, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(b + 4), a1), w1)));
+		_mm_storeu_ps(r + 8, _mm_add_ps(a2, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(b + 8), a2), w2)));
+	}
+#endif
+	for (; i < count; ++i)
+	{
+		result[i] = Vector3::Lerp(v1[i], v2[i], t[i]);
+	}
+}
+
+// ベクトル配列に差分を加える（result += (v - reference) * t）
+static void add_vectors(const Vector3 v[], const Vector3 reference[], const float t[], Vector3 result[], int count)
+{
+	int i = 0;
+#ifdef MATH_USE_SSE
+	const float* a = &v[0].x;
+	const float* b = &reference[0].x;
+	float* r = &result[0].x;
+	for (; i + 4 <= count; i += 4, a += 12, b += 12, r += 12)
+	{
+		const __m128 w = _mm_loadu_ps(&t[i]);
+		const __m128 w0 = _mm_shuffle_ps(w, w, _MM_SHUFFLE(1, 0, 0, 0));
+		const __m128 w1 = _mm_shuffle_ps(w, w, _MM_SHUFFLE(2, 2, 1, 1));
+		const __m128 w2 = _mm_shuffle_ps(w, w, _MM_SHUFFLE(3, 3, 3, 2));
+		_mm_storeu_ps(r, _mm_add_ps(_mm_loadu_ps(r), _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(a), _mm_loadu_ps(b)), w0)));
+		_mm_storeu_ps(r + 4, _mm_add_ps(_mm_loadu_ps(r + 4), _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(a + 4), _mm_loadu_ps(b + 4)), w1)));
+		_mm_storeu_ps(r + 8, _mm_add_ps(_mm_loadu_ps(r + 8), _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(a + 8), _mm_loadu_ps(b + 8)), w2)));
+	}
+#endif
+	for (; i < count; ++i)
+	{
+		result[i] += (v[i] - reference[i]) * t[i];
+	}
+}
+
+// クオータニオン配列の積（result = q1 * q2、resultはq2と同じ配列でもよい）
+static void multiply_rotations(const Quaternion q1[], const Quaternion q2[], Quaternion result[], int count)
+{
+	int i = 0;
+#ifdef MATH_USE_SSE
+	// 4要素ずつ転置して成分ごとに計算
+	for (; i + 4 <= count; i += 4)
+	{
+		__m128 ax = _mm_loadu_ps(&q1[i].x);
+		__m128 ay = _mm_loadu_ps(&q1[i + 1].x);
+		__m128 az = _mm_loadu_ps(&q1[i + 2].x);
+		__m128 aw = _mm_loadu_ps(&q1[i + 3].x);
+		_MM_TRANSPOSE4_PS(ax, ay, az, aw);
+		__m128 bx = _mm_loadu_ps(&q2[i].x);
+		__m128 by = _mm_loadu_ps(&q2[i + 1].x);
+		__m128 bz = _mm_loadu_ps(&q2[i + 2].x);
+		__m128 bw = _mm_loadu_ps(&q2[i + 3].x);
+		_MM_TRANSPOSE4_PS(bx, by, bz, bw);
+
+		__m128 x = _mm_add_ps(_mm_sub_ps(_mm_add_ps(_mm_mul_ps(ax, bw), _mm_mul_ps(ay, bz)), _mm_mul_ps(az, by)), _mm_mul_ps(aw, bx));
+		__m128 y = _mm_add_ps(_mm_add_ps(_mm_sub_ps(_mm_mul_ps(ay, bw), _mm_mul_ps(ax, bz)), _mm_mul_ps(az, bx)), _mm_mul_ps(aw, by));
+		__m128 z = _mm_add_ps(_mm_add_ps(_mm_sub_ps(_mm_mul_ps(ax, by), _mm_mul_ps(ay, bx)), _mm_mul_ps(az, bw)), _mm_mul_ps(aw, bz));
+		__m128 w = _mm_sub_ps(_mm_sub_ps(_mm_sub_ps(_mm_mul_ps(aw, bw), _mm_mul_ps(ax, bx)), _mm_mul_ps(ay, by)), _mm_mul_ps(az, bz));
+		_MM_TRANSPOSE4_PS(x, y, z, w);
+		_mm_storeu_ps(&result[i].x, x);
+		_mm_storeu_ps(&result[i + 1].x, y);
+		_mm_storeu_ps(&result[i + 2].x, z);
+		_mm_storeu_ps(&result[i + 3].x, w);
+	}
+#endif
+	for (; i < count; ++i)
+	{
+		result[i] = q1[i] * q2[i];
+	}
+}
+
+// 指定したボーンとその子孫のみ重みを持つマスクを作成（上半身のみなど）
+BoneMask BoneMask::create(const Skeleton& skeleton, int root, float weight)
+{
+	BoneMask result;
+	result.weights.assign(skeleton.bone_count(), 0.0f);
+	if (root < 0 || root >= skeleton.bone_count()) return result;
+
+	// 処理順は親が子より先なので、親の重みを順に伝搬できる
+	result.weights[root] = weight;
+	for (const auto bone : skeleton.order())
+	{
+		const int parent = skeleton.parent(bone);
+		if (parent >= 0 && result.weights[parent] > 0.0f)
+		{
+			result.weights[bone] = weight;
+		}
+	}
+	return result;
+}
+
+// レイヤーの追加（レイヤー番号を返す）
+int BlendTree::add_layer(const BlendLayer& layer)
+{
+	layers_.push_back(layer);
+	return (int)layers_.size() - 1;
+}
+
+// レイヤーの取得
+BlendLayer& BlendTree::layer(int index)
+{
+	return layers_[index];
+}
+
+// レイヤー数の取得
+int BlendTree::layer_count() const
+{
+	return (int)layers_.size();
+}
+
+// 全レイヤーの削除
+void BlendTree::clear()
+{
+	layers_.clear();
+}
+
+// 姿勢にレイヤーを重ねる（poseは基本の姿勢で、結果で上書きされる）
+void BlendTree::evaluate(AnimationPose& pose)
+{
+	const int count = pose.bone_count();
+	weights_.resize(count);
+	for (auto& layer : layers_)
+	{
+		if (layer.clip == nullptr || layer.weight <= 0.0f) continue;
+
+		// ボーンごとの重み
+		const bool masked = layer.mask != nullptr && (int)layer.mask->weights.size() >= count;
+		for (int i = 0; i < count; ++i)
+		{
+			weights_[i] = masked ? layer.weight * layer.mask->weights[i] : layer.weight;
+		}
+
+		layer.clip->sample(layer.time, layer_pose_, nullptr, count, &layer.cursor);
+		if (layer.mode == BlendLayerMode::Additive)
+		{
+			// 基準時間の姿勢は差分を求めるたびにサンプリングする
+			layer.clip->sample(layer.reference_time, reference_pose_, nullptr, count);
+			blend_additive(pose, count);
+		}
+		else
+		{
+			blend_override(pose, count);
+		}
+	}
+}
+
+// 上書きレイヤーの合成
+void BlendTree::blend_override(AnimationPose& pose, int count)
+{
+	Quaternion::Blend(pose.rotations.data(), layer_pose_.rotations.data(), weights_.data(), pose.rotations.data(), count);
+	blend_vectors(pose.translations.data(), layer_pose_.translations.data(), weights_.data(), pose.translations.data(), count);
+	blend_vectors(pose.scales.data(), layer_pose_.scales.data(), weights_.data(), pose.scales.data(), count);
+}
+
+// 加算レイヤーの合成
+void BlendTree::blend_additive(AnimationPose& pose, int count)
+{
+	// 基準姿勢からの回転の差分（layer * reference^-1）を求め、重みで単位回転から補間して掛ける
+	identities_.resize(count, Quaternion::Identity);
+	for (int i = 0; i < count; ++i)
+	{
+		auto& q = reference_pose_.rotations[i];
+		q = Quaternion(-q.x, -q.y, -q.z, q.w);
+	}
+	multiply_rotations(layer_pose_.rotations.data(), reference_pose_.rotations.data(), reference_pose_.rotations.data(), count);
+	Quaternion::Blend(identities_.data(), reference_pose_.rotations.data(), weights_.data(), reference_pose_.rotations.data(), count);
+	multiply_rotations(reference_pose_.rotations.data(), pose.rotations.data(), pose.rotations.data(), count);
+
+	// 平行移動と拡大縮小は差を加える
+	add_vectors(layer_pose_.translations.data(), reference_pose_.translations.data(), weights_.data(), pose.translations.data(), count);
+	add_vectors(layer_pose_.scales.data(), reference_pose_.scales.data(), weights_.data(), pose.scales.data(), count);
+}
\ No newline at end of file
@@ -0,0 +1,78 @@
+#ifndef BLEND_TREE_H_
+#define BLEND_TREE_H_
+
+#include <vector>
+#include "AnimationPose.h"
+#include "CompressedAnimationClip.h"
+#include "Skeleton.h"
+
+// 構造体：ボーンマスク（ボーンごとのレイヤーの重み）
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+struct BoneMask
+{
+	// 各ボーンの重み（0～1）
+	std::vector<float>	weights;
+
+	// 指定したボーンとその子孫のみ重みを持つマスクを作成（上半身のみなど）
+	static BoneMask create(const Skeleton& skeleton, int root, float weight = 1.0f);
+};
+
+// 列挙型：レイヤーの合成方法
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+enum class BlendLayerMode
+{
+	Override,	// 下のレイヤーの姿勢を重みで補間して置き換える
+	Additive,	// 基準時間の姿勢からの差分を重みに応じて加える
+};
+
+// 構造体：ブレンドレイヤー
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+struct BlendLayer
+{
+	const CompressedAnimationClip*	clip{ nullptr };			// アニメーションクリップ
+	float							time{ 0.0f };				// 再生時間
+	float							weight{ 1.0f };				// レイヤー全体の重み
+	const BoneMask*					mask{ nullptr };			// ボーンマスク（nullptrで全ボーン）
+	BlendLayerMode					mode{ BlendLayerMode::Override };	// 合成方法
+	float							reference_time{ 0.0f };		// 加算レイヤーの基準時間
+	ClipCursor						cursor;						// サンプリング位置
+};
+
+// クラス：ブレンドツリー
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// 基本の姿勢の上にレイヤーを順に重ねる。各レイヤーの合成は回転・平行移動・拡大縮小の
+// 成分ごとの配列に対して全ボーン分をまとめて行う。
+class BlendTree
+{
+public:
+	// レイヤーの追加（レイヤー番号を返す）
+	int add_layer(const BlendLayer& layer);
+	// レイヤーの取得
+	BlendLayer& layer(int index);
+	// レイヤー数の取得
+	int layer_count() const;
+	// 全レイヤーの削除
+	void clear();
+	// 姿勢にレイヤーを重ねる（poseは基本の姿勢で、結果で上書きされる）
+	void evaluate(AnimationPose& pose);
+
+private:
+	// 上書きレイヤーの合成
+	void blend_override(AnimationPose& pose, int count);
+	// 加算レイヤーの合成
+	void blend_additive(AnimationPose& pose, int count);
+
+private:
+	// レイヤー
+	std::vector<BlendLayer>	layers_;
+	// レイヤーの姿勢
+	AnimationPose			layer_pose_;
+	// 加算レイヤーの基準姿勢
+	AnimationPose			reference_pose_;
+	// ボーンごとの重み
+	std::vector<float>		weights_;
+	// 単位回転（加算レイヤーの補間元）
+	std::vector<Quaternion>	identities_;
+};
+
+#endif // !BLEND_TREE_H_
\ No newline at end of file
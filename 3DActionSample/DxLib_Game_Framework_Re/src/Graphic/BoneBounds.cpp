@@ -0,0 +1,207 @@
+#include "BoneBounds.h"
+#include "../Math/MathSIMD.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <fstream>
+
+// クラス：ボーンの境界球
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+
+// ファイル識別子
+static const char	MeshFileMagic[4]{ 'B', 'P', 'M', 'S' };
+// ファイル形式のバージョン
+static const int	MeshFileVersion{ 1 };
+
+// ファイルへの書き出し
+bool BindPoseMesh::save(const std::string& file_name) const
+{
+	std::ofstream file(file_name, std::ios::binary);
+	if (!file) return false;
+
+	const int bone_count = (int)bone_matrices.size();
+	const int vertex_count = (int)positions.size();
+	const int weight_count = (int)bones.size();
+	file.write(MeshFileMagic, sizeof(MeshFileMagic));
+	file.write((const char*)&MeshFileVersion, sizeof(MeshFileVersion));
+	file.write((const char*)&bone_count, sizeof(bone_count));
+	file.write((const char*)&vertex_count, sizeof(vertex_count));
+	file.write((const char*)&weight_count, sizeof(weight_count));
+	file.write((const char*)bone_matrices.data(), sizeof(AffineMatrix) * bone_count);
+	file.write((const char*)positions.data(), sizeof(Vector3) * vertex_count);
+	file.write((const char*)bones.data(), sizeof(int) * weight_count);
+
+	return (bool)file;
+}
+
+// ファイルからの読み込み
+bool BindPoseMesh::load(const std::string& file_name)
+{
+	std::ifstream file(file_name, std::ios::binary);
+	if (!file) return false;
+
+	// 識別子とバージョンを確認
+	char magic[4];
+	int version = 0;
+	file.read(magic, sizeof(magic));
+	file.read((char*)&version, sizeof(version));
+	if (!file || !std::equal(magic, magic + 4, MeshFileMagic) || version != MeshFileVersion) return false;
+
+	int bone_count = 0;
+	int vertex_count = 0;
+	int weight_count = 0;
+	file.read((char*)&bone_count, sizeof(bone_count));
+	file.read((char*)&vertex_count, sizeof(vertex_count));
+	file.read((char*)&weight_count, sizeof(weight_count));
+	if (!file || bone_count < 0 || vertex_count < 0 || (weight_count != 0 && weight_count != vertex_count)) return false;
+
+	std::vector<AffineMatrix> matrices(bone_count);
+	std::vector<Vector3> vertices(vertex_count);
+	std::vector<int> weights(weight_count);
+	file.read((char*)matrices.data(), sizeof(AffineMatrix) * bone_count);
+	file.read((char*)vertices.data(), sizeof(Vector3) * vertex_count);
+	file.read((char*)weights.data(), sizeof(int) * weight_count);
+	if (!file) return false;
+
+	bone_matrices.swap(matrices);
+	positions.swap(vertices);
+	bones.swap(weights);
+	return true;
+}
+
+// コンストラクタ（バインドポーズのメッシュから計算）
+BoneBounds::BoneBounds(const BindPoseMesh& mesh)
+{
+	const int bone_count = (int)mesh.bone_matrices.size();
+	const int vertex_count = (int)mesh.positions.size();
+	if (bone_count == 0) return;
+
+	// 各頂点を影響するボーンのローカル空間に変換
+	std::vector<AffineMatrix> inverses(bone_count);
+	for (int bone = 0; bone < bone_count; ++bone)
+	{
+		inverses[bone] = AffineMatrix::Invert(mesh.bone_matrices[bone]);
+	}
+	std::vector<int> owners(vertex_count);
+	std::vector<Vector3> locals(vertex_count);
+	std::vector<BoundingBox> boxes(bone_count);
+	for (int i = 0; i < vertex_count; ++i)
+	{
+		const auto& position = mesh.positions[i];
+		int owner = (i < (int)mesh.bones.size()) ? mesh.bones[i] : -1;
+		if (owner < 0 || owner >= bone_count)
+		{
+			// ウェイトがなければ、バインドポーズで原点が最も近いボーンにする
+			float nearest = FLT_MAX;
+			for (int bone = 0; bone < bone_count; ++bone)
+			{
+				const float distance = Vector3::DistanceSquared(position, mesh.bone_matrices[bone].Translation());
+				if (distance < nearest)
+				{
+					nearest = distance;
+					owner = bone;
+				}
+			}
+		}
+		owners[i] = owner;
+		locals[i] = AffineMatrix::Transform(position, inverses[owner]);
+		boxes[owner].Merge(locals[i], 0.0f);
+	}
+
+	// AABBの中心から最も遠い頂点までの距離を半径とする
+	sphere_indices_.assign(bone_count, -1);
+	for (int bone = 0; bone < bone_count; ++bone)
+	{
+		if (boxes[bone].IsEmpty()) continue;
+		sphere_indices_[bone] = (int)spheres_.size();
+		spheres_.push_back(BoneSphere{ boxes[bone].Center(), 0.0f, bone });
+	}
+	for (int i = 0; i < vertex_count; ++i)
+	{
+		auto& sphere = spheres_[sphere_indices_[owners[i]]];
+		sphere.radius = std::max(sphere.radius, Vector3::Distance(locals[i], sphere.center));
+	}
+}
+
+// ワールド変換行列からAABBを計算（境界球がなければ空のボックス）
+void BoneBounds::compute(const AffineMatrix world_matrices[], BoundingBox& result) const
+{
+	if (spheres_.empty())
+	{
+		result = BoundingBox::Empty;
+		return;
+	}
+
+#ifdef MATH_USE_SSE
+	__m128 minimum = _mm_set1_ps(FLT_MAX);
+	__m128 maximum = _mm_set1_ps(-FLT_MAX);
+	for (const auto& sphere : spheres_)
+	{
+		const auto& m = world_matrices[sphere.bone].m;
+		const __m128 r0 = _mm_loadu_ps(m[0]);
+		const __m128 r1 = _mm_loadu_ps(m[1]);
+		const __m128 r2 = _mm_loadu_ps(m[2]);
+
+		// 各行と（x, y, z, 1）の内積を転置して求める
+		const __m128 position = _mm_setr_ps(sphere.center.x, sphere.center.y, sphere.center.z, 1.0f);
+		__m128 x = _mm_mul_ps(r0, position);
+		__m128 y = _mm_mul_ps(r1, position);
+		__m128 z = _mm_mul_ps(r2, position);
+		__m128 w = _mm_setzero_ps();
+		_MM_TRANSPOSE4_PS(x, y, z, w);
+		const __m128 center = _mm_add_ps(_mm_add_ps(x, y), _mm_add_ps(z, w));
+
+		// 半径は各軸の拡大率の最大値で拡大する（列の長さの2乗を行の2乗の和で求める）
+		const __m128 lengths = _mm_add_ps(_mm_add_ps(_mm_mul_ps(r0, r0), _mm_mul_ps(r1, r1)), _mm_mul_ps(r2, r2));
+		__m128 scale = _mm_max_ps(lengths, _mm_shuffle_ps(lengths, lengths, _MM_SHUFFLE(3, 0, 2, 1)));
+		scale = _mm_max_ps(scale, _mm_shuffle_ps(lengths, lengths, _MM_SHUFFLE(3, 1, 0, 2)));
+		scale = _mm_shuffle_ps(scale, scale, _MM_SHUFFLE(0, 0, 0, 0));
+		const __m128 radius = _mm_mul_ps(_mm_sqrt_ps(scale), _mm_set1_ps(sphere.radius));
+
+		minimum = _mm_min_ps(minimum, _mm_sub_ps(center, radius));
+		maximum = _mm_max_ps(maximum, _mm_add_ps(center, radius));
+	}
+
+	float min_values[4];
+	float max_values[4];
+	_mm_storeu_ps(min_values, minimum);
+	_mm_storeu_ps(max_values, maximum);
+	result.minimum = Vector3(min_values[0], min_values[1], min_values[2]);
+	result.maximum = Vector3(max_values[0], max_values[1], max_values[2]);
+#else
+	result = BoundingBox::Empty;
+	for (const auto& sphere : spheres_)
+	{
+		Vector3 center;
+		float radius;
+		bone_sphere(sphere.bone, world_matrices, center, radius);
+		result.Merge(center, radius);
+	}
+#endif
+}
+
+// ボーンの境界球をワールド空間で取得（境界球がなければfalse）
+bool BoneBounds::bone_sphere(int bone, const AffineMatrix world_matrices[], Vector3& center, float& radius) const
+{
+	if (bone < 0 || bone >= (int)sphere_indices_.size() || sphere_indices_[bone] < 0) return false;
+
+	const auto& sphere = spheres_[sphere_indices_[bone]];
+	const auto& matrix = world_matrices[bone];
+	center = AffineMatrix::Transform(sphere.center, matrix);
+
+	// 各軸の拡大率の最大値で拡大
+	float scale = 0.0f;
+	for (int column = 0; column < 3; ++column)
+	{
+		const auto& m = matrix.m;
+		scale = std::max(scale, m[0][column] * m[0][column] + m[1][column] * m[1][column] + m[2][column] * m[2][column]);
+	}
+	radius = sphere.radius * std::sqrt(scale);
+	return true;
+}
+
+// 境界球の取得
+const std::vector<BoneSphere>& BoneBounds::spheres() const
+{
+	return spheres_;
+}
\ No newline at end of file
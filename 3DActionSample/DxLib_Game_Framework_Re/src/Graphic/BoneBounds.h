@@ -0,0 +1,66 @@
+#ifndef BONE_BOUNDS_H_
+#define BONE_BOUNDS_H_
+
+#include <string>
+#include <vector>
+#include "../Math/Vector3.h"
+#include "../Math/AffineMatrix.h"
+#include "../Math/BoundingBox.h"
+
+// 構造体：バインドポーズのメッシュ（ボーンの境界球の計算用）
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// 複数のボーンの影響を受ける頂点は、影響するボーンごとに同じ座標を登録する。
+// ファイルに書き出しておけば、DxLibなしでも境界球の計算を確認できる。
+struct BindPoseMesh
+{
+	// ファイルへの書き出し
+	bool save(const std::string& file_name) const;
+	// ファイルからの読み込み
+	bool load(const std::string& file_name);
+
+	// 各ボーンのバインドポーズでのワールド変換行列
+	std::vector<AffineMatrix>	bone_matrices;
+	// 各頂点のモデル空間での座標（影響するボーンごと）
+	std::vector<Vector3>		positions;
+	// 各座標に影響するボーン番号（空、または負の値の場合は最も近いボーン）
+	std::vector<int>			bones;
+};
+
+// 構造体：ボーンの境界球
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+struct BoneSphere
+{
+	Vector3	center;		// ボーンのローカル空間での中心座標
+	float	radius;		// 半径
+	int		bone;		// ボーン番号
+};
+
+// クラス：ボーンの境界球
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// 読み込み時に各頂点を影響するボーンのローカル空間で境界球を求めておき、
+// 実行時はボーンのワールド変換行列で変換してアクター全体のAABBを求める。
+// スキニング後の頂点は各ボーンで変換した位置の凸包に入るので、全ての境界球を囲むAABBは頂点を必ず含む。
+// （ボーン単体の境界球は、複数のボーンにまたがる頂点を含むとは限らない）
+class BoneBounds
+{
+public:
+	// デフォルトコンストラクタ
+	BoneBounds() = default;
+	// コンストラクタ（バインドポーズのメッシュから計算）
+	explicit BoneBounds(const BindPoseMesh& mesh);
+
+	// ワールド変換行列からAABBを計算（境界球がなければ空のボックス）
+	void compute(const AffineMatrix world_matrices[], BoundingBox& result) const;
+	// ボーンの境界球をワールド空間で取得（境界球がなければfalse）
+	bool bone_sphere(int bone, const AffineMatrix world_matrices[], Vector3& center, float& radius) const;
+	// 境界球の取得
+	const std::vector<BoneSphere>& spheres() const;
+
+private:
+	// 境界球（頂点を持つボーンのみ）
+	std::vector<BoneSphere>	spheres_;
+	// ボーンごとの境界球の番号（頂点を持たないボーンは-1）
+	std::vector<int>		sphere_indices_;
+};
+
+#endif // !BONE_BOUNDS_H_
\ No newline at end of file
@@ -0,0 +1,29 @@
+#include "BoneUploadCache.h"
+
+// クラス：ボーン行列のアップロードの記録
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+
+// ハンドルの記録の消去（モデルの読み込み直しや削除の時に呼び出す）
+void BoneUploadCache::erase(int handle)
+{
+	uploaded_.erase(handle);
+}
+
+// 全ての記録の消去
+void BoneUploadCache::clear()
+{
+	uploaded_.clear();
+	stats_ = BoneUploadStats();
+}
+
+// 統計の取得（reset_stats()からの累計）
+const BoneUploadStats& BoneUploadCache::stats() const
+{
+	return stats_;
+}
+
+// 統計のリセット
+void BoneUploadCache::reset_stats()
+{
+	stats_ = BoneUploadStats();
+}
\ No newline at end of file
@@ -0,0 +1,93 @@
+#ifndef BONE_UPLOAD_CACHE_H_
+#define BONE_UPLOAD_CACHE_H_
+
+#include <algorithm>
+#include <unordered_map>
+#include "../Math/AffineMatrix.h"
+
+// 構造体：ボーン行列のアップロードの統計
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+struct BoneUploadStats
+{
+	int	draws{ 0 };				// 描画回数
+	int	skipped_draws{ 0 };		// アップロードを全て省略した描画回数
+	int	full_uploads{ 0 };		// 全ボーンをアップロードした描画回数
+	int	uploaded_bones{ 0 };	// アップロードしたボーン数
+	int	total_bones{ 0 };		// 描画したメッシュの総ボーン数
+	int	handle_switches{ 0 };	// 他の配列が同じハンドルを使っていたため全ボーンをアップロードした回数（ハンドルを共有するインスタンスで発生）
+};
+
+// クラス：ボーン行列のアップロードの記録
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// モデルハンドルごとに最後にアップロードした変換行列の配列を記録し、同じ配列の再描画では値が変わったボーンだけを選ぶ。
+// ボーン行列はハンドルが保持するため、ハンドルを共有するインスタンスを交互に描画すると毎回全ボーンのアップロードになる。
+// SkeletalMeshはアクターごとに複製したハンドルを使い、インスタンスごとに記録が残るようにする。
+class BoneUploadCache
+{
+public:
+	// アップロードするボーンの選択（uploadはボーン番号と全ボーンのアップロードかを受け取り、1ボーンずつアップロードする、
+	// changed_bonesは前回のアップロードから値が変わったボーンのビット（選択後に消去する）、nullptrの場合は全ボーン）
+	template <class Upload>
+	void upload(int handle, int bone_count, const AffineMatrix world_matrices[], unsigned long long changed_bones[], Upload upload);
+	// ハンドルの記録の消去（モデルの読み込み直しや削除の時に呼び出す）
+	void erase(int handle);
+	// 全ての記録の消去
+	void clear();
+	// 統計の取得（reset_stats()からの累計）
+	const BoneUploadStats& stats() const;
+	// 統計のリセット
+	void reset_stats();
+
+private:
+	// モデルハンドルごとに最後にアップロードした変換行列の配列
+	std::unordered_map<int, const AffineMatrix*>	uploaded_;
+	// 統計
+	BoneUploadStats									stats_;
+};
+
+// アップロードするボーンの選択
+template <class Upload>
+void BoneUploadCache::upload(int handle, int bone_count, const AffineMatrix world_matrices[], unsigned long long changed_bones[], Upload upload)
+{
+	++stats_.draws;
+	stats_.total_bones += bone_count;
+
+	// 他の配列が最後にアップロードしたハンドルは、全ボーンをアップロードし直す
+	auto& uploaded = uploaded_[handle];
+	const int words = (bone_count + 63) / 64;
+	if (changed_bones == nullptr || uploaded != world_matrices)
+	{
+		for (int bone = 0; bone < bone_count; ++bone)
+		{
+			upload(bone, true);
+		}
+		if (changed_bones != nullptr)
+		{
+			stats_.handle_switches += (uploaded != nullptr) ? 1 : 0;
+			std::fill(changed_bones, changed_bones + words, 0ull);
+		}
+		uploaded = world_matrices;
+		++stats_.full_uploads;
+		stats_.uploaded_bones += bone_count;
+		return;
+	}
+
+	// 値が変わったボーンだけをアップロード（ボーン数を超えるビットは無視する）
+	int count = 0;
+	for (int word = 0; word < words; ++word)
+	{
+		auto bits = changed_bones[word];
+		for (int bone = word * 64; bits != 0 && bone < bone_count; ++bone, bits >>= 1)
+		{
+			if ((bits & 1ull) == 0) continue;
+
+			upload(bone, false);
+			++count;
+		}
+		changed_bones[word] = 0;
+	}
+	stats_.uploaded_bones += count;
+	stats_.skipped_draws += (count == 0) ? 1 : 0;
+}
+
+#endif // !BONE_UPLOAD_CACHE_H_
\ No newline at end of file
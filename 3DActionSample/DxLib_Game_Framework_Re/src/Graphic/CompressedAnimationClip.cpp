@@ -0,0 +1,479 @@
+#include "CompressedAnimationClip.h"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+
+// クラス：圧縮アニメーションクリップ
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+
+// ファイル識別子
+static const char	CompressedClipFileMagic[4]{ 'A', 'C', 'L', 'Z' };
+// ファイル形式のバージョン
+static const int	CompressedClipFileVersion{ 2 };
+// 回転成分の量子化の最大値（15ビット）
+static const float	RotationQuantum{ 32767.0f };
+// ベクトル成分の量子化の最大値（16ビット）
+static const float	VectorQuantum{ 65535.0f };
+// smallest three形式の各成分の範囲（±1/√2）
+static const float	Sqrt2{ 1.41421356f };
+// 一度に回転を補間するボーン数
+static const int	BlendBlock{ 64 };
+// 前回のキーから順に探索するキー数の上限（超えた場合は二分探索）
+static const int	CursorStepMax{ 4 };
+
+// 2つの回転の角度差を求める（acosより精度の良い弦の長さから求める）
+static float rotation_error(const Quaternion& q1, const Quaternion& q2)
+{
+	const Quaternion d = (Quaternion::Dot(q1, q2) < 0.0f) ? q1 + q2 : q1 - q2;
+	const float chord = std::sqrt(Quaternion::Dot(d, d));
+	return 4.0f * std::asin(std::min(chord * 0.5f, 1.0f));
+}
+
+// キーaとbの間でキーiを補間する時の補間率
+static float lerp_amount(const AnimationClip& clip, int a, int b, int i)
+{
+	const float span = clip.key_time(b) - clip.key_time(a);
+	return (span > 0.0f) ? (clip.key_time(i) - clip.key_time(a)) / span : 0.0f;
+}
+
+// 誤差がtolerance以内に収まるようにキーを削減し、残すキーの番号を返す
+// error(a, b, i)はキーaとbの補間でキーiを再現した時の誤差
+template <class Error>
+static std::vector<int> reduce_keys(int key_count, float tolerance, Error error)
+{
+	std::vector<int> kept{ 0 };
+	if (key_count <= 1) return kept;
+
+	// 全てのキーが先頭と同じであれば1キーのみ残す
+	bool is_constant = true;
+	for (int i = 1; i < key_count && is_constant; ++i)
+	{
+		is_constant = error(0, 0, i) <= tolerance;
+	}
+	if (is_constant) return kept;
+
+	// 直前に残したキーから補間できる限りキーを飛ばす
+	int anchor = 0;
+	for (int key = 2; key < key_count; ++key)
+	{
+		for (int i = anchor + 1; i < key; ++i)
+		{
+			if (error(anchor, key, i) > tolerance)
+			{
+				anchor = key - 1;
+				kept.push_back(anchor);
+				break;
+			}
+		}
+	}
+	kept.push_back(key_count - 1);
+
+	return kept;
+}
+
+// 配列の書き出し
+template <class T>
+static void write_array(std::ofstream& file, const std::vector<T>& data)
+{
+	const int count = (int)data.size();
+	file.write((const char*)&count, sizeof(count));
+	file.write((const char*)data.data(), sizeof(T) * count);
+}
+
+// 配列の読み込み
+template <class T>
+static bool read_array(std::ifstream& file, std::vector<T>& data)
+{
+	int count = 0;
+	file.read((char*)&count, sizeof(count));
+	if (!file || count < 0) return false;
+	data.resize(count);
+	file.read((char*)data.data(), sizeof(T) * count);
+	return (bool)file;
+}
+
+// 統計の合算
+void ClipCompressionStats::merge(const ClipCompressionStats& other)
+{
+	const int total = sample_count + other.sample_count;
+	if (total > 0)
+	{
+		average_rotation_error = (average_rotation_error * sample_count + other.average_rotation_error * other.sample_count) / total;
+		average_translation_error = (average_translation_error * sample_count + other.average_translation_error * other.sample_count) / total;
+	}
+	max_rotation_error = std::max(max_rotation_error, other.max_rotation_error);
+	max_translation_error = std::max(max_translation_error, other.max_translation_error);
+	raw_size += other.raw_size;
+	compressed_size += other.compressed_size;
+	sample_count = total;
+}
+
+// コンストラクタ（tolerancesはボーン数分の許容誤差）
+CompressedAnimationClip::CompressedAnimationClip(const AnimationClip& clip, const ClipTolerance tolerances[]) :
+	bone_count_{ clip.bone_count() },
+	key_interval_{ clip.key_interval() },
+	end_time_{ clip.end_time() }
+{
+	for (int bone = 0; bone < bone_count_; ++bone)
+	{
+		compress_rotation(clip, bone, tolerances[bone].rotation);
+		compress_vector(clip, bone, tolerances[bone].translation, false);
+		compress_vector(clip, bone, tolerances[bone].scale, true);
+	}
+}
+
+// 姿勢のサンプリング
+void CompressedAnimationClip::sample(float time, AnimationPose& result) const
+{
+	sample(time, result, nullptr, bone_count_);
+}
+
+// 指定したボーンのみ姿勢をサンプリング（それ以外のボーンは変更しない）
+void CompressedAnimationClip::sample(float time, AnimationPose& result, const int bones[], int count, ClipCursor* cursor) const
+{
+	result.resize(bone_count_);
+	time = std::min(std::max(time, 0.0f), end_time_);
+
+	// 別のクリップで使われていたサンプリング位置はリセット
+	if (cursor != nullptr && cursor->clip != this)
+	{
+		cursor->clip = this;
+		cursor->keys.assign(bone_count_ * 3, 0);
+	}
+	const auto cursor_of = [cursor](int bone, int channel)
+	{
+		return (cursor != nullptr) ? &cursor->keys[bone * 3 + channel] : nullptr;
+	};
+
+	// 回転は前後のキーを展開してから一括補間（ボーン指定時は補間後に各ボーンへ書き戻す）
+	Quaternion q0[BlendBlock];
+	Quaternion q1[BlendBlock];
+	Quaternion blended[BlendBlock];
+	float t[BlendBlock];
+	for (int base = 0; base < count; base += BlendBlock)
+	{
+		const int block = std::min(BlendBlock, count - base);
+		for (int i = 0; i < block; ++i)
+		{
+			const int bone = (bones != nullptr) ? bones[base + i] : base + i;
+			const Track& track = rotation_tracks_[bone];
+			const int key = find_key(track, rotation_keys_, time, t[i], cursor_of(bone, 0));
+			const int next = std::min(key + 1, track.first + track.count - 1);
+			q0[i] = unpack_rotation(rotation_keys_[key].value);
+			q1[i] = unpack_rotation(rotation_keys_[next].value);
+		}
+		if (bones == nullptr)
+		{
+			Quaternion::Blend(q0, q1, t, &result.rotations[base], block);
+			continue;
+		}
+		Quaternion::Blend(q0, q1, t, blended, block);
+		for (int i = 0; i < block; ++i)
+		{
+			result.rotations[bones[base + i]] = blended[i];
+		}
+	}
+
+	for (int i = 0; i < count; ++i)
+	{
+		const int bone = (bones != nullptr) ? bones[i] : i;
+		result.translations[bone] = sample_vector(translation_tracks_[bone], translation_keys_, time, cursor_of(bone, 1));
+		result.scales[bone] = sample_vector(scale_tracks_[bone], scale_keys_, time, cursor_of(bone, 2));
+	}
+}
+
+// 元のクリップとの誤差を測定
+ClipCompressionStats CompressedAnimationClip::measure(const AnimationClip& source) const
+{
+	ClipCompressionStats stats;
+	stats.raw_size = source.memory_size();
+	stats.compressed_size = memory_size();
+	stats.sample_count = source.key_count() * bone_count_;
+	if (stats.sample_count == 0) return stats;
+
+	AnimationPose pose;
+	double rotation_sum = 0.0;
+	double translation_sum = 0.0;
+	for (int key = 0; key < source.key_count(); ++key)
+	{
+		sample(source.key_time(key), pose);
+		for (int bone = 0; bone < bone_count_; ++bone)
+		{
+			const float rotation = rotation_error(pose.rotations[bone], source.key_rotation(key, bone));
+			const float translation = Vector3::Distance(pose.translations[bone], source.key_translation(key, bone));
+			stats.max_rotation_error = std::max(stats.max_rotation_error, rotation);
+			stats.max_translation_error = std::max(stats.max_translation_error, translation);
+			rotation_sum += rotation;
+			translation_sum += translation;
+		}
+	}
+	stats.average_rotation_error = (float)(rotation_sum / stats.sample_count);
+	stats.average_translation_error = (float)(translation_sum / stats.sample_count);
+
+	return stats;
+}
+
+// ボーン数の取得
+int CompressedAnimationClip::bone_count() const
+{
+	return bone_count_;
+}
+
+// 終了時間の取得
+float CompressedAnimationClip::end_time() const
+{
+	return end_time_;
+}
+
+// キーデータのメモリサイズの取得（バイト）
+int CompressedAnimationClip::memory_size() const
+{
+	const auto tracks = rotation_tracks_.size() + translation_tracks_.size() + scale_tracks_.size();
+	const auto keys = rotation_keys_.size() + translation_keys_.size() + scale_keys_.size();
+	return (int)(tracks * sizeof(Track) + keys * sizeof(TrackKey));
+}
+
+// ファイルへの書き出し
+bool CompressedAnimationClip::save(const std::string& file_name) const
+{
+	std::ofstream file(file_name, std::ios::binary);
+	if (!file) return false;
+
+	file.write(CompressedClipFileMagic, sizeof(CompressedClipFileMagic));
+	file.write((const char*)&CompressedClipFileVersion, sizeof(CompressedClipFileVersion));
+	file.write((const char*)&bone_count_, sizeof(bone_count_));
+	file.write((const char*)&key_interval_, sizeof(key_interval_));
+	file.write((const char*)&end_time_, sizeof(end_time_));
+	write_array(file, rotation_tracks_);
+	write_array(file, translation_tracks_);
+	write_array(file, scale_tracks_);
+	write_array(file, rotation_keys_);
+	write_array(file, translation_keys_);
+	write_array(file, scale_keys_);
+
+	return (bool)file;
+}
+
+// ファイルからの読み込み
+bool CompressedAnimationClip::load(const std::string& file_name)
+{
+	std::ifstream file(file_name, std::ios::binary);
+	if (!file) return false;
+
+	// 識別子とバージョンを確認
+	char magic[4];
+	int version = 0;
+	file.read(magic, sizeof(magic));
+	file.read((char*)&version, sizeof(version));
+	if (!file || !std::equal(magic, magic + 4, CompressedClipFileMagic) || version != CompressedClipFileVersion) return false;
+
+	// 一時オブジェクトに読み込み、全て読み込めた場合のみ反映
+	CompressedAnimationClip clip;
+	file.read((char*)&clip.bone_count_, sizeof(clip.bone_count_));
+	file.read((char*)&clip.key_interval_, sizeof(clip.key_interval_));
+	file.read((char*)&clip.end_time_, sizeof(clip.end_time_));
+	if (!file || clip.bone_count_ < 0 || clip.key_interval_ <= 0.0f) return false;
+
+	const bool result =
+		read_array(file, clip.rotation_tracks_) &&
+		read_array(file, clip.translation_tracks_) &&
+		read_array(file, clip.scale_tracks_) &&
+		read_array(file, clip.rotation_keys_) &&
+		read_array(file, clip.translation_keys_) &&
+		read_array(file, clip.scale_keys_);
+	if (!result) return false;
+
+	const auto bones = (size_t)clip.bone_count_;
+	if (clip.rotation_tracks_.size() != bones || clip.translation_tracks_.size() != bones || clip.scale_tracks_.size() != bones) return false;
+
+	*this = std::move(clip);
+	return true;
+}
+
+// 回転トラックの作成
+void CompressedAnimationClip::compress_rotation(const AnimationClip& clip, int bone, float tolerance)
+{
+	const auto kept = reduce_keys(clip.key_count(), tolerance, [&](int a, int b, int i)
+	{
+		const auto rotation = Quaternion::Nlerp(clip.key_rotation(a, bone), clip.key_rotation(b, bone), lerp_amount(clip, a, b, i));
+		return rotation_error(rotation, clip.key_rotation(i, bone));
+	});
+
+	Track track{ (int)rotation_keys_.size(), (int)kept.size(), Vector3::Zero, Vector3::Zero };
+	for (const auto key : kept)
+	{
+		rotation_keys_.push_back(TrackKey{ (unsigned short)key, pack_rotation(clip.key_rotation(key, bone)) });
+	}
+	rotation_tracks_.push_back(track);
+}
+
+// ベクトルトラックの作成
+void CompressedAnimationClip::compress_vector(const AnimationClip& clip, int bone, float tolerance, bool is_scale)
+{
+	const auto value = [&](int key) -> const Vector3&
+	{
+		return is_scale ? clip.key_scale(key, bone) : clip.key_translation(key, bone);
+	};
+	const auto kept = reduce_keys(clip.key_count(), tolerance, [&](int a, int b, int i)
+	{
+		return Vector3::Distance(Vector3::Lerp(value(a), value(b), lerp_amount(clip, a, b, i)), value(i));
+	});
+
+	// 残すキーの範囲で量子化の刻み幅を決める
+	Vector3 minimum = value(kept.front());
+	Vector3 maximum = minimum;
+	for (const auto key : kept)
+	{
+		minimum = Vector3::Min(minimum, value(key));
+		maximum = Vector3::Max(maximum, value(key));
+	}
+	Track track{ 0, (int)kept.size(), minimum, (maximum - minimum) / VectorQuantum };
+
+	auto& keys = is_scale ? scale_keys_ : translation_keys_;
+	track.first = (int)keys.size();
+	for (const auto key : kept)
+	{
+		keys.push_back(TrackKey{ (unsigned short)key, pack_vector(value(key), track) });
+	}
+	(is_scale ? scale_tracks_ : translation_tracks_).push_back(track);
+}
+
+// キーの探索（timeの直前のキー番号と補間率を求める、cursorはトラック内の前回のキー番号）
+int CompressedAnimationClip::find_key(const Track& track, const std::vector<TrackKey>& keys, float time, float& t, int* cursor) const
+{
+	// 1キーのみのトラックは探索しない
+	t = 0.0f;
+	if (track.count == 1) return track.first;
+
+	const TrackKey* begin = keys.data() + track.first;
+	const int last = track.count - 1;
+	const float frame = time / key_interval_;
+	const auto search = [&]()
+	{
+		return (int)(std::upper_bound(begin + 1, begin + track.count, frame,
+			[](float f, const TrackKey& key) { return f < key.frame; }) - begin) - 1;
+	};
+
+	int key = 0;
+	if (cursor == nullptr)
+	{
+		key = search();
+	}
+	else
+	{
+		// 前回のキーから数キー先まで順に進め、見つからなければ二分探索（巻き戻った場合も二分探索）
+		key = std::min(*cursor, last);
+		if (frame < begin[key].frame)
+		{
+			key = search();
+		}
+		else
+		{
+			for (int step = 0; key < last && begin[key + 1].frame <= frame; ++step)
+			{
+				if (step == CursorStepMax)
+				{
+					key = search();
+					break;
+				}
+				++key;
+			}
+		}
+		*cursor = key;
+	}
+	const int next = std::min(key + 1, last);
+
+	const float t0 = std::min(begin[key].frame * key_interval_, end_time_);
+	const float t1 = std::min(begin[next].frame * key_interval_, end_time_);
+	if (t1 > t0) t = std::min((time - t0) / (t1 - t0), 1.0f);
+
+	return track.first + key;
+}
+
+// ベクトルトラックのサンプリング
+Vector3 CompressedAnimationClip::sample_vector(const Track& track, const std::vector<TrackKey>& keys, float time, int* cursor) const
+{
+	// 1キーのみのトラックは補間しない
+	if (track.count == 1) return unpack_vector(keys[track.first].value, track);
+
+	float t = 0.0f;
+	const int key = find_key(track, keys, time, t, cursor);
+	const int next = std::min(key + 1, track.first + track.count - 1);
+
+	return Vector3::Lerp(unpack_vector(keys[key].value, track), unpack_vector(keys[next].value, track), t);
+}
+
+// 回転の量子化
+CompressedAnimationClip::PackedKey CompressedAnimationClip::pack_rotation(const Quaternion& rotation)
+{
+	const Quaternion q = Quaternion::Normalize(rotation);
+	const float c[4]{ q.x, q.y, q.z, q.w };
+
+	// 絶対値が最大の成分を省略し、正になるように符号を揃える（q と -q は同じ回転）
+	int largest = 0;
+	for (int i = 1; i < 4; ++i)
+	{
+		if (std::abs(c[i]) > std::abs(c[largest])) largest = i;
+	}
+	const float sign = (c[largest] < 0.0f) ? -1.0f : 1.0f;
+
+	PackedKey result;
+	for (int i = 0, j = 0; i < 4; ++i)
+	{
+		if (i == largest) continue;
+		const float n = std::min(std::max(c[i] * sign * Sqrt2 * 0.5f + 0.5f, 0.0f), 1.0f);
+		result.v[j++] = (unsigned short)std::lround(n * RotationQuantum);
+	}
+	// 省略した成分の番号は上位ビットに格納
+	result.v[0] |= (unsigned short)((largest >> 1) << 15);
+	result.v[1] |= (unsigned short)((largest & 1) << 15);
+
+	return result;
+}
+
+// 回転の復元
+Quaternion CompressedAnimationClip::unpack_rotation(const PackedKey& key)
+{
+	const int largest = ((key.v[0] >> 15) << 1) | (key.v[1] >> 15);
+
+	// 量子化値から[-1/√2, 1/√2]に戻す係数
+	const float scale = 2.0f / (RotationQuantum * Sqrt2);
+	const float offset = -1.0f / Sqrt2;
+	const float a = (key.v[0] & 0x7fff) * scale + offset;
+	const float b = (key.v[1] & 0x7fff) * scale + offset;
+	const float c = key.v[2] * scale + offset;
+	const float d = std::sqrt(std::max(1.0f - a * a - b * b - c * c, 0.0f));
+
+	switch (largest)
+	{
+	case 0:		return Quaternion(d, a, b, c);
+	case 1:		return Quaternion(a, d, b, c);
+	case 2:		return Quaternion(a, b, d, c);
+	default:	return Quaternion(a, b, c, d);
+	}
+}
+
+// ベクトルの量子化
+CompressedAnimationClip::PackedKey CompressedAnimationClip::pack_vector(const Vector3& v, const Track& track)
+{
+	const float value[3]{ v.x - track.minimum.x, v.y - track.minimum.y, v.z - track.minimum.z };
+	const float step[3]{ track.step.x, track.step.y, track.step.z };
+
+	PackedKey result;
+	for (int i = 0; i < 3; ++i)
+	{
+		const float n = (step[i] > 0.0f) ? value[i] / step[i] : 0.0f;
+		result.v[i] = (unsigned short)std::lround(std::min(std::max(n, 0.0f), VectorQuantum));
+	}
+
+	return result;
+}
+
+// ベクトルの復元
+Vector3 CompressedAnimationClip::unpack_vector(const PackedKey& key, const Track& track)
+{
+	return Vector3(
+		track.minimum.x + key.v[0] * track.step.x,
+		track.minimum.y + key.v[1] * track.step.y,
+		track.minimum.z + key.v[2] * track.step.z);
+}
\ No newline at end of file
@@ -0,0 +1,137 @@
+#ifndef COMPRESSED_ANIMATION_CLIP_H_
+#define COMPRESSED_ANIMATION_CLIP_H_
+
+#include <string>
+#include <vector>
+#include "AnimationClip.h"
+
+// 構造体：キー削減の許容誤差（ボーンごとに指定する）
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+struct ClipTolerance
+{
+	float	rotation{ 0.001f };			// 回転の許容誤差（ラジアン）
+	float	translation{ 0.01f };		// 平行移動の許容誤差
+	float	scale{ 0.001f };			// 拡大縮小の許容誤差
+};
+
+// 構造体：圧縮結果の統計
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+struct ClipCompressionStats
+{
+	int		raw_size{ 0 };					// 圧縮前のキーデータサイズ（バイト）
+	int		compressed_size{ 0 };			// 圧縮後のキーデータサイズ（バイト）
+	int		sample_count{ 0 };				// 誤差を測定したサンプル数（ボーン数 * キー数）
+	float	max_rotation_error{ 0.0f };		// 回転の最大誤差（ラジアン）
+	float	average_rotation_error{ 0.0f };	// 回転の平均誤差（ラジアン）
+	float	max_translation_error{ 0.0f };	// 平行移動の最大誤差
+	float	average_translation_error{ 0.0f };	// 平行移動の平均誤差
+
+	// 統計の合算
+	void merge(const ClipCompressionStats& other);
+};
+
+// 構造体：クリップのサンプリング位置（トラックごとに前回使ったキーを保持する）
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// 再生時間が前回から進んでいれば前回のキーから順に探索し、巻き戻った場合や大きく飛んだ場合は二分探索する。
+// 別のクリップで使うと自動的にリセットされる。
+struct ClipCursor
+{
+	const void*			clip{ nullptr };	// 前回サンプリングしたクリップ
+	std::vector<int>	keys;				// トラックごとの前回のキー番号（ボーン番号 * 3 + 成分）
+};
+
+// クラス：圧縮アニメーションクリップ
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// 回転はsmallest three形式（15ビット * 3 + 最大成分の番号）、平行移動と拡大縮小はトラックごとの
+// 範囲で16ビットに量子化する。キーは許容誤差内で線形補間できるものを削除し、ボーン・成分ごとに
+// 独立したトラックに格納する。各キーはフレーム番号と量子化値を隣接させて格納する。
+class CompressedAnimationClip
+{
+public:
+	// デフォルトコンストラクタ
+	CompressedAnimationClip() = default;
+	// コンストラクタ（tolerancesはボーン数分の許容誤差）
+	CompressedAnimationClip(const AnimationClip& clip, const ClipTolerance tolerances[]);
+
+	// 姿勢のサンプリング
+	void sample(float time, AnimationPose& result) const;
+	// 指定したボーンのみ姿勢をサンプリング（それ以外のボーンは変更しない、cursorを指定すると前回の位置から探索する）
+	void sample(float time, AnimationPose& result, const int bones[], int count, ClipCursor* cursor = nullptr) const;
+	// 元のクリップとの誤差を測定
+	ClipCompressionStats measure(const AnimationClip& source) const;
+
+	// ボーン数の取得
+	int bone_count() const;
+	// 終了時間の取得
+	float end_time() const;
+	// キーデータのメモリサイズの取得（バイト）
+	int memory_size() const;
+
+	// ファイルへの書き出し
+	bool save(const std::string& file_name) const;
+	// ファイルからの読み込み
+	bool load(const std::string& file_name);
+
+private:
+	// 構造体：量子化した3成分（回転は最大成分を除く3成分、ベクトルはx, y, z）
+	struct PackedKey
+	{
+		unsigned short	v[3];
+	};
+
+	// 構造体：キー（フレーム番号と量子化した値）
+	struct TrackKey
+	{
+		unsigned short	frame;		// フレーム番号
+		PackedKey		value;		// 量子化した値
+	};
+
+	// 構造体：トラック（1ボーン1成分分のキー列）
+	struct Track
+	{
+		int				first;		// 先頭キーの番号
+		int				count;		// キー数
+		Vector3			minimum;	// 量子化範囲の最小値（ベクトルのみ）
+		Vector3			step;		// 量子化の刻み幅（ベクトルのみ）
+	};
+
+	// 回転トラックの作成
+	void compress_rotation(const AnimationClip& clip, int bone, float tolerance);
+	// ベクトルトラックの作成
+	void compress_vector(const AnimationClip& clip, int bone, float tolerance, bool is_scale);
+	// キーの探索（timeの直前のキー番号と補間率を求める、cursorはトラック内の前回のキー番号）
+	int find_key(const Track& track, const std::vector<TrackKey>& keys, float time, float& t, int* cursor) const;
+	// ベクトルトラックのサンプリング
+	Vector3 sample_vector(const Track& track, const std::vector<TrackKey>& keys, float time, int* cursor) const;
+
+	// 回転の量子化
+	static PackedKey pack_rotation(const Quaternion& rotation);
+	// 回転の復元
+	static Quaternion unpack_rotation(const PackedKey& key);
+	// ベクトルの量子化
+	static PackedKey pack_vector(const Vector3& v, const Track& track);
+	// ベクトルの復元
+	static Vector3 unpack_vector(const PackedKey& key, const Track& track);
+
+private:
+	// ボーン数
+	int							bone_count_{ 0 };
+	// キーの間隔
+	float						key_interval_{ 1.0f };
+	// 終了時間
+	float						end_time_{ 0.0f };
+	// 回転トラック（ボーンごと）
+	std::vector<Track>			rotation_tracks_;
+	// 平行移動トラック（ボーンごと）
+	std::vector<Track>			translation_tracks_;
+	// 拡大縮小トラック（ボーンごと）
+	std::vector<Track>			scale_tracks_;
+	// 回転キー
+	std::vector<TrackKey>		rotation_keys_;
+	// 平行移動キー
+	std::vector<TrackKey>		translation_keys_;
+	// 拡大縮小キー
+	std::vector<TrackKey>		scale_keys_;
+};
+
+#endif // !COMPRESSED_ANIMATION_CLIP_H_
\ No newline at end of file
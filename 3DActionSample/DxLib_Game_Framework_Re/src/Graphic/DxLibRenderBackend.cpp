@@ -0,0 +1,61 @@
+#include "DxLibRenderBackend.h"
+#include "SkeletalMesh.h"
+#include "Shader/ShaderManager.h"
+#include <DxLib.h>
+
+// クラス：DxLibの描画バックエンド
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+
+// レンダーターゲットの変更
+void DxLibRenderBackend::set_render_target(int render_target)
+{
+	// 描画パスごとにWorldが切り替える
+}
+
+// シェーダーの変更
+void DxLibRenderBackend::set_shader(int shader)
+{
+	if (shader < 0)
+	{
+		ShaderManager::shader_off();
+		return;
+	}
+
+	ShaderManager::set_ps(shader);
+	ShaderManager::shader_on();
+}
+
+// モデルのバインド
+void DxLibRenderBackend::bind_model(int model)
+{
+	SkeletalMesh::bind(model);
+}
+
+// テクスチャの変更
+void DxLibRenderBackend::set_texture(int texture)
+{
+	SetUseTextureToShader(0, texture);
+}
+
+// バインド中のモデルを描画（changed_bonesは前回のアップロードから値が変わったボーンのビット、nullptrで全ボーン、
+// handleはアクターごとに複製したモデルハンドル、負の値でバインド中のモデルの共有ハンドル）
+void DxLibRenderBackend::draw_skinned(const AffineMatrix world_matrices[], unsigned long long changed_bones[], int handle)
+{
+	SkeletalMesh::draw(world_matrices, changed_bones, handle);
+}
+
+// 1回のインスタンス描画に詰められるボーン行列数の取得（0でインスタンス描画に非対応）
+int DxLibRenderBackend::instance_capacity() const
+{
+	return 0;
+}
+
+// バインド中のモデルのインスタンスをまとめて描画
+void DxLibRenderBackend::draw_instanced(const InstanceBatch& batch)
+{
+	// インスタンス描画には対応しないため、1体ずつ全ボーンをアップロードして描画する
+	for (int i = 0; i < batch.instance_count; ++i)
+	{
+		SkeletalMesh::draw(batch.palettes + i * batch.bone_count);
+	}
+}
\ No newline at end of file
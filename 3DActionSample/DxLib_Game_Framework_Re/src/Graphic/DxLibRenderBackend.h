@@ -0,0 +1,30 @@
+#ifndef DXLIB_RENDER_BACKEND_H_
+#define DXLIB_RENDER_BACKEND_H_
+
+#include "IRenderBackend.h"
+
+// クラス：DxLibの描画バックエンド
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// レンダーターゲットの切り替えは呼び出し側（World）が描画パスごとに行うため、ここでは何もしない。
+// DxLibのMV1モデルにはスキンメッシュのインスタンス描画がないため、インスタンス描画には対応しない。
+class DxLibRenderBackend : public IRenderBackend
+{
+public:
+	// レンダーターゲットの変更
+	virtual void set_render_target(int render_target) override;
+	// シェーダーの変更
+	virtual void set_shader(int shader) override;
+	// モデルのバインド
+	virtual void bind_model(int model) override;
+	// テクスチャの変更
+	virtual void set_texture(int texture) override;
+	// バインド中のモデルを描画（changed_bonesは前回のアップロードから値が変わったボーンのビット、nullptrで全ボーン、
+	// handleはアクターごとに複製したモデルハンドル、負の値でバインド中のモデルの共有ハンドル）
+	virtual void draw_skinned(const AffineMatrix world_matrices[], unsigned long long changed_bones[], int handle) override;
+	// 1回のインスタンス描画に詰められるボーン行列数の取得（0でインスタンス描画に非対応）
+	virtual int instance_capacity() const override;
+	// バインド中のモデルのインスタンスをまとめて描画
+	virtual void draw_instanced(const InstanceBatch& batch) override;
+};
+
+#endif // !DXLIB_RENDER_BACKEND_H_
\ No newline at end of file
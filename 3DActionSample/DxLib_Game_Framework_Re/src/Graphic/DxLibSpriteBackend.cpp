@@ -0,0 +1,37 @@
+#include "DxLibSpriteBackend.h"
+
+// クラス：DxLibのスプライト描画バックエンド
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+
+// 矩形の描画（verticesは矩形ごとに左上、右上、左下、右下の順の4頂点）
+void DxLibSpriteBackend::draw_quads(int graph, const SpriteVertex vertices[], int quad_count)
+{
+	if (quad_count <= 0) return;
+
+	// インデックスは矩形数の最大値に合わせて一度だけ作成する
+	for (int quad = (int)indices_.size() / 6; quad < quad_count; ++quad)
+	{
+		const unsigned short base = (unsigned short)(quad * 4);
+		indices_.push_back(base + 0);
+		indices_.push_back(base + 1);
+		indices_.push_back(base + 2);
+		indices_.push_back(base + 2);
+		indices_.push_back(base + 1);
+		indices_.push_back(base + 3);
+	}
+
+	// DxLibの頂点に変換
+	const int vertex_count = quad_count * 4;
+	dx_vertices_.resize(vertex_count);
+	for (int i = 0; i < vertex_count; ++i)
+	{
+		auto& v = dx_vertices_[i];
+		v.pos = VGet(vertices[i].x, vertices[i].y, 0.0f);
+		v.rhw = 1.0f;
+		v.dif = GetColorU8(255, 255, 255, 255);
+		v.u = vertices[i].u;
+		v.v = vertices[i].v;
+	}
+
+	DrawPolygonIndexed2D(dx_vertices_.data(), vertex_count, indices_.data(), quad_count * 2, graph, TRUE);
+}
\ No newline at end of file
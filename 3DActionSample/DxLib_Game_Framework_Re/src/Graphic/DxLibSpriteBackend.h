@@ -0,0 +1,24 @@
+#ifndef DXLIB_SPRITE_BACKEND_H_
+#define DXLIB_SPRITE_BACKEND_H_
+
+#include <vector>
+#include <DxLib.h>
+#include "ISpriteBackend.h"
+
+// クラス：DxLibのスプライト描画バックエンド
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// 矩形をまとめてDrawPolygonIndexed2Dで描画する。描画輝度やブレンドモードはDxLibの現在の設定が適用される。
+class DxLibSpriteBackend : public ISpriteBackend
+{
+public:
+	// 矩形の描画（verticesは矩形ごとに左上、右上、左下、右下の順の4頂点）
+	virtual void draw_quads(int graph, const SpriteVertex vertices[], int quad_count) override;
+
+private:
+	// DxLibの頂点の作業領域
+	std::vector<VERTEX2D>		dx_vertices_;
+	// 矩形を2つの三角形に分けるインデックス
+	std::vector<unsigned short>	indices_;
+};
+
+#endif // !DXLIB_SPRITE_BACKEND_H_
\ No newline at end of file
@@ -0,0 +1,89 @@
+#include "FrustumCulling.h"
+
+// クラス：視錐台カリング
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+
+// 判定の開始（視野変換行列 * 透視変換行列から視錐台を作成し、統計をリセット）
+void FrustumCulling::begin(const Matrix& view_projection)
+{
+	set_frustum(Frustum::CreateFromMatrix(view_projection));
+	visible_count_ = 0;
+	culled_count_ = 0;
+	occluded_count_ = 0;
+	clear();
+}
+
+// 視錐台の設定
+void FrustumCulling::set_frustum(const Frustum& frustum)
+{
+	frustum_ = frustum;
+}
+
+// 遮蔽カリング用の深度バッファの設定（nullptrで遮蔽カリングしない）
+void FrustumCulling::set_occlusion(const OcclusionBuffer* occlusion)
+{
+	occlusion_ = occlusion;
+}
+
+// 描画候補の消去
+void FrustumCulling::clear()
+{
+	x_.clear();
+	y_.clear();
+	z_.clear();
+	radius_.clear();
+}
+
+// 描画候補の追加
+void FrustumCulling::add(const Vector3& center, float radius)
+{
+	x_.push_back(center.x);
+	y_.push_back(center.y);
+	z_.push_back(center.z);
+	radius_.push_back(radius);
+}
+
+// 判定（視錐台と交差し、遮蔽物に隠れていない描画候補の番号を返す）
+const std::vector<int>& FrustumCulling::cull()
+{
+	const int count = (int)radius_.size();
+	visible_.resize(count);
+	visible_.resize(frustum_.Intersects(x_.data(), y_.data(), z_.data(), radius_.data(), count, visible_.data()));
+	culled_count_ += count - (int)visible_.size();
+
+	// 視錐台内に残ったものだけ遮蔽物に隠れているかを調べる
+	if (occlusion_ != nullptr)
+	{
+		int visible = 0;
+		for (const auto index : visible_)
+		{
+			if (occlusion_->is_visible(Vector3(x_[index], y_[index], z_[index]), radius_[index]))
+			{
+				visible_[visible++] = index;
+			}
+		}
+		occluded_count_ += (int)visible_.size() - visible;
+		visible_.resize(visible);
+	}
+
+	visible_count_ += (int)visible_.size();
+	return visible_;
+}
+
+// 描画候補と判定された数の取得
+int FrustumCulling::visible_count() const
+{
+	return visible_count_;
+}
+
+// 視錐台の外でカリングされた数の取得
+int FrustumCulling::culled_count() const
+{
+	return culled_count_;
+}
+
+// 遮蔽物に隠れてカリングされた数の取得
+int FrustumCulling::occluded_count() const
+{
+	return occluded_count_;
+}
\ No newline at end of file
@@ -0,0 +1,59 @@
+#ifndef FRUSTUM_CULLING_H_
+#define FRUSTUM_CULLING_H_
+
+#include <vector>
+#include "../Math/Vector3.h"
+#include "../Math/Matrix.h"
+#include "../Math/Frustum.h"
+#include "OcclusionBuffer.h"
+
+// クラス：視錐台カリング
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// 描画候補の境界球を登録し、視錐台と交差するものの番号（登録順）を一括で求める。
+// 遮蔽カリング用の深度バッファを設定すると、遮蔽物の奥に隠れたものも除く。
+// 統計はbegin()からの累計。
+class FrustumCulling
+{
+public:
+	// 判定の開始（視野変換行列 * 透視変換行列から視錐台を作成し、統計をリセット）
+	void begin(const Matrix& view_projection);
+	// 視錐台の設定
+	void set_frustum(const Frustum& frustum);
+	// 遮蔽カリング用の深度バッファの設定（nullptrで遮蔽カリングしない）
+	void set_occlusion(const OcclusionBuffer* occlusion);
+	// 描画候補の消去
+	void clear();
+	// 描画候補の追加
+	void add(const Vector3& center, float radius);
+	// 判定（視錐台と交差し、遮蔽物に隠れていない描画候補の番号を返す）
+	const std::vector<int>& cull();
+
+	// 描画候補と判定された数の取得
+	int visible_count() const;
+	// 視錐台の外でカリングされた数の取得
+	int culled_count() const;
+	// 遮蔽物に隠れてカリングされた数の取得
+	int occluded_count() const;
+
+private:
+	// 視錐台
+	Frustum					frustum_;
+	// 遮蔽カリング用の深度バッファ
+	const OcclusionBuffer*	occlusion_{ nullptr };
+	// 描画候補の中心座標（成分ごと）
+	std::vector<float>		x_;
+	std::vector<float>		y_;
+	std::vector<float>		z_;
+	// 描画候補の半径
+	std::vector<float>		radius_;
+	// 視錐台と交差する描画候補の番号
+	std::vector<int>		visible_;
+	// 描画候補と判定された数
+	int						visible_count_{ 0 };
+	// 視錐台の外でカリングされた数
+	int						culled_count_{ 0 };
+	// 遮蔽物に隠れてカリングされた数
+	int						occluded_count_{ 0 };
+};
+
+#endif // !FRUSTUM_CULLING_H_
\ No newline at end of file
@@ -1,95 +1,119 @@
 #include "Graphics2D.h"
 #include <DxLib.h>
 
-// NXF2DOtBbNX
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：2Dグラフィックス
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
-// XvCgf[^
+// スプライトデータ
 std::unordered_map<int, AnimatedSprite> Graphics2D::sprite_map_;
+// スプライトバッチ
+SpriteBatch Graphics2D::sprite_batch_;
+// スプライトバッチの描画バックエンド
+DxLibSpriteBackend Graphics2D::sprite_backend_;
 
-// 
+// 初期化
 void Graphics2D::initialize()
 {
 	sprite_map_.clear();
+	sprite_batch_.clear();
+	sprite_batch_.reset_stats();
 }
 
-// 摜t@C̓ǂݍ
+// 画像ファイルの読み込み
 void Graphics2D::load(int id, const std::string& file_name)
 {
 	sprite_map_[id].load(file_name);
 }
 
-// 摜t@C̓ǂݍ݁iw肠j
+// 画像ファイルの読み込み（分割指定あり）
 void Graphics2D::load(int id, const std::string& file_name, int row, int column)
 {
 	sprite_map_[id].load(file_name, row, column);
 }
 
-// `i摜Śj
+// 描画（画像全体）
 void Graphics2D::draw(int id, const Vector2& position)
 {
 	sprite_map_[id].draw(position);
 }
 
-// `i摜̈ꕔ`j
+// 描画（画像の一部分を描画）
 void Graphics2D::draw(int id, const Vector2& position, int x, int y, int w, int h)
 {
 	sprite_map_[id].draw(position, x, y, w, h);
 }
 
-// `iԍwj
+// 描画（分割番号指定）
 void Graphics2D::draw(int id, int div_no, const Vector2& position,
 	const Vector2& center, const Vector2& scale, float rotation)
 {
 	sprite_map_[id].draw(div_no, position, center, scale, rotation);
 }
 
-// `iAj[Vwj
+// 描画（アニメーション指定）
 void Graphics2D::draw(int id, int animation, float time, const Vector2& position,
 	const Vector2& center, const Vector2& scale, float rotation)
 {
 	sprite_map_[id].draw(animation, time, position, center, scale, rotation);
 }
 
-// Aj[V̒ǉ
+// アニメーションの追加
 void Graphics2D::add_animation(int id, int animation, int start, int end, float time)
 {
 	sprite_map_[id].add_animation(animation, start, end, time);
 }
 
-// L[t[̒ǉ
+// キーフレームの追加
 void Graphics2D::add_key_frame(int id, int animation, float time, int div_no)
 {
 	sprite_map_[id].add_key_frame(animation, time, div_no);
 }
 
-// L[t[̒ǉ
+// キーフレームの追加
 void Graphics2D::add_key_frame(int id, int animation, float time, int x, int y, int w, int h)
 {
 	sprite_map_[id].add_key_frame(animation, time, x, y, w, h);
 }
 
-// XvCg̍폜
+// バッチ描画用のテクスチャの取得
+SpriteTexture Graphics2D::texture(int id)
+{
+	return sprite_map_[id].texture();
+}
+
+// スプライトバッチの取得
+SpriteBatch& Graphics2D::batch()
+{
+	return sprite_batch_;
+}
+
+// スプライトバッチに溜めた矩形の描画
+void Graphics2D::flush()
+{
+	sprite_batch_.flush(sprite_backend_);
+}
+
+// スプライトの削除
 void Graphics2D::delete_sprite(int id)
 {
 	sprite_map_.erase(id);
 }
 
-// Aj[V̏IԂ擾
+// アニメーションの終了時間を取得
 float Graphics2D::get_sprite_animation_end_time(int id, int animation)
 {
 	return sprite_map_[id].animation_end_time(animation);
 }
 
-// wiF̐ݒ
+// 背景色の設定
 void Graphics2D::clear_color(float r, float g, float b)
 {
 	SetBackgroundColor(int(r * 255.0f), int(g * 255.0f), int(b * 255.0f));
 }
 
-// I
+// 終了
 void Graphics2D::finalize()
 {
-	// Ɠ
+	// 初期化と同じ処理
 	initialize();
 }
\ No newline at end of file
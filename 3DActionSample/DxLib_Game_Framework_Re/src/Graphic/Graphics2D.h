@@ -3,48 +3,60 @@
 
 #include "../Math/Vector2.h"
 #include "AnimatedSprite.h"
+#include "SpriteBatch.h"
+#include "DxLibSpriteBackend.h"
 #include <string>
 #include <unordered_map>
 
-// NXF2DOtBbNX
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：2Dグラフィックス
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 class Graphics2D
 {
 public:
-	// 
+	// 初期化
 	static void initialize();
-	// 摜t@C̓ǂݍ
+	// 画像ファイルの読み込み
 	static void load(int id, const std::string& file_name);
-	// 摜t@C̓ǂݍ݁iw肠j
+	// 画像ファイルの読み込み（分割指定あり）
 	static void load(int id, const std::string& file_name, int row, int column);
-	// `i摜Śj
+	// 描画（画像全体）
 	static void draw(int id, const Vector2& position);
-	// `i摜̈ꕔ`j
+	// 描画（画像の一部分を描画）
 	static void draw(int id, const Vector2& position, int x, int y, int w, int h);
-	// `iԍwj
+	// 描画（分割番号指定）
 	static void draw(int id, int div_no, const Vector2& position,
 		const Vector2& center = Vector2::Zero, const Vector2& scale = Vector2::One, float rotation = 0.0f);
-	// `iAj[Vwj
+	// 描画（アニメーション指定）
 	static void draw(int id, int animation, float time, const Vector2& position,
 		const Vector2& center = Vector2::Zero, const Vector2& scale = Vector2::One, float rotation = 0.0f);
-	// Aj[V̒ǉ
+	// アニメーションの追加
 	static void add_animation(int id, int animation, int start, int end, float time);
-	// L[t[̒ǉ
+	// キーフレームの追加
 	static void add_key_frame(int id, int animation, float time, int div_no);
-	// L[t[̒ǉ
+	// キーフレームの追加
 	static void add_key_frame(int id, int animation, float time, int x, int y, int w, int h);
-	// XvCg̍폜
+	// バッチ描画用のテクスチャの取得
+	static SpriteTexture texture(int id);
+	// スプライトバッチの取得
+	static SpriteBatch& batch();
+	// スプライトバッチに溜めた矩形の描画
+	static void flush();
+	// スプライトの削除
 	static void delete_sprite(int id);
-	// Aj[V̏IԂ擾
+	// アニメーションの終了時間を取得
 	static float get_sprite_animation_end_time(int id, int animation);
-	// wiF̐ݒ
+	// 背景色の設定
 	static void clear_color(float r, float g, float b);
-	// I
+	// 終了
 	static void finalize();
 
 private:
-	// XvCgf[^
+	// スプライトデータ
 	static std::unordered_map<int, AnimatedSprite> sprite_map_;
+	// スプライトバッチ
+	static SpriteBatch sprite_batch_;
+	// スプライトバッチの描画バックエンド
+	static DxLibSpriteBackend sprite_backend_;
 };
 
 #endif // !GRAPHICS_2D_H_
\ No newline at end of file
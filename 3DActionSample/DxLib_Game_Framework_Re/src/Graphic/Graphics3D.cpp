@@ -1,46 +1,46 @@
 #include "Graphics3D.h"
 #include "../Math/MathHelper.h"
 
-// NXF3DOtBbNX
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：3Dグラフィックス
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
-// Cg̃p[^
+// ライトのパラメータ
 Light Graphics3D::light_;
 
-// 
+// 初期化
 void Graphics3D::initialize()
 {
-	// `𗠉ʂɂ
+	// 描画先を裏画面にする
 	SetDrawScreen(DX_SCREEN_BACK);
-	// Zobt@L
+	// Zバッファを有効化
 	enable_z_buffer();
-	// Zobt@ւ݂̏
+	// Zバッファへの書き込みを許可
 	enable_write_z_buffer();
-	// ftHg̃Cgݒ
+	// デフォルトのライト設定
 	set_light(Light());
-	// CeBOL
+	// ライティングを有効化
 	enable_lighting();
 }
 
-// I
+// 終了
 void Graphics3D::finalize()
 {
 
 }
 
-// XN[̏
+// スクリーンの消去
 void Graphics3D::clear()
 {
 	ClearDrawScreen();
 }
 
-// XN[J[̐ݒ
+// スクリーン消去カラーの設定
 void Graphics3D::clear_color(float r, float g, float b)
 {
 	SetBackgroundColor(int(r * 255), int(g * 255), int(b * 255));
 }
 
-// r[|[g̐ݒ
+// ビューポートの設定
 void Graphics3D::set_viewport(int x, int y, int w, int h)
 {
 	MATRIX viewport_matrix;
@@ -49,31 +49,31 @@ void Graphics3D::set_viewport(int x, int y, int w, int h)
 	SetDrawArea(x, y, x + w, y + h);
 }
 
-// ϊs̐ݒ
+// 視野変換行列の設定
 void Graphics3D::set_view_matrix(const Matrix& view)
 {
 	SetCameraViewMatrix(view);
 }
 
-// ϊs̐ݒ
+// 透視変換行列の設定
 void Graphics3D::set_projection_matrix(const Matrix& projection)
 {
 	SetupCamera_ProjectionMatrix(projection);
 }
 
-// ϊs̎擾
+// 視野変換行列の取得
 Matrix Graphics3D::get_view_matrix()
 {
 	return GetCameraViewMatrix();
 }
 
-// ϊs̎擾
+// 透視変換行列の取得
 Matrix Graphics3D::get_projection_matrix()
 {
 	return GetCameraProjectionMatrix();
 }
 
-// Cg̐ݒ
+// ライトの設定
 void Graphics3D::set_light(const Light& light)
 {
 	switch (light.type)
@@ -97,49 +97,49 @@ void Graphics3D::set_light(const Light& light)
 	light_ = light;
 }
 
-// Cg̎擾
+// ライトの取得
 const Light& Graphics3D::get_light()
 {
 	return light_;
 }
 
-// CeBO̗L
+// ライティングの有効化
 void Graphics3D::enable_lighting()
 {
 	SetLightEnable(TRUE);
 }
 
-// CeBO̖
+// ライティングの無効化
 void Graphics3D::disable_lighting()
 {
 	SetLightEnable(FALSE);
 }
 
-// Zobt@̗L
+// Zバッファの有効化
 void Graphics3D::enable_z_buffer()
 {
 	SetUseZBuffer3D(TRUE);
 }
 
-// Zobt@̖
+// Zバッファの無効化
 void Graphics3D::disable_z_buffer()
 {
 	SetUseZBuffer3D(FALSE);
 }
 
-// Zobt@ւ݂̏̋
+// Zバッファへの書き込みの許可
 void Graphics3D::enable_write_z_buffer()
 {
 	SetWriteZBuffer3D(TRUE);
 }
 
-// Zobt@ւ݂̏̋֎~
+// Zバッファへの書き込みの禁止
 void Graphics3D::disable_write_z_buffer()
 {
 	SetWriteZBuffer3D(FALSE);
 }
 
-// uh[h̐ݒ
+// ブレンドモードの設定
 void Graphics3D::blend_mode(BlendMode mode, float a)
 {
 	switch (mode)
@@ -5,88 +5,88 @@
 #include "../Math/Color.h"
 #include "../Math/Matrix.h"
 
-// \́FCgij
+// 構造体：ライト（光源）
 struct Light
 {
-	// 񋓌^FCg̎
+	// 列挙型：ライトの種類
 	enum class LightType
 	{
-		Directional,	// s
-		Point,			// |CgCg
-		Spot,			// X|bgCg
+		Directional,	// 平行光源
+		Point,			// ポイントライト
+		Spot,			// スポットライト
 	};
 
-	LightType	type{ LightType::Directional };		// Cg̎
-	Vector3		direction{ 1.0f, -1.0f, 1.0f };		// Cg̕
-	Vector3		position{ 0.0f, 0.0f, 0.0f };		// Cg̍W
-	Color		ambient{ 0.3f, 0.3f, 0.3f, 1.0f };	// 
-	Color		diffuse{ 1.0f, 1.0f, 1.0f, 1.0f };	// gUˌ
-	Color		specular{ 1.0f, 1.0f, 1.0f ,1.0f };	// ʔˌ
-	float		attenuation0{ 0.1f };				// p[^1
-	float		attenuation1{ 0.1f };				// p[^2
-	float		attenuation2{ 0.1f };				// p[^3
-	float		range{ 2000.0f };					// Cg̗L
-	float		out_angle{ 114.0f };				// X|bgCg̊Opx
-	float		in_angle{ 114.0f };					// X|bgCg̓px
+	LightType	type{ LightType::Directional };		// ライトの種類
+	Vector3		direction{ 1.0f, -1.0f, 1.0f };		// ライトの方向
+	Vector3		position{ 0.0f, 0.0f, 0.0f };		// ライトの座標
+	Color		ambient{ 0.3f, 0.3f, 0.3f, 1.0f };	// 環境光
+	Color		diffuse{ 1.0f, 1.0f, 1.0f, 1.0f };	// 拡散反射光
+	Color		specular{ 1.0f, 1.0f, 1.0f ,1.0f };	// 鏡面反射光
+	float		attenuation0{ 0.1f };				// 減衰パラメータ1
+	float		attenuation1{ 0.1f };				// 減衰パラメータ2
+	float		attenuation2{ 0.1f };				// 減衰パラメータ3
+	float		range{ 2000.0f };					// ライトの有効距離
+	float		out_angle{ 114.0f };				// スポットライトの外側角度
+	float		in_angle{ 114.0f };					// スポットライトの内側角度
 };
 
-// 񋓌^Fuh[h
+// 列挙型：ブレンドモード
 enum class BlendMode
 {
-	None,		// 
-	Alpha,		// At@uh
-	Add,		// Zuh
-	Sub,		// Zuh
+	None,		// 無効
+	Alpha,		// アルファブレンド
+	Add,		// 加算ブレンド
+	Sub,		// 減算ブレンド
 };
 
-// NXF3DOtBbNX
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：3Dグラフィックス
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 class Graphics3D
 {
 public:
-	// 
+	// 初期化
 	static void initialize();
-	// I
+	// 終了
 	static void finalize();
 
-	// XN[̏
+	// スクリーンの消去
 	static void clear();
-	// XN[J[̐ݒ
+	// スクリーン消去カラーの設定
 	static void clear_color(float r, float g, float b);
 
-	// r[|[g̐ݒ
+	// ビューポートの設定
 	static void set_viewport(int x, int y, int w, int h);
-	// ϊs̐ݒ
+	// 視野変換行列の設定
 	static void set_view_matrix(const Matrix& view);
-	// ϊs̐ݒ
+	// 透視変換行列の設定
 	static void set_projection_matrix(const Matrix& projection);
-	// ϊs̎擾
+	// 視野変換行列の取得
 	static Matrix get_view_matrix();
-	// ϊs̎擾
+	// 透視変換行列の取得
 	static Matrix get_projection_matrix();
 
-	// Cg̐ݒ
+	// ライトの設定
 	static void set_light(const Light& light);
-	// Cg̎擾
+	// ライトの取得
 	static const Light& get_light();
-	// CeBO̗L
+	// ライティングの有効化
 	static void enable_lighting();
-	// CeBO̖
+	// ライティングの無効化
 	static void disable_lighting();
-	// Zobt@̗L
+	// Zバッファの有効化
 	static void enable_z_buffer();
-	// Zobt@̖
+	// Zバッファの無効化
 	static void disable_z_buffer();
-	// Zobt@ւ݂̏̋
+	// Zバッファへの書き込みの許可
 	static void enable_write_z_buffer();
-	// Zobt@ւ݂̏̋֎~
+	// Zバッファへの書き込みの禁止
 	static void disable_write_z_buffer();
 
-	// uh[h̐ݒ
+	// ブレンドモードの設定
 	static void blend_mode(BlendMode mode, float a = 1.0f);
 
 private:
-	// Cg̃p[^
+	// ライトのパラメータ
 	static Light light_;
 };
 
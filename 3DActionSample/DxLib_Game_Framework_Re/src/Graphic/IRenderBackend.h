@@ -0,0 +1,32 @@
+#ifndef IRENDER_BACKEND_H_
+#define IRENDER_BACKEND_H_
+
+#include "../Math/AffineMatrix.h"
+#include "InstanceBuffer.h"
+
+// クラス：描画バックエンドインターフェース
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// 描画コマンドの実行先。状態の変更は値が変わった時だけ呼び出される。
+class IRenderBackend
+{
+public:
+	// 仮想デストラクタ
+	virtual ~IRenderBackend() { }
+	// レンダーターゲットの変更
+	virtual void set_render_target(int render_target) = 0;
+	// シェーダーの変更
+	virtual void set_shader(int shader) = 0;
+	// モデルのバインド
+	virtual void bind_model(int model) = 0;
+	// テクスチャの変更
+	virtual void set_texture(int texture) = 0;
+	// バインド中のモデルを描画（changed_bonesは前回のアップロードから値が変わったボーンのビット、nullptrで全ボーン、
+	// handleはアクターごとに複製したモデルハンドル、負の値でバインド中のモデルの共有ハンドル）
+	virtual void draw_skinned(const AffineMatrix world_matrices[], unsigned long long changed_bones[], int handle) = 0;
+	// 1回のインスタンス描画に詰められるボーン行列数の取得（0でインスタンス描画に非対応）
+	virtual int instance_capacity() const = 0;
+	// バインド中のモデルのインスタンスをまとめて描画
+	virtual void draw_instanced(const InstanceBatch& batch) = 0;
+};
+
+#endif // !IRENDER_BACKEND_H_
\ No newline at end of file
@@ -0,0 +1,25 @@
+#ifndef ISPRITE_BACKEND_H_
+#define ISPRITE_BACKEND_H_
+
+// 構造体：スプライトの頂点
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+struct SpriteVertex
+{
+	float	x;		// スクリーン座標のx
+	float	y;		// スクリーン座標のy
+	float	u;		// テクスチャ座標のu
+	float	v;		// テクスチャ座標のv
+};
+
+// クラス：スプライトの描画バックエンドインターフェース
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+class ISpriteBackend
+{
+public:
+	// 仮想デストラクタ
+	virtual ~ISpriteBackend() { }
+	// 矩形の描画（verticesは矩形ごとに左上、右上、左下、右下の順の4頂点）
+	virtual void draw_quads(int graph, const SpriteVertex vertices[], int quad_count) = 0;
+};
+
+#endif // !ISPRITE_BACKEND_H_
\ No newline at end of file
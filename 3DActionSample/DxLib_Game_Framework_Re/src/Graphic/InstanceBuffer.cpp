@@ -0,0 +1,67 @@
+#include "InstanceBuffer.h"
+#include <algorithm>
+
+// クラス：インスタンス描画用のボーン行列バッファ
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+
+// コンストラクタ
+InstanceBuffer::InstanceBuffer(int capacity)
+{
+	set_capacity(capacity);
+}
+
+// バッチの開始（以前に詰めた行列は消去する）
+void InstanceBuffer::begin(int model, int bone_count)
+{
+	model_ = model;
+	bone_count_ = bone_count;
+	instance_count_ = 0;
+}
+
+// インスタンスの追加（容量に収まらなければ何もせずにfalseを返す）
+bool InstanceBuffer::add(const AffineMatrix world_matrices[])
+{
+	if (bone_count_ <= 0 || (instance_count_ + 1) * bone_count_ > capacity_) return false;
+
+	// 配列は容量分を確保済みなので、コピーするだけで済む
+	std::copy(world_matrices, world_matrices + bone_count_, palettes_.begin() + instance_count_ * bone_count_);
+	++instance_count_;
+	return true;
+}
+
+// 詰めたバッチの取得（次のbegin()まで有効）
+InstanceBatch InstanceBuffer::batch() const
+{
+	InstanceBatch result;
+	result.model = model_;
+	result.bone_count = bone_count_;
+	result.instance_count = instance_count_;
+	result.palettes = palettes_.data();
+	return result;
+}
+
+// 容量の設定（1バッチに詰めるボーン行列の最大数）
+void InstanceBuffer::set_capacity(int capacity)
+{
+	capacity_ = std::max(capacity, 0);
+	palettes_.resize(capacity_);
+	instance_count_ = 0;
+}
+
+// 容量の取得
+int InstanceBuffer::capacity() const
+{
+	return capacity_;
+}
+
+// 1バッチに詰められるインスタンス数の取得（ボーン数が容量を超える場合は0）
+int InstanceBuffer::instances_per_batch(int bone_count) const
+{
+	return (bone_count > 0) ? capacity_ / bone_count : 0;
+}
+
+// 詰めたインスタンス数の取得
+int InstanceBuffer::size() const
+{
+	return instance_count_;
+}
\ No newline at end of file
@@ -0,0 +1,60 @@
+#ifndef INSTANCE_BUFFER_H_
+#define INSTANCE_BUFFER_H_
+
+#include <vector>
+#include "../Math/AffineMatrix.h"
+
+// 構造体：インスタンス描画のバッチ
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+struct InstanceBatch
+{
+	int					model;			// スケルタルメッシュのID
+	int					bone_count;		// 1インスタンスのボーン数
+	int					instance_count;	// インスタンス数
+	const AffineMatrix*	palettes;		// インスタンス順に詰めたボーン行列（bone_count * instance_count個）
+};
+
+// クラス：インスタンス描画用のボーン行列バッファ
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// 同じモデルを描画する各インスタンスのボーン行列を1つの配列に詰める。
+// インスタンスnのボーンbの行列はpalettes[n * bone_count + b]にあり、シェーダーはインスタンス番号から参照できる。
+// 1バッチに詰める行列数は容量までに抑え、容量を超える分は次のバッチに回す。
+class InstanceBuffer
+{
+public:
+	// 既定の容量（定数バッファ1つ分の4096個のfloat4に収まるボーン行列数）
+	static const int	DefaultCapacity{ 4096 / 3 };
+
+	// コンストラクタ
+	explicit InstanceBuffer(int capacity = DefaultCapacity);
+
+	// バッチの開始（以前に詰めた行列は消去する）
+	void begin(int model, int bone_count);
+	// インスタンスの追加（容量に収まらなければ何もせずにfalseを返す）
+	bool add(const AffineMatrix world_matrices[]);
+	// 詰めたバッチの取得（次のbegin()まで有効）
+	InstanceBatch batch() const;
+
+	// 容量の設定（1バッチに詰めるボーン行列の最大数）
+	void set_capacity(int capacity);
+	// 容量の取得
+	int capacity() const;
+	// 1バッチに詰められるインスタンス数の取得（ボーン数が容量を超える場合は0）
+	int instances_per_batch(int bone_count) const;
+	// 詰めたインスタンス数の取得
+	int size() const;
+
+private:
+	// 1バッチに詰めるボーン行列の最大数
+	int							capacity_;
+	// バッチのモデル
+	int							model_{ -1 };
+	// 1インスタンスのボーン数
+	int							bone_count_{ 0 };
+	// 詰めたインスタンス数
+	int							instance_count_{ 0 };
+	// インスタンス順に詰めたボーン行列
+	std::vector<AffineMatrix>	palettes_;
+};
+
+#endif // !INSTANCE_BUFFER_H_
\ No newline at end of file
@@ -1,14 +1,14 @@
 #include "Light.h"
 
-// NXFCg
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：ライト
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
-// RXgN^
+// コンストラクタ
 Light::Light(IWorld* world, const Vector3& position) :
 	Actor(world, "Light", position)
 { }
 
-// `
+// 描画
 void Light::draw() const
 {
 
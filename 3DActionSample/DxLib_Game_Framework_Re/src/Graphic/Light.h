@@ -3,14 +3,14 @@
 
 #include "../Actor/Actor.h"
 
-// NXFCg
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：ライト
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 class Light : public Actor
 {
 public:
-	// RXgN^
+	// コンストラクタ
 	Light(IWorld* world, const Vector3& position);
-	// `
+	// 描画
 	virtual void draw() const override;
 };
 
@@ -1,32 +1,32 @@
 #include "ModelAsset.h"
 #include <DxLib.h>
 
-// NXFfAZbg
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：モデルアセット
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
-// fXgN^
+// デストラクタ
 ModelAsset::~ModelAsset()
 {
-	// f[^
+	// データを消去
 	clear();
 }
 
-// f̓ǂݍ
+// モデルの読み込み
 bool ModelAsset::load(int id, const std::string& file_name)
 {
-	// ID̃f[^폜
+	// 同じIDのデータを削除
 	erase(id);
-	// ff[^ǂݍ
+	// モデルデータを読み込む
 	asset_[id] = MV1LoadModel(file_name.c_str());
 
-	// ǂݍ݌ʂԂ
+	// 読み込み結果を返す
 	return asset_[id] != -1;
 }
 
-// f̍폜
+// モデルの削除
 void ModelAsset::erase(int id)
 {
-	// Ỹff[^݂ꍇAf[^폜
+	// 該当のモデルデータが存在する場合、データを削除
 	if (asset_.count(id) > 0)
 	{
 		MV1DeleteModel(asset_[id]);
@@ -34,10 +34,10 @@ void ModelAsset::erase(int id)
 	}
 }
 
-// f[^̏
+// データの消去
 void ModelAsset::clear()
 {
-	// SẴff[^
+	// 全てのモデルデータを消去
 	for (const auto model : asset_)
 	{
 		MV1DeleteModel(model.second);
@@ -45,7 +45,7 @@ void ModelAsset::clear()
 	asset_.clear();
 }
 
-// nh̎擾
+// ハンドルの取得
 int ModelAsset::operator[](int id) const
 {
 	return asset_.at(id);
@@ -4,30 +4,30 @@
 #include <string>
 #include <unordered_map>
 
-// NXFfAZbg
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：モデルアセット
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 class ModelAsset
 {
 public:
-	// ftHgRXgN^
+	// デフォルトコンストラクタ
 	ModelAsset() = default;
-	// fXgN^
+	// デストラクタ
 	~ModelAsset();
-	// f̓ǂݍ
+	// モデルの読み込み
 	bool load(int id, const std::string& file_name);
-	// f̍폜
+	// モデルの削除
 	void erase(int id);
-	// f[^̏
+	// データの消去
 	void clear();
-	// nh̎擾
+	// ハンドルの取得
 	int operator[](int id) const;
 
-	// Rs[֎~
+	// コピー禁止
 	ModelAsset(const ModelAsset& other) = delete;
 	ModelAsset& operator = (const ModelAsset& other) = delete;
 
 private:
-	// ff[^}bv
+	// モデルデータマップ
 	std::unordered_map<int, int> asset_;
 };
 
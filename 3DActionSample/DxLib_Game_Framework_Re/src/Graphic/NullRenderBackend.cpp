@@ -0,0 +1,81 @@
+#include "NullRenderBackend.h"
+
+// クラス：何も描画しない描画バックエンド
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+
+// レンダーターゲットの変更
+void NullRenderBackend::set_render_target(int /*render_target*/)
+{
+	++state_changes_;
+}
+
+// シェーダーの変更
+void NullRenderBackend::set_shader(int /*shader*/)
+{
+	++state_changes_;
+}
+
+// モデルのバインド
+void NullRenderBackend::bind_model(int /*model*/)
+{
+	++state_changes_;
+}
+
+// テクスチャの変更
+void NullRenderBackend::set_texture(int /*texture*/)
+{
+	++state_changes_;
+}
+
+// バインド中のモデルを描画（changed_bonesは前回のアップロードから値が変わったボーンのビット、nullptrで全ボーン、
+// handleはアクターごとに複製したモデルハンドル、負の値でバインド中のモデルの共有ハンドル）
+void NullRenderBackend::draw_skinned(const AffineMatrix /*world_matrices*/[], unsigned long long /*changed_bones*/[], int /*handle*/)
+{
+	++draw_calls_;
+	++instances_;
+}
+
+// 1回のインスタンス描画に詰められるボーン行列数の取得（0でインスタンス描画に非対応）
+int NullRenderBackend::instance_capacity() const
+{
+	return instance_capacity_;
+}
+
+// バインド中のモデルのインスタンスをまとめて描画
+void NullRenderBackend::draw_instanced(const InstanceBatch& batch)
+{
+	++draw_calls_;
+	instances_ += batch.instance_count;
+}
+
+// インスタンス描画の容量の設定（0でインスタンス描画に非対応）
+void NullRenderBackend::set_instance_capacity(int capacity)
+{
+	instance_capacity_ = capacity;
+}
+
+// 回数のリセット
+void NullRenderBackend::reset()
+{
+	state_changes_ = 0;
+	draw_calls_ = 0;
+	instances_ = 0;
+}
+
+// 状態の変更回数の取得（レンダーターゲット、シェーダー、モデル、テクスチャの合計）
+int NullRenderBackend::state_changes() const
+{
+	return state_changes_;
+}
+
+// 描画回数の取得
+int NullRenderBackend::draw_calls() const
+{
+	return draw_calls_;
+}
+
+// 描画したインスタンス数の取得（インスタンス描画以外の描画を含む）
+int NullRenderBackend::instances() const
+{
+	return instances_;
+}
\ No newline at end of file
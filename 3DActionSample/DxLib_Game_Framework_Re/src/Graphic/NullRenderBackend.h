@@ -0,0 +1,51 @@
+#ifndef NULL_RENDER_BACKEND_H_
+#define NULL_RENDER_BACKEND_H_
+
+#include "IRenderBackend.h"
+
+// クラス：何も描画しない描画バックエンド
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// 呼び出し回数だけを数える。DxLibなしで描画コマンドの記録と実行のCPU負荷を計測するために使う。
+// インスタンス描画の容量を設定すると、インスタンス描画に対応したバックエンドとして振る舞う。
+class NullRenderBackend : public IRenderBackend
+{
+public:
+	// レンダーターゲットの変更
+	virtual void set_render_target(int render_target) override;
+	// シェーダーの変更
+	virtual void set_shader(int shader) override;
+	// モデルのバインド
+	virtual void bind_model(int model) override;
+	// テクスチャの変更
+	virtual void set_texture(int texture) override;
+	// バインド中のモデルを描画（changed_bonesは前回のアップロードから値が変わったボーンのビット、nullptrで全ボーン、
+	// handleはアクターごとに複製したモデルハンドル、負の値でバインド中のモデルの共有ハンドル）
+	virtual void draw_skinned(const AffineMatrix world_matrices[], unsigned long long changed_bones[], int handle) override;
+	// 1回のインスタンス描画に詰められるボーン行列数の取得（0でインスタンス描画に非対応）
+	virtual int instance_capacity() const override;
+	// バインド中のモデルのインスタンスをまとめて描画
+	virtual void draw_instanced(const InstanceBatch& batch) override;
+
+	// インスタンス描画の容量の設定（0でインスタンス描画に非対応）
+	void set_instance_capacity(int capacity);
+	// 回数のリセット
+	void reset();
+	// 状態の変更回数の取得（レンダーターゲット、シェーダー、モデル、テクスチャの合計）
+	int state_changes() const;
+	// 描画回数の取得
+	int draw_calls() const;
+	// 描画したインスタンス数の取得（インスタンス描画以外の描画を含む）
+	int instances() const;
+
+private:
+	// 状態の変更回数
+	int	state_changes_{ 0 };
+	// 描画回数
+	int	draw_calls_{ 0 };
+	// 描画したインスタンス数
+	int	instances_{ 0 };
+	// インスタンス描画の容量
+	int	instance_capacity_{ 0 };
+};
+
+#endif // !NULL_RENDER_BACKEND_H_
\ No newline at end of file
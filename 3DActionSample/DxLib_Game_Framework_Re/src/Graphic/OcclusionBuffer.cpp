@@ -0,0 +1,473 @@
+#include "OcclusionBuffer.h"
+#include "../Math/MathSIMD.h"
+#include "WorkerPool.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+// クラス：遮蔽カリング用の深度バッファ
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+
+// 三角形から作成（面積の大きい順にmax_triangles個までを選び、使われる頂点だけを残す）
+OccluderMesh OccluderMesh::create(const std::vector<Vector3>& positions, const std::vector<int>& indices, int max_triangles)
+{
+	const int count = (int)indices.size() / 3;
+	std::vector<float> areas(count);
+	for (int i = 0; i < count; ++i)
+	{
+		const auto& p0 = positions[indices[i * 3 + 0]];
+		const auto& p1 = positions[indices[i * 3 + 1]];
+		const auto& p2 = positions[indices[i * 3 + 2]];
+		areas[i] = Vector3::Cross(p1 - p0, p2 - p0).Length();
+	}
+
+	// 面積の大きい順に選ぶ（元の順番は保つ）
+	std::vector<int> order(count);
+	std::iota(order.begin(), order.end(), 0);
+	const int selected = std::max(std::min(max_triangles, count), 0);
+	std::stable_sort(order.begin(), order.end(), [&](int a, int b) { return areas[a] > areas[b]; });
+	order.resize(selected);
+	std::sort(order.begin(), order.end());
+
+	OccluderMesh result;
+	std::vector<int> remap(positions.size(), -1);
+	for (const auto triangle : order)
+	{
+		for (int i = 0; i < 3; ++i)
+		{
+			const int index = indices[triangle * 3 + i];
+			if (remap[index] < 0)
+			{
+				remap[index] = (int)result.positions.size();
+				result.positions.push_back(positions[index]);
+			}
+			result.indices.push_back(remap[index]);
+		}
+	}
+	return result;
+}
+
+// 三角形の数の取得
+int OccluderMesh::triangle_count() const
+{
+	return (int)indices.size() / 3;
+}
+
+// 遮蔽物がない画素の深度
+static const float EmptyDepth{ std::numeric_limits<float>::infinity() };
+
+// 判定時の深度の余裕（遮蔽物とほぼ同じ深度にあるボックスは丸め誤差を考えて見えるとする）
+static const float DepthEpsilon{ 1.0e-6f };
+
+// クリップ面の数（左、右、下、上、手前）
+static const int ClipPlaneCount{ 5 };
+// クリップで増える頂点の最大数を含めた多角形の頂点数の上限
+static const int ClipVertexMax{ 3 + ClipPlaneCount };
+
+// クリップ座標の頂点とクリップ面との符号付き距離（内側で0以上）
+static float clip_distance(const float v[4], int plane)
+{
+	switch (plane)
+	{
+	case 0: return v[3] + v[0];
+	case 1: return v[3] - v[0];
+	case 2: return v[3] + v[1];
+	case 3: return v[3] - v[1];
+#ifdef MATH_LEFT_HANDED
+	default: return v[2];
+#else
+	default: return v[2] + v[3];
+#endif
+	}
+}
+
+// 多角形を1つのクリップ面で切り取る（切り取った後の頂点数を返す）
+static int clip_polygon(const float in[][4], int count, float out[][4], int plane)
+{
+	int result = 0;
+	for (int i = 0; i < count; ++i)
+	{
+		const float* a = in[i];
+		const float* b = in[(i + 1) % count];
+		const float da = clip_distance(a, plane);
+		const float db = clip_distance(b, plane);
+		if (da >= 0.0f)
+		{
+			std::copy(a, a + 4, out[result++]);
+		}
+		if ((da >= 0.0f) != (db >= 0.0f))
+		{
+			const float t = da / (da - db);
+			for (int j = 0; j < 4; ++j)
+			{
+				out[result][j] = a[j] + (b[j] - a[j]) * t;
+			}
+			++result;
+		}
+	}
+	return result;
+}
+
+// コンストラクタ（幅と高さはブロックの大きさの倍数に切り上げる）
+OcclusionBuffer::OcclusionBuffer(int width, int height) :
+	width_{ (std::max(width, 1) + BlockSize - 1) / BlockSize * BlockSize },
+	height_{ (std::max(height, 1) + BlockSize - 1) / BlockSize * BlockSize },
+	tiles_x_{ (width_ + TileSize - 1) / TileSize },
+	tiles_y_{ (height_ + TileSize - 1) / TileSize },
+	depth_((size_t)width_ * height_, EmptyDepth),
+	block_depth_((size_t)(width_ / BlockSize) * (height_ / BlockSize), EmptyDepth),
+	bins_(tiles_x_ * tiles_y_)
+{ }
+
+// 遮蔽物の描画（view_projectionは視野変換行列 * 透視変換行列）
+void OcclusionBuffer::render(const OccluderMesh& occluders, const Matrix& view_projection)
+{
+	view_projection_ = view_projection;
+	stats_ = OcclusionStats();
+	stats_.triangles = occluders.triangle_count();
+	rendered_ = stats_.triangles > 0;
+	if (!rendered_) return;
+
+	// 全頂点をクリップ座標に変換
+	const int vertex_count = (int)occluders.positions.size();
+	const auto& m = view_projection.m;
+	clip_.resize((size_t)vertex_count * 4);
+#ifdef MATH_USE_SSE
+	const __m128 row0 = _mm_loadu_ps(m[0]);
+	const __m128 row1 = _mm_loadu_ps(m[1]);
+	const __m128 row2 = _mm_loadu_ps(m[2]);
+	const __m128 row3 = _mm_loadu_ps(m[3]);
+	for (int i = 0; i < vertex_count; ++i)
+	{
+		const auto& p = occluders.positions[i];
+		const __m128 clip = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(p.x), row0), _mm_mul_ps(_mm_set1_ps(p.y), row1)),
+			_mm_add_ps(_mm_mul_ps(_mm_set1_ps(p.z), row2), row3));
+		_mm_storeu_ps(&clip_[(size_t)i * 4], clip);
+	}
+#else
+	for (int i = 0; i < vertex_count; ++i)
+	{
+		const auto& p = occluders.positions[i];
+		for (int j = 0; j < 4; ++j)
+		{
+			clip_[(size_t)i * 4 + j] = p.x * m[0][j] + p.y * m[1][j] + p.z * m[2][j] + m[3][j];
+		}
+	}
+#endif
+
+	// 三角形をクリップして前計算
+	triangles_.clear();
+	for (int i = 0; i < stats_.triangles; ++i)
+	{
+		const float* v[3];
+		int outside[ClipPlaneCount]{ };
+		bool clipped = false;
+		for (int j = 0; j < 3; ++j)
+		{
+			v[j] = &clip_[(size_t)occluders.indices[i * 3 + j] * 4];
+			for (int plane = 0; plane < ClipPlaneCount; ++plane)
+			{
+				if (clip_distance(v[j], plane) < 0.0f)
+				{
+					++outside[plane];
+					clipped = true;
+				}
+			}
+		}
+		// 全頂点が同じクリップ面の外側にあれば描画しない
+		if (std::find(outside, outside + ClipPlaneCount, 3) != outside + ClipPlaneCount) continue;
+
+		if (!clipped)
+		{
+			setup(v[0], v[1], v[2]);
+			continue;
+		}
+
+		// クリップ面で切り取り、扇形に分割する
+		float polygon[2][ClipVertexMax][4];
+		int count = 3;
+		for (int j = 0; j < 3; ++j)
+		{
+			std::copy(v[j], v[j] + 4, polygon[0][j]);
+		}
+		int current = 0;
+		for (int plane = 0; plane < ClipPlaneCount && count >= 3; ++plane)
+		{
+			if (outside[plane] == 0) continue;
+			count = clip_polygon(polygon[current], count, polygon[1 - current], plane);
+			current = 1 - current;
+		}
+		for (int j = 1; j + 1 < count; ++j)
+		{
+			setup(polygon[current][0], polygon[current][j], polygon[current][j + 1]);
+		}
+	}
+	stats_.rasterized = (int)triangles_.size();
+
+	// 三角形を重なるタイルに振り分ける
+	for (auto& bin : bins_)
+	{
+		bin.clear();
+	}
+	for (int i = 0; i < (int)triangles_.size(); ++i)
+	{
+		const auto& triangle = triangles_[i];
+		for (int ty = triangle.min_y / TileSize; ty <= triangle.max_y / TileSize; ++ty)
+		{
+			for (int tx = triangle.min_x / TileSize; tx <= triangle.max_x / TileSize; ++tx)
+			{
+				bins_[ty * tiles_x_ + tx].push_back(i);
+			}
+		}
+	}
+
+	// タイルごとに並列に描画
+	WorkerPool::parallel_for(tiles_x_ * tiles_y_, 1, [&](int begin, int end)
+	{
+		for (int tile = begin; tile < end; ++tile)
+		{
+			rasterize_tile(tile);
+		}
+	});
+}
+
+// 消去（以降の判定は全て見えるになる）
+void OcclusionBuffer::clear()
+{
+	std::fill(depth_.begin(), depth_.end(), EmptyDepth);
+	std::fill(block_depth_.begin(), block_depth_.end(), EmptyDepth);
+	rendered_ = false;
+}
+
+// 境界ボックスが見えるか
+bool OcclusionBuffer::is_visible(const BoundingBox& box) const
+{
+	if (!rendered_ || box.IsEmpty()) return true;
+
+	// 8頂点を画面に投影し、画面上の矩形と最も手前の深度を求める
+	const auto& m = view_projection_.m;
+	float min_x = std::numeric_limits<float>::max();
+	float min_y = std::numeric_limits<float>::max();
+	float max_x = std::numeric_limits<float>::lowest();
+	float max_y = std::numeric_limits<float>::lowest();
+	float min_z = std::numeric_limits<float>::max();
+	for (int i = 0; i < 8; ++i)
+	{
+		const float x = (i & 1) ? box.maximum.x : box.minimum.x;
+		const float y = (i & 2) ? box.maximum.y : box.minimum.y;
+		const float z = (i & 4) ? box.maximum.z : box.minimum.z;
+		float clip[4];
+		for (int j = 0; j < 4; ++j)
+		{
+			clip[j] = x * m[0][j] + y * m[1][j] + z * m[2][j] + m[3][j];
+		}
+		// 手前のクリップ面にかかる場合は判定しない
+		if (clip_distance(clip, ClipPlaneCount - 1) <= 0.0f) return true;
+
+		const float inv_w = 1.0f / clip[3];
+		const float sx = (clip[0] * inv_w * 0.5f + 0.5f) * width_;
+		const float sy = (0.5f - clip[1] * inv_w * 0.5f) * height_;
+		min_x = std::min(min_x, sx);
+		min_y = std::min(min_y, sy);
+		max_x = std::max(max_x, sx);
+		max_y = std::max(max_y, sy);
+		min_z = std::min(min_z, clip[2] * inv_w);
+	}
+	min_z -= DepthEpsilon;
+
+	// 画面外の部分は視錐台カリングに任せる
+	if (max_x < 0.0f || max_y < 0.0f || min_x >= width_ || min_y >= height_) return true;
+	const int x0 = std::max((int)std::floor(min_x), 0);
+	const int y0 = std::max((int)std::floor(min_y), 0);
+	const int x1 = std::min((int)std::floor(max_x), width_ - 1);
+	const int y1 = std::min((int)std::floor(max_y), height_ - 1);
+
+	// ブロックの最大深度より手前にあるブロックだけ画素ごとに調べる
+	const int blocks_x = width_ / BlockSize;
+	for (int by = y0 / BlockSize; by <= y1 / BlockSize; ++by)
+	{
+		for (int bx = x0 / BlockSize; bx <= x1 / BlockSize; ++bx)
+		{
+			if (block_depth_[by * blocks_x + bx] < min_z) continue;
+
+			const int px0 = std::max(bx * BlockSize, x0);
+			const int px1 = std::min(bx * BlockSize + BlockSize - 1, x1);
+			const int py0 = std::max(by * BlockSize, y0);
+			const int py1 = std::min(by * BlockSize + BlockSize - 1, y1);
+			for (int y = py0; y <= py1; ++y)
+			{
+				const float* row = &depth_[(size_t)y * width_];
+				for (int x = px0; x <= px1; ++x)
+				{
+					if (row[x] >= min_z) return true;
+				}
+			}
+		}
+	}
+	return false;
+}
+
+// 境界球が見えるか（外接するボックスで判定する）
+bool OcclusionBuffer::is_visible(const Vector3& center, float radius) const
+{
+	const Vector3 extents{ radius, radius, radius };
+	return is_visible(BoundingBox(center - extents, center + extents));
+}
+
+// 幅の取得
+int OcclusionBuffer::width() const
+{
+	return width_;
+}
+
+// 高さの取得
+int OcclusionBuffer::height() const
+{
+	return height_;
+}
+
+// 深度の取得（遮蔽物がない画素は正の無限大）
+float OcclusionBuffer::depth(int x, int y) const
+{
+	return depth_[(size_t)y * width_ + x];
+}
+
+// 統計の取得（前回のrender()の結果）
+const OcclusionStats& OcclusionBuffer::stats() const
+{
+	return stats_;
+}
+
+// 三角形の前計算（裏面や画素を含まない三角形は追加しない）
+void OcclusionBuffer::setup(const float v0[4], const float v1[4], const float v2[4])
+{
+	// 画面座標（yは下向き）と深度
+	float x[3], y[3], z[3];
+	const float* v[3]{ v0, v1, v2 };
+	for (int i = 0; i < 3; ++i)
+	{
+		const float inv_w = 1.0f / v[i][3];
+		x[i] = (v[i][0] * inv_w * 0.5f + 0.5f) * width_;
+		y[i] = (0.5f - v[i][1] * inv_w * 0.5f) * height_;
+		z[i] = v[i][2] * inv_w;
+	}
+
+	// 表面は左手系では画面上で時計回り（右手系では反時計回り）
+	float area = (x[1] - x[0]) * (y[2] - y[0]) - (y[1] - y[0]) * (x[2] - x[0]);
+#ifndef MATH_LEFT_HANDED
+	area = -area;
+#endif
+	if (!(area > 0.0f)) return;
+
+	Triangle triangle;
+	triangle.min_x = std::max((int)std::floor(std::min({ x[0], x[1], x[2] })), 0);
+	triangle.min_y = std::max((int)std::floor(std::min({ y[0], y[1], y[2] })), 0);
+	triangle.max_x = std::min((int)std::ceil(std::max({ x[0], x[1], x[2] })), width_ - 1);
+	triangle.max_y = std::min((int)std::ceil(std::max({ y[0], y[1], y[2] })), height_ - 1);
+	if (triangle.min_x > triangle.max_x || triangle.min_y > triangle.max_y) return;
+
+	// 辺の関数（内側で0以上になるよう、裏返る座標系では符号を反転する）
+#ifdef MATH_LEFT_HANDED
+	const float sign = 1.0f;
+#else
+	const float sign = -1.0f;
+#endif
+	for (int i = 0; i < 3; ++i)
+	{
+		const int j = (i + 1) % 3;
+		triangle.edge_a[i] = -(y[j] - y[i]) * sign;
+		triangle.edge_b[i] = (x[j] - x[i]) * sign;
+		triangle.edge_c[i] = ((y[j] - y[i]) * x[i] - (x[j] - x[i]) * y[i]) * sign;
+	}
+
+	// 深度の平面
+	const float signed_area = area * sign;
+	triangle.depth_a = ((z[1] - z[0]) * (y[2] - y[0]) - (z[2] - z[0]) * (y[1] - y[0])) / signed_area;
+	triangle.depth_b = ((z[2] - z[0]) * (x[1] - x[0]) - (z[1] - z[0]) * (x[2] - x[0])) / signed_area;
+	triangle.depth_c = z[0] - triangle.depth_a * x[0] - triangle.depth_b * y[0];
+	triangles_.push_back(triangle);
+}
+
+// タイルの描画
+void OcclusionBuffer::rasterize_tile(int tile)
+{
+	const int tile_x0 = (tile % tiles_x_) * TileSize;
+	const int tile_y0 = (tile / tiles_x_) * TileSize;
+	const int tile_x1 = std::min(tile_x0 + TileSize, width_) - 1;
+	const int tile_y1 = std::min(tile_y0 + TileSize, height_) - 1;
+
+	// タイルを消去
+	for (int y = tile_y0; y <= tile_y1; ++y)
+	{
+		std::fill(&depth_[(size_t)y * width_ + tile_x0], &depth_[(size_t)y * width_ + tile_x1] + 1, EmptyDepth);
+	}
+
+	for (const auto index : bins_[tile])
+	{
+		const auto& t = triangles_[index];
+		// 4画素ずつ処理するため、開始位置を4の倍数に揃える（タイルの境界も4の倍数）
+		const int x0 = std::max(t.min_x, tile_x0) & ~3;
+		const int x1 = std::min(t.max_x, tile_x1);
+		const int y0 = std::max(t.min_y, tile_y0);
+		const int y1 = std::min(t.max_y, tile_y1);
+		for (int y = y0; y <= y1; ++y)
+		{
+			// 画素の中心で判定する
+			const float py = y + 0.5f;
+			float* row = &depth_[(size_t)y * width_];
+			const float row_e0 = t.edge_b[0] * py + t.edge_c[0];
+			const float row_e1 = t.edge_b[1] * py + t.edge_c[1];
+			const float row_e2 = t.edge_b[2] * py + t.edge_c[2];
+			const float row_z = t.depth_b * py + t.depth_c;
+#ifdef MATH_USE_SSE
+			const __m128 a0 = _mm_set1_ps(t.edge_a[0]), a1 = _mm_set1_ps(t.edge_a[1]), a2 = _mm_set1_ps(t.edge_a[2]);
+			const __m128 r0 = _mm_set1_ps(row_e0), r1 = _mm_set1_ps(row_e1), r2 = _mm_set1_ps(row_e2);
+			const __m128 za = _mm_set1_ps(t.depth_a), rz = _mm_set1_ps(row_z);
+			const __m128 zero = _mm_setzero_ps();
+			for (int x = x0; x <= x1; x += 4)
+			{
+				const __m128 px = _mm_add_ps(_mm_set1_ps((float)x), _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f));
+				const __m128 e0 = _mm_add_ps(_mm_mul_ps(a0, px), r0);
+				const __m128 e1 = _mm_add_ps(_mm_mul_ps(a1, px), r1);
+				const __m128 e2 = _mm_add_ps(_mm_mul_ps(a2, px), r2);
+				const __m128 inside = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(e0, zero), _mm_cmpge_ps(e1, zero)), _mm_cmpge_ps(e2, zero));
+				if (_mm_movemask_ps(inside) == 0) continue;
+
+				const __m128 z = _mm_add_ps(_mm_mul_ps(za, px), rz);
+				const __m128 d = _mm_loadu_ps(&row[x]);
+				_mm_storeu_ps(&row[x], _mm_or_ps(_mm_and_ps(inside, _mm_min_ps(d, z)), _mm_andnot_ps(inside, d)));
+			}
+#else
+			for (int x = x0; x <= x1; ++x)
+			{
+				const float px = x + 0.5f;
+				if (t.edge_a[0] * px + row_e0 < 0.0f || t.edge_a[1] * px + row_e1 < 0.0f || t.edge_a[2] * px + row_e2 < 0.0f) continue;
+
+				row[x] = std::min(row[x], t.depth_a * px + row_z);
+			}
+#endif
+		}
+	}
+
+	// タイル内のブロックの最大深度を更新
+	const int blocks_x = width_ / BlockSize;
+	for (int by = tile_y0 / BlockSize; by <= tile_y1 / BlockSize; ++by)
+	{
+		for (int bx = tile_x0 / BlockSize; bx <= tile_x1 / BlockSize; ++bx)
+		{
+			float max_depth = 0.0f;
+			bool first = true;
+			for (int y = by * BlockSize; y < (by + 1) * BlockSize; ++y)
+			{
+				const float* row = &depth_[(size_t)y * width_ + bx * BlockSize];
+				for (int x = 0; x < BlockSize; ++x)
+				{
+					max_depth = first ? row[x] : std::max(max_depth, row[x]);
+					first = false;
+				}
+			}
+			block_depth_[by * blocks_x + bx] = max_depth;
+		}
+	}
+}
\ No newline at end of file
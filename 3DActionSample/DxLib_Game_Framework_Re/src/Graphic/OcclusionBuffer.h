@@ -0,0 +1,118 @@
+#ifndef OCCLUSION_BUFFER_H_
+#define OCCLUSION_BUFFER_H_
+
+#include <vector>
+#include "../Math/Vector3.h"
+#include "../Math/Matrix.h"
+#include "../Math/BoundingBox.h"
+
+// 構造体：遮蔽物のメッシュ
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+struct OccluderMesh
+{
+	// 三角形から作成（面積の大きい順にmax_triangles個までを選び、使われる頂点だけを残す）
+	static OccluderMesh create(const std::vector<Vector3>& positions, const std::vector<int>& indices, int max_triangles);
+	// 三角形の数の取得
+	int triangle_count() const;
+
+	// 頂点のワールド座標
+	std::vector<Vector3>	positions;
+	// 三角形の頂点番号（3個で1つの三角形、表面の向きは描画と同じ）
+	std::vector<int>		indices;
+};
+
+// 構造体：遮蔽カリング用深度バッファの統計
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+struct OcclusionStats
+{
+	int	triangles{ 0 };		// 遮蔽物の三角形の数
+	int	rasterized{ 0 };	// 描画した三角形の数（裏面と視錐台外を除き、クリップで分割されたものを含む）
+};
+
+// クラス：遮蔽カリング用の深度バッファ
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// 遮蔽物の三角形をCPUで低解像度の深度バッファに描画し、境界ボックスが遮蔽物の奥に隠れているかを判定する。
+// 深度は透視除算後のz（奥ほど大きい）で、画面をタイルに分けてWorkerPoolで並列に描画する。
+// 判定はまずBlockSize四方のブロックの最大深度で行い、それで判定できないブロックだけ画素ごとに調べる。
+// 手前のクリップ面にかかるボックスや描画していない状態では、常に見えると判定する。
+class OcclusionBuffer
+{
+public:
+	// 既定の解像度
+	static const int	DefaultWidth{ 256 };
+	static const int	DefaultHeight{ 144 };
+	// ブロックの大きさ（画素）
+	static const int	BlockSize{ 8 };
+	// タイルの大きさ（画素、ブロックの大きさの倍数）
+	static const int	TileSize{ 32 };
+
+	// コンストラクタ（幅と高さはブロックの大きさの倍数に切り上げる）
+	explicit OcclusionBuffer(int width = DefaultWidth, int height = DefaultHeight);
+
+	// 遮蔽物の描画（view_projectionは視野変換行列 * 透視変換行列）
+	void render(const OccluderMesh& occluders, const Matrix& view_projection);
+	// 消去（以降の判定は全て見えるになる）
+	void clear();
+	// 境界ボックスが見えるか
+	bool is_visible(const BoundingBox& box) const;
+	// 境界球が見えるか（外接するボックスで判定する）
+	bool is_visible(const Vector3& center, float radius) const;
+
+	// 幅の取得
+	int width() const;
+	// 高さの取得
+	int height() const;
+	// 深度の取得（遮蔽物がない画素は正の無限大）
+	float depth(int x, int y) const;
+	// 統計の取得（前回のrender()の結果）
+	const OcclusionStats& stats() const;
+
+private:
+	// 画面上の三角形（描画用に前計算した係数）
+	struct Triangle
+	{
+		float	edge_a[3];		// 辺の関数 a * x + b * y + c のa（内側で0以上）
+		float	edge_b[3];		// 辺の関数のb
+		float	edge_c[3];		// 辺の関数のc
+		float	depth_a;		// 深度の平面 a * x + b * y + c のa
+		float	depth_b;		// 深度の平面のb
+		float	depth_c;		// 深度の平面のc
+		int		min_x;			// 画素の範囲
+		int		min_y;
+		int		max_x;
+		int		max_y;
+	};
+
+	// 三角形の前計算（裏面や画素を含まない三角形は追加しない）
+	void setup(const float v0[4], const float v1[4], const float v2[4]);
+	// タイルの描画
+	void rasterize_tile(int tile);
+
+private:
+	// 幅
+	int								width_;
+	// 高さ
+	int								height_;
+	// 横方向のタイル数
+	int								tiles_x_;
+	// 縦方向のタイル数
+	int								tiles_y_;
+	// 各画素の深度
+	std::vector<float>				depth_;
+	// 各ブロックの最大深度
+	std::vector<float>				block_depth_;
+	// 描画時の視野変換行列 * 透視変換行列
+	Matrix							view_projection_;
+	// 遮蔽物を描画したか
+	bool							rendered_{ false };
+	// 頂点のクリップ座標（x, y, z, wの順）
+	std::vector<float>				clip_;
+	// 前計算した三角形
+	std::vector<Triangle>			triangles_;
+	// タイルごとの三角形の番号
+	std::vector<std::vector<int>>	bins_;
+	// 統計
+	OcclusionStats					stats_;
+};
+
+#endif // !OCCLUSION_BUFFER_H_
\ No newline at end of file
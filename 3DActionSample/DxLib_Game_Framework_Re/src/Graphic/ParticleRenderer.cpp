@@ -0,0 +1,72 @@
+#include "ParticleRenderer.h"
+#include "Billboard.h"
+#include "Graphics3D.h"
+#include <algorithm>
+
+// クラス：パーティクルの描画
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+
+// 描画（viewは現在のカメラのビュー行列）
+void ParticleRenderer::draw(const ParticleSystem& particles, const Matrix& view)
+{
+	if (particles.size() == 0) return;
+
+	// ビュー行列の列からカメラの右方向と上方向を求める
+	const Vector3 right{ view.m[0][0], view.m[1][0], view.m[2][0] };
+	const Vector3 up{ view.m[0][1], view.m[1][1], view.m[2][1] };
+	const Vector3 corners[4]{ -right + up, right + up, -right - up, right - up };
+
+	// インデックスは最大数で一度だけ作成する
+	if (indices_.empty())
+	{
+		indices_.reserve(ParticlesPerDraw * 6);
+		for (int i = 0; i < ParticlesPerDraw; ++i)
+		{
+			const unsigned short base = (unsigned short)(i * 4);
+			indices_.insert(indices_.end(), { base, (unsigned short)(base + 1), (unsigned short)(base + 2),
+				(unsigned short)(base + 2), (unsigned short)(base + 1), (unsigned short)(base + 3) });
+		}
+	}
+
+	// 半透明のため、Zバッファは参照するが書き込まない
+	Graphics3D::disable_write_z_buffer();
+	SetUseLighting(FALSE);
+	for (const auto& buffer : particles.buffers())
+	{
+		if (buffer.count == 0) continue;
+
+		Graphics3D::blend_mode(buffer.additive ? BlendMode::Add : BlendMode::Alpha);
+		const int graph = Billboard::handle(buffer.texture);
+		for (int first = 0; first < buffer.count; first += ParticlesPerDraw)
+		{
+			const int count = std::min(buffer.count - first, ParticlesPerDraw);
+			vertices_.resize(count * 4);
+			for (int i = 0; i < count; ++i)
+			{
+				const int p = first + i;
+				const Vector3 center{ buffer.x[p], buffer.y[p], buffer.z[p] };
+				const float half = buffer.size[p] * 0.5f;
+				// アルファは残りの寿命に合わせて減衰する
+				const unsigned int color = buffer.color[p];
+				const float fade = std::min(buffer.life[p] * buffer.inv_life[p], 1.0f);
+				const COLOR_U8 dif = GetColorU8((color >> 16) & 0xff, (color >> 8) & 0xff, color & 0xff, (int)((color >> 24) * fade));
+				for (int c = 0; c < 4; ++c)
+				{
+					auto& v = vertices_[i * 4 + c];
+					v.pos = center + corners[c] * half;
+					v.norm = VGet(0.0f, 0.0f, -1.0f);
+					v.dif = dif;
+					v.spc = GetColorU8(0, 0, 0, 0);
+					v.u = (float)(c & 1);
+					v.v = (float)(c >> 1);
+					v.su = v.u;
+					v.sv = v.v;
+				}
+			}
+			DrawPolygonIndexed3D(vertices_.data(), count * 4, indices_.data(), count * 2, graph, TRUE);
+		}
+	}
+	SetUseLighting(TRUE);
+	Graphics3D::blend_mode(BlendMode::None);
+	Graphics3D::enable_write_z_buffer();
+}
\ No newline at end of file
@@ -0,0 +1,27 @@
+#ifndef PARTICLE_RENDERER_H_
+#define PARTICLE_RENDERER_H_
+
+#include <vector>
+#include <DxLib.h>
+#include "ParticleSystem.h"
+#include "../Math/Matrix.h"
+
+// クラス：パーティクルの描画
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// パーティクルをカメラに向いた矩形の頂点配列に展開し、バッファごとにDrawPolygonIndexed3Dで1回にまとめて描画する。
+class ParticleRenderer
+{
+public:
+	// 描画（viewは現在のカメラのビュー行列）
+	void draw(const ParticleSystem& particles, const Matrix& view);
+
+private:
+	// 1回の描画のパーティクル数の上限（16bitのインデックスで参照できる頂点数）
+	static const int			ParticlesPerDraw{ 65536 / 4 };
+	// 頂点の作業領域
+	std::vector<VERTEX3D>		vertices_;
+	// パーティクルを2つの三角形に分けるインデックス
+	std::vector<unsigned short>	indices_;
+};
+
+#endif // !PARTICLE_RENDERER_H_
\ No newline at end of file
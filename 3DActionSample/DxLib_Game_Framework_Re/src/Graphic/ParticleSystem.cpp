@@ -0,0 +1,258 @@
+#include "ParticleSystem.h"
+#include "../Math/MathHelper.h"
+#include "../Math/MathSIMD.h"
+#include "../Math/Random.h"
+#include "WorkerPool.h"
+#include <algorithm>
+#include <cmath>
+
+// クラス：パーティクルシステム
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+
+// 色をARGBの32bit値に変換
+static unsigned int pack_color(const Color& color)
+{
+	const auto to_byte = [](float value) { return (unsigned int)(MathHelper::clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f); };
+	return (to_byte(color.a) << 24) | (to_byte(color.r) << 16) | (to_byte(color.g) << 8) | to_byte(color.b);
+}
+
+// バッファの容量の確保（既存のパーティクルは保持する）
+static void reserve(ParticleBuffer& buffer, int capacity)
+{
+	if (capacity <= (int)buffer.x.size()) return;
+
+	capacity = std::max(capacity, (int)buffer.x.size() * 2);
+	for (auto array : { &buffer.x, &buffer.y, &buffer.z, &buffer.vx, &buffer.vy, &buffer.vz,
+		&buffer.life, &buffer.inv_life, &buffer.size, &buffer.grow, &buffer.weight })
+	{
+		array->resize(capacity);
+	}
+	buffer.color.resize(capacity);
+}
+
+// パーティクルの発生（発生した数を返す）
+int ParticleSystem::emit(const ParticleEmitterDesc& desc, const Vector3& position, const Vector3& direction, int count, Random& random)
+{
+	// 上限を超える分は発生させない（乱数の生成もしない）
+	const int n = std::max(std::min(count, budget_ - alive_), 0);
+	stats_.dropped += std::max(count, 0) - n;
+	if (n == 0) return 0;
+
+	auto& buffer = find_buffer(desc.texture, desc.additive);
+	const int first = buffer.count;
+	reserve(buffer, first + n);
+
+	// 発生方向を中心とする円錐の座標軸
+	Vector3 axis = (direction.Length() > 0.0f) ? Vector3::Normalize(direction) : Vector3::Up;
+	const Vector3 side = (std::abs(axis.y) < 0.99f) ? Vector3::Up : Vector3::Right;
+	const Vector3 tangent = Vector3::Normalize(Vector3::Cross(axis, side));
+	const Vector3 bitangent = Vector3::Cross(axis, tangent);
+
+	// 乱数は属性ごとに一括生成し、速度の配列を作業領域として使う（vx：初速、vy：円錐の角度の余弦、vz：円周方向の角度）
+	random.rand_float(&buffer.vx[first], n, desc.speed_min, desc.speed_max);
+	random.rand_float(&buffer.vy[first], n, MathHelper::cos(desc.spread), 1.0f);
+	random.rand_float(&buffer.vz[first], n, 0.0f, 360.0f);
+	random.rand_float(&buffer.life[first], n, desc.life_min, desc.life_max);
+	random.rand_float(&buffer.size[first], n, desc.size_min, desc.size_max);
+
+	const unsigned int color = pack_color(desc.color);
+	for (int i = first; i < first + n; ++i)
+	{
+		const float speed = buffer.vx[i];
+		const float cos_theta = buffer.vy[i];
+		const float sin_theta = std::sqrt(std::max(1.0f - cos_theta * cos_theta, 0.0f));
+		const Vector3 velocity = (axis * cos_theta + (tangent * MathHelper::cos(buffer.vz[i]) + bitangent * MathHelper::sin(buffer.vz[i])) * sin_theta) * speed;
+
+		buffer.x[i] = position.x;
+		buffer.y[i] = position.y;
+		buffer.z[i] = position.z;
+		buffer.vx[i] = velocity.x;
+		buffer.vy[i] = velocity.y;
+		buffer.vz[i] = velocity.z;
+		buffer.inv_life[i] = 1.0f / std::max(buffer.life[i], 1.0f);
+		buffer.grow[i] = desc.grow;
+		buffer.weight[i] = desc.weight;
+		buffer.color[i] = color;
+	}
+
+	buffer.count += n;
+	alive_ += n;
+	stats_.emitted += n;
+	return n;
+}
+
+// 更新（全パーティクルを進め、寿命が尽きたものを削除する）
+void ParticleSystem::update(float delta_time)
+{
+	alive_ = 0;
+	stats_.buffers = 0;
+	for (auto& buffer : buffers_)
+	{
+		if (buffer.count == 0) continue;
+
+		// SIMDで4個ずつ処理できるよう、分割の大きさを4の倍数に揃える
+		const int threads = WorkerPool::thread_count();
+		const int grain = std::max(((buffer.count + threads - 1) / threads + 3) & ~3, ParallelGrain);
+		WorkerPool::parallel_for(buffer.count, grain, [&](int begin, int end)
+		{
+			simulate(buffer, begin, end, delta_time);
+		});
+		remove_dead(buffer);
+
+		alive_ += buffer.count;
+		stats_.buffers += (buffer.count > 0) ? 1 : 0;
+	}
+	stats_.alive = alive_;
+}
+
+// 全パーティクルの消去
+void ParticleSystem::clear()
+{
+	buffers_.clear();
+	alive_ = 0;
+	stats_ = ParticleStats();
+}
+
+// 統計のリセット（tickの開始時に呼び出す）
+void ParticleSystem::reset_stats()
+{
+	stats_.emitted = 0;
+	stats_.dropped = 0;
+}
+
+// 生存数の上限の設定
+void ParticleSystem::set_budget(int budget)
+{
+	budget_ = std::max(budget, 0);
+}
+
+// 生存数の上限の取得
+int ParticleSystem::budget() const
+{
+	return budget_;
+}
+
+// 重力加速度の設定（1フレームあたり）
+void ParticleSystem::set_gravity(const Vector3& gravity)
+{
+	gravity_ = gravity;
+}
+
+// 空気抵抗の設定（1フレームあたりの速度の減衰率）
+void ParticleSystem::set_drag(float drag)
+{
+	drag_ = drag;
+}
+
+// 生存しているパーティクル数の取得
+int ParticleSystem::size() const
+{
+	return alive_;
+}
+
+// バッファの取得
+const std::vector<ParticleBuffer>& ParticleSystem::buffers() const
+{
+	return buffers_;
+}
+
+// 統計の取得
+const ParticleStats& ParticleSystem::stats() const
+{
+	return stats_;
+}
+
+// テクスチャとブレンドモードに対応するバッファの取得
+ParticleBuffer& ParticleSystem::find_buffer(int texture, bool additive)
+{
+	for (auto& buffer : buffers_)
+	{
+		if (buffer.texture == texture && buffer.additive == additive) return buffer;
+	}
+
+	buffers_.emplace_back();
+	buffers_.back().texture = texture;
+	buffers_.back().additive = additive;
+	return buffers_.back();
+}
+
+// バッファの指定範囲の更新
+void ParticleSystem::simulate(ParticleBuffer& buffer, int begin, int end, float delta_time) const
+{
+	const float damp = std::max(1.0f - drag_ * delta_time, 0.0f);
+	const Vector3 gravity = gravity_ * delta_time;
+	float* x = buffer.x.data();
+	float* y = buffer.y.data();
+	float* z = buffer.z.data();
+	float* vx = buffer.vx.data();
+	float* vy = buffer.vy.data();
+	float* vz = buffer.vz.data();
+	float* life = buffer.life.data();
+	float* size = buffer.size.data();
+	const float* grow = buffer.grow.data();
+	const float* weight = buffer.weight.data();
+
+	int i = begin;
+#ifdef MATH_USE_SSE
+	const __m128 dt4 = _mm_set1_ps(delta_time);
+	const __m128 damp4 = _mm_set1_ps(damp);
+	const __m128 gx = _mm_set1_ps(gravity.x), gy = _mm_set1_ps(gravity.y), gz = _mm_set1_ps(gravity.z);
+	const __m128 zero = _mm_setzero_ps();
+	for (; i + 4 <= end; i += 4)
+	{
+		const __m128 w = _mm_loadu_ps(weight + i);
+		const __m128 nvx = _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(vx + i), _mm_mul_ps(gx, w)), damp4);
+		const __m128 nvy = _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(vy + i), _mm_mul_ps(gy, w)), damp4);
+		const __m128 nvz = _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(vz + i), _mm_mul_ps(gz, w)), damp4);
+		_mm_storeu_ps(vx + i, nvx);
+		_mm_storeu_ps(vy + i, nvy);
+		_mm_storeu_ps(vz + i, nvz);
+		_mm_storeu_ps(x + i, _mm_add_ps(_mm_loadu_ps(x + i), _mm_mul_ps(nvx, dt4)));
+		_mm_storeu_ps(y + i, _mm_add_ps(_mm_loadu_ps(y + i), _mm_mul_ps(nvy, dt4)));
+		_mm_storeu_ps(z + i, _mm_add_ps(_mm_loadu_ps(z + i), _mm_mul_ps(nvz, dt4)));
+		_mm_storeu_ps(life + i, _mm_sub_ps(_mm_loadu_ps(life + i), dt4));
+		_mm_storeu_ps(size + i, _mm_max_ps(_mm_add_ps(_mm_loadu_ps(size + i), _mm_mul_ps(_mm_loadu_ps(grow + i), dt4)), zero));
+	}
+#endif
+	for (; i < end; ++i)
+	{
+		vx[i] = (vx[i] + gravity.x * weight[i]) * damp;
+		vy[i] = (vy[i] + gravity.y * weight[i]) * damp;
+		vz[i] = (vz[i] + gravity.z * weight[i]) * damp;
+		x[i] += vx[i] * delta_time;
+		y[i] += vy[i] * delta_time;
+		z[i] += vz[i] * delta_time;
+		life[i] -= delta_time;
+		size[i] = std::max(size[i] + grow[i] * delta_time, 0.0f);
+	}
+}
+
+// 寿命が尽きたパーティクルの削除（末尾のパーティクルで穴を埋める）
+void ParticleSystem::remove_dead(ParticleBuffer& buffer)
+{
+	int count = buffer.count;
+	for (int i = 0; i < count; )
+	{
+		if (buffer.life[i] > 0.0f)
+		{
+			++i;
+			continue;
+		}
+
+		// 末尾のパーティクルを移動（移動したパーティクルも判定するためiは進めない）
+		const int last = --count;
+		buffer.x[i] = buffer.x[last];
+		buffer.y[i] = buffer.y[last];
+		buffer.z[i] = buffer.z[last];
+		buffer.vx[i] = buffer.vx[last];
+		buffer.vy[i] = buffer.vy[last];
+		buffer.vz[i] = buffer.vz[last];
+		buffer.life[i] = buffer.life[last];
+		buffer.inv_life[i] = buffer.inv_life[last];
+		buffer.size[i] = buffer.size[last];
+		buffer.grow[i] = buffer.grow[last];
+		buffer.weight[i] = buffer.weight[last];
+		buffer.color[i] = buffer.color[last];
+	}
+	buffer.count = count;
+}
\ No newline at end of file
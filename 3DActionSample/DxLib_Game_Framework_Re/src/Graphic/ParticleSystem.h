@@ -0,0 +1,113 @@
+#ifndef PARTICLE_SYSTEM_H_
+#define PARTICLE_SYSTEM_H_
+
+#include <vector>
+#include "../Math/Vector3.h"
+#include "../Math/Color.h"
+
+class Random;
+
+// 構造体：パーティクルの発生設定
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+struct ParticleEmitterDesc
+{
+	int		texture{ 0 };			// ビルボードのテクスチャID
+	bool	additive{ false };		// 加算合成で描画するか
+	float	spread{ 30.0f };		// 発生方向のばらつき（度、方向を中心とする円錐の半角）
+	float	speed_min{ 0.5f };		// 初速の最小値
+	float	speed_max{ 1.0f };		// 初速の最大値
+	float	life_min{ 20.0f };		// 寿命の最小値（フレーム）
+	float	life_max{ 30.0f };		// 寿命の最大値（フレーム）
+	float	size_min{ 1.0f };		// 大きさの最小値
+	float	size_max{ 2.0f };		// 大きさの最大値
+	float	grow{ 0.0f };			// 1フレームあたりの大きさの変化量
+	float	weight{ 1.0f };			// 重力の倍率（負の値で上昇する）
+	Color	color{ Color::White };	// 色（アルファは寿命に合わせて減衰する）
+};
+
+// 構造体：パーティクルのバッファ（同じテクスチャとブレンドモードのパーティクル）
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// 属性ごとに配列を分けて持ち（SoA）、4個ずつまとめてSIMD命令で更新する。
+struct ParticleBuffer
+{
+	int							texture{ 0 };		// ビルボードのテクスチャID
+	bool						additive{ false };	// 加算合成で描画するか
+	int							count{ 0 };			// 生存しているパーティクル数
+	std::vector<float>			x, y, z;			// 座標
+	std::vector<float>			vx, vy, vz;			// 速度
+	std::vector<float>			life;				// 残りの寿命（フレーム）
+	std::vector<float>			inv_life;			// 寿命の逆数（アルファの減衰用）
+	std::vector<float>			size;				// 大きさ
+	std::vector<float>			grow;				// 1フレームあたりの大きさの変化量
+	std::vector<float>			weight;				// 重力の倍率
+	std::vector<unsigned int>	color;				// 色（ARGB）
+};
+
+// 構造体：パーティクルシステムの統計
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+struct ParticleStats
+{
+	int	alive{ 0 };		// 生存しているパーティクル数
+	int	emitted{ 0 };	// 今回のtickで発生したパーティクル数
+	int	dropped{ 0 };	// 今回のtickで上限により発生しなかったパーティクル数
+	int	buffers{ 0 };	// 使用中のバッファ数（描画回数）
+};
+
+// クラス：パーティクルシステム
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// 全エミッターのパーティクルをテクスチャとブレンドモードごとのバッファにまとめて更新する。
+// 生存数はシステム全体の上限を超えないため、エミッターの処理量も上限で抑えられる。
+class ParticleSystem
+{
+public:
+	// パーティクルの発生（発生した数を返す）
+	int emit(const ParticleEmitterDesc& desc, const Vector3& position, const Vector3& direction, int count, Random& random);
+	// 更新（全パーティクルを進め、寿命が尽きたものを削除する）
+	void update(float delta_time);
+	// 全パーティクルの消去
+	void clear();
+	// 統計のリセット（tickの開始時に呼び出す）
+	void reset_stats();
+
+	// 生存数の上限の設定
+	void set_budget(int budget);
+	// 生存数の上限の取得
+	int budget() const;
+	// 重力加速度の設定（1フレームあたり）
+	void set_gravity(const Vector3& gravity);
+	// 空気抵抗の設定（1フレームあたりの速度の減衰率）
+	void set_drag(float drag);
+
+	// 生存しているパーティクル数の取得
+	int size() const;
+	// バッファの取得
+	const std::vector<ParticleBuffer>& buffers() const;
+	// 統計の取得
+	const ParticleStats& stats() const;
+
+private:
+	// テクスチャとブレンドモードに対応するバッファの取得
+	ParticleBuffer& find_buffer(int texture, bool additive);
+	// バッファの指定範囲の更新
+	void simulate(ParticleBuffer& buffer, int begin, int end, float delta_time) const;
+	// 寿命が尽きたパーティクルの削除
+	static void remove_dead(ParticleBuffer& buffer);
+
+private:
+	// 1回に処理する最少パーティクル数（これより少ない場合は並列化しない）
+	static const int			ParallelGrain{ 8192 };
+	// テクスチャとブレンドモードごとのバッファ
+	std::vector<ParticleBuffer>	buffers_;
+	// 生存数の上限
+	int							budget_{ 8192 };
+	// 生存しているパーティクル数
+	int							alive_{ 0 };
+	// 重力加速度（1フレームあたり）
+	Vector3						gravity_{ 0.0f, -0.03f, 0.0f };
+	// 空気抵抗（1フレームあたりの速度の減衰率）
+	float						drag_{ 0.02f };
+	// 統計
+	ParticleStats				stats_;
+};
+
+#endif // !PARTICLE_SYSTEM_H_
\ No newline at end of file
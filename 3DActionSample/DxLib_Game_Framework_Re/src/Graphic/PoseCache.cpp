@@ -0,0 +1,184 @@
+#include "PoseCache.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+// クラス：ポーズキャッシュ
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+
+// 再生時間の量子化単位（1tickで進む再生時間と同じ）
+float PoseCache::time_quantum_{ 0.5f };
+// キーごとのポーズの先頭位置
+std::unordered_map<PoseCacheKey, int, PoseCache::KeyHash> PoseCache::entries_;
+// ポーズの保存領域
+std::vector<AffineMatrix> PoseCache::pool_;
+// ヒット数
+int PoseCache::hit_count_{ 0 };
+// ミス数
+int PoseCache::miss_count_{ 0 };
+
+// 比較演算子
+bool PoseCacheKey::operator == (const PoseCacheKey& other) const
+{
+	return model == other.model && motion == other.motion && time == other.time
+		&& prev_motion == other.prev_motion && prev_time == other.prev_time && amount == other.amount;
+}
+
+// キーのハッシュ関数
+std::size_t PoseCache::KeyHash::operator () (const PoseCacheKey& key) const
+{
+	const int values[]{ key.model, key.motion, key.time, key.prev_motion, key.prev_time, key.amount };
+	std::size_t result = 0;
+	for (const auto value : values)
+	{
+		result = result * 31 + std::hash<int>()(value);
+	}
+	return result;
+}
+
+// 初期化
+void PoseCache::initialize()
+{
+	// 終了処理と同じ
+	finalize();
+}
+
+// 終了処理
+void PoseCache::finalize()
+{
+	clear();
+	reset_stats();
+	time_quantum_ = 0.5f;
+}
+
+// キャッシュの消去（tickの開始時に呼び出す）
+void PoseCache::clear()
+{
+	entries_.clear();
+	pool_.clear();
+}
+
+// 再生状態の量子化（量子化した時間はクリップの範囲に丸める、end_timeは各モーションの終了時間）
+PoseCacheState PoseCache::make_state(int model, int prev_motion, float prev_time, float prev_end_time, int motion, float time, float end_time, float amount)
+{
+	PoseCacheState state;
+	auto& key = state.key;
+	key.model = model;
+	key.motion = motion;
+	key.time = quantize(time, time_quantum_);
+	state.time = quantized_time(key.time, time, end_time);
+
+	// 補間率は量子化する場合のみ段階数に丸める
+	state.amount = (time_quantum_ > 0.0f) ? std::floor(amount * BlendSteps + 0.5f) / BlendSteps : amount;
+
+	// 補間が終わっていれば補間元はキーに含めない
+	if (state.amount >= 1.0f)
+	{
+		state.amount = 1.0f;
+		state.prev_time = prev_time;
+		key.prev_motion = -1;
+		key.prev_time = 0;
+		key.amount = 0;
+	}
+	else
+	{
+		key.prev_motion = prev_motion;
+		key.prev_time = quantize(prev_time, time_quantum_);
+		key.amount = quantize(state.amount, 0.0f);
+		state.prev_time = quantized_time(key.prev_time, prev_time, prev_end_time);
+	}
+
+	return state;
+}
+
+// 検索（見つかった場合はローカル変換行列をコピーしてtrueを返す）
+bool PoseCache::find(const PoseCacheKey& key, AffineMatrix local_matrices[], int bone_count)
+{
+	const auto entry = entries_.find(key);
+	if (entry == entries_.end())
+	{
+		++miss_count_;
+		return false;
+	}
+
+	++hit_count_;
+	std::copy(pool_.begin() + entry->second, pool_.begin() + entry->second + bone_count, local_matrices);
+	return true;
+}
+
+// 登録
+void PoseCache::add(const PoseCacheKey& key, const AffineMatrix local_matrices[], int bone_count)
+{
+	// tickごとに消去されていない場合は溢れる前に消去
+	if (entries_.size() >= (std::size_t)EntryMax)
+	{
+		clear();
+	}
+
+	const int offset = (int)pool_.size();
+	if (entries_.emplace(key, offset).second)
+	{
+		pool_.insert(pool_.end(), local_matrices, local_matrices + bone_count);
+	}
+}
+
+// 再生時間の量子化単位の設定（0で量子化しない）
+void PoseCache::set_time_quantum(float quantum)
+{
+	time_quantum_ = std::max(quantum, 0.0f);
+	clear();
+}
+
+// 再生時間の量子化単位の取得
+float PoseCache::time_quantum()
+{
+	return time_quantum_;
+}
+
+// ヒット数の取得
+int PoseCache::hit_count()
+{
+	return hit_count_;
+}
+
+// ミス数の取得
+int PoseCache::miss_count()
+{
+	return miss_count_;
+}
+
+// ヒット率の取得
+float PoseCache::hit_rate()
+{
+	const int total = hit_count_ + miss_count_;
+	return (total > 0) ? (float)hit_count_ / total : 0.0f;
+}
+
+// 統計のリセット
+void PoseCache::reset_stats()
+{
+	hit_count_ = 0;
+	miss_count_ = 0;
+}
+
+// 値の量子化（量子化の段階番号、量子化しない場合は値のビット列を返す）
+int PoseCache::quantize(float value, float quantum)
+{
+	// 量子化しない場合は値のビット列をそのまま使う
+	if (quantum <= 0.0f)
+	{
+		int bits;
+		std::memcpy(&bits, &value, sizeof(bits));
+		return bits;
+	}
+
+	return (int)std::floor(value / quantum + 0.5f);
+}
+
+// 段階番号に対応する時間（0以上、end_time以下に丸める）
+float PoseCache::quantized_time(int index, float time, float end_time)
+{
+	// 四捨五入で終了時間を超えた段階も、クリップの範囲内でサンプリングする
+	const float value = (time_quantum_ > 0.0f) ? index * time_quantum_ : time;
+	return std::min(std::max(value, 0.0f), end_time);
+}
\ No newline at end of file
@@ -0,0 +1,98 @@
+#ifndef POSE_CACHE_H_
+#define POSE_CACHE_H_
+
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+#include "../Math/AffineMatrix.h"
+
+// 構造体：ポーズキャッシュのキー（量子化したアニメーションの再生状態）
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+struct PoseCacheKey
+{
+	int		model;			// モデルID
+	int		motion;			// 再生中のモーション番号
+	int		time;			// 量子化した再生時間
+	int		prev_motion;	// 補間元のモーション番号（補間していなければ-1）
+	int		prev_time;		// 量子化した補間元の再生時間
+	int		amount;			// 量子化した補間率
+
+	// 比較演算子
+	bool operator == (const PoseCacheKey& other) const;
+};
+
+// 構造体：量子化した再生状態（キャッシュのキーと、キーに対応するサンプリング位置）
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+struct PoseCacheState
+{
+	PoseCacheKey	key;		// キャッシュのキー
+	float			prev_time;	// サンプリングする補間元の再生時間（0以上、補間元の終了時間以下）
+	float			time;		// サンプリングする再生時間（0以上、終了時間以下）
+	float			amount;		// サンプリングする補間率
+};
+
+// クラス：ポーズキャッシュ
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// 同じtickに同じモデル・モーション・再生時間・補間状態でサンプリングされるローカル変換行列を共有する。
+// キャッシュはtickごとに消去される。
+class PoseCache
+{
+public:
+	// 初期化
+	static void initialize();
+	// 終了処理
+	static void finalize();
+	// キャッシュの消去（tickの開始時に呼び出す）
+	static void clear();
+
+	// 再生状態の量子化（量子化した時間はクリップの範囲に丸める、end_timeは各モーションの終了時間）
+	static PoseCacheState make_state(int model, int prev_motion, float prev_time, float prev_end_time, int motion, float time, float end_time, float amount);
+	// 検索（見つかった場合はローカル変換行列をコピーしてtrueを返す）
+	static bool find(const PoseCacheKey& key, AffineMatrix local_matrices[], int bone_count);
+	// 登録
+	static void add(const PoseCacheKey& key, const AffineMatrix local_matrices[], int bone_count);
+
+	// 再生時間の量子化単位の設定（0で量子化しない）
+	static void set_time_quantum(float quantum);
+	// 再生時間の量子化単位の取得
+	static float time_quantum();
+
+	// ヒット数の取得
+	static int hit_count();
+	// ミス数の取得
+	static int miss_count();
+	// ヒット率の取得
+	static float hit_rate();
+	// 統計のリセット
+	static void reset_stats();
+
+private:
+	// 構造体：キーのハッシュ関数
+	struct KeyHash
+	{
+		std::size_t operator () (const PoseCacheKey& key) const;
+	};
+
+	// 値の量子化（量子化の段階番号、量子化しない場合は値のビット列を返す）
+	static int quantize(float value, float quantum);
+	// 段階番号に対応する時間（0以上、end_time以下に丸める）
+	static float quantized_time(int index, float time, float end_time);
+
+private:
+	// 補間率の量子化段階数
+	static const int	BlendSteps{ 32 };
+	// 保持するポーズの最大数（tickごとに消去されない場合の保険）
+	static const int	EntryMax{ 1024 };
+	// 再生時間の量子化単位
+	static float		time_quantum_;
+	// キーごとのポーズの先頭位置
+	static std::unordered_map<PoseCacheKey, int, KeyHash>	entries_;
+	// ポーズの保存領域
+	static std::vector<AffineMatrix>	pool_;
+	// ヒット数
+	static int			hit_count_;
+	// ミス数
+	static int			miss_count_;
+};
+
+#endif // !POSE_CACHE_H_
\ No newline at end of file
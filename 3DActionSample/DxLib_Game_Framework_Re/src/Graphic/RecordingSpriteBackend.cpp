@@ -0,0 +1,33 @@
+#include "RecordingSpriteBackend.h"
+
+// クラス：描画内容を記録するスプライト描画バックエンド
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+
+// 矩形の描画（verticesは矩形ごとに左上、右上、左下、右下の順の4頂点）
+void RecordingSpriteBackend::draw_quads(int graph, const SpriteVertex vertices[], int quad_count)
+{
+	draws_.push_back({ graph, std::vector<SpriteVertex>(vertices, vertices + quad_count * 4) });
+}
+
+// 記録の消去
+void RecordingSpriteBackend::clear()
+{
+	draws_.clear();
+}
+
+// 記録した描画の取得
+const std::vector<RecordedSpriteDraw>& RecordingSpriteBackend::draws() const
+{
+	return draws_;
+}
+
+// 記録した矩形の総数の取得
+int RecordingSpriteBackend::quad_count() const
+{
+	int count = 0;
+	for (const auto& draw : draws_)
+	{
+		count += (int)draw.vertices.size() / 4;
+	}
+	return count;
+}
\ No newline at end of file
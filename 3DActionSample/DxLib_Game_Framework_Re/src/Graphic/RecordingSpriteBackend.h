@@ -0,0 +1,36 @@
+#ifndef RECORDING_SPRITE_BACKEND_H_
+#define RECORDING_SPRITE_BACKEND_H_
+
+#include <vector>
+#include "ISpriteBackend.h"
+
+// 構造体：記録したスプライトの描画
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+struct RecordedSpriteDraw
+{
+	int							graph;		// グラフィックハンドル
+	std::vector<SpriteVertex>	vertices;	// 頂点
+};
+
+// クラス：描画内容を記録するスプライト描画バックエンド
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// 実際には描画せず、描画の呼び出しと頂点を保存する。DxLibなしでバッチの結果を確認するために使う。
+class RecordingSpriteBackend : public ISpriteBackend
+{
+public:
+	// 矩形の描画（verticesは矩形ごとに左上、右上、左下、右下の順の4頂点）
+	virtual void draw_quads(int graph, const SpriteVertex vertices[], int quad_count) override;
+
+	// 記録の消去
+	void clear();
+	// 記録した描画の取得
+	const std::vector<RecordedSpriteDraw>& draws() const;
+	// 記録した矩形の総数の取得
+	int quad_count() const;
+
+private:
+	// 記録した描画
+	std::vector<RecordedSpriteDraw>	draws_;
+};
+
+#endif // !RECORDING_SPRITE_BACKEND_H_
\ No newline at end of file
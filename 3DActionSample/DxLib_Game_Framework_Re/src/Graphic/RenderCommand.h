@@ -0,0 +1,36 @@
+#ifndef RENDER_COMMAND_H_
+#define RENDER_COMMAND_H_
+
+#include "../Math/AffineMatrix.h"
+
+// 構造体：描画コマンド
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// ソートキーは上位からレンダーターゲット、シェーダー、モデル、テクスチャの各16bit。
+// キーの昇順に実行すれば、同じ状態の描画がまとまる。
+struct RenderCommand
+{
+	unsigned long long	key;			// ソートキー
+	int					render_target;	// レンダーターゲット（描画パスの番号）
+	int					shader;			// ピクセルシェーダー（負の値でDxLib標準のシェーダー）
+	int					model;			// スケルタルメッシュのID
+	int					bone_count;		// ボーン数
+	int					handle;			// 描画するモデルハンドル（アクターごとの複製、負の値でモデルの共有ハンドル）
+	int					texture;		// テクスチャ（負の値でモデルのマテリアルのまま）
+	const AffineMatrix*	world_matrices;	// ボーン数分のワールド変換行列（実行まで有効であること）
+	unsigned long long*	changed_bones;	// 前回のアップロードから値が変わったボーンのビット（nullptrで毎回全ボーン）
+
+	// ソートキーの作成
+	static unsigned long long make_key(int render_target, int shader, int model, int texture);
+};
+
+// ソートキーの作成
+inline unsigned long long RenderCommand::make_key(int render_target, int shader, int model, int texture)
+{
+	// 負の値（未指定）が先頭に来るように1ずらす
+	return ((unsigned long long)((render_target + 1) & 0xffff) << 48)
+		| ((unsigned long long)((shader + 1) & 0xffff) << 32)
+		| ((unsigned long long)((model + 1) & 0xffff) << 16)
+		| (unsigned long long)((texture + 1) & 0xffff);
+}
+
+#endif // !RENDER_COMMAND_H_
\ No newline at end of file
@@ -0,0 +1,182 @@
+#include "RenderQueue.h"
+
+// クラス：描画コマンドリスト
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+
+// 同じバッチにまとめられるか（状態とボーン数が同じ）
+static bool same_batch(const RenderCommand& a, const RenderCommand& b)
+{
+	return a.render_target == b.render_target && a.shader == b.shader && a.model == b.model
+		&& a.texture == b.texture && a.bone_count == b.bone_count;
+}
+
+// 描画パスの設定（以降に記録するコマンドのレンダーターゲットとシェーダー）
+void RenderQueue::set_pass(int render_target, int shader)
+{
+	render_target_ = render_target;
+	shader_ = shader;
+}
+
+// スケルタルメッシュの描画の記録（world_matricesとchanged_bonesは実行まで有効であること、handleはアクターごとに複製したモデルハンドル）
+void RenderQueue::submit(int model, const AffineMatrix world_matrices[], int bone_count, int texture, unsigned long long changed_bones[], int handle)
+{
+	RenderCommand command;
+	command.key = RenderCommand::make_key(render_target_, shader_, model, texture);
+	command.render_target = render_target_;
+	command.shader = shader_;
+	command.model = model;
+	command.bone_count = bone_count;
+	command.handle = handle;
+	command.texture = texture;
+	command.world_matrices = world_matrices;
+	command.changed_bones = changed_bones;
+	commands_.push_back(command);
+}
+
+// ソート
+void RenderQueue::sort()
+{
+	const int count = (int)commands_.size();
+	if (count <= 1) return;
+
+	// 全桁のヒストグラムを1回の走査で求める
+	int histograms[RadixPasses][256]{ };
+	for (const auto& command : commands_)
+	{
+		for (int pass = 0; pass < RadixPasses; ++pass)
+		{
+			++histograms[pass][(command.key >> (pass * 8)) & 0xff];
+		}
+	}
+
+	// 下位の桁から安定な分布数え上げソート（全コマンドで同じ値の桁は飛ばす）
+	scratch_.resize(count);
+	for (int pass = 0; pass < RadixPasses; ++pass)
+	{
+		int* histogram = histograms[pass];
+		if (histogram[(commands_[0].key >> (pass * 8)) & 0xff] == count) continue;
+
+		int offset = 0;
+		for (int digit = 0; digit < 256; ++digit)
+		{
+			const int n = histogram[digit];
+			histogram[digit] = offset;
+			offset += n;
+		}
+		for (const auto& command : commands_)
+		{
+			scratch_[histogram[(command.key >> (pass * 8)) & 0xff]++] = command;
+		}
+		commands_.swap(scratch_);
+	}
+}
+
+// 実行（実行後にコマンドを消去する）
+void RenderQueue::execute(IRenderBackend& backend)
+{
+	// インスタンス描画の容量はバックエンドに合わせる（0でインスタンス描画しない）
+	const int capacity = backend.instance_capacity();
+	if (capacity != instances_.capacity())
+	{
+		instances_.set_capacity(capacity);
+	}
+
+	bool first = true;
+	int render_target = 0;
+	int shader = 0;
+	int model = 0;
+	int texture = 0;
+	const int count = (int)commands_.size();
+	for (int i = 0; i < count; )
+	{
+		const auto& command = commands_[i];
+
+		// 値が変わった状態だけを変更する
+		if (first || command.render_target != render_target)
+		{
+			render_target = command.render_target;
+			backend.set_render_target(render_target);
+			++stats_.target_changes;
+		}
+		if (first || command.shader != shader)
+		{
+			shader = command.shader;
+			backend.set_shader(shader);
+			++stats_.shader_changes;
+		}
+		if (first || command.model != model)
+		{
+			model = command.model;
+			backend.bind_model(model);
+			++stats_.model_binds;
+		}
+		if (first || command.texture != texture)
+		{
+			texture = command.texture;
+			backend.set_texture(texture);
+			++stats_.texture_changes;
+		}
+		first = false;
+
+		// 同じバッチにまとめられるコマンドが2つ以上続けばインスタンス描画
+		int last = i + 1;
+		if (instances_.instances_per_batch(command.bone_count) >= 2)
+		{
+			while (last < count && same_batch(commands_[last], command)) ++last;
+		}
+		if (last - i >= 2)
+		{
+			draw_instanced(backend, i, last);
+			i = last;
+			continue;
+		}
+
+		backend.draw_skinned(command.world_matrices, command.changed_bones, command.handle);
+		++stats_.commands;
+		++stats_.draw_calls;
+		++i;
+	}
+
+	clear();
+}
+
+// コマンドの消去
+void RenderQueue::clear()
+{
+	commands_.clear();
+}
+
+// 統計のリセット（フレームの開始時に呼び出す）
+void RenderQueue::reset_stats()
+{
+	stats_ = RenderQueueStats();
+}
+
+// 記録中のコマンド数の取得
+int RenderQueue::size() const
+{
+	return (int)commands_.size();
+}
+
+// 統計の取得（reset_stats()からの累計）
+const RenderQueueStats& RenderQueue::stats() const
+{
+	return stats_;
+}
+
+// 同じ状態とボーン数のコマンドが続く範囲[first, last)をインスタンス描画
+void RenderQueue::draw_instanced(IRenderBackend& backend, int first, int last)
+{
+	const auto& head = commands_[first];
+	for (int i = first; i < last; )
+	{
+		// 容量いっぱいまで詰めて1回で描画する
+		instances_.begin(head.model, head.bone_count);
+		while (i < last && instances_.add(commands_[i].world_matrices)) ++i;
+		backend.draw_instanced(instances_.batch());
+		++stats_.draw_calls;
+		++stats_.instanced_draws;
+		stats_.instances += instances_.size();
+	}
+	stats_.commands += last - first;
+}
\ No newline at end of file
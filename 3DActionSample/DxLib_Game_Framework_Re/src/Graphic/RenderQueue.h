@@ -0,0 +1,70 @@
+#ifndef RENDER_QUEUE_H_
+#define RENDER_QUEUE_H_
+
+#include <vector>
+#include "RenderCommand.h"
+#include "IRenderBackend.h"
+#include "InstanceBuffer.h"
+
+// 構造体：描画コマンドリストの統計
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+struct RenderQueueStats
+{
+	int	commands{ 0 };			// 実行したコマンド数
+	int	target_changes{ 0 };	// レンダーターゲットの変更回数
+	int	shader_changes{ 0 };	// シェーダーの変更回数
+	int	model_binds{ 0 };		// モデルのバインド回数
+	int	texture_changes{ 0 };	// テクスチャの変更回数
+	int	draw_calls{ 0 };		// 描画回数（インスタンス描画は1バッチで1回）
+	int	instanced_draws{ 0 };	// インスタンス描画の回数
+	int	instances{ 0 };			// インスタンス描画で描画したインスタンス数
+};
+
+// クラス：描画コマンドリスト
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// 描画をその場で行わずにコマンドとして記録し、ソートキーで基数ソートしてからバックエンドで実行する。
+// 同じ状態のコマンドがまとまるため、状態の変更は値が変わった時だけで済む。
+// バックエンドがインスタンス描画に対応していれば、同じモデルが続く範囲のボーン行列を詰めてまとめて描画する。
+class RenderQueue
+{
+public:
+	// 描画パスの設定（以降に記録するコマンドのレンダーターゲットとシェーダー）
+	void set_pass(int render_target, int shader = -1);
+	// スケルタルメッシュの描画の記録（world_matricesとchanged_bonesは実行まで有効であること、handleはアクターごとに複製したモデルハンドル）
+	void submit(int model, const AffineMatrix world_matrices[], int bone_count, int texture = -1, unsigned long long changed_bones[] = nullptr, int handle = -1);
+	// ソート
+	void sort();
+	// 実行（実行後にコマンドを消去する）
+	void execute(IRenderBackend& backend);
+	// コマンドの消去
+	void clear();
+	// 統計のリセット（フレームの開始時に呼び出す）
+	void reset_stats();
+
+	// 記録中のコマンド数の取得
+	int size() const;
+	// 統計の取得（reset_stats()からの累計）
+	const RenderQueueStats& stats() const;
+
+private:
+	// 同じ状態とボーン数のコマンドが続く範囲[first, last)をインスタンス描画
+	void draw_instanced(IRenderBackend& backend, int first, int last);
+
+private:
+	// 基数ソートの桁数（8bitずつ）
+	static const int				RadixPasses{ 8 };
+	// 記録中のコマンド
+	std::vector<RenderCommand>		commands_;
+	// ソート用の作業領域
+	std::vector<RenderCommand>		scratch_;
+	// インスタンス描画用のボーン行列バッファ
+	InstanceBuffer					instances_{ 0 };
+	// 現在の描画パスのレンダーターゲット
+	int								render_target_{ 0 };
+	// 現在の描画パスのシェーダー
+	int								shader_{ -1 };
+	// 統計
+	RenderQueueStats				stats_;
+};
+
+#endif // !RENDER_QUEUE_H_
\ No newline at end of file
@@ -1,31 +1,31 @@
 #include "CubeMap.h"
 #include <DxLib.h>
 
-// NXFL[u}bv
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：キューブマップ
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
-// fXgN^
+// デストラクタ
 CubeMap::~CubeMap()
 {
-	clear();	// Sf[^
+	clear();	// 全データを消去
 }
 
-// ǂݍ
+// 読み込み
 bool CubeMap::load(int id, const std::string& file_name)
 {
-	// ID̃f[^폜
+	// 同じIDのデータを削除
 	erase(id);
-	// ff[^ǂݍ
+	// モデルデータを読み込む
 	cube_map_[id] = LoadGraph(file_name.c_str());
 
-	// ǂݍ݌ʂԂ
+	// 読み込み結果を返す
 	return cube_map_[id] != -1;
 }
 
-// }bv̍폜
+// 環境マップの削除
 void CubeMap::erase(int id)
 {
-	// ỸVF[_[f[^݂ꍇAf[^폜
+	// 該当のシェーダーデータが存在する場合、データを削除
 	if (cube_map_.count(id) > 0)
 	{
 		DeleteGraph(cube_map_[id]);
@@ -33,10 +33,10 @@ void CubeMap::erase(int id)
 	}
 }
 
-// f[^̏
+// データの消去
 void CubeMap::clear()
 {
-	// SẴVF[_[f[^
+	// 全てのシェーダーデータを消去
 	for (const auto data : cube_map_)
 	{
 		DeleteGraph(data.second);
@@ -44,7 +44,7 @@ void CubeMap::clear()
 	cube_map_.clear();
 }
 
-// nh̎擾
+// ハンドルの取得
 int CubeMap::operator[](int id) const
 {
 	return cube_map_.at(id);
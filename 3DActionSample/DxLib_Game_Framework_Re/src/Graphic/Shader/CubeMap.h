@@ -4,30 +4,30 @@
 #include <string>
 #include <unordered_map>
 
-// NXFL[u}bv
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：キューブマップ
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 class CubeMap
 {
 public:
-	// ftHgRXgN^
+	// デフォルトコンストラクタ
 	CubeMap() = default;
-	// fXgN^
+	// デストラクタ
 	~CubeMap();
-	// ǂݍ
+	// 読み込み
 	bool load(int id, const std::string& file_name);
-	// }bv̍폜
+	// 環境マップの削除
 	void erase(int id);
-	// f[^̏
+	// データの消去
 	void clear();
-	// nh̎擾
+	// ハンドルの取得
 	int operator[](int id) const;
 
-	// Rs[֎~
+	// コピー禁止
 	CubeMap(const CubeMap& other) = delete;
 	CubeMap& operator = (const CubeMap& other) = delete;
 
 private:
-	// }bvf[^}bv
+	// 環境マップデータマップ
 	std::unordered_map<int, int> cube_map_;
 };
 
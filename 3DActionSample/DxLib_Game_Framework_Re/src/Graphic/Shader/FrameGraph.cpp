@@ -0,0 +1,167 @@
+#include "FrameGraph.h"
+#include <algorithm>
+
+// クラス：フレームグラフ
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+
+// 全パスとリソースの消去
+void FrameGraph::reset()
+{
+	resources_.clear();
+	passes_.clear();
+	steps_.clear();
+	output_ = -1;
+}
+
+// リソースの宣言（リソース番号を返す）
+int FrameGraph::create_texture(const std::string& name, const RenderTargetDesc& desc)
+{
+	resources_.push_back(Resource{ name, desc });
+	return (int)resources_.size() - 1;
+}
+
+// パスの追加（パス番号を返す、入力は追加済みのパスが描画したリソースであること）
+int FrameGraph::add_pass(const std::string& name, const std::vector<int>& inputs, int output, const FramePassFunction& execute)
+{
+	passes_.push_back(FramePass{ name, inputs, output, execute });
+	return (int)passes_.size() - 1;
+}
+
+// コンパイル（outputは画面に描画する最終出力のリソース）
+void FrameGraph::compile(int output)
+{
+	output_ = output;
+	const int pass_count = (int)passes_.size();
+	steps_.assign(pass_count, Step());
+
+	// 最終出力から逆にたどり、必要なリソースに描画するパスだけを残す
+	std::vector<bool> needed(resources_.size(), false);
+	needed[output] = true;
+	for (int i = pass_count - 1; i >= 0; --i)
+	{
+		const auto& pass = passes_[i];
+		if (!needed[pass.output]) continue;
+
+		steps_[i].culled = false;
+		for (const auto input : pass.inputs)
+		{
+			needed[input] = true;
+		}
+	}
+
+	// 各リソースを最初と最後に使うパスを求める
+	std::vector<int> first(resources_.size(), -1);
+	std::vector<int> last(resources_.size(), -1);
+	auto use = [&](int resource, int index)
+	{
+		if (first[resource] < 0) first[resource] = index;
+		last[resource] = index;
+	};
+	for (int i = 0; i < pass_count; ++i)
+	{
+		if (steps_[i].culled) continue;
+
+		for (const auto input : passes_[i].inputs)
+		{
+			use(input, i);
+		}
+		use(passes_[i].output, i);
+	}
+	for (int resource = 0; resource < (int)resources_.size(); ++resource)
+	{
+		if (first[resource] < 0) continue;
+
+		steps_[first[resource]].acquires.push_back(resource);
+		// 最終出力は画面に描画してから解放する
+		if (resource != output_)
+		{
+			steps_[last[resource]].releases.push_back(resource);
+		}
+	}
+
+	// 同じリソースに続けて描画するパスをまとめる
+	int previous = -1;
+	for (int i = 0; i < pass_count; ++i)
+	{
+		if (steps_[i].culled) continue;
+
+		const auto& pass = passes_[i];
+		if (previous >= 0 && passes_[previous].output == pass.output
+			&& std::find(pass.inputs.begin(), pass.inputs.end(), pass.output) == pass.inputs.end())
+		{
+			steps_[i].merged = true;
+			steps_[previous].end = false;
+		}
+		previous = i;
+	}
+}
+
+// 実行（最後に最終出力を画面に描画する）
+void FrameGraph::execute(IFrameGraphBackend& backend) const
+{
+	if (output_ < 0) return;
+
+	for (int i = 0; i < (int)passes_.size(); ++i)
+	{
+		const auto& step = steps_[i];
+		if (step.culled) continue;
+
+		const auto& pass = passes_[i];
+		for (const auto resource : step.acquires)
+		{
+			backend.acquire(resource, resources_[resource].desc);
+		}
+		if (!step.merged) backend.begin(pass.output);
+		pass.execute(backend, pass);
+		if (step.end) backend.end(pass.output);
+		for (const auto resource : step.releases)
+		{
+			backend.release(resource);
+		}
+	}
+
+	backend.present(output_);
+	backend.release(output_);
+}
+
+// パス数の取得
+int FrameGraph::pass_count() const
+{
+	return (int)passes_.size();
+}
+
+// パスの取得
+const FramePass& FrameGraph::pass(int index) const
+{
+	return passes_[index];
+}
+
+// 実行されるパス数の取得
+int FrameGraph::executed_pass_count() const
+{
+	return (int)std::count_if(steps_.begin(), steps_.end(), [](const Step& step) { return !step.culled; });
+}
+
+// パスが除かれたか
+bool FrameGraph::is_culled(int index) const
+{
+	return steps_[index].culled;
+}
+
+// パスが前のパスとまとめられたか
+bool FrameGraph::is_merged(int index) const
+{
+	return steps_[index].merged;
+}
+
+// リソース数の取得
+int FrameGraph::resource_count() const
+{
+	return (int)resources_.size();
+}
+
+// リソースの仕様の取得
+const RenderTargetDesc& FrameGraph::desc(int resource) const
+{
+	return resources_[resource].desc;
+}
\ No newline at end of file
@@ -0,0 +1,88 @@
+#ifndef FRAME_GRAPH_H_
+#define FRAME_GRAPH_H_
+
+#include <functional>
+#include <string>
+#include <vector>
+#include "RenderTargetDesc.h"
+#include "IFrameGraphBackend.h"
+
+struct FramePass;
+
+// パスの処理（描画先のリソースはbegin済み）
+using FramePassFunction = std::function<void(IFrameGraphBackend& backend, const FramePass& pass)>;
+
+// 構造体：フレームグラフのパス
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+struct FramePass
+{
+	std::string			name;		// 名前
+	std::vector<int>	inputs;		// 参照するリソース
+	int					output;		// 描画先のリソース
+	FramePassFunction	execute;	// 処理
+};
+
+// クラス：フレームグラフ
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// パスは入力と出力のリソースを宣言して追加順に並べる。compile()で最終出力に寄与しないパスを除き、
+// 各リソースを最初に使うパスの前に確保して最後に使うパスの後に解放するよう決める。
+// 同じリソースに続けて描画し、そのリソースを入力にしないパスは、前のパスとまとめて1回のbegin/endで実行する。
+// コンパイルはDxLibに依存しないため、モックの実行先で確保の順番を確認できる。
+class FrameGraph
+{
+public:
+	// 全パスとリソースの消去
+	void reset();
+	// リソースの宣言（リソース番号を返す）
+	int create_texture(const std::string& name, const RenderTargetDesc& desc);
+	// パスの追加（パス番号を返す、入力は追加済みのパスが描画したリソースであること）
+	int add_pass(const std::string& name, const std::vector<int>& inputs, int output, const FramePassFunction& execute);
+	// コンパイル（outputは画面に描画する最終出力のリソース）
+	void compile(int output);
+	// 実行（最後に最終出力を画面に描画する）
+	void execute(IFrameGraphBackend& backend) const;
+
+	// パス数の取得
+	int pass_count() const;
+	// パスの取得
+	const FramePass& pass(int index) const;
+	// 実行されるパス数の取得
+	int executed_pass_count() const;
+	// パスが除かれたか
+	bool is_culled(int index) const;
+	// パスが前のパスとまとめられたか
+	bool is_merged(int index) const;
+	// リソース数の取得
+	int resource_count() const;
+	// リソースの仕様の取得
+	const RenderTargetDesc& desc(int resource) const;
+
+private:
+	// 構造体：リソース
+	struct Resource
+	{
+		std::string			name;	// 名前
+		RenderTargetDesc	desc;	// 仕様
+	};
+	// 構造体：コンパイル後のパスの実行手順
+	struct Step
+	{
+		bool				culled{ true };		// 除かれたか
+		bool				merged{ false };	// 前のパスとまとめられたか
+		bool				end{ true };		// パスの後に描画を終了するか
+		std::vector<int>	acquires;			// パスの前に確保するリソース
+		std::vector<int>	releases;			// パスの後に解放するリソース
+	};
+
+private:
+	// リソース
+	std::vector<Resource>	resources_;
+	// パス
+	std::vector<FramePass>	passes_;
+	// コンパイル後の実行手順（パスごと）
+	std::vector<Step>		steps_;
+	// 最終出力のリソース
+	int						output_{ -1 };
+};
+
+#endif // !FRAME_GRAPH_H_
\ No newline at end of file
@@ -0,0 +1,30 @@
+#ifndef IFRAME_GRAPH_BACKEND_H_
+#define IFRAME_GRAPH_BACKEND_H_
+
+#include "RenderTargetDesc.h"
+
+// クラス：フレームグラフの実行先インターフェース
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// リソースは番号で指定する。実体の確保と解放はフレームグラフが決めた順に呼び出される。
+class IFrameGraphBackend
+{
+public:
+	// 仮想デストラクタ
+	virtual ~IFrameGraphBackend() { }
+	// リソースの確保
+	virtual void acquire(int resource, const RenderTargetDesc& desc) = 0;
+	// リソースの解放
+	virtual void release(int resource) = 0;
+	// リソースへの描画の開始
+	virtual void begin(int resource) = 0;
+	// リソースへの描画の終了
+	virtual void end(int resource) = 0;
+	// リソースのテクスチャの取得
+	virtual int texture(int resource) const = 0;
+	// 描画中のリソースに画面全体の矩形を描画（設定中のピクセルシェーダーを使う）
+	virtual void draw_quad(int resource) = 0;
+	// リソースを画面に描画
+	virtual void present(int resource) = 0;
+};
+
+#endif // !IFRAME_GRAPH_BACKEND_H_
\ No newline at end of file
@@ -5,12 +5,12 @@
 
 struct PixelShaderCB
 {
-	VECTOR	ViewPosition;	// _̈ʒu
-	float	padding0;		// pfBO
-	VECTOR	LightPosition;	// Cg̈ʒu
-	float	padding1;		// pfBO
-	VECTOR	LightColor;		// Cg̐F
-	float	padding2;		// pfBO
+	VECTOR	ViewPosition;	// 視点の位置
+	float	padding0;		// パディング
+	VECTOR	LightPosition;	// ライトの位置
+	float	padding1;		// パディング
+	VECTOR	LightColor;		// ライトの色
+	float	padding2;		// パディング
 };
 
 #endif // !PIXEL_SHADER_CB_
\ No newline at end of file
@@ -0,0 +1,52 @@
+#include "PoolFrameGraphBackend.h"
+#include "RenderTargetPool.h"
+
+// クラス：レンダーターゲットプールを使うフレームグラフの実行先
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+
+// リソースの確保
+void PoolFrameGraphBackend::acquire(int resource, const RenderTargetDesc& desc)
+{
+	if (resource >= (int)targets_.size())
+	{
+		targets_.resize(resource + 1, nullptr);
+	}
+	targets_[resource] = RenderTargetPool::acquire(desc);
+}
+
+// リソースの解放
+void PoolFrameGraphBackend::release(int resource)
+{
+	RenderTargetPool::release(targets_[resource]);
+	targets_[resource] = nullptr;
+}
+
+// リソースへの描画の開始
+void PoolFrameGraphBackend::begin(int resource)
+{
+	targets_[resource]->begin();
+}
+
+// リソースへの描画の終了
+void PoolFrameGraphBackend::end(int resource)
+{
+	targets_[resource]->end();
+}
+
+// リソースのテクスチャの取得
+int PoolFrameGraphBackend::texture(int resource) const
+{
+	return targets_[resource]->texture();
+}
+
+// 描画中のリソースに画面全体の矩形を描画（設定中のピクセルシェーダーを使う）
+void PoolFrameGraphBackend::draw_quad(int resource)
+{
+	targets_[resource]->draw();
+}
+
+// リソースを画面に描画
+void PoolFrameGraphBackend::present(int resource)
+{
+	DrawGraph(0, 0, targets_[resource]->texture(), FALSE);
+}
\ No newline at end of file
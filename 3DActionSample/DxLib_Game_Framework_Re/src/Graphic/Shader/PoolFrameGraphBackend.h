@@ -0,0 +1,33 @@
+#ifndef POOL_FRAME_GRAPH_BACKEND_H_
+#define POOL_FRAME_GRAPH_BACKEND_H_
+
+#include <vector>
+#include "IFrameGraphBackend.h"
+#include "RenderTarget.h"
+
+// クラス：レンダーターゲットプールを使うフレームグラフの実行先
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+class PoolFrameGraphBackend : public IFrameGraphBackend
+{
+public:
+	// リソースの確保
+	virtual void acquire(int resource, const RenderTargetDesc& desc) override;
+	// リソースの解放
+	virtual void release(int resource) override;
+	// リソースへの描画の開始
+	virtual void begin(int resource) override;
+	// リソースへの描画の終了
+	virtual void end(int resource) override;
+	// リソースのテクスチャの取得
+	virtual int texture(int resource) const override;
+	// 描画中のリソースに画面全体の矩形を描画（設定中のピクセルシェーダーを使う）
+	virtual void draw_quad(int resource) override;
+	// リソースを画面に描画
+	virtual void present(int resource) override;
+
+private:
+	// リソースごとのレンダーターゲット
+	std::vector<RenderTarget*>	targets_;
+};
+
+#endif // !POOL_FRAME_GRAPH_BACKEND_H_
\ No newline at end of file
@@ -0,0 +1,139 @@
+#include "PostEffect.h"
+#include "ShaderManager.h"
+#include "ShaderID.h"
+#include "BloomCB.h"
+#include "RadialCB.h"
+#include <DxLib.h>
+
+// クラス：ポストエフェクト
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+
+// 有効なエフェクトの組み合わせが同じか（フレームグラフの再構築の判定用）
+bool PostEffectSettings::has_same_passes(const PostEffectSettings& other) const
+{
+	return bloom == other.bloom && radiation_blur == other.radiation_blur && grayscale == other.grayscale;
+}
+
+// ブルーム用の定数バッファ
+int PostEffect::cb_bloom_{ -1 };
+// 放射ブラー用の定数バッファ
+int PostEffect::cb_radial_{ -1 };
+
+// 初期化
+void PostEffect::initialize()
+{
+	// 終了処理と同じ
+	finalize();
+
+	// シェーダー用定数バッファを生成
+	cb_bloom_ = CreateShaderConstantBuffer(sizeof(BloomCB));
+	cb_radial_ = CreateShaderConstantBuffer(sizeof(RadialCB));
+}
+
+// 終了処理
+void PostEffect::finalize()
+{
+	if (cb_bloom_ != -1) DeleteShaderConstantBuffer(cb_bloom_);
+	if (cb_radial_ != -1) DeleteShaderConstantBuffer(cb_radial_);
+	cb_bloom_ = -1;
+	cb_radial_ = -1;
+}
+
+// ブルーム（輝度抽出、水平/垂直方向ブラー、合成）
+int PostEffect::add_bloom(FrameGraph& graph, int source, const PostEffectSettings& settings)
+{
+	// ブラーは1/4の大きさで行う（画面全体の矩形を描画するだけなのでZバッファは不要）
+	const auto& source_desc = graph.desc(source);
+	const RenderTargetDesc blur_desc{ source_desc.width / 4, source_desc.height / 4, false, false };
+	const RenderTargetDesc combine_desc{ source_desc.width, source_desc.height, false, false };
+	const int bright = graph.create_texture("Bright", blur_desc);
+	const int blur_h = graph.create_texture("BlurH", blur_desc);
+	const int blur_v = graph.create_texture("BlurV", blur_desc);
+	const int combine = graph.create_texture("BloomCombine", combine_desc);
+
+	// 輝度を抽出
+	graph.add_pass("BrightPass", { source }, bright, [&settings](IFrameGraphBackend& backend, const FramePass& pass)
+	{
+		// ブルームシェーダー用のパラメータを設定
+		auto cb = (BloomCB*)GetBufferShaderConstantBuffer(cb_bloom_);
+		*cb = BloomCB();
+		cb->g_BrightPassThreshold = settings.bloom_threshold;
+		cb->g_BloomIntensity = settings.bloom_intensity;
+		cb->g_BloomSaturation = settings.bloom_saturation;
+		cb->g_BaseIntensity = settings.base_intensity;
+		cb->g_BaseSaturation = settings.base_saturation;
+		UpdateShaderConstantBuffer(cb_bloom_);
+		// ピクセルシェーダーの定数バッファを4番目のスロットに指定
+		SetShaderConstantBuffer(cb_bloom_, DX_SHADERTYPE_PIXEL, 4);
+
+		ShaderManager::set_ps((int)ShaderID::PS_BrightPass);
+		SetUseTextureToShader(0, backend.texture(pass.inputs[0]));
+		backend.draw_quad(pass.output);
+	});
+	// 水平方向ブラーをかける
+	graph.add_pass("GaussianBlurH", { bright }, blur_h, [](IFrameGraphBackend& backend, const FramePass& pass)
+	{
+		ShaderManager::set_ps((int)ShaderID::PS_GaussianBlurH);
+		SetUseTextureToShader(0, backend.texture(pass.inputs[0]));
+		backend.draw_quad(pass.output);
+	});
+	// 垂直方向ブラーをかける
+	graph.add_pass("GaussianBlurV", { blur_h }, blur_v, [](IFrameGraphBackend& backend, const FramePass& pass)
+	{
+		ShaderManager::set_ps((int)ShaderID::PS_GaussianBlurV);
+		SetUseTextureToShader(0, backend.texture(pass.inputs[0]));
+		backend.draw_quad(pass.output);
+	});
+	// 元画像とブラー画像を合成
+	graph.add_pass("BloomCombine", { source, blur_v }, combine, [](IFrameGraphBackend& backend, const FramePass& pass)
+	{
+		ShaderManager::set_ps((int)ShaderID::PS_BloomCombine);
+		SetUseTextureToShader(0, backend.texture(pass.inputs[0]));
+		SetUseTextureToShader(1, backend.texture(pass.inputs[1]));
+		backend.draw_quad(pass.output);
+	});
+
+	return combine;
+}
+
+// 放射ブラー
+int PostEffect::add_radiation_blur(FrameGraph& graph, int source, const PostEffectSettings& settings)
+{
+	auto desc = graph.desc(source);
+	desc.z_buffer = false;
+	const int output = graph.create_texture("RadiationBlur", desc);
+
+	graph.add_pass("RadiationBlur", { source }, output, [&settings](IFrameGraphBackend& backend, const FramePass& pass)
+	{
+		// 放射ブラー用のパラメータを設定
+		auto cb = (RadialCB*)GetBufferShaderConstantBuffer(cb_radial_);
+		cb->_Strength = settings.radiation_strength;
+		cb->_SampleCount = settings.radiation_sample_count;
+		UpdateShaderConstantBuffer(cb_radial_);
+		// ピクセルシェーダーの定数バッファを6番目のスロットに指定
+		SetShaderConstantBuffer(cb_radial_, DX_SHADERTYPE_PIXEL, 6);
+
+		ShaderManager::set_ps((int)ShaderID::PS_RadiationBlur);
+		SetUseTextureToShader(0, backend.texture(pass.inputs[0]));
+		backend.draw_quad(pass.output);
+	});
+
+	return output;
+}
+
+// グレースケール
+int PostEffect::add_grayscale(FrameGraph& graph, int source)
+{
+	auto desc = graph.desc(source);
+	desc.z_buffer = false;
+	const int output = graph.create_texture("Grayscale", desc);
+
+	graph.add_pass("Grayscale", { source }, output, [](IFrameGraphBackend& backend, const FramePass& pass)
+	{
+		ShaderManager::set_ps((int)ShaderID::PS_PostEffect);
+		SetUseTextureToShader(0, backend.texture(pass.inputs[0]));
+		backend.draw_quad(pass.output);
+	});
+
+	return output;
+}
\ No newline at end of file
@@ -0,0 +1,50 @@
+#ifndef POST_EFFECT_H_
+#define POST_EFFECT_H_
+
+#include "FrameGraph.h"
+
+// 構造体：ポストエフェクトの設定
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+struct PostEffectSettings
+{
+	bool	bloom{ true };					// ブルームを適用するか
+	float	bloom_threshold{ 0.5f };		// 抽出する輝度の最小値
+	float	bloom_intensity{ 0.75f };		// ブルームテクスチャの輝度
+	float	bloom_saturation{ 0.75f };		// ブルームテクスチャの彩度
+	float	base_intensity{ 0.8f };			// 元テクスチャの輝度
+	float	base_saturation{ 0.8f };		// 元テクスチャの彩度
+	bool	radiation_blur{ false };		// 放射ブラーを適用するか
+	float	radiation_strength{ 0.1f };		// 放射ブラーの強さ（0.0~1.0）
+	int		radiation_sample_count{ 8 };	// 放射ブラーの分割コマ数
+	bool	grayscale{ false };				// グレースケールに変換するか
+
+	// 有効なエフェクトの組み合わせが同じか（フレームグラフの再構築の判定用）
+	bool has_same_passes(const PostEffectSettings& other) const;
+};
+
+// クラス：ポストエフェクト
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// 各エフェクトをフレームグラフのパスとして追加する。add_*は入力のリソースを受け取り、出力のリソースを返す。
+// settingsの値はパスの実行時に読むため、フレームグラフを実行する間は有効であること。
+class PostEffect
+{
+public:
+	// 初期化
+	static void initialize();
+	// 終了処理
+	static void finalize();
+	// ブルーム（輝度抽出、水平/垂直方向ブラー、合成）
+	static int add_bloom(FrameGraph& graph, int source, const PostEffectSettings& settings);
+	// 放射ブラー
+	static int add_radiation_blur(FrameGraph& graph, int source, const PostEffectSettings& settings);
+	// グレースケール
+	static int add_grayscale(FrameGraph& graph, int source);
+
+private:
+	// ブルーム用の定数バッファ
+	static int	cb_bloom_;
+	// 放射ブラー用の定数バッファ
+	static int	cb_radial_;
+};
+
+#endif // !POST_EFFECT_H_
\ No newline at end of file
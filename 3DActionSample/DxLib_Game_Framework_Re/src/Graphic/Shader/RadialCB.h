@@ -3,8 +3,8 @@
 
 struct RadialCB
 {
-	float	_Strength;	// ڂ̋(0.0~1.0)
-	int		_SampleCount;	// R}
+	float	_Strength;	// ぼかしの強さ(0.0~1.0)
+	int		_SampleCount;	// 分割コマ数
 	float	Dummy;
 	float	Dummy2;
 };
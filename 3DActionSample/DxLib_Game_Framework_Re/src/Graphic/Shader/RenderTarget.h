@@ -3,35 +3,35 @@
 
 #include <DxLib.h>
 
-// NXF_[^[Qbg
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：レンダーターゲット
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 class RenderTarget
 {
 public:
-	// RXgN^
+	// コンストラクタ
 	RenderTarget(int width, int height, bool hdr = false, bool z_
 		= true, int bit_depth = 32, int channel = 4);
-	// fXgN^
+	// デストラクタ
 	~RenderTarget();
-	// Jn
+	// 開始
 	void begin();
-	// I
+	// 終了
 	void end();
-	// `
+	// 描画
 	void draw() const;
-	// ̎擾
+	// 幅の取得
 	int width() const;
-	// ̎擾
+	// 高さの取得
 	int height() const;
-	// eNX`̎擾
+	// テクスチャの取得
 	int texture() const;
 
 private:
-	int				width_;						// 
-	int				height_;					// 
-	int				texture_;					// eNX`
-	VERTEX2DSHADER	vertices_[4];				// _f[^
-	int				prev_draw_screen_{ -1 };	// O̕`XN[
+	int				width_;						// 幅
+	int				height_;					// 高さ
+	int				texture_;					// テクスチャ
+	VERTEX2DSHADER	vertices_[4];				// 頂点データ
+	int				prev_draw_screen_{ -1 };	// 前回の描画スクリーン
 };
 
 #endif // !RENDER_TARGET_H_
\ No newline at end of file
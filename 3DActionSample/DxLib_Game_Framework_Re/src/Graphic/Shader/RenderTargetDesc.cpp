@@ -0,0 +1,26 @@
+#include "RenderTargetDesc.h"
+
+// 構造体：レンダーターゲットの仕様
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+
+// Zバッファの1ピクセルあたりのバイト数（DxLibの既定は16bit）
+static const int ZBufferBytes{ 2 };
+
+// プールの検索キーの取得
+unsigned long long RenderTargetDesc::key() const
+{
+	return ((unsigned long long)(width & 0xffff) << 48)
+		| ((unsigned long long)(height & 0xffff) << 32)
+		| ((unsigned long long)(bit_depth & 0xff) << 16)
+		| ((unsigned long long)(channel & 0xff) << 8)
+		| ((hdr ? 1ull : 0ull) << 1)
+		| (z_buffer ? 1ull : 0ull);
+}
+
+// 推定メモリ量の取得（バイト）
+int RenderTargetDesc::bytes() const
+{
+	const int color = hdr ? (channel * bit_depth / 8) : (bit_depth / 8);
+	const int depth = z_buffer ? ZBufferBytes : 0;
+	return width * height * (color + depth);
+}
\ No newline at end of file
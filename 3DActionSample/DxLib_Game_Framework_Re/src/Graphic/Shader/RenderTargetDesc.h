@@ -0,0 +1,21 @@
+#ifndef RENDER_TARGET_DESC_H_
+#define RENDER_TARGET_DESC_H_
+
+// 構造体：レンダーターゲットの仕様
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+struct RenderTargetDesc
+{
+	int		width;				// 幅
+	int		height;				// 高さ
+	bool	hdr{ false };		// 浮動小数点テクスチャか
+	bool	z_buffer{ true };	// Zバッファを持つか
+	int		bit_depth{ 32 };	// ビット深度
+	int		channel{ 4 };		// チャンネル数（浮動小数点テクスチャの場合）
+
+	// プールの検索キーの取得
+	unsigned long long key() const;
+	// 推定メモリ量の取得（バイト）
+	int bytes() const;
+};
+
+#endif // !RENDER_TARGET_DESC_H_
\ No newline at end of file
@@ -0,0 +1,93 @@
+#include "RenderTargetPool.h"
+#include <algorithm>
+
+// クラス：レンダーターゲットプール
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+
+// 作成済みのレンダーターゲット
+std::vector<RenderTargetPool::Entry> RenderTargetPool::entries_;
+// 仕様ごとの空きレンダーターゲット（entries_の番号）
+std::unordered_map<unsigned long long, std::vector<int>> RenderTargetPool::free_;
+// 作成済みのレンダーターゲットの推定メモリ量
+int RenderTargetPool::reserved_bytes_{ 0 };
+// 使用中のレンダーターゲットの推定メモリ量
+int RenderTargetPool::used_bytes_{ 0 };
+// 使用中のレンダーターゲットの推定メモリ量の最大値
+int RenderTargetPool::peak_bytes_{ 0 };
+
+// 初期化
+void RenderTargetPool::initialize()
+{
+	// 終了処理と同じ
+	finalize();
+}
+
+// 終了処理
+void RenderTargetPool::finalize()
+{
+	entries_.clear();
+	free_.clear();
+	reserved_bytes_ = 0;
+	used_bytes_ = 0;
+	peak_bytes_ = 0;
+}
+
+// レンダーターゲットの取得（同じ仕様の空きがなければ作成する）
+RenderTarget* RenderTargetPool::acquire(const RenderTargetDesc& desc)
+{
+	int index;
+	auto& free = free_[desc.key()];
+	if (!free.empty())
+	{
+		// 最後に返されたものから再利用する
+		index = free.back();
+		free.pop_back();
+	}
+	else
+	{
+		index = (int)entries_.size();
+		entries_.push_back(Entry{ std::make_unique<RenderTarget>(desc.width, desc.height, desc.hdr, desc.z_buffer, desc.bit_depth, desc.channel), desc, false });
+		reserved_bytes_ += desc.bytes();
+	}
+
+	auto& entry = entries_[index];
+	entry.in_use = true;
+	used_bytes_ += desc.bytes();
+	peak_bytes_ = std::max(peak_bytes_, used_bytes_);
+
+	return entry.target.get();
+}
+
+// レンダーターゲットの返却
+void RenderTargetPool::release(RenderTarget* target)
+{
+	for (int i = 0; i < (int)entries_.size(); ++i)
+	{
+		auto& entry = entries_[i];
+		if (entry.target.get() != target) continue;
+		if (!entry.in_use) return;
+
+		entry.in_use = false;
+		used_bytes_ -= entry.desc.bytes();
+		free_[entry.desc.key()].push_back(i);
+		return;
+	}
+}
+
+// 作成済みのレンダーターゲット数の取得
+int RenderTargetPool::target_count()
+{
+	return (int)entries_.size();
+}
+
+// 作成済みのレンダーターゲットの推定メモリ量の取得（バイト）
+int RenderTargetPool::reserved_bytes()
+{
+	return reserved_bytes_;
+}
+
+// 同時に使用されたレンダーターゲットの推定メモリ量の最大値の取得（バイト）
+int RenderTargetPool::peak_bytes()
+{
+	return peak_bytes_;
+}
\ No newline at end of file
@@ -0,0 +1,56 @@
+#ifndef RENDER_TARGET_POOL_H_
+#define RENDER_TARGET_POOL_H_
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include "RenderTarget.h"
+#include "RenderTargetDesc.h"
+
+// クラス：レンダーターゲットプール
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// 描画パスはフレームの中で必要な期間だけレンダーターゲットを借り、使い終わったら返す。
+// 返されたレンダーターゲットは同じ仕様の次の要求に再利用されるため、
+// 生存期間が重ならないパス同士は同じテクスチャを共有する。
+class RenderTargetPool
+{
+public:
+	// 初期化
+	static void initialize();
+	// 終了処理
+	static void finalize();
+	// レンダーターゲットの取得（同じ仕様の空きがなければ作成する）
+	static RenderTarget* acquire(const RenderTargetDesc& desc);
+	// レンダーターゲットの返却
+	static void release(RenderTarget* target);
+
+	// 作成済みのレンダーターゲット数の取得
+	static int target_count();
+	// 作成済みのレンダーターゲットの推定メモリ量の取得（バイト）
+	static int reserved_bytes();
+	// 同時に使用されたレンダーターゲットの推定メモリ量の最大値の取得（バイト）
+	static int peak_bytes();
+
+private:
+	// 構造体：プールの要素
+	struct Entry
+	{
+		std::unique_ptr<RenderTarget>	target;	// レンダーターゲット
+		RenderTargetDesc				desc;	// 仕様
+		bool							in_use;	// 使用中か
+	};
+
+private:
+	// 作成済みのレンダーターゲット
+	static std::vector<Entry>	entries_;
+	// 仕様ごとの空きレンダーターゲット（entries_の番号）
+	static std::unordered_map<unsigned long long, std::vector<int>>	free_;
+	// 作成済みのレンダーターゲットの推定メモリ量
+	static int	reserved_bytes_;
+	// 使用中のレンダーターゲットの推定メモリ量
+	static int	used_bytes_;
+	// 使用中のレンダーターゲットの推定メモリ量の最大値
+	static int	peak_bytes_;
+};
+
+#endif // !RENDER_TARGET_POOL_H_
\ No newline at end of file
@@ -1,43 +1,43 @@
 #include "Shader.h"
 #include <DxLib.h>
 
-// NXFVF[_[
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：シェーダー
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
-// fXgN^
+// デストラクタ
 Shader::~Shader()
 {
-	clear();	// Sf[^
+	clear();	// 全データを消去
 }
 
-// _VF[_[̓ǂݍ
+// 頂点シェーダーの読み込み
 bool Shader::load_vs(int id, const std::string & file_name)
 {
-	// ID̃f[^폜
+	// 同じIDのデータを削除
 	erase(id);
-	// ff[^ǂݍ
+	// モデルデータを読み込む
 	shader_[id] = LoadVertexShader(file_name.c_str());
 
-	// ǂݍ݌ʂԂ
+	// 読み込み結果を返す
 	return shader_[id] != -1;
 }
 
-// sNZVF[_[̓ǂݍ
+// ピクセルシェーダーの読み込み
 bool Shader::load_ps(int id, const std::string & file_name)
 {
-	// ID̃f[^폜
+	// 同じIDのデータを削除
 	erase(id);
-	// ff[^ǂݍ
+	// モデルデータを読み込む
 	shader_[id] = LoadPixelShader(file_name.c_str());
 
-	// ǂݍ݌ʂԂ
+	// 読み込み結果を返す
 	return shader_[id] != -1;
 }
 
-// VF[_[̍폜
+// シェーダーの削除
 void Shader::erase(int id)
 {
-	// ỸVF[_[f[^݂ꍇAf[^폜
+	// 該当のシェーダーデータが存在する場合、データを削除
 	if (shader_.count(id) > 0)
 	{
 		DeleteShader(shader_[id]);
@@ -45,10 +45,10 @@ void Shader::erase(int id)
 	}
 }
 
-// f[^̏
+// データの消去
 void Shader::clear()
 {
-	// SẴVF[_[f[^
+	// 全てのシェーダーデータを消去
 	for (const auto data : shader_)
 	{
 		DeleteShader(data.second);
@@ -56,19 +56,19 @@ void Shader::clear()
 	shader_.clear();
 }
 
-// nh̎擾
+// ハンドルの取得
 int Shader::operator[](int id) const
 {
 	return shader_.at(id);
 }
 
-// _VF[_[̎w
+// 頂点シェーダーの指定
 void Shader::set_vs(int id)
 {
 	SetUseVertexShader(shader_[id]);
 }
 
-// sNZVF[_[̎w
+// ピクセルシェーダーの指定
 void Shader::set_ps(int id)
 {
 	SetUsePixelShader(shader_[id]);
@@ -4,36 +4,36 @@
 #include <string>
 #include <unordered_map>
 
-// NXFVF[_[
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：シェーダー
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 class Shader
 {
 public:
-	// ftHgRXgN^
+	// デフォルトコンストラクタ
 	Shader() = default;
-	// fXgN^
+	// デストラクタ
 	~Shader();
-	// _VF[_[̓ǂݍ
+	// 頂点シェーダーの読み込み
 	bool load_vs(int id, const std::string& file_name);
-	// sNZVF[_[̓ǂݍ
+	// ピクセルシェーダーの読み込み
 	bool load_ps(int id, const std::string& file_name);
-	// VF[_[̍폜
+	// シェーダーの削除
 	void erase(int id);
-	// f[^̏
+	// データの消去
 	void clear();
-	// nh̎擾
+	// ハンドルの取得
 	int operator[](int id) const;
-	// _VF[_[̎w
+	// 頂点シェーダーの指定
 	void set_vs(int id);
-	// sNZVF[_[̎w
+	// ピクセルシェーダーの指定
 	void set_ps(int id);
 
-	// Rs[֎~
+	// コピー禁止
 	Shader(const Shader& other) = delete;
 	Shader& operator = (const Shader& other) = delete;
 
 private:
-	// VF[_[f[^}bv
+	// シェーダーデータマップ
 	std::unordered_map<int, int> shader_;
 };
 
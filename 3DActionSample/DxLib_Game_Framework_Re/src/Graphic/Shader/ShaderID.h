@@ -1,8 +1,8 @@
 #ifndef SHADER_ID_H_
 #define SHADER_ID_H_
 
-// 񋓌^FVF[_[ID
-// ҁF Qi"Jacky" Ho Siu Kij
+// 列挙型：シェーダーID
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
 enum class ShaderID
 {
@@ -12,6 +12,7 @@ enum class ShaderID
 	PS_BloomCombine,
 
 	PS_RadiationBlur,
+	PS_PostEffect,
 };
 
 #endif // !SHADER_ID_H_
\ No newline at end of file
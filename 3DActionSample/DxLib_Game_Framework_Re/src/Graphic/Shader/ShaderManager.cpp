@@ -3,27 +3,27 @@
 
 #include "PixelShaderCB.h"
 
-// NXFVF[_[Ǘ
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：シェーダー管理
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
-// VF[_[AZbg
+// シェーダーアセット
 Shader ShaderManager::shader_asset_;
-// L[u}bvAZbg
+// キューブマップアセット
 CubeMap ShaderManager::cubemap_asset_;
-// sNZVF[_[p̕ϐobt@
+// ピクセルシェーダー用の変数バッファ
 int ShaderManager::pscbhandle_{ -1 };
 
-// 
+// 初期化
 void ShaderManager::initialize()
 {
-	// IƓ
+	// 終了処理と同じ
 	finalize();
 
-	// sNZVF[_[p̕ϐobt@쐬
+	// ピクセルシェーダー用の変数バッファを作成
 	pscbhandle_ = CreateShaderConstantBuffer(sizeof(PixelShaderCB));
 }
 
-// I
+// 終了処理
 void ShaderManager::finalize()
 {
 	shader_asset_.clear();
@@ -31,74 +31,74 @@ void ShaderManager::finalize()
 	pscbhandle_ = -1;
 }
 
-// _VF[_[̓ǂݍ
+// 頂点シェーダーの読み込み
 bool ShaderManager::load_vs(int id, const std::string& file_name)
 {
 	return shader_asset_.load_vs(id, file_name);
 }
 
-// sNZVF[_[̓ǂݍ
+// ピクセルシェーダーの読み込み
 bool ShaderManager::load_ps(int id, const std::string& file_name)
 {
 	return shader_asset_.load_ps(id, file_name);
 }
 
-// L[u}bv̓ǂݍ
+// キューブマップの読み込み
 bool ShaderManager::load_cubemap(int id, const std::string& file_name)
 {
 	return cubemap_asset_.load(id, file_name);
 }
 
-// _VF[_[̍폜
+// 頂点シェーダーの削除
 void ShaderManager::erase_vs(int id)
 {
 	shader_asset_.erase(id);
 }
 
-// sNZVF[_[̍폜
+// ピクセルシェーダーの削除
 void ShaderManager::erase_ps(int id)
 {
 	shader_asset_.erase(id);
 }
 
-// L[u}bv̍폜
+// キューブマップの削除
 void ShaderManager::erase_cubemap(int id)
 {
 	cubemap_asset_.erase(id);
 }
 
-// _VF[_[̎w
+// 頂点シェーダーの指定
 void ShaderManager::set_vs(int id)
 {
 	shader_asset_.set_vs(id);
 }
 
-// sNZVF[_[̎w
+// ピクセルシェーダーの指定
 void ShaderManager::set_ps(int id)
 {
 	shader_asset_.set_ps(id);
 }
 
-// L[u}bv̎w
+// キューブマップの指定
 void ShaderManager::set_cubemap(int id, int stage)
 {
 	SetTextureAddressMode(DX_TEXADDRESS_CLAMP, stage);
 	SetUseTextureToShader(stage, cubemap_asset_[id]);
 }
 
-// L[u}bv̉
+// キューブマップの解除
 void ShaderManager::off_cubemap(int stage)
 {
 	SetUseTextureToShader(11, -1);
 }
 
-// VF[_[̗L
+// シェーダーの有効化
 void ShaderManager::shader_on()
 {
 	MV1SetUseOrigShader(TRUE);
 }
 
-// VF[_[̖
+// シェーダーの無効化
 void ShaderManager::shader_off()
 {
 	MV1SetUseOrigShader(FALSE);
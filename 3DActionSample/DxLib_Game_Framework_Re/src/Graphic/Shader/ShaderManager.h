@@ -7,47 +7,47 @@
 #include "Shader.h"
 #include "CubeMap.h"
 
-// NXFVF[_[Ǘ
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：シェーダー管理
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 class ShaderManager
 {
 public:
-	// 
+	// 初期化
 	static void initialize();
-	// I
+	// 終了処理
 	static void finalize();
-	// _VF[_[̓ǂݍ
+	// 頂点シェーダーの読み込み
 	static bool load_vs(int id, const std::string& file_name);
-	// sNZVF[_[̓ǂݍ
+	// ピクセルシェーダーの読み込み
 	static bool load_ps(int id, const std::string& file_name);
-	// L[u}bv̓ǂݍ
+	// キューブマップの読み込み
 	static bool load_cubemap(int id, const std::string& file_name);
-	// _VF[_[̍폜
+	// 頂点シェーダーの削除
 	static void erase_vs(int id);
-	// sNZVF[_[̍폜
+	// ピクセルシェーダーの削除
 	static void erase_ps(int id);
-	// L[u}bv̍폜
+	// キューブマップの削除
 	static void erase_cubemap(int id);
-	// _VF[_[̎w
+	// 頂点シェーダーの指定
 	static void set_vs(int id);
-	// sNZVF[_[̎w
+	// ピクセルシェーダーの指定
 	static void set_ps(int id);
-	// L[u}bv̎w
+	// キューブマップの指定
 	static void set_cubemap(int id, int stage);
-	// L[u}bv̉
+	// キューブマップの解除
 	static void off_cubemap(int stage);
 
-	// VF[_[̗L
+	// シェーダーの有効化
 	static void shader_on();
-	// VF[_[̖
+	// シェーダーの無効化
 	static void shader_off();
 
 private:
-	// VF[_[AZbg
+	// シェーダーアセット
 	static Shader	shader_asset_;
-	// L[u}bvAZbg
+	// キューブマップアセット
 	static CubeMap	cubemap_asset_;
-	// sNZVF[_[p̕ϐobt@
+	// ピクセルシェーダー用の変数バッファ
 	static int		pscbhandle_;
 };
 
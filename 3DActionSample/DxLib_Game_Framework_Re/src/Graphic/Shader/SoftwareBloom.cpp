@@ -0,0 +1,284 @@
+#include "SoftwareBloom.h"
+#include "../../Math/MathSIMD.h"
+#include "../WorkerPool.h"
+#include <algorithm>
+#include <cmath>
+
+// クラス：ブルームのCPU実装
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+
+// コンストラクタ（黒で初期化）
+BloomImage::BloomImage(int width, int height) :
+	width{ width }, height{ height }, pixels((size_t)width * height * 4, 0.0f)
+{ }
+
+// 画素の取得
+const float* BloomImage::at(int x, int y) const
+{
+	return &pixels[((size_t)y * width + x) * 4];
+}
+
+float* BloomImage::at(int x, int y)
+{
+	return &pixels[((size_t)y * width + x) * 4];
+}
+
+// 画素の演算（SSEが使えない場合はスカラー処理）
+#ifdef MATH_USE_SSE
+using Pixel = __m128;
+static inline Pixel load(const float* p) { return _mm_loadu_ps(p); }
+static inline void store(float* p, Pixel v) { _mm_storeu_ps(p, v); }
+static inline Pixel splat(float s) { return _mm_set1_ps(s); }
+static inline Pixel add(Pixel a, Pixel b) { return _mm_add_ps(a, b); }
+static inline Pixel sub(Pixel a, Pixel b) { return _mm_sub_ps(a, b); }
+static inline Pixel mul(Pixel a, Pixel b) { return _mm_mul_ps(a, b); }
+// RGBの内積（wは無視する）
+static inline float dot3(Pixel a, Pixel b)
+{
+	const Pixel m = _mm_mul_ps(a, b);
+	const Pixel y = _mm_shuffle_ps(m, m, _MM_SHUFFLE(1, 1, 1, 1));
+	const Pixel z = _mm_shuffle_ps(m, m, _MM_SHUFFLE(2, 2, 2, 2));
+	return _mm_cvtss_f32(_mm_add_ss(_mm_add_ss(m, y), z));
+}
+#else
+struct Pixel { float v[4]; };
+static inline Pixel load(const float* p) { return Pixel{ { p[0], p[1], p[2], p[3] } }; }
+static inline void store(float* p, Pixel v) { std::copy(v.v, v.v + 4, p); }
+static inline Pixel splat(float s) { return Pixel{ { s, s, s, s } }; }
+static inline Pixel add(Pixel a, Pixel b) { return Pixel{ { a.v[0] + b.v[0], a.v[1] + b.v[1], a.v[2] + b.v[2], a.v[3] + b.v[3] } }; }
+static inline Pixel sub(Pixel a, Pixel b) { return Pixel{ { a.v[0] - b.v[0], a.v[1] - b.v[1], a.v[2] - b.v[2], a.v[3] - b.v[3] } }; }
+static inline Pixel mul(Pixel a, Pixel b) { return Pixel{ { a.v[0] * b.v[0], a.v[1] * b.v[1], a.v[2] * b.v[2], a.v[3] * b.v[3] } }; }
+// RGBの内積（wは無視する）
+static inline float dot3(Pixel a, Pixel b) { return a.v[0] * b.v[0] + a.v[1] * b.v[1] + a.v[2] * b.v[2]; }
+#endif
+
+// 不透明のRGBAとして書き込む
+static inline void store_opaque(float* p, Pixel v)
+{
+	store(p, v);
+	p[3] = 1.0f;
+}
+
+// 線形補間
+static inline Pixel lerp(Pixel a, Pixel b, float t)
+{
+	return add(a, mul(sub(b, a), splat(t)));
+}
+
+// 輝度の係数（BrightPass.hlsl）
+static const float LuminanceWeights[4]{ 0.33f, 0.34f, 0.33f, 0.0f };
+// グレースケールの係数（BloomCombine.hlsl）
+static const float GreyWeights[4]{ 0.3f, 0.59f, 0.11f, 0.0f };
+
+// 彩度の調節
+static inline Pixel adjust_saturation(Pixel color, float saturation)
+{
+	const Pixel grey = splat(dot3(color, load(GreyWeights)));
+	return lerp(grey, color, saturation);
+}
+
+// 範囲内に収める
+static inline int clamp(int value, int max)
+{
+	return std::min(std::max(value, 0), max);
+}
+
+// 構造体：1方向の双線形補間のサンプリング位置（出力の画素ごと）
+struct SampleAxis
+{
+	std::vector<int>	first;		// 補間する前側の画素
+	std::vector<int>	second;		// 補間する後側の画素
+	std::vector<float>	weight;		// 後側の画素の割合
+
+	// 作成（出力の画素xの中心を入力の(x + 0.5) * scale + offsetの位置でサンプリングする、画素の中心は+0.5）
+	SampleAxis(int count, int source_count, float scale, float offset) :
+		first(count), second(count), weight(count)
+	{
+		for (int i = 0; i < count; ++i)
+		{
+			const float position = (i + 0.5f) * scale + offset - 0.5f;
+			const int base = (int)std::floor(position);
+			first[i] = clamp(base, source_count - 1);
+			second[i] = clamp(base + 1, source_count - 1);
+			weight[i] = position - base;
+		}
+	}
+};
+
+// 双線形補間でサンプリング（xは横方向のサンプリング位置の番号、yは縦方向）
+static inline Pixel sample_bilinear(const BloomImage& image, const SampleAxis& axis_x, int x, const SampleAxis& axis_y, int y)
+{
+	const int x0 = axis_x.first[x];
+	const int x1 = axis_x.second[x];
+	const float tx = axis_x.weight[x];
+	const Pixel top = lerp(load(image.at(x0, axis_y.first[y])), load(image.at(x1, axis_y.first[y])), tx);
+	const Pixel bottom = lerp(load(image.at(x0, axis_y.second[y])), load(image.at(x1, axis_y.second[y])), tx);
+	return lerp(top, bottom, axis_y.weight[y]);
+}
+
+// 1回に処理する行数（行単位で複数スレッドに分ける）
+static const int RowGrain{ 8 };
+
+// 大きさの変更（全画素を上書きするため初期化しない）
+static void resize(BloomImage& image, int width, int height)
+{
+	image.width = width;
+	image.height = height;
+	image.pixels.resize((size_t)width * height * 4);
+}
+
+// ブラーの半径（画素、ガウシアンウェイトの中心以外の数）
+static const int BlurRadius{ 4 };
+
+// 1方向のブラー（horizontalがfalseの場合は垂直方向、中心と両側のBlurRadius画素ずつを畳み込む）
+static void blur(const BloomImage& source, BloomImage& result, const BloomCB& param, bool horizontal)
+{
+	resize(result, source.width, source.height);
+
+	Pixel weights[BlurRadius + 1];
+	for (int i = 0; i <= BlurRadius; ++i)
+	{
+		weights[i] = splat(param.g_GaussianWeights[i]);
+	}
+
+	WorkerPool::parallel_for(source.height, RowGrain, [&](int begin, int end)
+	{
+		const int width = source.width;
+		for (int y = begin; y < end; ++y)
+		{
+			float* output = result.at(0, y);
+			if (horizontal)
+			{
+				// 行の中で左右の画素を畳み込む（両端の近くだけ範囲を制限する）
+				const float* line = source.at(0, y);
+				for (int x = 0; x < width; ++x)
+				{
+					Pixel sum = mul(load(line + x * 4), weights[0]);
+					if (x >= BlurRadius && x < width - BlurRadius)
+					{
+						for (int i = 1; i <= BlurRadius; ++i)
+						{
+							sum = add(sum, mul(add(load(line + (x + i) * 4), load(line + (x - i) * 4)), weights[i]));
+						}
+					}
+					else
+					{
+						for (int i = 1; i <= BlurRadius; ++i)
+						{
+							const Pixel pair = add(load(line + clamp(x + i, width - 1) * 4), load(line + clamp(x - i, width - 1) * 4));
+							sum = add(sum, mul(pair, weights[i]));
+						}
+					}
+					store_opaque(output + x * 4, sum);
+				}
+			}
+			else
+			{
+				// 上下の行を順に畳み込む（行単位でメモリを連続に読む）
+				const float* center = source.at(0, y);
+				for (int x = 0; x < width; ++x)
+				{
+					store(output + x * 4, mul(load(center + x * 4), weights[0]));
+				}
+				for (int i = 1; i <= BlurRadius; ++i)
+				{
+					const float* above = source.at(0, clamp(y - i, source.height - 1));
+					const float* below = source.at(0, clamp(y + i, source.height - 1));
+					for (int x = 0; x < width; ++x)
+					{
+						const Pixel pair = add(load(below + x * 4), load(above + x * 4));
+						store(output + x * 4, add(load(output + x * 4), mul(pair, weights[i])));
+					}
+				}
+				for (int x = 0; x < width; ++x)
+				{
+					output[x * 4 + 3] = 1.0f;
+				}
+			}
+		}
+	});
+}
+
+// 輝度抽出（resultの大きさで縮小する）
+void SoftwareBloom::bright_pass(const BloomImage& source, BloomImage& result, const BloomCB& param)
+{
+	resize(result, result.width, result.height);
+	const float scale_x = (float)source.width / result.width;
+	const float scale_y = (float)source.height / result.height;
+	// 周囲4点（元画像の半画素ずつずらした位置）のサンプリング位置
+	const SampleAxis left(result.width, source.width, scale_x, -0.5f);
+	const SampleAxis right(result.width, source.width, scale_x, 0.5f);
+	const SampleAxis top(result.height, source.height, scale_y, -0.5f);
+	const SampleAxis bottom(result.height, source.height, scale_y, 0.5f);
+	const Pixel quarter = splat(0.25f);
+	const Pixel luminance_weights = load(LuminanceWeights);
+	const Pixel zero = splat(0.0f);
+
+	WorkerPool::parallel_for(result.height, RowGrain, [&](int begin, int end)
+	{
+		for (int y = begin; y < end; ++y)
+		{
+			for (int x = 0; x < result.width; ++x)
+			{
+				// 周囲4点の平均
+				Pixel color = add(add(sample_bilinear(source, left, x, bottom, y), sample_bilinear(source, left, x, top, y)),
+					add(sample_bilinear(source, right, x, bottom, y), sample_bilinear(source, right, x, top, y)));
+				color = mul(color, quarter);
+				// 指定した輝度を超える画素だけを残す
+				if (dot3(color, luminance_weights) - param.g_BrightPassThreshold <= 0.0f)
+				{
+					color = zero;
+				}
+				store_opaque(result.at(x, y), color);
+			}
+		}
+	});
+}
+
+// 水平方向ブラー
+void SoftwareBloom::blur_h(const BloomImage& source, BloomImage& result, const BloomCB& param)
+{
+	blur(source, result, param, true);
+}
+
+// 垂直方向ブラー
+void SoftwareBloom::blur_v(const BloomImage& source, BloomImage& result, const BloomCB& param)
+{
+	blur(source, result, param, false);
+}
+
+// 元画像とブラー画像の合成（resultは元画像の大きさ）
+void SoftwareBloom::combine(const BloomImage& base, const BloomImage& bloom, BloomImage& result, const BloomCB& param)
+{
+	resize(result, base.width, base.height);
+	// ブラー画像を拡大するサンプリング位置
+	const SampleAxis axis_x(base.width, bloom.width, (float)bloom.width / base.width, 0.0f);
+	const SampleAxis axis_y(base.height, bloom.height, (float)bloom.height / base.height, 0.0f);
+	const Pixel base_intensity = splat(param.g_BaseIntensity);
+	const Pixel bloom_intensity = splat(param.g_BloomIntensity);
+
+	WorkerPool::parallel_for(base.height, RowGrain, [&](int begin, int end)
+	{
+		for (int y = begin; y < end; ++y)
+		{
+			for (int x = 0; x < base.width; ++x)
+			{
+				const Pixel base_color = mul(adjust_saturation(load(base.at(x, y)), param.g_BaseSaturation), base_intensity);
+				const Pixel bloom_sample = sample_bilinear(bloom, axis_x, x, axis_y, y);
+				const Pixel bloom_color = mul(adjust_saturation(bloom_sample, param.g_BloomSaturation), bloom_intensity);
+				store_opaque(result.at(x, y), add(base_color, bloom_color));
+			}
+		}
+	});
+}
+
+// ブルーム全体（ブラーは1/4の大きさで行う）
+void SoftwareBloom::apply(const BloomImage& source, BloomImage& result, const BloomCB& param)
+{
+	BloomImage bright(source.width / 4, source.height / 4);
+	BloomImage blurred;
+	bright_pass(source, bright, param);
+	blur_h(bright, blurred, param);
+	blur_v(blurred, bright, param);
+	combine(source, bright, result, param);
+}
\ No newline at end of file
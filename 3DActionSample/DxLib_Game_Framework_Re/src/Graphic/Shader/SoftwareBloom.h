@@ -0,0 +1,45 @@
+#ifndef SOFTWARE_BLOOM_H_
+#define SOFTWARE_BLOOM_H_
+
+#include <vector>
+#include "BloomCB.h"
+
+// 構造体：ブルーム処理用の画像（RGBAの浮動小数点、左上から行順）
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+struct BloomImage
+{
+	int					width{ 0 };		// 幅
+	int					height{ 0 };	// 高さ
+	std::vector<float>	pixels;			// 画素（1画素につき4要素）
+
+	// デフォルトコンストラクタ
+	BloomImage() = default;
+	// コンストラクタ（黒で初期化）
+	BloomImage(int width, int height);
+	// 画素の取得
+	const float* at(int x, int y) const;
+	float* at(int x, int y);
+};
+
+// クラス：ブルームのCPU実装
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// BrightPass、GaussianBlurH/V、BloomCombineの各シェーダーと同じ処理をCPUで行う。
+// GPUなしでの結果の比較とフォールバック用。各画素はSIMDで4要素同時に計算し、行単位でWorkerPoolに分ける。
+// テクスチャの範囲外は端の画素を使い（クランプ）、縮小/拡大は双線形補間でサンプリングする。
+// ブラーはGaussianBlurH/V.hlslと同じく、中心と両側の4画素ずつを畳み込む。
+class SoftwareBloom
+{
+public:
+	// 輝度抽出（resultの大きさで縮小する）
+	static void bright_pass(const BloomImage& source, BloomImage& result, const BloomCB& param);
+	// 水平方向ブラー
+	static void blur_h(const BloomImage& source, BloomImage& result, const BloomCB& param);
+	// 垂直方向ブラー
+	static void blur_v(const BloomImage& source, BloomImage& result, const BloomCB& param);
+	// 元画像とブラー画像の合成（resultは元画像の大きさ）
+	static void combine(const BloomImage& base, const BloomImage& bloom, BloomImage& result, const BloomCB& param);
+	// ブルーム全体（ブラーは1/4の大きさで行う）
+	static void apply(const BloomImage& source, BloomImage& result, const BloomCB& param);
+};
+
+#endif // !SOFTWARE_BLOOM_H_
\ No newline at end of file
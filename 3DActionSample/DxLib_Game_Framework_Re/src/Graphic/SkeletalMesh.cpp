@@ -1,160 +1,393 @@
 #include "SkeletalMesh.h"
 #include <DxLib.h>
+#include <algorithm>
+#include <cfloat>
 
-// NXFXP^bV
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：スケルタルメッシュ
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
-// oCh̃f
+// バインド中のモデル
 int SkeletalMesh::model_{ -1 };
-// {[̃[Jϊs
-Matrix SkeletalMesh::local_matrices_[SkeletalMesh::BoneMax];
-// {[̃[hϊs
-Matrix SkeletalMesh::world_matrices_[SkeletalMesh::BoneMax];
-// fAZbg
+// モデルアセット
 ModelAsset SkeletalMesh::asset_;
+// キーの抽出間隔
+const float SkeletalMesh::KeyInterval{ 1.0f };
+// 許容誤差を最大まで緩める階層の深さ
+const float SkeletalMesh::ToleranceDepthMax{ 4.0f };
+// 頂点がボーンの影響を受けるとみなすスキンウェイトの下限
+const float SkeletalMesh::SkinWeightMin{ 1.0e-3f };
+// モデルごとのスケルトン
+std::unordered_map<int, Skeleton> SkeletalMesh::skeletons_;
+// モデルごとのボーンの境界球
+std::unordered_map<int, BoneBounds> SkeletalMesh::bounds_;
+// モデルごとのアニメーションクリップ
+std::unordered_map<int, std::vector<CompressedAnimationClip>> SkeletalMesh::clips_;
+// モデルごとのアニメーションクリップの圧縮統計
+std::unordered_map<int, ClipCompressionStats> SkeletalMesh::clip_stats_;
+// バインド中のモデルのアニメーションクリップ
+const std::vector<CompressedAnimationClip>* SkeletalMesh::bound_clips_{ nullptr };
+// サンプリング用の姿勢
+AnimationPose SkeletalMesh::pose_;
+// サンプリング用の姿勢（補間元）
+AnimationPose SkeletalMesh::prev_pose_;
+// ボーン行列のアップロードの記録
+BoneUploadCache SkeletalMesh::upload_cache_;
 
-// 
+// 初期化
 void SkeletalMesh::initialize()
 {
-	// IƓ
+	// 終了処理と同じ
 	finalize();
 }
 
-// I
+// 終了処理
 void SkeletalMesh::finalize()
 {
 	asset_.clear();
+	skeletons_.clear();
+	bounds_.clear();
+	clips_.clear();
+	clip_stats_.clear();
+	upload_cache_.clear();
 	model_ = -1;
+	bound_clips_ = nullptr;
 }
 
-// ǂݍ
+// 読み込み
 bool SkeletalMesh::load(int id, const std::string& file_name)
 {
-	return asset_.load(id, file_name);
+	if (!asset_.load(id, file_name)) return false;
+	// 読み込み時の処理でボーン行列がリセットされるため、アップロードの記録を消去
+	upload_cache_.erase(asset_[id]);
+
+	// スケルトンを作成
+	build_skeleton(id);
+	// バインドポーズからボーンの境界球を計算
+	bounds_[id] = BoneBounds(load_bind_pose(id, file_name));
+	// アニメーションクリップを抽出
+	bake_clips(id);
+
+	return true;
 }
 
-// 폜
+// 削除
 void SkeletalMesh::erase(int id)
 {
-	model_ = (model_ == asset_[id]) ? -1 : model_;
+	if (model_ == asset_[id])
+	{
+		model_ = -1;
+		bound_clips_ = nullptr;
+	}
+	upload_cache_.erase(asset_[id]);
 	asset_.erase(id);
+	skeletons_.erase(id);
+	bounds_.erase(id);
+	clips_.erase(id);
+	clip_stats_.erase(id);
+}
+
+// 描画用のモデルハンドルの複製（アクターごとにボーン行列を保持する、失敗した場合は負の値）
+int SkeletalMesh::duplicate(int id)
+{
+	return MV1DuplicateModel(asset_[id]);
+}
+
+// 複製したモデルハンドルの削除
+void SkeletalMesh::release(int handle)
+{
+	if (handle < 0) return;
+
+	upload_cache_.erase(handle);
+	MV1DeleteModel(handle);
 }
 
-// bṼoCh
+// メッシュのバインド
 void SkeletalMesh::bind(int id)
 {
 	model_ = asset_[id];
+	bound_clips_ = &clips_.at(id);
 }
 
-// Aj[ṼoCh
-void SkeletalMesh::bind_animation(int motion, float time)
+// アニメーションのサンプリング
+void SkeletalMesh::sample_animation(int motion, float time, AffineMatrix local_matrices[])
 {
-	const auto index = MV1AttachAnim(model_, motion);
-	MV1SetAttachAnimTime(model_, index, time);
+	clip(motion).sample(time, pose_);
+	pose_.to_matrices(local_matrices);
+}
+
+// アニメーションのサンプリング（補間付き）
+void SkeletalMesh::sample_animation(int prev_motion, float prev_time, int motion, float time, float amount, AffineMatrix local_matrices[])
+{
+	sample_pose(prev_motion, prev_time, motion, time, amount, nullptr, clip(motion).bone_count()).to_matrices(local_matrices);
+}
+
+// 指定したボーンの姿勢のサンプリング（補間付き、bonesがnullptrの場合は全ボーン、cursorは各モーションのサンプリング位置）
+const AnimationPose& SkeletalMesh::sample_pose(int prev_motion, float prev_time, int motion, float time, float amount, const int bones[], int count,
+	ClipCursor* prev_cursor, ClipCursor* cursor)
+{
+	clip(motion).sample(time, pose_, bones, count, cursor);
 
-	for (int i = 0; i < MV1GetFrameNum(model_); ++i)
+	// 補間が終わっていれば前のモーションはサンプリングしない（指定外のボーンの値は補間しても使われない）
+	if (amount < 1.0f)
 	{
-		MV1ResetFrameUserLocalMatrix(model_, i);
-		local_matrices_[i] = MV1GetFrameLocalMatrix(model_, i);
+		clip(prev_motion).sample(prev_time, prev_pose_, bones, count, prev_cursor);
+		AnimationPose::blend(prev_pose_, pose_, amount, pose_);
 	}
 
-	MV1DetachAnim(model_, index);
+	return pose_;
 }
 
-// Aj[ṼoChiԕtj
-void SkeletalMesh::bind_animation(int prev_motion, float prev_time, int motion, float time, float amount)
+// スケルトンの取得
+const Skeleton& SkeletalMesh::skeleton(int id)
 {
-	const auto prev_index = MV1AttachAnim(model_, prev_motion);
-	const auto now_index = MV1AttachAnim(model_, motion);
-	MV1SetAttachAnimBlendRate(model_, prev_index, 1.0f - amount);
-	MV1SetAttachAnimBlendRate(model_, now_index, amount);
-	MV1SetAttachAnimTime(model_, prev_index, prev_time);
-	MV1SetAttachAnimTime(model_, now_index, time);
+	return skeletons_.at(id);
+}
 
-	for (int i = 0; i < MV1GetFrameNum(model_); ++i)
-	{
-		MV1ResetFrameUserLocalMatrix(model_, i);
-		local_matrices_[i] = MV1GetFrameLocalMatrix(model_, i);
-	}
+// ボーンの境界球の取得
+const BoneBounds& SkeletalMesh::bounds(int id)
+{
+	return bounds_.at(id);
+}
 
-	MV1DetachAnim(model_, prev_index);
-	MV1DetachAnim(model_, now_index);
+// バインドポーズのメッシュをファイルに書き出す（境界球の計算の確認用）
+bool SkeletalMesh::save_bind_pose(int id, const std::string& file_name)
+{
+	return extract_bind_pose(id).save(file_name);
 }
 
-// [hϊšvZ
-void SkeletalMesh::transform(const Matrix& world)
+// 名前からボーン番号を検索（見つからなければ負の値）
+int SkeletalMesh::find_bone(int id, const std::string& name)
 {
-	// [Jϊsݒ
-	for (int i = 0; i < MV1GetFrameNum(model_); ++i)
-	{
-		MV1SetFrameUserLocalMatrix(model_, i, local_matrices_[i]);
-	}
-	// [hϊsݒ
-	MV1SetMatrix(model_, world);
+	return MV1SearchFrame(asset_[id], name.c_str());
+}
 
-	// [hϊs擾
-	for (int i = 0; i < MV1GetFrameNum(model_); ++i)
-	{
-		world_matrices_[i] = MV1GetFrameLocalWorldMatrix(model_, i);
-	}
+// アニメーションクリップの取得
+const CompressedAnimationClip& SkeletalMesh::clip(int motion)
+{
+	return (*bound_clips_)[motion];
 }
 
-// `
-void SkeletalMesh::draw()
+// アニメーションクリップをファイルに書き出す
+bool SkeletalMesh::save_clip(int id, int motion, const std::string& file_name)
 {
-	for (int i = 0; i < MV1GetFrameNum(model_); ++i)
-	{
-		MV1ResetFrameUserLocalMatrix(model_, i);
-		MV1SetFrameUserLocalWorldMatrix(model_, i, world_matrices_[i]);
-	}
+	return clips_.at(id)[motion].save(file_name);
+}
 
-	MV1DrawModel(model_);
+// アニメーションクリップの圧縮統計の取得（全モーションの合計）
+const ClipCompressionStats& SkeletalMesh::clip_stats(int id)
+{
+	return clip_stats_.at(id);
 }
 
-// [Jϊs̎擾
-void SkeletalMesh::get_local_matrices(Matrix local_matrices[])
+// 描画（world_matricesはボーン数分のワールド変換行列、changed_bonesは前回のアップロードから値が変わったボーンのビット
+// （アップロード後に消去する）、nullptrの場合は全ボーンをアップロードする、handleはduplicateで複製したハンドル（負の値でバインド中のモデル））
+void SkeletalMesh::draw(const AffineMatrix world_matrices[], unsigned long long changed_bones[], int handle)
 {
-	for (int i = 0; i < MV1GetFrameNum(model_); ++i)
+	const int model = (handle >= 0) ? handle : model_;
+	upload_cache_.upload(model, MV1GetFrameNum(model), world_matrices, changed_bones, [&](int bone, bool full)
 	{
-		local_matrices[i] = local_matrices_[i];
-	}
+		if (full) MV1ResetFrameUserLocalMatrix(model, bone);
+		MV1SetFrameUserLocalWorldMatrix(model, bone, world_matrices[bone]);
+	});
+
+	MV1DrawModel(model);
 }
 
-// [Jϊs̐ݒ
-void SkeletalMesh::set_local_matrices(const Matrix local_matrices[])
+// ボーン行列のアップロードの統計の取得（reset_upload_stats()からの累計）
+const BoneUploadStats& SkeletalMesh::upload_stats()
 {
-	for (int i = 0; i < MV1GetFrameNum(model_); ++i)
-	{
-		local_matrices_[i] = local_matrices[i];
-	}
+	return upload_cache_.stats();
 }
 
-// [hϊs̎擾
-void SkeletalMesh::get_world_matrices(Matrix world_matrices[])
+// ボーン行列のアップロードの統計のリセット（フレームの開始時に呼び出す）
+void SkeletalMesh::reset_upload_stats()
 {
-	for (int i = 0; i < MV1GetFrameNum(model_); ++i)
+	upload_cache_.reset_stats();
+}
+
+// ボーン数の取得
+int SkeletalMesh::bone_count()
+{
+	return MV1GetFrameNum(model_);
+}
+
+// モーションの終了時間の取得
+float SkeletalMesh::end_time(int motion)
+{
+	return clip(motion).end_time();
+}
+
+// スケルトンの作成
+void SkeletalMesh::build_skeleton(int id)
+{
+	const int model = asset_[id];
+
+	std::vector<int> parents(MV1GetFrameNum(model));
+	for (int bone = 0; bone < (int)parents.size(); ++bone)
 	{
-		world_matrices[i] = world_matrices_[i];
+		parents[bone] = MV1GetFrameParent(model, bone);
 	}
+	skeletons_[id] = Skeleton(parents);
 }
 
-// [hϊs̐ݒ
-void SkeletalMesh::set_world_matrices(const Matrix world_matrices[])
+// バインドポーズのメッシュの読み込み（モデルと同じ場所の.bpmファイルがなければ抽出して書き出す）
+BindPoseMesh SkeletalMesh::load_bind_pose(int id, const std::string& file_name)
 {
-	for (int i = 0; i < MV1GetFrameNum(model_); ++i)
+	// スキンウェイトの抽出はボーンごとに参照用メッシュを更新するため時間がかかる。
+	// 書き出したファイルをモデルと一緒に配布しておけば、読み込み時には抽出しない
+	const std::string bind_pose_file = file_name.substr(0, file_name.find_last_of('.')) + ".bpm";
+	BindPoseMesh mesh;
+	if (mesh.load(bind_pose_file) && (int)mesh.bone_matrices.size() == MV1GetFrameNum(asset_[id])) return mesh;
+
+	mesh = extract_bind_pose(id);
+	mesh.save(bind_pose_file);
+	return mesh;
+}
+
+// バインドポーズのメッシュの抽出
+BindPoseMesh SkeletalMesh::extract_bind_pose(int id)
+{
+	const int model = asset_[id];
+	BindPoseMesh result;
+
+	// 各ボーンのバインドポーズでのワールド変換行列
+	result.bone_matrices.resize(MV1GetFrameNum(model));
+	for (int bone = 0; bone < (int)result.bone_matrices.size(); ++bone)
+	{
+		MV1ResetFrameUserLocalMatrix(model, bone);
+		result.bone_matrices[bone] = MV1GetFrameLocalWorldMatrix(model, bone);
+	}
+
+	// バインドポーズでの全頂点の座標
+	MV1SetupReferenceMesh(model, -1, TRUE, TRUE);
+	const auto bind_pose = read_reference_positions(model);
+	const int vertex_count = (int)bind_pose.size();
+	BoundingBox extent;
+	for (const auto& position : bind_pose)
 	{
-		world_matrices_[i] = world_matrices[i];
+		extent.Merge(position, 0.0f);
 	}
+	const float size = extent.IsEmpty() ? 1.0f : std::max(Vector3::Distance(extent.minimum, extent.maximum), 1.0f);
+
+	// 参照用メッシュからはスキンウェイトを取得できないため、ボーンを1つずつ平行移動させて求める
+	// ボーンのワールド座標がdだけ移動すると、各頂点はそのボーンと子孫のウェイトの和 * dだけ移動する
+	const int bone_count = (int)result.bone_matrices.size();
+	std::vector<std::vector<float>> subtree_weights(bone_count);
+	for (int bone = 0; bone < bone_count; ++bone)
+	{
+		const Matrix local = MV1GetFrameLocalMatrix(model, bone);
+		MV1SetFrameUserLocalMatrix(model, bone, local * Matrix::CreateTranslation(Vector3(size, 0.0f, 0.0f)));
+		const Vector3 offset = Matrix(MV1GetFrameLocalWorldMatrix(model, bone)).Translation() - result.bone_matrices[bone].Translation();
+		const auto moved = read_reference_positions(model);
+		MV1ResetFrameUserLocalMatrix(model, bone);
+
+		const float length_squared = offset.LengthSquared();
+		subtree_weights[bone].assign(vertex_count, 0.0f);
+		if (length_squared < FLT_EPSILON) continue;
+		for (int i = 0; i < vertex_count; ++i)
+		{
+			subtree_weights[bone][i] = Vector3::Dot(moved[i] - bind_pose[i], offset) / length_squared;
+		}
+	}
+	MV1TerminateReferenceMesh(model, -1, TRUE, TRUE);
+
+	// 子のウェイトの和を引いて各ボーン自身のウェイトを求め、影響する全てのボーンに頂点を登録する
+	std::vector<float> weights(vertex_count);
+	std::vector<bool> registered(vertex_count, false);
+	for (int bone = 0; bone < bone_count; ++bone)
+	{
+		weights = subtree_weights[bone];
+		for (int child = 0; child < bone_count; ++child)
+		{
+			if (MV1GetFrameParent(model, child) != bone) continue;
+			for (int i = 0; i < vertex_count; ++i)
+			{
+				weights[i] -= subtree_weights[child][i];
+			}
+		}
+		for (int i = 0; i < vertex_count; ++i)
+		{
+			if (weights[i] < SkinWeightMin) continue;
+			result.positions.push_back(bind_pose[i]);
+			result.bones.push_back(bone);
+			registered[i] = true;
+		}
+	}
+	// どのボーンにも動かされない頂点は、最も近いボーンに登録する
+	for (int i = 0; i < vertex_count; ++i)
+	{
+		if (registered[i]) continue;
+		result.positions.push_back(bind_pose[i]);
+		result.bones.push_back(-1);
+	}
+
+	return result;
 }
 
-// {[̎擾
-int SkeletalMesh::bone_count()
+// 参照用メッシュを更新して全頂点の座標を取得
+std::vector<Vector3> SkeletalMesh::read_reference_positions(int model)
 {
-	return MV1GetFrameNum(model_);
+	MV1RefreshReferenceMesh(model, -1, TRUE, TRUE);
+	const auto mesh = MV1GetReferenceMesh(model, -1, TRUE, TRUE);
+	std::vector<Vector3> result(mesh.VertexNum);
+	for (int i = 0; i < mesh.VertexNum; ++i)
+	{
+		result[i] = mesh.Vertexs[i].Position;
+	}
+	return result;
 }
 
-// [V̏IԂ̎擾
-float SkeletalMesh::end_time(int motion)
+// アニメーションクリップの抽出
+void SkeletalMesh::bake_clips(int id)
 {
-	return MV1GetAnimTotalTime(model_, motion);
+	const int model = asset_[id];
+	const int bone_count = MV1GetFrameNum(model);
+
+	// 根元に近いボーンほど誤差が子孫に伝搬するため、階層の深さに応じて許容誤差を緩める
+	std::vector<ClipTolerance> tolerances(bone_count);
+	for (int bone = 0; bone < bone_count; ++bone)
+	{
+		int depth = 0;
+		for (int parent = MV1GetFrameParent(model, bone); parent >= 0; parent = MV1GetFrameParent(model, parent))
+		{
+			++depth;
+		}
+		const float scale = std::min(1.0f + depth, ToleranceDepthMax) / ToleranceDepthMax;
+		tolerances[bone].rotation *= scale;
+		tolerances[bone].translation *= scale;
+		tolerances[bone].scale *= scale;
+	}
+
+	std::vector<CompressedAnimationClip> clips;
+	ClipCompressionStats stats;
+	for (int motion = 0; motion < MV1GetAnimNum(model); ++motion)
+	{
+		AnimationClip clip{ bone_count, MV1GetAnimTotalTime(model, motion), KeyInterval };
+
+		// キーの時刻ごとにアニメーションを適用し、各ボーンのローカル変換行列を分解して記録
+		const auto index = MV1AttachAnim(model, motion);
+		for (int key = 0; key < clip.key_count(); ++key)
+		{
+			MV1SetAttachAnimTime(model, index, clip.key_time(key));
+			for (int bone = 0; bone < bone_count; ++bone)
+			{
+				MV1ResetFrameUserLocalMatrix(model, bone);
+				const Matrix local = MV1GetFrameLocalMatrix(model, bone);
+
+				Vector3 scale;
+				Quaternion rotation;
+				Vector3 translation;
+				local.Decompose(scale, rotation, translation);
+				clip.set_key(key, bone, scale, rotation, translation);
+			}
+		}
+		MV1DetachAnim(model, index);
+
+		// 圧縮して誤差を記録
+		clips.emplace_back(clip, tolerances.data());
+		stats.merge(clips.back().measure(clip));
+	}
+
+	clips_[id].swap(clips);
+	clip_stats_[id] = stats;
 }
\ No newline at end of file
@@ -2,56 +2,109 @@
 #define SKELETAL_MESH_H_
 
 #include <string>
-#include "../Math/Matrix.h"
+#include <unordered_map>
+#include <vector>
+#include "../Math/AffineMatrix.h"
 #include "ModelAsset.h"
+#include "CompressedAnimationClip.h"
+#include "Skeleton.h"
+#include "BoneBounds.h"
+#include "BoneUploadCache.h"
 
-// NXFXP^bV
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：スケルタルメッシュ
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// ボーン行列はモデルハンドルが保持するため、アクターごとにduplicateで複製したハンドルで描画し、
+// 同じアクターの再描画では値が変わったボーンだけをアップロードする（記録はBoneUploadCacheが持つ）。
+// 複製のないハンドル（共有ハンドル）を複数のインスタンスで交互に描画すると毎回全ボーンのアップロードになる（handle_switchesで数える）。
 class SkeletalMesh
 {
 public:
-	// 
+	// 初期化
 	static void initialize();
-	// I
+	// 終了処理
 	static void finalize();
-	// ǂݍ
+	// 読み込み
 	static bool load(int id, const std::string& file_name);
-	// 폜
+	// 削除
 	static void erase(int id);
-	// bṼoCh
+	// 描画用のモデルハンドルの複製（アクターごとにボーン行列を保持する、失敗した場合は負の値）
+	static int duplicate(int id);
+	// 複製したモデルハンドルの削除
+	static void release(int handle);
+	// メッシュのバインド
 	static void bind(int id);
-	// Aj[ṼoCh
-	static void bind_animation(int motion, float time);
-	// Aj[ṼoChiԕtj
-	static void bind_animation(int prev_motion, float prev_time, int motion, float time, float amount);
-	// [hϊšvZ
-	static void transform(const Matrix& world);
-	// `
-	static void draw();
-	// [Jϊs̎擾
-	static void get_local_matrices(Matrix local_matrices[]);
-	// [Jϊs̐ݒ
-	static void set_local_matrices(const Matrix local_matrices[]);
-	// [hϊs̎擾
-	static void get_world_matrices(Matrix world_matrices[]);
-	// [hϊs̐ݒ
-	static void set_world_matrices(const Matrix world_matrices[]);
-	// {[̎擾
+	// アニメーションのサンプリング
+	static void sample_animation(int motion, float time, AffineMatrix local_matrices[]);
+	// アニメーションのサンプリング（補間付き）
+	static void sample_animation(int prev_motion, float prev_time, int motion, float time, float amount, AffineMatrix local_matrices[]);
+	// スケルトンの取得
+	static const Skeleton& skeleton(int id);
+	// 名前からボーン番号を検索（見つからなければ負の値）
+	static int find_bone(int id, const std::string& name);
+	// 指定したボーンの姿勢のサンプリング（補間付き、bonesがnullptrの場合は全ボーン、cursorは各モーションのサンプリング位置）
+	static const AnimationPose& sample_pose(int prev_motion, float prev_time, int motion, float time, float amount, const int bones[], int count,
+		ClipCursor* prev_cursor = nullptr, ClipCursor* cursor = nullptr);
+	// ボーンの境界球の取得
+	static const BoneBounds& bounds(int id);
+	// バインドポーズのメッシュをファイルに書き出す（境界球の計算の確認用）
+	static bool save_bind_pose(int id, const std::string& file_name);
+	// アニメーションクリップの取得
+	static const CompressedAnimationClip& clip(int motion);
+	// アニメーションクリップをファイルに書き出す
+	static bool save_clip(int id, int motion, const std::string& file_name);
+	// アニメーションクリップの圧縮統計の取得（全モーションの合計）
+	static const ClipCompressionStats& clip_stats(int id);
+	// 描画（world_matricesはボーン数分のワールド変換行列、changed_bonesは前回のアップロードから値が変わったボーンのビット
+	// （アップロード後に消去する）、nullptrの場合は全ボーンをアップロードする、handleはduplicateで複製したハンドル（負の値でバインド中のモデル））
+	static void draw(const AffineMatrix world_matrices[], unsigned long long changed_bones[] = nullptr, int handle = -1);
+	// ボーン行列のアップロードの統計の取得（reset_upload_stats()からの累計）
+	static const BoneUploadStats& upload_stats();
+	// ボーン行列のアップロードの統計のリセット（フレームの開始時に呼び出す）
+	static void reset_upload_stats();
+	// ボーン数の取得
 	static int bone_count();
-	// [V̏IԂ̎擾
+	// モーションの終了時間の取得
 	static float end_time(int motion);
 
 private:
-	// oCh̃f
+	// スケルトンの作成
+	static void build_skeleton(int id);
+	// バインドポーズのメッシュの読み込み（モデルと同じ場所の.bpmファイルがなければ抽出して書き出す）
+	static BindPoseMesh load_bind_pose(int id, const std::string& file_name);
+	// バインドポーズのメッシュの抽出（スキンウェイトは各ボーンを動かした時の頂点の移動量から求める）
+	static BindPoseMesh extract_bind_pose(int id);
+	// 参照用メッシュを更新して全頂点の座標を取得
+	static std::vector<Vector3> read_reference_positions(int model);
+	// アニメーションクリップの抽出
+	static void bake_clips(int id);
+
+private:
+	// バインド中のモデル
 	static int			model_;
-	// {[̍ő吔
-	static const int	BoneMax{ 256 };
-	// {[̃[Jϊs
-	static Matrix		local_matrices_[BoneMax];
-	// {[̃[hϊs
-	static Matrix		world_matrices_[BoneMax];
-	// fAZbg
+	// モデルアセット
 	static ModelAsset	asset_;
+	// キーの抽出間隔
+	static const float	KeyInterval;
+	// 許容誤差を最大まで緩める階層の深さ
+	static const float	ToleranceDepthMax;
+	// 頂点がボーンの影響を受けるとみなすスキンウェイトの下限
+	static const float	SkinWeightMin;
+	// モデルごとのスケルトン
+	static std::unordered_map<int, Skeleton>	skeletons_;
+	// モデルごとのボーンの境界球
+	static std::unordered_map<int, BoneBounds>	bounds_;
+	// モデルごとのアニメーションクリップ
+	static std::unordered_map<int, std::vector<CompressedAnimationClip>>	clips_;
+	// モデルごとのアニメーションクリップの圧縮統計
+	static std::unordered_map<int, ClipCompressionStats>	clip_stats_;
+	// バインド中のモデルのアニメーションクリップ
+	static const std::vector<CompressedAnimationClip>*	bound_clips_;
+	// サンプリング用の姿勢
+	static AnimationPose	pose_;
+	// サンプリング用の姿勢（補間元）
+	static AnimationPose	prev_pose_;
+	// ボーン行列のアップロードの記録
+	static BoneUploadCache	upload_cache_;
 };
 
 #endif // !SKELETAL_MESH_H_
\ No newline at end of file
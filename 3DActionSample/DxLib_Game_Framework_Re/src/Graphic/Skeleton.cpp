@@ -0,0 +1,72 @@
+#include "Skeleton.h"
+#include <algorithm>
+
+// クラス：スケルトン（ボーンの親子関係）
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+
+// コンストラクタ（parentsは各ボーンの親番号、ルートは負の値）
+Skeleton::Skeleton(const std::vector<int>& parents) :
+	parents_(parents.size(), -1),
+	depths_(parents.size(), 0),
+	order_(parents.size())
+{
+	const int count = (int)parents.size();
+	for (int i = 0; i < count; ++i)
+	{
+		parents_[i] = (parents[i] >= 0 && parents[i] < count) ? parents[i] : -1;
+	}
+
+	// 階層の深さを求め、浅い順に並べる（同じ深さは番号順）
+	for (int i = 0; i < count; ++i)
+	{
+		for (int parent = parents_[i]; parent >= 0 && depths_[i] < count; parent = parents_[parent])
+		{
+			++depths_[i];
+		}
+	}
+	for (int i = 0; i < count; ++i)
+	{
+		order_[i] = i;
+	}
+	std::stable_sort(order_.begin(), order_.end(), [&](int a, int b) { return depths_[a] < depths_[b]; });
+}
+
+// ワールド変換行列の計算
+void Skeleton::transform(const AffineMatrix local_matrices[], const AffineMatrix& world, AffineMatrix world_matrices[]) const
+{
+	for (const auto bone : order_)
+	{
+		const int parent = parents_[bone];
+		world_matrices[bone] = AffineMatrix::Multiply(local_matrices[bone], (parent >= 0) ? world_matrices[parent] : world);
+	}
+}
+
+// ボーン数の取得
+int Skeleton::bone_count() const
+{
+	return (int)parents_.size();
+}
+
+// 親ボーンの番号の取得（ルートは-1）
+int Skeleton::parent(int bone) const
+{
+	return parents_[bone];
+}
+
+// 階層の深さの取得（ルートは0）
+int Skeleton::depth(int bone) const
+{
+	return depths_[bone];
+}
+
+// 処理順の取得
+const std::vector<int>& Skeleton::order() const
+{
+	return order_;
+}
+
+// 指定した深さ以下のボーン数の取得（処理順の先頭からこの数だけが該当する）
+int Skeleton::bone_count_within_depth(int depth) const
+{
+	return (int)(std::upper_bound(order_.begin(), order_.end(), depth, [&](int value, int bone) { return value < depths_[bone]; }) - order_.begin());
+}
\ No newline at end of file
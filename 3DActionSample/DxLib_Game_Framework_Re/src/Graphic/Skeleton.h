@@ -0,0 +1,42 @@
+#ifndef SKELETON_H_
+#define SKELETON_H_
+
+#include <vector>
+#include "../Math/AffineMatrix.h"
+
+// クラス：スケルトン（ボーンの親子関係）
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// 親が必ず子より先に来るボーンの処理順を読み込み時に求めておき、
+// ローカル変換行列からワールド変換行列を1回の走査で計算する。
+class Skeleton
+{
+public:
+	// デフォルトコンストラクタ
+	Skeleton() = default;
+	// コンストラクタ（parentsは各ボーンの親番号、ルートは負の値）
+	explicit Skeleton(const std::vector<int>& parents);
+
+	// ワールド変換行列の計算
+	void transform(const AffineMatrix local_matrices[], const AffineMatrix& world, AffineMatrix world_matrices[]) const;
+
+	// ボーン数の取得
+	int bone_count() const;
+	// 親ボーンの番号の取得（ルートは-1）
+	int parent(int bone) const;
+	// 階層の深さの取得（ルートは0）
+	int depth(int bone) const;
+	// 処理順の取得
+	const std::vector<int>& order() const;
+	// 指定した深さ以下のボーン数の取得（処理順の先頭からこの数だけが該当する）
+	int bone_count_within_depth(int depth) const;
+
+private:
+	// 各ボーンの親番号
+	std::vector<int>	parents_;
+	// 各ボーンの階層の深さ
+	std::vector<int>	depths_;
+	// 親が子より先に来るボーンの処理順
+	std::vector<int>	order_;
+};
+
+#endif // !SKELETON_H_
\ No newline at end of file
@@ -0,0 +1,70 @@
+#include "SkeletonJobs.h"
+#include "WorkerPool.h"
+#include <cstring>
+
+// クラス：スケルトン変換ジョブ
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+
+// 登録されたジョブ
+std::vector<SkeletonJobs::Job> SkeletonJobs::jobs_;
+
+// 終了処理
+void SkeletonJobs::finalize()
+{
+	jobs_.clear();
+}
+
+// ジョブの登録（実行まで各配列を保持しておくこと、boundsを指定するとboxにAABBも計算する）
+void SkeletonJobs::add(const Skeleton& skeleton, const AffineMatrix local_matrices[], const Matrix& world, AffineMatrix world_matrices[],
+	const BoneBounds* bounds, BoundingBox* box, unsigned long long changed_bones[])
+{
+	jobs_.push_back(Job{ &skeleton, local_matrices, AffineMatrix(world), world_matrices, bounds, box, changed_bones });
+}
+
+// 登録したジョブを全て実行
+void SkeletonJobs::run()
+{
+	// アクターごとにボーン数が異なるため、1ジョブずつ取り出して負荷を均等にする
+	WorkerPool::parallel_for((int)jobs_.size(), 1, [](int begin, int end)
+	{
+		for (int i = begin; i < end; ++i)
+		{
+			execute(jobs_[i]);
+		}
+	});
+	jobs_.clear();
+}
+
+// ワールド変換行列を作業領域に計算し、値が変わったボーンだけ書き戻してビットを立てる
+void SkeletonJobs::transform_changed(const Job& job)
+{
+	static thread_local std::vector<AffineMatrix> scratch;
+	const int bone_count = job.skeleton->bone_count();
+	scratch.resize(bone_count);
+	job.skeleton->transform(job.local_matrices, job.world, scratch.data());
+
+	for (int bone = 0; bone < bone_count; ++bone)
+	{
+		if (std::memcmp(&scratch[bone], &job.world_matrices[bone], sizeof(AffineMatrix)) == 0) continue;
+
+		job.world_matrices[bone] = scratch[bone];
+		job.changed_bones[bone / 64] |= 1ull << (bone % 64);
+	}
+}
+
+// ジョブの実行
+void SkeletonJobs::execute(const Job& job)
+{
+	if (job.changed_bones == nullptr)
+	{
+		job.skeleton->transform(job.local_matrices, job.world, job.world_matrices);
+	}
+	else
+	{
+		transform_changed(job);
+	}
+	if (job.bounds != nullptr && job.box != nullptr)
+	{
+		job.bounds->compute(job.world_matrices, *job.box);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,49 @@
+#ifndef SKELETON_JOBS_H_
+#define SKELETON_JOBS_H_
+
+#include <vector>
+#include "../Math/AffineMatrix.h"
+#include "../Math/BoundingBox.h"
+#include "Skeleton.h"
+#include "BoneBounds.h"
+
+// クラス：スケルトン変換ジョブ
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// 各アクターのワールド変換行列の計算をジョブとして登録し、全アクターの更新後に
+// WorkerPoolのワーカースレッドとメインスレッドで並列に実行する。
+class SkeletonJobs
+{
+public:
+	// 終了処理
+	static void finalize();
+	// ジョブの登録（実行まで各配列を保持しておくこと、boundsを指定するとboxにAABBも計算する、
+	// changed_bonesを指定すると値が変わったボーンのビットを立てる）
+	static void add(const Skeleton& skeleton, const AffineMatrix local_matrices[], const Matrix& world, AffineMatrix world_matrices[],
+		const BoneBounds* bounds = nullptr, BoundingBox* box = nullptr, unsigned long long changed_bones[] = nullptr);
+	// 登録したジョブを全て実行
+	static void run();
+
+private:
+	// 構造体：ジョブ
+	struct Job
+	{
+		const Skeleton*		skeleton;			// スケルトン
+		const AffineMatrix*	local_matrices;		// ローカル変換行列
+		AffineMatrix		world;				// モデルのワールド変換行列
+		AffineMatrix*		world_matrices;		// 計算結果
+		const BoneBounds*	bounds;				// ボーンの境界球
+		BoundingBox*		box;				// AABBの計算結果
+		unsigned long long*	changed_bones;		// 値が変わったボーンのビット（64ボーンごとに1要素）
+	};
+
+	// ジョブの実行
+	static void execute(const Job& job);
+	// 値が変わったボーンを記録しながらワールド変換行列を計算
+	static void transform_changed(const Job& job);
+
+private:
+	// 登録されたジョブ
+	static std::vector<Job>			jobs_;
+};
+
+#endif // !SKELETON_JOBS_H_
\ No newline at end of file
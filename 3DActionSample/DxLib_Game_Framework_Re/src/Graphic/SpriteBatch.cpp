@@ -0,0 +1,96 @@
+#include "SpriteBatch.h"
+#include <algorithm>
+
+// クラス：スプライトバッチ
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+
+// 画像全体の追加
+void SpriteBatch::add(const SpriteTexture& texture, const Vector2& position)
+{
+	SpriteRect source;
+	source.w = texture.width;
+	source.h = texture.height;
+	add(texture, source, position, Vector2((float)texture.width, (float)texture.height));
+}
+
+// 画像の一部分の追加（sizeに合わせて拡大縮小する）
+void SpriteBatch::add(const SpriteTexture& texture, const SpriteRect& source, const Vector2& position, const Vector2& size)
+{
+	if (texture.graph == -1 || texture.width <= 0 || texture.height <= 0) return;
+
+	// テクスチャ座標
+	const float u0 = (float)source.x / texture.width;
+	const float v0 = (float)source.y / texture.height;
+	const float u1 = (float)(source.x + source.w) / texture.width;
+	const float v1 = (float)(source.y + source.h) / texture.height;
+
+	const float x0 = position.x;
+	const float y0 = position.y;
+	const float x1 = position.x + size.x;
+	const float y1 = position.y + size.y;
+	vertices_.push_back({ x0, y0, u0, v0 });
+	vertices_.push_back({ x1, y0, u1, v0 });
+	vertices_.push_back({ x0, y1, u0, v1 });
+	vertices_.push_back({ x1, y1, u1, v1 });
+
+	// 直前と同じテクスチャであれば範囲を延ばす
+	if (!runs_.empty() && runs_.back().graph == texture.graph)
+	{
+		++runs_.back().quad_count;
+		return;
+	}
+	runs_.push_back({ texture.graph, (int)vertices_.size() / 4 - 1, 1 });
+}
+
+// 画像の一部分を横に並べて追加（stepは描画位置の間隔）
+void SpriteBatch::add_tiled(const SpriteTexture& texture, const SpriteRect& source, const Vector2& position, int count, float step)
+{
+	const Vector2 size((float)source.w, (float)source.h);
+	for (int i = 0; i < count; ++i)
+	{
+		add(texture, source, Vector2(position.x + step * i, position.y), size);
+	}
+}
+
+// 描画（描画後に矩形を消去する）
+void SpriteBatch::flush(ISpriteBackend& backend)
+{
+	for (const auto& run : runs_)
+	{
+		// インデックスの上限を超える範囲は分けて描画する
+		for (int first = 0; first < run.quad_count; first += QuadsPerDraw)
+		{
+			const int count = std::min(run.quad_count - first, QuadsPerDraw);
+			backend.draw_quads(run.graph, &vertices_[(run.first_quad + first) * 4], count);
+			++stats_.draw_calls;
+		}
+		stats_.quads += run.quad_count;
+	}
+
+	clear();
+}
+
+// 矩形の消去
+void SpriteBatch::clear()
+{
+	vertices_.clear();
+	runs_.clear();
+}
+
+// 統計のリセット（フレームの開始時に呼び出す）
+void SpriteBatch::reset_stats()
+{
+	stats_ = SpriteBatchStats();
+}
+
+// 溜めている矩形の数の取得
+int SpriteBatch::size() const
+{
+	return (int)vertices_.size() / 4;
+}
+
+// 統計の取得（reset_stats()からの累計）
+const SpriteBatchStats& SpriteBatch::stats() const
+{
+	return stats_;
+}
\ No newline at end of file
@@ -0,0 +1,80 @@
+#ifndef SPRITE_BATCH_H_
+#define SPRITE_BATCH_H_
+
+#include <vector>
+#include "../Math/Vector2.h"
+#include "ISpriteBackend.h"
+
+// 構造体：スプライトバッチのテクスチャ
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+struct SpriteTexture
+{
+	int	graph{ -1 };	// グラフィックハンドル
+	int	width{ 0 };		// 画像の幅
+	int	height{ 0 };	// 画像の高さ
+};
+
+// 構造体：スプライトの転送元の矩形（ピクセル単位）
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+struct SpriteRect
+{
+	int	x{ 0 };			// 左上のx座標
+	int	y{ 0 };			// 左上のy座標
+	int	w{ 0 };			// 幅
+	int	h{ 0 };			// 高さ
+};
+
+// 構造体：スプライトバッチの統計
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+struct SpriteBatchStats
+{
+	int	quads{ 0 };			// 描画した矩形の数
+	int	draw_calls{ 0 };	// 描画回数
+};
+
+// クラス：スプライトバッチ
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// 矩形をその場で描画せずに頂点配列に溜め、同じテクスチャが続く範囲をまとめて1回で描画する。
+// 追加した順番で描画されるため、重なり順は個別に描画した場合と変わらない。
+class SpriteBatch
+{
+public:
+	// 画像全体の追加
+	void add(const SpriteTexture& texture, const Vector2& position);
+	// 画像の一部分の追加（sizeに合わせて拡大縮小する）
+	void add(const SpriteTexture& texture, const SpriteRect& source, const Vector2& position, const Vector2& size);
+	// 画像の一部分を横に並べて追加（stepは描画位置の間隔）
+	void add_tiled(const SpriteTexture& texture, const SpriteRect& source, const Vector2& position, int count, float step);
+	// 描画（描画後に矩形を消去する）
+	void flush(ISpriteBackend& backend);
+	// 矩形の消去
+	void clear();
+	// 統計のリセット（フレームの開始時に呼び出す）
+	void reset_stats();
+
+	// 溜めている矩形の数の取得
+	int size() const;
+	// 統計の取得（reset_stats()からの累計）
+	const SpriteBatchStats& stats() const;
+
+private:
+	// 構造体：同じテクスチャが続く範囲
+	struct Run
+	{
+		int	graph;			// グラフィックハンドル
+		int	first_quad;		// 最初の矩形の番号
+		int	quad_count;		// 矩形の数
+	};
+
+private:
+	// 1回の描画の矩形数の上限（16bitのインデックスで参照できる頂点数）
+	static const int			QuadsPerDraw{ 65536 / 4 };
+	// 頂点（矩形ごとに左上、右上、左下、右下）
+	std::vector<SpriteVertex>	vertices_;
+	// 同じテクスチャが続く範囲
+	std::vector<Run>			runs_;
+	// 統計
+	SpriteBatchStats			stats_;
+};
+
+#endif // !SPRITE_BATCH_H_
\ No newline at end of file
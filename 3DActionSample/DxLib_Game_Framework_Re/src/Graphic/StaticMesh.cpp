@@ -1,24 +1,24 @@
 #include "StaticMesh.h"
 #include <DxLib.h>
 
-// NXFX^eBbNbV
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：スタティックメッシュ
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
-// oCh̃f
+// バインド中のモデル
 int StaticMesh::model_{ -1 };
-// {[̃[hϊs
+// ボーンのワールド変換行列
 Matrix StaticMesh::world_matrix_{ Matrix::Identity };
-// fAZbg
+// モデルアセット
 ModelAsset StaticMesh::asset_;
 
-// 
+// 初期化
 void StaticMesh::initialize()
 {
-	// IƓ
+	// 終了処理と同じ
 	finalize();
 }
 
-// I
+// 終了処理
 void StaticMesh::finalize()
 {
 	asset_.clear();
@@ -26,33 +26,33 @@ void StaticMesh::finalize()
 	world_matrix_ = Matrix::Identity;
 }
 
-// ǂݍ
+// 読み込み
 bool StaticMesh::load(int id, const std::string& file_name)
 {
 	return asset_.load(id, file_name);
 }
 
-// 폜
+// 削除
 void StaticMesh::erase(int id)
 {
 	model_ = (model_ == asset_[id]) ? -1 : model_;
 	asset_.erase(id);
 }
 
-// bṼoCh
+// メッシュのバインド
 void StaticMesh::bind(int id)
 {
 	model_ = asset_[id];
 }
 
-// `
+// 描画
 void StaticMesh::draw()
 {
 	MV1SetMatrix(model_, world_matrix_);
 	MV1DrawModel(model_);
 }
 
-// [hϊšvZ
+// ワールド変換行列の計算
 void StaticMesh::transform(const Matrix & world)
 {
 	world_matrix_ = world;
@@ -5,32 +5,32 @@
 #include "../Math/Matrix.h"
 #include "ModelAsset.h"
 
-// NXFX^eBbNbV
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：スタティックメッシュ
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 class StaticMesh
 {
 public:
-	// 
+	// 初期化
 	static void initialize();
-	// I
+	// 終了処理
 	static void finalize();
-	// ǂݍ
+	// 読み込み
 	static bool load(int id, const std::string& file_name);
-	// 폜
+	// 削除
 	static void erase(int id);
-	// bṼoCh
+	// メッシュのバインド
 	static void bind(int id);
-	// `
+	// 描画
 	static void draw();
-	// [hϊšvZ
+	// ワールド変換行列の計算
 	static void transform(const Matrix& world);
 
 private:
-	// oCh̃f
+	// バインド中のモデル
 	static int			model_;
-	// {[̃[hϊs
+	// ボーンのワールド変換行列
 	static Matrix		world_matrix_;
-	// fAZbg
+	// モデルアセット
 	static ModelAsset	asset_;
 };
 
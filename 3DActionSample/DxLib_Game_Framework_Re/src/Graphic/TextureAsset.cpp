@@ -1,32 +1,32 @@
 #include "TextureAsset.h"
 #include <DxLib.h>
 
-// NXFeNX`AZbg
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：テクスチャアセット
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
-// fXgN^
+// デストラクタ
 TextureAsset::~TextureAsset()
 {
-	// f[^
+	// データを消去
 	clear();
 }
 
-// eNX`̓ǂݍ
+// テクスチャの読み込み
 bool TextureAsset::load(int id, const std::string& file_name)
 {
-	// ID̃f[^폜
+	// 同じIDのデータを削除
 	erase(id);
-	// ff[^ǂݍ
+	// モデルデータを読み込む
 	textures_[id] = LoadGraph(file_name.c_str());
 
-	// ǂݍ݌ʂԂ
+	// 読み込み結果を返す
 	return textures_[id] != -1;
 }
 
-// eNX`̍폜
+// テクスチャの削除
 void TextureAsset::erase(int id)
 {
-	// ỸeNX`f[^݂ꍇAf[^폜
+	// 該当のテクスチャデータが存在する場合、データを削除
 	if (textures_.count(id) > 0)
 	{
 		DeleteGraph(textures_[id]);
@@ -34,10 +34,10 @@ void TextureAsset::erase(int id)
 	}
 }
 
-// f[^̏
+// データの消去
 void TextureAsset::clear()
 {
-	// SẴeNX`f[^
+	// 全てのテクスチャデータを消去
 	for (const auto texture : textures_)
 	{
 		DeleteGraph(texture.second);
@@ -46,7 +46,7 @@ void TextureAsset::clear()
 	textures_.clear();
 }
 
-// nh̎擾
+// ハンドルの取得
 int TextureAsset::operator[](int id) const
 {
 	return textures_.at(id);
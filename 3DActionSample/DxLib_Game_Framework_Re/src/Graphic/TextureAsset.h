@@ -4,30 +4,30 @@
 #include <unordered_map>
 #include <string>
 
-// NXFeNX`AZbg
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：テクスチャアセット
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 class TextureAsset
 {
 public:
-	// ftHgRXgN^
+	// デフォルトコンストラクタ
 	TextureAsset() = default;
-	// fXgN^
+	// デストラクタ
 	~TextureAsset();
-	// eNX`̓ǂݍ
+	// テクスチャの読み込み
 	bool load(int id, const std::string& file_name);
-	// eNX`̍폜
+	// テクスチャの削除
 	void erase(int id);
-	// f[^̏
+	// データの消去
 	void clear();
-	// nh̎擾
+	// ハンドルの取得
 	int operator[](int id) const;
 
-	// Rs[֎~
+	// コピー禁止
 	TextureAsset(const TextureAsset& other) = delete;
 	TextureAsset& operator = (const TextureAsset& other) = delete;
 
 private:
-	// eNX`f[^}bv
+	// テクスチャデータマップ
 	std::unordered_map<int, int> textures_;
 };
 
@@ -0,0 +1,143 @@
+#include "WorkerPool.h"
+#include <algorithm>
+
+// クラス：ワーカースレッドプール
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+
+// ワーカースレッド
+std::vector<std::thread> WorkerPool::threads_;
+// 実行中の処理
+const std::function<void(int begin, int end)>* WorkerPool::task_{ nullptr };
+// 実行中の処理の要素数
+int WorkerPool::count_{ 0 };
+// 1回に取り出す要素数
+int WorkerPool::grain_{ 1 };
+// 次に実行する要素の番号
+std::atomic<int> WorkerPool::next_{ 0 };
+// 同期用ミューテックス
+std::mutex WorkerPool::mutex_;
+// 実行開始の通知
+std::condition_variable WorkerPool::start_;
+// 実行完了の通知
+std::condition_variable WorkerPool::done_;
+// 実行の世代番号
+int WorkerPool::generation_{ 0 };
+// 実行中のワーカースレッド数
+int WorkerPool::working_{ 0 };
+// 終了要求
+bool WorkerPool::quit_{ false };
+
+// 初期化（thread_countはメインスレッドを含むスレッド数、0でCPUのコア数）
+void WorkerPool::initialize(int thread_count)
+{
+	set_thread_count(thread_count);
+}
+
+// 終了処理
+void WorkerPool::finalize()
+{
+	stop_threads();
+}
+
+// 範囲[0, count)をgrain個ずつに分けて並列に実行（fnは分けた範囲[begin, end)ごとに呼ばれる）
+void WorkerPool::parallel_for(int count, int grain, const std::function<void(int begin, int end)>& fn)
+{
+	if (count <= 0) return;
+
+	grain = std::max(grain, 1);
+	// ワーカースレッドがない、または1回分しかない場合はメインスレッドで実行
+	if (threads_.empty() || count <= grain)
+	{
+		fn(0, count);
+		return;
+	}
+
+	// ワーカースレッドに実行開始を通知し、メインスレッドも実行に参加する
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		task_ = &fn;
+		count_ = count;
+		grain_ = grain;
+		next_ = 0;
+		working_ = (int)threads_.size();
+		++generation_;
+	}
+	start_.notify_all();
+	execute();
+
+	// 全てのワーカースレッドの完了を待つ
+	std::unique_lock<std::mutex> lock(mutex_);
+	done_.wait(lock, [] { return working_ == 0; });
+	task_ = nullptr;
+}
+
+// スレッド数の設定（メインスレッドを含む、0でCPUのコア数）
+void WorkerPool::set_thread_count(int thread_count)
+{
+	if (thread_count <= 0)
+	{
+		thread_count = std::max((int)std::thread::hardware_concurrency(), 1);
+	}
+
+	// 既存のワーカースレッドを終了させてから作り直す
+	stop_threads();
+	for (int i = 1; i < thread_count; ++i)
+	{
+		threads_.emplace_back(worker, generation_);
+	}
+}
+
+// スレッド数の取得
+int WorkerPool::thread_count()
+{
+	return (int)threads_.size() + 1;
+}
+
+// ワーカースレッドの処理（generationは作成時の世代番号）
+void WorkerPool::worker(int generation)
+{
+	for (;;)
+	{
+		// 実行開始または終了要求を待つ
+		{
+			std::unique_lock<std::mutex> lock(mutex_);
+			start_.wait(lock, [&] { return quit_ || generation_ != generation; });
+			if (quit_) return;
+			generation = generation_;
+		}
+
+		execute();
+
+		// 完了を通知
+		std::lock_guard<std::mutex> lock(mutex_);
+		if (--working_ == 0)
+		{
+			done_.notify_one();
+		}
+	}
+}
+
+// ワーカースレッドの終了
+void WorkerPool::stop_threads()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		quit_ = true;
+	}
+	start_.notify_all();
+	for (auto& thread : threads_)
+	{
+		thread.join();
+	}
+	threads_.clear();
+	quit_ = false;
+}
+
+// 未処理の範囲を取り出して実行
+void WorkerPool::execute()
+{
+	for (int begin = next_.fetch_add(grain_); begin < count_; begin = next_.fetch_add(grain_))
+	{
+		(*task_)(begin, std::min(begin + grain_, count_));
+	}
+}
\ No newline at end of file
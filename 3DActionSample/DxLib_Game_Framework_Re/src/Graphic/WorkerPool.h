@@ -0,0 +1,63 @@
+#ifndef WORKER_POOL_H_
+#define WORKER_POOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// クラス：ワーカースレッドプール
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// 初期化時に作成したワーカースレッドを使い回し、範囲の処理をメインスレッドと並列に実行する。
+// 呼び出しごとにスレッドを作らないため、毎フレームの処理でも使える。メインスレッドからのみ呼び出すこと。
+class WorkerPool
+{
+public:
+	// 初期化（thread_countはメインスレッドを含むスレッド数、0でCPUのコア数）
+	static void initialize(int thread_count = 0);
+	// 終了処理
+	static void finalize();
+	// 範囲[0, count)をgrain個ずつに分けて並列に実行（fnは分けた範囲[begin, end)ごとに呼ばれる）
+	static void parallel_for(int count, int grain, const std::function<void(int begin, int end)>& fn);
+
+	// スレッド数の設定（メインスレッドを含む、0でCPUのコア数）
+	static void set_thread_count(int thread_count);
+	// スレッド数の取得
+	static int thread_count();
+
+private:
+	// ワーカースレッドの処理（generationは作成時の世代番号）
+	static void worker(int generation);
+	// ワーカースレッドの終了
+	static void stop_threads();
+	// 未処理の範囲を取り出して実行
+	static void execute();
+
+private:
+	// ワーカースレッド
+	static std::vector<std::thread>	threads_;
+	// 実行中の処理
+	static const std::function<void(int begin, int end)>*	task_;
+	// 実行中の処理の要素数
+	static int						count_;
+	// 1回に取り出す要素数
+	static int						grain_;
+	// 次に実行する要素の番号
+	static std::atomic<int>			next_;
+	// 同期用ミューテックス
+	static std::mutex				mutex_;
+	// 実行開始の通知
+	static std::condition_variable	start_;
+	// 実行完了の通知
+	static std::condition_variable	done_;
+	// 実行の世代番号
+	static int						generation_;
+	// 実行中のワーカースレッド数
+	static int						working_;
+	// 終了要求
+	static bool						quit_;
+};
+
+#endif // !WORKER_POOL_H_
\ No newline at end of file
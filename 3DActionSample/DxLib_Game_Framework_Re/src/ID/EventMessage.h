@@ -1,21 +1,21 @@
 #ifndef EVENT_MESSAGE_H_
 #define EVENT_MESSAGE_H_
 
-// 񋓌^FCxgbZ[W
-// ҁF Qi"Jacky" Ho Siu Kij
+// 列挙型：イベントメッセージ種類
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 enum class EventMessage
 {
-	None,				// _~[
-	PlayerDead,			// vC[S
-	EnemyDead,			// GS
-	BossDead,			// {XGS
-	PlayerDamage,		// vC[_[W󂯂
-	EnemyDamage,		// G_[W󂯂
-	StageClear,			// Xe[WNA
-	GameOver,			// Q[I[o[
-	HitStop,			// qbgXgbv
-	Camera_Vibration,	// JU
-	EnemyDestroy,		// SGL
+	None,				// ダミー
+	PlayerDead,			// プレイヤー死亡
+	EnemyDead,			// 敵死亡
+	BossDead,			// ボス敵死亡
+	PlayerDamage,		// プレイヤーがダメージを受ける
+	EnemyDamage,		// 敵がダメージを受ける
+	StageClear,			// ステージクリア
+	GameOver,			// ゲームオーバー
+	HitStop,			// ヒットストップ
+	Camera_Vibration,	// カメラ振動
+	EnemyDestroy,		// 全敵キャラを消去
 };
 
 #endif // !EVENT_MESSAGE_H_
\ No newline at end of file
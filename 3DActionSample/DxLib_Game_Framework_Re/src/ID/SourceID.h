@@ -1,53 +1,56 @@
 #ifndef SOURCE_ID_H_
 #define SOURCE_ID_H_
 
-// 񋓌^FfID
-// ҁF Qi"Jacky" Ho Siu Kij
+// 列挙型：素材ID
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 enum
 {
-	// Xe[W
-	MESH_STAGE_CASTLE,		// tB[h
-	MESH_SKYBOX,			// XJC{bNX
-
-	// f
-	MESH_PALADIN,			// vC[
-	MESH_GHOUL,				// GG
-	MESH_DRAGONBOAR,		// {XG
-
-	// eNX`
-	TEXTURE_TITLELOGO,		// ^CgS
-	TEXTURE_START,			// X^[g\
-	TEXTURE_PLAYER_HPGAUGE,	// vC[̗̑̓Q[W
-	TEXTURE_PLAYER_HP,		// vC[̗͕̑\
-	TEXTURE_P1MESSAGE,		// tF[Y1ڕWbZ[W
-	TEXTURE_P2MESSAGE,		// tF[Y2ڕWbZ[W
-	TEXTURE_BOSS_HPGAUGE,	// {X̗̑̓Q[W
-	TEXTURE_BOSS_HP,		// {X̗͕̑\
-	TEXTURE_PAUSE_BG,		// |[Yʔwi
-	TEXTURE_PAUSE_TEXT,		// |[Yʕ
+	// ステージ
+	MESH_STAGE_CASTLE,		// 城フィールド
+	MESH_SKYBOX,			// スカイボックス
+
+	// モデル
+	MESH_PALADIN,			// プレイヤー
+	MESH_GHOUL,				// 雑魚敵
+	MESH_DRAGONBOAR,		// ボス敵
+
+	// テクスチャ
+	TEXTURE_TITLELOGO,		// タイトルロゴ
+	TEXTURE_START,			// スタート表示
+	TEXTURE_PLAYER_HPGAUGE,	// プレイヤーの体力ゲージ
+	TEXTURE_PLAYER_HP,		// プレイヤーの体力表示
+	TEXTURE_P1MESSAGE,		// フェーズ1目標メッセージ
+	TEXTURE_P2MESSAGE,		// フェーズ2目標メッセージ
+	TEXTURE_BOSS_HPGAUGE,	// ボスの体力ゲージ
+	TEXTURE_BOSS_HP,		// ボスの体力表示
+	TEXTURE_PAUSE_BG,		// ポーズ画面背景
+	TEXTURE_PAUSE_TEXT,		// ポーズ画面文字
+
+	// ビルボード
+	BILLBOARD_PARTICLE,		// パーティクル
 
 	// BGM
-	BGM_TITLE,				// ^CgBGM
-	BGM_STAGE,				// Xe[WBGM
-	BGM_BOSS,				// {XBGM
+	BGM_TITLE,				// タイトル画面BGM
+	BGM_STAGE,				// ステージBGM
+	BGM_BOSS,				// ボス戦BGM
 
 	// SE
-	SE_START,				// Q[X^[gSE
-	SE_SLASH,				// vC[U
-	SE_BLOCK,				// vC[h
-	SE_PLAYER_ATK_HIT,		// vC[U
-	SE_ENEMY_ATK_LIGHT,		// G̍Uij
-	SE_ENEMY_ATK_HEAVY,		// G̍Uij
-	SE_BOSS_TACKLE,			// {XG̃^bN
-	SE_BOSS_ROAR,			// {XG̙K
-
-	// VF[_[
-	SHADER_VERTEX_SHADER,			// _VF[_[
-	SHADER_PIXEL_SHADER,			// sNZVF[_[
-	SHADER_SKYBOX_VERTEX_SHADER,	// XJC{bNXp_VF[_[
-	SHADER_SKYBOX_PIXEL_SHADER,		// XJC{bNXpsNZVF[_[
-
-	// L[u}bv
+	SE_START,				// ゲームスタートSE
+	SE_SLASH,				// プレイヤー攻撃
+	SE_BLOCK,				// プレイヤー防御
+	SE_PLAYER_ATK_HIT,		// プレイヤー攻撃命中
+	SE_ENEMY_ATK_LIGHT,		// 敵の攻撃（小）
+	SE_ENEMY_ATK_HEAVY,		// 敵の攻撃（大）
+	SE_BOSS_TACKLE,			// ボス敵のタックル
+	SE_BOSS_ROAR,			// ボス敵の咆哮
+
+	// シェーダー
+	SHADER_VERTEX_SHADER,			// 頂点シェーダー
+	SHADER_PIXEL_SHADER,			// ピクセルシェーダー
+	SHADER_SKYBOX_VERTEX_SHADER,	// スカイボックス用頂点シェーダー
+	SHADER_SKYBOX_PIXEL_SHADER,		// スカイボックス用ピクセルシェーダー
+
+	// キューブマップ
 	CUBEMAP_TEST_SPECULAR_HDR,
 	CUBEMAP_TEST_DIFFUSE_HDR,
 	CUBEMAP_TEST_BRDF,
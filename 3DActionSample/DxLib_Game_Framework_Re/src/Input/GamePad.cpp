@@ -1,20 +1,20 @@
 #include "GamePad.h"
 #include <string>
 
-// Q[pbh̓NX
+// ゲームパッド入力クラス
 
-// RXgN^
+// コンストラクタ
 GamePad::GamePad() :
 	current_L_stick_{ Vector2::Zero }, current_R_stick_{ Vector2::Zero }
 {
-	// ͏ԂNA
+	// 入力状態をクリア
 	m_inputs_.clear();
 	m_onbuttons_.clear();
 	m_offbuttons_.clear();
 	m_pads_.clear();
 	m_onPOVbuttons_.clear();
 
-	// ͔
+	// 入力判定を初期化
 	m_inputs_.push_back(PAD_INPUT_DOWN);
 	m_inputs_.push_back(PAD_INPUT_UP);
 	m_inputs_.push_back(PAD_INPUT_LEFT);
@@ -32,13 +32,13 @@ GamePad::GamePad() :
 	m_inputs_.push_back(PAD_INPUT_11);
 	m_inputs_.push_back(PAD_INPUT_12);
 
-	// pbh̐ڑ
+	// パッドの接続情報を初期化
 	m_pads_.push_back(DX_INPUT_PAD1);
 	m_pads_.push_back(DX_INPUT_PAD2);
 	m_pads_.push_back(DX_INPUT_PAD3);
 	m_pads_.push_back(DX_INPUT_PAD4);
 
-	// ͏Ԃ
+	// 入力状態を初期化
 	for (auto& j : m_pads_)
 	{
 		for (auto& i : m_inputs_)
@@ -50,7 +50,7 @@ GamePad::GamePad() :
 	}
 }
 
-// ̃{^ꂽ
+// 特定のボタンが押されたか
 bool GamePad::ButtonTriggerDown(UINT button, int pad)
 {
 	Exception(pad, button);
@@ -58,7 +58,7 @@ bool GamePad::ButtonTriggerDown(UINT button, int pad)
 	return m_onbuttons_[pad][button] == 1;
 }
 
-// ̃{^ꂽ
+// 特定のボタンが離されたか
 bool GamePad::ButtonTriggerUp(UINT button, int pad)
 {
 	Exception(pad, button);
@@ -66,7 +66,7 @@ bool GamePad::ButtonTriggerUp(UINT button, int pad)
 	return m_offbuttons_[pad][button] == 1;
 }
 
-// ̃{^Ă邩
+// 特定のボタンが押されているか
 bool GamePad::ButtonStateDown(UINT button, int pad)
 {
 	Exception(pad, button);
@@ -74,7 +74,7 @@ bool GamePad::ButtonStateDown(UINT button, int pad)
 	return m_onbuttons_[pad][button] > 0;
 }
 
-// ̃{^Ă邩
+// 特定のボタンが離されているか
 bool GamePad::ButtonStateUp(UINT button, int pad)
 {
 	Exception(pad, button);
@@ -82,7 +82,7 @@ bool GamePad::ButtonStateUp(UINT button, int pad)
 	return m_offbuttons_[pad][button] > 0;
 }
 
-// ꂩ̃{^ꂽ
+// いずれかのボタンが押されたか
 bool GamePad::AnyButtonTriggerDown(int pad)
 {
 	for (auto& button : m_inputs_)
@@ -98,7 +98,7 @@ bool GamePad::AnyButtonTriggerDown(int pad)
 	return false;
 }
 
-// ꂩ̃{^ꂽ
+// いずれかのボタンが離されたか
 bool GamePad::AnyButtonTriggerUp(int pad)
 {
 	for (auto& button : m_inputs_)
@@ -114,7 +114,7 @@ bool GamePad::AnyButtonTriggerUp(int pad)
 	return false;
 }
 
-// ꂩ̃{^Ă邩
+// いずれかのボタンが押されているか
 bool GamePad::AnyButtonStateDown(int pad)
 {
 	for (auto& button : m_inputs_)
@@ -130,7 +130,7 @@ bool GamePad::AnyButtonStateDown(int pad)
 	return false;
 }
 
-// ꂩ̃{^Ă邩
+// いずれかのボタンが離されているか
 bool GamePad::AnyButtonStateUp(int pad)
 {
 	for (auto& button : m_inputs_)
@@ -146,24 +146,24 @@ bool GamePad::AnyButtonStateUp(int pad)
 	return false;
 }
 
-// POV̓͂ꂽuԂ̕擾
+// POVの入力された瞬間の方向を取得
 int GamePad::POVTriggerDown(int pad)
 {
-	// ͂ȂꍇA-1Ԃ
+	// 入力がない場合、-1を返す
 	if (m_onPOVbuttons_[pad] != 1)
 		return -1;
 
-	// ͂Ă擾
+	// 入力されてる方向を取得
 	return POVStateDown(pad);
 }
 
-// POV̓͂Ă擾
+// POVの入力されてる方向を取得
 int GamePad::POVStateDown(int pad)
 {
 	return GetJoypadPOVState(pad, 0) / 100;
 }
 
-// LXeBbN̓͋擾
+// Lスティックの入力具合を取得
 Vector2 GamePad::L_Stick(int pad)
 {
 	int x = 0, y = 0;
@@ -172,19 +172,19 @@ Vector2 GamePad::L_Stick(int pad)
 	return Vector2((float)x / 1000.0f, (float)-y / 1000.0f);
 }
 
-// t[LXeBbN̓͂擾
+// 現フレームのLスティックの入力を取得
 Vector2 GamePad::GetCurrent_L_Stick()
 {
 	return current_L_stick_;
 }
 
-// Ot[LXeBbN̓͂擾
+// 前フレームのLスティックの入力を取得
 Vector2 GamePad::GetPrevious_L_Stick()
 {
 	return previous_L_stick_;
 }
 
-// RXeBbN̓͋擾
+// Rスティックの入力具合を取得
 Vector2 GamePad::R_Stick(int pad)
 {
 	int x = 0, y = 0;
@@ -192,34 +192,34 @@ Vector2 GamePad::R_Stick(int pad)
 	return Vector2((float)x / 1000.0f, (float)-y / 1000.0f);
 }
 
-// t[RXeBbN̓͂擾
+// 現フレームのRスティックの入力を取得
 Vector2 GamePad::GetCurrent_R_Stick()
 {
 	return current_R_stick_;
 }
 
-// Ot[RXeBbN̓͂擾
+// 前フレームのRスティックの入力を取得
 Vector2 GamePad::GetPrevious_R_Stick()
 {
 	return previous_R_stick_;
 }
 
-// Q[pbh̐UJn
+// ゲームパッドの振動を開始させる
 void GamePad::VibrationStart(int power, int time, int pad)
 {
 	StartJoypadVibration(pad, power, time);
 }
 
-// Q[pbh̐U~
+// ゲームパッドの振動を停止させる
 void GamePad::VibrationStop(int pad)
 {
 	StopJoypadVibration(pad);
 }
 
-// XV
+// 更新
 void GamePad::update()
 {
-	// e{^̏ԂXV
+	// 各ボタンの状態を更新
 	for (auto& pad : m_pads_)
 	{
 		for (auto& button : m_inputs_)
@@ -245,13 +245,13 @@ void GamePad::update()
 		}
 	}
 
-	// LXeBbN̏ԂXV
+	// Lスティックの状態を更新
 	previous_L_stick_ = current_L_stick_;
 	int x = 0, y = 0;
 	GetJoypadAnalogInput(&x, &y, 1);
 	current_L_stick_ = Vector2((float)x / 1000.0f, (float)-y / 1000.0f);
 
-	// RXeBbN̏ԂXV
+	// Rスティックの状態を更新
 	previous_R_stick_ = current_R_stick_;
 	GetJoypadAnalogInputRight(&x, &y, 1);
 	current_R_stick_ = Vector2((float)x / 1000.0f, (float)-y / 1000.0f);
@@ -260,8 +260,8 @@ void GamePad::update()
 void GamePad::Exception(int pad, int button)
 {
 	if (m_onbuttons_.find(pad) == m_onbuttons_.end())
-		throw std::string("cOȂAw肵pbhԍ͎gpł܂");
+		throw std::string("残念ながら、指定したパッド番号は使用できません");
 
 	if (m_onbuttons_[pad].find(button) == m_onbuttons_[pad].end())
-		throw std::string("cOȂAw肵{^ԍ͎gpł܂");
+		throw std::string("残念ながら、指定したボタン番号は使用できません");
 }
\ No newline at end of file
@@ -7,7 +7,7 @@
 #include <vector>
 #include <array>
 
-// ڑĂQ[pbh̔ԍ
+// 接続しているゲームパッドの番号
 namespace PadNo
 {
 	const UINT Pad1 = DX_INPUT_PAD1;
@@ -16,95 +16,95 @@ namespace PadNo
 	const UINT Pad4 = DX_INPUT_PAD4;
 }
 
-// Q[pbh̃{^
-// p.s.\L[ƏĂ邪ۂ̓XeBbN̂Ƃ炵
+// ゲームパッドのボタン
+// p.s.十字キーと書いてあるが実際はスティックのことらしい
 namespace PadButton
 {
-	const UINT Left = PAD_INPUT_LEFT;		// {^
-	const UINT Right = PAD_INPUT_RIGHT;		// E{^
-	const UINT Up = PAD_INPUT_UP;			// {^
-	const UINT Down = PAD_INPUT_DOWN;		// {^
-	const UINT A = PAD_INPUT_1;				// A{^
-	const UINT B = PAD_INPUT_2;				// B{^
-	const UINT X = PAD_INPUT_3;				// X{^
-	const UINT Y = PAD_INPUT_4;				// Y{^
-	const UINT L = PAD_INPUT_5;				// L{^
-	const UINT R = PAD_INPUT_6;				// R{^
-	const UINT Back = PAD_INPUT_7;			// Back{^
-	const UINT Start = PAD_INPUT_8;			// Start{^
+	const UINT Left = PAD_INPUT_LEFT;		// 左ボタン
+	const UINT Right = PAD_INPUT_RIGHT;		// 右ボタン
+	const UINT Up = PAD_INPUT_UP;			// 上ボタン
+	const UINT Down = PAD_INPUT_DOWN;		// 下ボタン
+	const UINT A = PAD_INPUT_1;				// Aボタン
+	const UINT B = PAD_INPUT_2;				// Bボタン
+	const UINT X = PAD_INPUT_3;				// Xボタン
+	const UINT Y = PAD_INPUT_4;				// Yボタン
+	const UINT L = PAD_INPUT_5;				// Lボタン
+	const UINT R = PAD_INPUT_6;				// Rボタン
+	const UINT Back = PAD_INPUT_7;			// Backボタン
+	const UINT Start = PAD_INPUT_8;			// Startボタン
 	const UINT NUM9 = PAD_INPUT_9;
 	const UINT NUM10 = PAD_INPUT_10;
 	const UINT NUM11 = PAD_INPUT_11;
 	const UINT NUM12 = PAD_INPUT_12;
 }
 
-// Q[pbh̓NX
+// ゲームパッド入力クラス
 class GamePad
 {
 private:
-	// RXgN^
+	// コンストラクタ
 	GamePad();
-	// fXgN^
+	// デストラクタ
 	~GamePad() = default;
 
 public:
-	// Q[pbhNX̎擾
+	// ゲームパッドクラスの取得
 	static GamePad &getInstance()
 	{
 		static GamePad g;
 		return g;
 	}
 
-	// ̃{^ꂽ
+	// 特定のボタンが押されたか
 	bool ButtonTriggerDown(UINT button, int pad = PadNo::Pad1);
-	// ̃{^ꂽ
+	// 特定のボタンが離されたか
 	bool ButtonTriggerUp(UINT button, int pad = PadNo::Pad1);
-	// ̃{^Ă邩
+	// 特定のボタンが押されているか
 	bool ButtonStateDown(UINT button, int pad = PadNo::Pad1);
-	// ̃{^Ă邩
+	// 特定のボタンが離されているか
 	bool ButtonStateUp(UINT button, int pad = PadNo::Pad1);
 
-	// ꂩ̃{^ꂽ
+	// いずれかのボタンが押されたか
 	bool AnyButtonTriggerDown(int pad = PadNo::Pad1);
-	// ꂩ̃{^ꂽ
+	// いずれかのボタンが離されたか
 	bool AnyButtonTriggerUp(int pad = PadNo::Pad1);
-	// ꂩ̃{^Ă邩
+	// いずれかのボタンが押されているか
 	bool AnyButtonStateDown(int pad = PadNo::Pad1);
-	// ꂩ̃{^Ă邩
+	// いずれかのボタンが離されているか
 	bool AnyButtonStateUp(int pad = PadNo::Pad1);
 	
-	// POVi\L[j̓͂ꂽuԂ̕擾
+	// POV（十字キー）の入力された瞬間の方向を取得
 	int POVTriggerDown(int pad = PadNo::Pad1);
-	// POV̓͂Ă擾
+	// POVの入力されてる方向を取得
 	int POVStateDown(int pad = PadNo::Pad1);
 
-	// LXeBbN̓͋擾
+	// Lスティックの入力具合を取得
 	// (x = -1.0 ~ 1.0, y = -1.0 ~ 1.0)
 	Vector2 L_Stick(int pad = PadNo::Pad1);
-	// t[LXeBbN̓͂擾
+	// 現フレームのLスティックの入力を取得
 	Vector2 GetCurrent_L_Stick();
-	// Ot[LXeBbN̓͂擾
+	// 前フレームのLスティックの入力を取得
 	Vector2 GetPrevious_L_Stick();
-	// RXeBbN̓͋擾
+	// Rスティックの入力具合を取得
 	// (x = -1.0 ~ 1.0, y = -1.0 ~ 1.0)
 	Vector2 R_Stick(int pad = PadNo::Pad1);
-	// t[RXeBbN̓͂擾
+	// 現フレームのRスティックの入力を取得
 	Vector2 GetCurrent_R_Stick();
-	// Ot[RXeBbN̓͂擾
+	// 前フレームのRスティックの入力を取得
 	Vector2 GetPrevious_R_Stick();
 
-	// Q[pbh̐UJn
+	// ゲームパッドの振動を開始させる
 	void VibrationStart(int power, int time, int pad = PadNo::Pad1);
-	// Q[pbh̐U~
+	// ゲームパッドの振動を停止させる
 	void VibrationStop(int pad = PadNo::Pad1);
 
-	// XV
+	// 更新
 	void update();
 
-	// Rs[֎~
+	// コピー禁止
 	GamePad(const GamePad&) = delete;
 	GamePad& operator = (const GamePad&) = delete;
-	// ړ֎~
+	// 移動禁止
 	GamePad(GamePad&&) = delete;
 	GamePad& operator = (GamePad&&) = delete;
 
@@ -112,23 +112,23 @@ private:
 	void Exception(int pad, int button);
 
 private:
-	// {^̏ԕۑp}bv
-	std::unordered_map<int, std::unordered_map<int, int>> m_onbuttons_;			// Ă
-	std::unordered_map<int, std::unordered_map<int, int>> m_offbuttons_;		// ĂȂ
-	// \L[̏
+	// ボタンの状態保存用マップ
+	std::unordered_map<int, std::unordered_map<int, int>> m_onbuttons_;			// 押されている
+	std::unordered_map<int, std::unordered_map<int, int>> m_offbuttons_;		// 押されていない
+	// 十字キーの状態
 	std::unordered_map<int, int> m_onPOVbuttons_;
-	// Q[pbh̔ԍ
+	// ゲームパッドの番号
 	std::vector<int> m_pads_;
-	// {^͔̓
+	// ボタンの入力判定
 	std::vector<int> m_inputs_;
 
-	// t[LXeBbN
+	// 現フレームのLスティック入力
 	Vector2 current_L_stick_;
-	// Ot[LXeBbN
+	// 前フレームのLスティック入力
 	Vector2 previous_L_stick_;
-	// t[RXeBbN
+	// 現フレームのRスティック入力
 	Vector2 current_R_stick_;
-	// Ot[RXeBbN
+	// 前フレームのRスティック入力
 	Vector2 previous_R_stick_;
 };
 
@@ -1,11 +1,11 @@
 #include "Keyboard.h"
 
-// L[{[h̓NX
+// キーボード入力クラス
 
-// RXgN^
+// コンストラクタ
 Keyboard::Keyboard()
 {
-	// SẴL[Ԃ
+	// 全てのキー状態を初期化する
 	for (int i = 0; i < 256; ++i)
 	{
 		m_onkey_[i] = 0;
@@ -13,31 +13,31 @@ Keyboard::Keyboard()
 	}
 }
 
-// ̃L[ꂽ
+// 特定のキーが押されたか
 bool Keyboard::KeyTriggerDown(UINT keycode)
 {
 	return m_onkey_[keycode] == 1;
 }
 
-// ̃L[ꂽ
+// 特定のキーが離されたか
 bool Keyboard::KeyTriggerUp(UINT keycode)
 {
 	return m_offkey_[keycode] == 1;
 }
 
-// ̃L[Ă邩
+// 特定のキーが押されているか
 bool Keyboard::KeyStateDown(UINT keycode)
 {
 	return m_keycode_[keycode] == 1;
 }
 
-// ̃L[Ă邩
+// 特定のキーが離されているか
 bool Keyboard::KeyStateUp(UINT keycode)
 {
 	return m_keycode_[keycode] == 0;
 }
 
-// ꂩ̃L[ꂽ
+// いずれかのキーが押されたか
 bool Keyboard::AnyKeyTriggerDown(UINT keycode)
 {
 	for (int i = 0; i < 256; ++i)
@@ -48,7 +48,7 @@ bool Keyboard::AnyKeyTriggerDown(UINT keycode)
 	return false;
 }
 
-// ꂩ̃L[ꂽ
+// いずれかのキーが離されたか
 bool Keyboard::AnyKeyTriggerUp(UINT keycode)
 {
 	for (int i = 0; i < 256; ++i)
@@ -59,7 +59,7 @@ bool Keyboard::AnyKeyTriggerUp(UINT keycode)
 	return false;
 }
 
-// ꂩ̃L[Ă邩
+// いずれかのキーが押されているか
 bool Keyboard::AnyKeyStateDown(UINT keycode)
 {
 	for (int i = 0; i < 256; ++i)
@@ -70,7 +70,7 @@ bool Keyboard::AnyKeyStateDown(UINT keycode)
 	return false;
 }
 
-// ꂩ̃L[Ă邩
+// いずれかのキーが離されているか
 bool Keyboard::AnyKeyStateUp(UINT keycode)
 {
 	for (int i = 0; i < 256; ++i)
@@ -81,29 +81,29 @@ bool Keyboard::AnyKeyStateUp(UINT keycode)
 	return false;
 }
 
-// XV
+// 更新
 void Keyboard::update()
 {
-	// SẴL[̏Ԃ擾
+	// 全てのキーの状態を取得
 	GetHitKeyStateAll(m_keycode_);
 
-	// SẴL[̏ԂXV
+	// 全てのキーの状態を更新
 	for (int i = 0; i < 256; ++i)
 	{
 		update_key(m_keycode_[i], i);
 	}
 }
 
-// L[̏ԂXV
+// キーの状態を更新
 void Keyboard::update_key(char key, int num)
 {
-	// Ă
+	// 押されていれば
 	if (key != 0)
 	{
 		m_offkey_[num] = 0;
 		m_onkey_[num]++;
 	}
-	// ĂȂ
+	// 押されていなければ
 	else
 	{
 		m_onkey_[num] = 0;
@@ -4,171 +4,171 @@
 #include <DxLib.h>
 #include <array>
 
-// L[{[h̃L[
+// キーボードのキー
 namespace Keycode
 {
-	const UINT Back = KEY_INPUT_BACK;				// obNXy[XL[
-	const UINT Tab = KEY_INPUT_TAB;					// ^uL[
-	const UINT Return = KEY_INPUT_RETURN;			// G^[L[
-	const UINT L_Shift = KEY_INPUT_LSHIFT;			// VtgL[
-	const UINT R_Shift = KEY_INPUT_RSHIFT;			// EVtgL[
-	const UINT L_Control = KEY_INPUT_LCONTROL;		// Rg[L[
-	const UINT R_Control = KEY_INPUT_RCONTROL;		// ERg[L[
-	const UINT Escape = KEY_INPUT_ESCAPE;			// GXP[vL[
-	const UINT Space = KEY_INPUT_SPACE;				// Xy[XL[
-	const UINT PageUp = KEY_INPUT_PGUP;				// y[WAbvL[
-	const UINT PageDown = KEY_INPUT_PGDN;			// y[W_EL[
-	const UINT End = KEY_INPUT_END;					// GhL[
-	const UINT Home = KEY_INPUT_HOME;				// z[L[
-	const UINT Left = KEY_INPUT_LEFT;				// L[
-	const UINT Up = KEY_INPUT_UP;					// L[
-	const UINT Right = KEY_INPUT_RIGHT;				// EL[
-	const UINT Down = KEY_INPUT_DOWN;				// L[
-	const UINT Insert = KEY_INPUT_INSERT;			// CT[gL[
-	const UINT Delete = KEY_INPUT_DELETE;			// f[gL[
-
-	const UINT Minus = KEY_INPUT_MINUS;				// -L[
-	const UINT Yen = KEY_INPUT_YEN;					// \L[
-	const UINT PrevTrack = KEY_INPUT_PREVTRACK;		// ^L[
-	const UINT Period = KEY_INPUT_PERIOD;			// .L[
-	const UINT Slash = KEY_INPUT_SLASH;				// /L[
-	const UINT L_Alt = KEY_INPUT_LALT;				// AltL[
-	const UINT R_Alt = KEY_INPUT_RALT;				// EAltL[
-	const UINT Scroll = KEY_INPUT_SCROLL;			// ScrollLockL[
-	const UINT SemiColon = KEY_INPUT_SEMICOLON;		// ;L[
-	const UINT Colon = KEY_INPUT_COLON;				// :L[
-	const UINT L_Bracket = KEY_INPUT_LBRACKET;		// [L[
-	const UINT R_Bracket = KEY_INPUT_RBRACKET;		// ]L[
-	const UINT At = KEY_INPUT_AT;					// @L[
-	const UINT BackSlash = KEY_INPUT_BACKSLASH;		// \L[
-	const UINT Comma = KEY_INPUT_COMMA;				// ,L[
-	const UINT CapsLock = KEY_INPUT_CAPSLOCK;		// CapsLockL[
-	const UINT Pause = KEY_INPUT_PAUSE;				// PauseBreakL[
-
-	const UINT NumPad_0 = KEY_INPUT_NUMPAD0;			// eL[ 0
-	const UINT NumPad_1 = KEY_INPUT_NUMPAD1;			// eL[ 1
-	const UINT NumPad_2 = KEY_INPUT_NUMPAD2;			// eL[ 2
-	const UINT NumPad_3 = KEY_INPUT_NUMPAD3;			// eL[ 3
-	const UINT NumPad_4 = KEY_INPUT_NUMPAD4;			// eL[ 4
-	const UINT NumPad_5 = KEY_INPUT_NUMPAD5;			// eL[ 5
-	const UINT NumPad_6 = KEY_INPUT_NUMPAD6;			// eL[ 6
-	const UINT NumPad_7 = KEY_INPUT_NUMPAD7;			// eL[ 7
-	const UINT NumPad_8 = KEY_INPUT_NUMPAD8;			// eL[ 8
-	const UINT NumPad_9 = KEY_INPUT_NUMPAD9;			// eL[ 9
-	const UINT Multiply = KEY_INPUT_MULTIPLY;			// eL[ *
-	const UINT Add = KEY_INPUT_ADD;						// eL[ +
-	const UINT Subtract = KEY_INPUT_SUBTRACT;			// eL[ -
-	const UINT Decimal = KEY_INPUT_DECIMAL;				// eL[ .
-	const UINT Divide = KEY_INPUT_DIVIDE;				// eL[ /
-	const UINT NumPad_Enter = KEY_INPUT_NUMPADENTER;	// eL[ Enter
-
-	const UINT F1 = KEY_INPUT_F1;			// F1L[
-	const UINT F2 = KEY_INPUT_F2;			// F2L[
-	const UINT F3 = KEY_INPUT_F3;			// F3L[
-	const UINT F4 = KEY_INPUT_F4;			// F4L[
-	const UINT F5 = KEY_INPUT_F5;			// F5L[
-	const UINT F6 = KEY_INPUT_F6;			// F6L[
-	const UINT F7 = KEY_INPUT_F7;			// F7L[
-	const UINT F8 = KEY_INPUT_F8;			// F8L[
-	const UINT F9 = KEY_INPUT_F9;			// F9L[
-	const UINT F10 = KEY_INPUT_F10;			// F10L[
-	const UINT F11 = KEY_INPUT_F11;			// F11L[
-	const UINT F12 = KEY_INPUT_F12;			// F12L[
-
-	const UINT A = KEY_INPUT_A;				// AL[
-	const UINT B = KEY_INPUT_B;				// BL[
-	const UINT C = KEY_INPUT_C;				// CL[
-	const UINT D = KEY_INPUT_D;				// DL[
-	const UINT E = KEY_INPUT_E;				// EL[
-	const UINT F = KEY_INPUT_F;				// FL[
-	const UINT G = KEY_INPUT_G;				// GL[
-	const UINT H = KEY_INPUT_H;				// HL[
-	const UINT I = KEY_INPUT_I;				// IL[
-	const UINT J = KEY_INPUT_J;				// JL[
-	const UINT K = KEY_INPUT_K;				// KL[
-	const UINT L = KEY_INPUT_L;				// LL[
-	const UINT M = KEY_INPUT_M;				// ML[
-	const UINT N = KEY_INPUT_N;				// NL[
-	const UINT O = KEY_INPUT_O;				// OL[
-	const UINT P = KEY_INPUT_P;				// PL[
-	const UINT Q = KEY_INPUT_Q;				// QL[
-	const UINT R = KEY_INPUT_R;				// RL[
-	const UINT S = KEY_INPUT_S;				// SL[
-	const UINT T = KEY_INPUT_T;				// TL[
-	const UINT U = KEY_INPUT_U;				// UL[
-	const UINT V = KEY_INPUT_V;				// VL[
-	const UINT W = KEY_INPUT_W;				// WL[
-	const UINT X = KEY_INPUT_X;				// XL[
-	const UINT Y = KEY_INPUT_Y;				// YL[
-	const UINT Z = KEY_INPUT_Z;				// ZL[
-
-	const UINT Zero = KEY_INPUT_0;			// 0L[
-	const UINT One = KEY_INPUT_1;			// 1L[
-	const UINT Two = KEY_INPUT_2;			// 2L[
-	const UINT Three = KEY_INPUT_3;			// 3L[
-	const UINT Four = KEY_INPUT_4;			// 4L[
-	const UINT Five = KEY_INPUT_5;			// 5L[
-	const UINT Six = KEY_INPUT_6;			// 6L[
-	const UINT Seven = KEY_INPUT_7;			// 7L[
-	const UINT Eight = KEY_INPUT_8;			// 8L[
-	const UINT Nine = KEY_INPUT_9;			// 9L[
+	const UINT Back = KEY_INPUT_BACK;				// バックスペースキー
+	const UINT Tab = KEY_INPUT_TAB;					// タブキー
+	const UINT Return = KEY_INPUT_RETURN;			// エンターキー
+	const UINT L_Shift = KEY_INPUT_LSHIFT;			// 左シフトキー
+	const UINT R_Shift = KEY_INPUT_RSHIFT;			// 右シフトキー
+	const UINT L_Control = KEY_INPUT_LCONTROL;		// 左コントロールキー
+	const UINT R_Control = KEY_INPUT_RCONTROL;		// 右コントロールキー
+	const UINT Escape = KEY_INPUT_ESCAPE;			// エスケープキー
+	const UINT Space = KEY_INPUT_SPACE;				// スペースキー
+	const UINT PageUp = KEY_INPUT_PGUP;				// ページアップキー
+	const UINT PageDown = KEY_INPUT_PGDN;			// ページダウンキー
+	const UINT End = KEY_INPUT_END;					// エンドキー
+	const UINT Home = KEY_INPUT_HOME;				// ホームキー
+	const UINT Left = KEY_INPUT_LEFT;				// 左キー
+	const UINT Up = KEY_INPUT_UP;					// 上キー
+	const UINT Right = KEY_INPUT_RIGHT;				// 右キー
+	const UINT Down = KEY_INPUT_DOWN;				// 下キー
+	const UINT Insert = KEY_INPUT_INSERT;			// インサートキー
+	const UINT Delete = KEY_INPUT_DELETE;			// デリートキー
+
+	const UINT Minus = KEY_INPUT_MINUS;				// -キー
+	const UINT Yen = KEY_INPUT_YEN;					// \キー
+	const UINT PrevTrack = KEY_INPUT_PREVTRACK;		// ^キー
+	const UINT Period = KEY_INPUT_PERIOD;			// .キー
+	const UINT Slash = KEY_INPUT_SLASH;				// /キー
+	const UINT L_Alt = KEY_INPUT_LALT;				// 左Altキー
+	const UINT R_Alt = KEY_INPUT_RALT;				// 右Altキー
+	const UINT Scroll = KEY_INPUT_SCROLL;			// ScrollLockキー
+	const UINT SemiColon = KEY_INPUT_SEMICOLON;		// ;キー
+	const UINT Colon = KEY_INPUT_COLON;				// :キー
+	const UINT L_Bracket = KEY_INPUT_LBRACKET;		// [キー
+	const UINT R_Bracket = KEY_INPUT_RBRACKET;		// ]キー
+	const UINT At = KEY_INPUT_AT;					// @キー
+	const UINT BackSlash = KEY_INPUT_BACKSLASH;		// \キー
+	const UINT Comma = KEY_INPUT_COMMA;				// ,キー
+	const UINT CapsLock = KEY_INPUT_CAPSLOCK;		// CapsLockキー
+	const UINT Pause = KEY_INPUT_PAUSE;				// PauseBreakキー
+
+	const UINT NumPad_0 = KEY_INPUT_NUMPAD0;			// テンキー 0
+	const UINT NumPad_1 = KEY_INPUT_NUMPAD1;			// テンキー 1
+	const UINT NumPad_2 = KEY_INPUT_NUMPAD2;			// テンキー 2
+	const UINT NumPad_3 = KEY_INPUT_NUMPAD3;			// テンキー 3
+	const UINT NumPad_4 = KEY_INPUT_NUMPAD4;			// テンキー 4
+	const UINT NumPad_5 = KEY_INPUT_NUMPAD5;			// テンキー 5
+	const UINT NumPad_6 = KEY_INPUT_NUMPAD6;			// テンキー 6
+	const UINT NumPad_7 = KEY_INPUT_NUMPAD7;			// テンキー 7
+	const UINT NumPad_8 = KEY_INPUT_NUMPAD8;			// テンキー 8
+	const UINT NumPad_9 = KEY_INPUT_NUMPAD9;			// テンキー 9
+	const UINT Multiply = KEY_INPUT_MULTIPLY;			// テンキー *
+	const UINT Add = KEY_INPUT_ADD;						// テンキー +
+	const UINT Subtract = KEY_INPUT_SUBTRACT;			// テンキー -
+	const UINT Decimal = KEY_INPUT_DECIMAL;				// テンキー .
+	const UINT Divide = KEY_INPUT_DIVIDE;				// テンキー /
+	const UINT NumPad_Enter = KEY_INPUT_NUMPADENTER;	// テンキー Enter
+
+	const UINT F1 = KEY_INPUT_F1;			// F1キー
+	const UINT F2 = KEY_INPUT_F2;			// F2キー
+	const UINT F3 = KEY_INPUT_F3;			// F3キー
+	const UINT F4 = KEY_INPUT_F4;			// F4キー
+	const UINT F5 = KEY_INPUT_F5;			// F5キー
+	const UINT F6 = KEY_INPUT_F6;			// F6キー
+	const UINT F7 = KEY_INPUT_F7;			// F7キー
+	const UINT F8 = KEY_INPUT_F8;			// F8キー
+	const UINT F9 = KEY_INPUT_F9;			// F9キー
+	const UINT F10 = KEY_INPUT_F10;			// F10キー
+	const UINT F11 = KEY_INPUT_F11;			// F11キー
+	const UINT F12 = KEY_INPUT_F12;			// F12キー
+
+	const UINT A = KEY_INPUT_A;				// Aキー
+	const UINT B = KEY_INPUT_B;				// Bキー
+	const UINT C = KEY_INPUT_C;				// Cキー
+	const UINT D = KEY_INPUT_D;				// Dキー
+	const UINT E = KEY_INPUT_E;				// Eキー
+	const UINT F = KEY_INPUT_F;				// Fキー
+	const UINT G = KEY_INPUT_G;				// Gキー
+	const UINT H = KEY_INPUT_H;				// Hキー
+	const UINT I = KEY_INPUT_I;				// Iキー
+	const UINT J = KEY_INPUT_J;				// Jキー
+	const UINT K = KEY_INPUT_K;				// Kキー
+	const UINT L = KEY_INPUT_L;				// Lキー
+	const UINT M = KEY_INPUT_M;				// Mキー
+	const UINT N = KEY_INPUT_N;				// Nキー
+	const UINT O = KEY_INPUT_O;				// Oキー
+	const UINT P = KEY_INPUT_P;				// Pキー
+	const UINT Q = KEY_INPUT_Q;				// Qキー
+	const UINT R = KEY_INPUT_R;				// Rキー
+	const UINT S = KEY_INPUT_S;				// Sキー
+	const UINT T = KEY_INPUT_T;				// Tキー
+	const UINT U = KEY_INPUT_U;				// Uキー
+	const UINT V = KEY_INPUT_V;				// Vキー
+	const UINT W = KEY_INPUT_W;				// Wキー
+	const UINT X = KEY_INPUT_X;				// Xキー
+	const UINT Y = KEY_INPUT_Y;				// Yキー
+	const UINT Z = KEY_INPUT_Z;				// Zキー
+
+	const UINT Zero = KEY_INPUT_0;			// 0キー
+	const UINT One = KEY_INPUT_1;			// 1キー
+	const UINT Two = KEY_INPUT_2;			// 2キー
+	const UINT Three = KEY_INPUT_3;			// 3キー
+	const UINT Four = KEY_INPUT_4;			// 4キー
+	const UINT Five = KEY_INPUT_5;			// 5キー
+	const UINT Six = KEY_INPUT_6;			// 6キー
+	const UINT Seven = KEY_INPUT_7;			// 7キー
+	const UINT Eight = KEY_INPUT_8;			// 8キー
+	const UINT Nine = KEY_INPUT_9;			// 9キー
 }
 
-// L[{[h̓NX
+// キーボード入力クラス
 class Keyboard
 {
 private:
-	// RXgN^
+	// コンストラクタ
 	Keyboard();
-	// fXgN^
+	// デストラクタ
 	~Keyboard() = default;
 
 public:
-	// L[{[hNX̎擾
+	// キーボードクラスの取得
 	static Keyboard &getInstance()
 	{
 		static Keyboard k;
 		return k;
 	}
 
-	// ̃L[ꂽ
+	// 特定のキーが押されたか
 	bool KeyTriggerDown(UINT keycode);
-	// ̃L[ꂽ
+	// 特定のキーが離されたか
 	bool KeyTriggerUp(UINT keycode);
-	// ̃L[Ă邩
+	// 特定のキーが押されているか
 	bool KeyStateDown(UINT keycode);
-	// ̃L[Ă邩
+	// 特定のキーが離されているか
 	bool KeyStateUp(UINT keycode);
 
-	// ꂩ̃L[ꂽ
+	// いずれかのキーが押されたか
 	bool AnyKeyTriggerDown(UINT keycode);
-	// ꂩ̃L[ꂽ
+	// いずれかのキーが離されたか
 	bool AnyKeyTriggerUp(UINT keycode);
-	// ꂩ̃L[Ă邩
+	// いずれかのキーが押されているか
 	bool AnyKeyStateDown(UINT keycode);
-	// ꂩ̃L[Ă邩
+	// いずれかのキーが離されているか
 	bool AnyKeyStateUp(UINT keycode);
 
-	// XV
+	// 更新
 	void update();
 
-	// Rs[֎~
+	// コピー禁止
 	Keyboard(const Keyboard&) = delete;
 	Keyboard& operator = (const Keyboard&) = delete;
-	// ړ֎~
+	// 移動禁止
 	Keyboard(Keyboard&&) = delete;
 	Keyboard& operator = (Keyboard&&) = delete;
 
 private:
-	// L[̏ԂXV
+	// キーの状態を更新
 	void update_key(char key, int num);
 
 private:
-	// L[̏Ԏ擾pz
+	// キーの状態取得用配列
 	char m_keycode_[256];
-	// L[̏ԕۑpz
-	std::array<int, 256> m_onkey_;		// Ă
-	std::array<int, 256> m_offkey_;		// ĂȂ
+	// キーの状態保存用配列
+	std::array<int, 256> m_onkey_;		// 押されている
+	std::array<int, 256> m_offkey_;		// 押されていない
 };
 
 #endif // !KEYBOARD_H_
\ No newline at end of file
@@ -1,33 +1,33 @@
 #include "Mouse.h"
 
-// }EX̓NX
+// マウス入力クラス
 
-// RXgN^
+// コンストラクタ
 Mouse::Mouse() :
 	current_state_{ 0 }, previous_state_{ 0 }
 {
-	SetUseDirectInputFlag(TRUE);	// sȂƁA}EX5{^܂ł擾łȂ
+	SetUseDirectInputFlag(TRUE);	// これを実行しないと、マウス5ボタンまでしか取得できない
 }
 
-// {^Ă邩
+// ボタンが押されているか
 bool Mouse::State(UINT button)
 {
 	return (current_state_ & button) != 0;
 }
 
-// {^ꂽ
+// ボタンが押されたか
 bool Mouse::Trigger(UINT button)
 {
 	return (current_state_ & ~previous_state_ & button) != 0;
 }
 
-// {^ꂽ
+// ボタンが離されたか
 bool Mouse::Release(UINT button)
 {
 	return (~current_state_ & previous_state_ & button) != 0;
 }
 
-// }EXJ[\̈ʒu擾
+// マウスカーソルの位置を取得
 Vector2 Mouse::cursor_point()
 {
 	int x = 0, y = 0;
@@ -35,25 +35,25 @@ Vector2 Mouse::cursor_point()
 	return Vector2(float(x), float(y));
 }
 
-// }EXJ[\̈ʒuݒ
+// マウスカーソルの位置を設定
 void Mouse::cursor_point(const Vector2& point)
 {
 	SetMousePoint(int(point.x), int(point.y));
 }
 
-// }EXJ[\̕\
+// マウスカーソルの表示
 void Mouse::show_cursor()
 {
 	SetMouseDispFlag(TRUE);
 }
 
-// }EXJ[\̔\
+// マウスカーソルの非表示
 void Mouse::hide_cursor()
 {
 	SetMouseDispFlag(FALSE);
 }
 
-// XV
+// 更新
 void Mouse::update()
 {
 	previous_state_ = current_state_;
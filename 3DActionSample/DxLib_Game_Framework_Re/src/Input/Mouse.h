@@ -5,66 +5,66 @@
 #include <array>
 #include "../Math/Vector2.h"
 
-// }EX̃{^
+// マウスのボタン
 namespace MouseButton
 {
-	const UINT Left = MOUSE_INPUT_LEFT;			// {^
-	const UINT Right = MOUSE_INPUT_RIGHT;		// E{^
-	const UINT Middle = MOUSE_INPUT_MIDDLE;		// {^
-	const UINT Button4 = MOUSE_INPUT_4;			// {^4
-	const UINT Button5 = MOUSE_INPUT_5;			// {^5
-	const UINT Button6 = MOUSE_INPUT_6;			// {^6
-	const UINT Button7 = MOUSE_INPUT_7;			// {^7
-	const UINT Button8 = MOUSE_INPUT_8;			// {^8
+	const UINT Left = MOUSE_INPUT_LEFT;			// 左ボタン
+	const UINT Right = MOUSE_INPUT_RIGHT;		// 右ボタン
+	const UINT Middle = MOUSE_INPUT_MIDDLE;		// 中央ボタン
+	const UINT Button4 = MOUSE_INPUT_4;			// ボタン4
+	const UINT Button5 = MOUSE_INPUT_5;			// ボタン5
+	const UINT Button6 = MOUSE_INPUT_6;			// ボタン6
+	const UINT Button7 = MOUSE_INPUT_7;			// ボタン7
+	const UINT Button8 = MOUSE_INPUT_8;			// ボタン8
 }
 
-// }EX̓NX
+// マウス入力クラス
 class Mouse
 {
 private:
-	// RXgN^
+	// コンストラクタ
 	Mouse();
-	// fXgN^
+	// デストラクタ
 	~Mouse() = default;
 
 public:
-	// }EXNX̎擾
+	// マウスクラスの取得
 	static Mouse &getInstance()
 	{
 		static Mouse m;
 		return m;
 	}
 
-	// {^Ă邩
+	// ボタンが押されているか
 	bool State(UINT button);
-	// {^ꂽ
+	// ボタンが押されたか
 	bool Trigger(UINT button);
-	// {^ꂽ
+	// ボタンが離されたか
 	bool Release(UINT button);
 
-	// }EXJ[\̈ʒu擾
+	// マウスカーソルの位置を取得
 	Vector2 cursor_point();
-	// }EXJ[\̈ʒuݒ
+	// マウスカーソルの位置を設定
 	void cursor_point(const Vector2& point);
-	// }EXJ[\̕\
+	// マウスカーソルの表示
 	void show_cursor();
-	// }EXJ[\̔\
+	// マウスカーソルの非表示
 	void hide_cursor();
 
-	// XV
+	// 更新
 	void update();
 
-	// Rs[֎~
+	// コピー禁止
 	Mouse(const Mouse&) = delete;
 	Mouse& operator = (const Mouse&) = delete;
-	// ړ֎~
+	// 移動禁止
 	Mouse(Mouse&&) = delete;
 	Mouse& operator = (Mouse&&) = delete;
 
 private:
-	// ͏ԕۑpϐ
-	int current_state_;		// t[
-	int previous_state_;	// Ot[
+	// 入力状態保存用変数
+	int current_state_;		// 現フレーム
+	int previous_state_;	// 前フレーム
 };
 
 #endif // !MOUSE_H_
\ No newline at end of file
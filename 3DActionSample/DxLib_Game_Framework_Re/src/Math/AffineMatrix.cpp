@@ -0,0 +1,174 @@
+#include "AffineMatrix.h"
+#include "MathSIMD.h"
+#include "Vector3.h"
+#include "Quaternion.h"
+
+// 構造体：アフィン変換行列（3行4列）
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+
+// 単位行列の実体を定義
+const AffineMatrix AffineMatrix::Identity;
+
+// コンストラクタ（Matrixから変換、4列目は無視する）
+AffineMatrix::AffineMatrix(const Matrix& matrix)
+{
+	for (int i = 0; i < 3; ++i)
+	{
+		m[i][0] = matrix.m[0][i];
+		m[i][1] = matrix.m[1][i];
+		m[i][2] = matrix.m[2][i];
+		m[i][3] = matrix.m[3][i];
+	}
+}
+
+// ワールド変換行列を作成
+AffineMatrix AffineMatrix::CreateWorld(const Vector3& scale, const Quaternion& rotation, const Vector3& translation)
+{
+	float xx = rotation.x * rotation.x * 2.0f;
+	float yy = rotation.y * rotation.y * 2.0f;
+	float zz = rotation.z * rotation.z * 2.0f;
+	float xy = rotation.x * rotation.y * 2.0f;
+	float xz = rotation.x * rotation.z * 2.0f;
+	float yz = rotation.y * rotation.z * 2.0f;
+	float wx = rotation.w * rotation.x * 2.0f;
+	float wy = rotation.w * rotation.y * 2.0f;
+	float wz = rotation.w * rotation.z * 2.0f;
+
+	// Matrix::CreateWorldと同じ（拡大縮小→回転→平行移動）変換を転置した形で作成
+	AffineMatrix result;
+	result.m[0][0] = (1.0f - yy - zz) * scale.x; result.m[0][1] = (xy - wz) * scale.y; result.m[0][2] = (xz + wy) * scale.z; result.m[0][3] = translation.x;
+	result.m[1][0] = (xy + wz) * scale.x; result.m[1][1] = (1.0f - xx - zz) * scale.y; result.m[1][2] = (yz - wx) * scale.z; result.m[1][3] = translation.y;
+	result.m[2][0] = (xz - wy) * scale.x; result.m[2][1] = (yz + wx) * scale.y; result.m[2][2] = (1.0f - xx - yy) * scale.z; result.m[2][3] = translation.z;
+
+	return result;
+}
+
+// 2つの行列を連結（m1を適用した後にm2を適用）
+AffineMatrix AffineMatrix::Multiply(const AffineMatrix& m1, const AffineMatrix& m2)
+{
+	AffineMatrix result;
+
+#ifdef MATH_USE_SSE
+	// m1の各行をそのまま読み込み、m2の係数で重み付けして加算する
+	const __m128 row0 = _mm_loadu_ps(m1.m[0]);
+	const __m128 row1 = _mm_loadu_ps(m1.m[1]);
+	const __m128 row2 = _mm_loadu_ps(m1.m[2]);
+	const __m128 unit_w = _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f);
+
+	for (int i = 0; i < 3; ++i)
+	{
+		__m128 r = _mm_mul_ps(_mm_set1_ps(m2.m[i][0]), row0);
+		r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(m2.m[i][1]), row1));
+		r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(m2.m[i][2]), row2));
+		r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(m2.m[i][3]), unit_w));
+		_mm_storeu_ps(result.m[i], r);
+	}
+#else
+	for (int i = 0; i < 3; ++i)
+	{
+		for (int j = 0; j < 4; ++j)
+		{
+			result.m[i][j] = m2.m[i][0] * m1.m[0][j] + m2.m[i][1] * m1.m[1][j] + m2.m[i][2] * m1.m[2][j];
+		}
+		result.m[i][3] += m2.m[i][3];
+	}
+#endif
+
+	return result;
+}
+
+// 逆行列を求める
+AffineMatrix AffineMatrix::Invert(const AffineMatrix& matrix)
+{
+	const auto& a = matrix.m;
+
+	// 3x3部分の余因子を求める
+	float c00 = a[1][1] * a[2][2] - a[1][2] * a[2][1];
+	float c01 = a[1][2] * a[2][0] - a[1][0] * a[2][2];
+	float c02 = a[1][0] * a[2][1] - a[1][1] * a[2][0];
+	float det = a[0][0] * c00 + a[0][1] * c01 + a[0][2] * c02;
+
+	if (det == 0.0f)
+	{
+		return matrix;	// 逆行列が存在しない
+	}
+
+	float inv_det = 1.0f / det;
+
+	AffineMatrix result;
+	result.m[0][0] = c00 * inv_det;
+	result.m[0][1] = (a[0][2] * a[2][1] - a[0][1] * a[2][2]) * inv_det;
+	result.m[0][2] = (a[0][1] * a[1][2] - a[0][2] * a[1][1]) * inv_det;
+	result.m[1][0] = c01 * inv_det;
+	result.m[1][1] = (a[0][0] * a[2][2] - a[0][2] * a[2][0]) * inv_det;
+	result.m[1][2] = (a[0][2] * a[1][0] - a[0][0] * a[1][2]) * inv_det;
+	result.m[2][0] = c02 * inv_det;
+	result.m[2][1] = (a[0][1] * a[2][0] - a[0][0] * a[2][1]) * inv_det;
+	result.m[2][2] = (a[0][0] * a[1][1] - a[0][1] * a[1][0]) * inv_det;
+
+	// 平行移動成分を逆変換
+	for (int i = 0; i < 3; ++i)
+	{
+		result.m[i][3] = -(result.m[i][0] * a[0][3] + result.m[i][1] * a[1][3] + result.m[i][2] * a[2][3]);
+	}
+
+	return result;
+}
+
+// 座標を変換
+Vector3 AffineMatrix::Transform(const Vector3& position, const AffineMatrix& matrix)
+{
+	return Vector3
+	(
+		position.x * matrix.m[0][0] + position.y * matrix.m[0][1] + position.z * matrix.m[0][2] + matrix.m[0][3],
+		position.x * matrix.m[1][0] + position.y * matrix.m[1][1] + position.z * matrix.m[1][2] + matrix.m[1][3],
+		position.x * matrix.m[2][0] + position.y * matrix.m[2][1] + position.z * matrix.m[2][2] + matrix.m[2][3]
+	);
+}
+
+// 法線ベクトルを変換
+Vector3 AffineMatrix::TransformNormal(const Vector3& normal, const AffineMatrix& matrix)
+{
+	return Vector3
+	(
+		normal.x * matrix.m[0][0] + normal.y * matrix.m[0][1] + normal.z * matrix.m[0][2],
+		normal.x * matrix.m[1][0] + normal.y * matrix.m[1][1] + normal.z * matrix.m[1][2],
+		normal.x * matrix.m[2][0] + normal.y * matrix.m[2][1] + normal.z * matrix.m[2][2]
+	);
+}
+
+// 平行移動ベクトルを取得
+Vector3 AffineMatrix::Translation() const
+{
+	return Vector3(m[0][3], m[1][3], m[2][3]);
+}
+
+// Matrixに変換
+Matrix AffineMatrix::ToMatrix() const
+{
+	return Matrix
+	(
+		m[0][0], m[1][0], m[2][0], 0.0f,
+		m[0][1], m[1][1], m[2][1], 0.0f,
+		m[0][2], m[1][2], m[2][2], 0.0f,
+		m[0][3], m[1][3], m[2][3], 1.0f
+	);
+}
+
+// 演算子オーバーロード
+AffineMatrix& operator *= (AffineMatrix& m1, const AffineMatrix& m2)
+{
+	m1 = AffineMatrix::Multiply(m1, m2);
+
+	return m1;
+}
+
+AffineMatrix operator * (AffineMatrix m1, const AffineMatrix& m2)
+{
+	return m1 *= m2;
+}
+
+Vector3 operator * (const Vector3& v, const AffineMatrix& m)
+{
+	return AffineMatrix::Transform(v, m);
+}
\ No newline at end of file
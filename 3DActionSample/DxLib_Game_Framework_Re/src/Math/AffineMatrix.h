@@ -0,0 +1,82 @@
+#ifndef AFFINE_MATRIX_H_
+#define AFFINE_MATRIX_H_
+
+#include "DxLibInterop.h"
+#include "Matrix.h"
+
+// 構造体：アフィン変換行列（3行4列）
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// 4列目が常に（0, 0, 0, 1）となるMatrixを転置して保持する。
+// 各行は変換後のx, y, z成分を求める係数で、4列目が平行移動成分となる。
+
+struct Vector3;		// 3Dベクトル構造体
+struct Quaternion;	// クオータニオン構造体
+
+struct AffineMatrix
+{
+	// 単位行列
+	float m[3][4]
+	{
+		1.0f, 0.0f, 0.0f, 0.0f,
+		0.0f, 1.0f, 0.0f, 0.0f,
+		0.0f, 0.0f, 1.0f, 0.0f
+	};
+
+	// デフォルトコンストラクタ
+	AffineMatrix() = default;
+	// コンストラクタ（Matrixから変換、4列目は無視する）
+	explicit AffineMatrix(const Matrix& matrix);
+
+	// ワールド変換行列を作成
+	static AffineMatrix CreateWorld(const Vector3& scale, const Quaternion& rotation, const Vector3& translation);
+	// 2つの行列を連結（m1を適用した後にm2を適用）
+	static AffineMatrix Multiply(const AffineMatrix& m1, const AffineMatrix& m2);
+	// 逆行列を求める
+	static AffineMatrix Invert(const AffineMatrix& matrix);
+	// 座標を変換
+	static Vector3 Transform(const Vector3& position, const AffineMatrix& matrix);
+	// 法線ベクトルを変換
+	static Vector3 TransformNormal(const Vector3& normal, const AffineMatrix& matrix);
+
+	// 平行移動ベクトルを取得
+	Vector3 Translation() const;
+	// Matrixに変換
+	Matrix ToMatrix() const;
+
+	// 単位行列の定数
+	static const AffineMatrix Identity;
+
+#ifdef MATH_DXLIB_INTEROP
+	// Dxlib用変換関数
+	AffineMatrix(const DxLib::MATRIX& mat)
+	{
+		for (int i = 0; i < 3; ++i)
+		{
+			m[i][0] = mat.m[0][i];
+			m[i][1] = mat.m[1][i];
+			m[i][2] = mat.m[2][i];
+			m[i][3] = mat.m[3][i];
+		}
+	}
+	// DxLibの行列に変換
+	operator DxLib::MATRIX() const
+	{
+		DxLib::MATRIX result;
+		for (int i = 0; i < 4; ++i)
+		{
+			result.m[i][0] = m[0][i];
+			result.m[i][1] = m[1][i];
+			result.m[i][2] = m[2][i];
+			result.m[i][3] = (i == 3) ? 1.0f : 0.0f;
+		}
+		return result;
+	}
+#endif
+};
+
+// 演算子オーバーロード
+AffineMatrix& operator *= (AffineMatrix& m1, const AffineMatrix& m2);
+AffineMatrix operator * (AffineMatrix m1, const AffineMatrix& m2);
+Vector3 operator * (const Vector3& v, const AffineMatrix& m);
+
+#endif // !AFFINE_MATRIX_H_
\ No newline at end of file
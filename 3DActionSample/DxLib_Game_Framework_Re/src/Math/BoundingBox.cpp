@@ -0,0 +1,50 @@
+#include "BoundingBox.h"
+#include <cfloat>
+
+// 構造体：軸平行境界ボックス（AABB）
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+
+// デフォルトコンストラクタ（空のボックス）
+BoundingBox::BoundingBox() :
+	minimum{ FLT_MAX, FLT_MAX, FLT_MAX }, maximum{ -FLT_MAX, -FLT_MAX, -FLT_MAX }
+{ }
+
+// コンストラクタ
+BoundingBox::BoundingBox(const Vector3& minimum, const Vector3& maximum) :
+	minimum{ minimum }, maximum{ maximum }
+{ }
+
+// 空か（点を1つも含まない）
+bool BoundingBox::IsEmpty() const
+{
+	return minimum.x > maximum.x || minimum.y > maximum.y || minimum.z > maximum.z;
+}
+
+// 中心座標を求める
+Vector3 BoundingBox::Center() const
+{
+	return (minimum + maximum) * 0.5f;
+}
+
+// 各軸の半分の大きさを求める
+Vector3 BoundingBox::Extents() const
+{
+	return (maximum - minimum) * 0.5f;
+}
+
+// 外接球の半径を求める
+float BoundingBox::Radius() const
+{
+	return Extents().Length();
+}
+
+// 球を含むように拡張
+void BoundingBox::Merge(const Vector3& center, float radius)
+{
+	const Vector3 extent{ radius, radius, radius };
+	minimum = Vector3::Min(minimum, center - extent);
+	maximum = Vector3::Max(maximum, center + extent);
+}
+
+// 空のボックスの定数
+const BoundingBox BoundingBox::Empty{ };
\ No newline at end of file
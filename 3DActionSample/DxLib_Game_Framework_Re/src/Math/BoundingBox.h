@@ -0,0 +1,33 @@
+#ifndef BOUNDING_BOX_H_
+#define BOUNDING_BOX_H_
+
+#include "Vector3.h"
+
+// 構造体：軸平行境界ボックス（AABB）
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+struct BoundingBox
+{
+	Vector3 minimum;	// 最小座標
+	Vector3 maximum;	// 最大座標
+
+	// デフォルトコンストラクタ（空のボックス）
+	BoundingBox();
+	// コンストラクタ
+	BoundingBox(const Vector3& minimum, const Vector3& maximum);
+
+	// 空か（点を1つも含まない）
+	bool IsEmpty() const;
+	// 中心座標を求める
+	Vector3 Center() const;
+	// 各軸の半分の大きさを求める
+	Vector3 Extents() const;
+	// 外接球の半径を求める
+	float Radius() const;
+	// 球を含むように拡張
+	void Merge(const Vector3& center, float radius);
+
+	// 空のボックスの定数
+	static const BoundingBox Empty;
+};
+
+#endif // !BOUNDING_BOX_H_
\ No newline at end of file
@@ -4,16 +4,16 @@
 #include "../../Math/Matrix.h"
 #include <algorithm>
 
-// NXFՓˏ
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：衝突処理
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
-// ̓m̏Փˏ
+// 球体同士の衝突処理
 bool Collision::sphere_to_sphere(const Vector3& p1, const float r1, const Vector3& p2, const float r2)
 {
 	return Vector3::Distance(p1, p2) <= r1 + r2;
 }
 
-// JvZm̏Փˏ
+// カプセル同士の衝突処理
 bool Collision::capsule_to_capsule(const Vector3 p1[], const float& r1, const Vector3 p2[], const float& r2)
 {
 	VECTOR p1_start = p1[0];
@@ -24,7 +24,7 @@ bool Collision::capsule_to_capsule(const Vector3 p1[], const float& r1, const Ve
 	return HitCheck_Capsule_Capsule(p1_start, p1_end, r1, p2_start, p2_end, r2);
 }
 
-// JvZm̏Փˏ
+// カプセル同士の衝突処理
 bool Collision::capsule_to_capsule(const Vector3& p1, const Matrix& m1, const float& l1, const float& r1, const Vector3& p2, const Matrix& m2, const float& l2, const float& r2)
 {
 	Vector3 point1[2], point2[2];
@@ -36,7 +36,7 @@ bool Collision::capsule_to_capsule(const Vector3& p1, const Matrix& m1, const fl
 	return capsule_to_capsule(point1, r1, point2, r2);
 }
 
-// ̂ƃJvZ̏Փˏ
+// 球体とカプセルの衝突処理
 bool Collision::sphere_to_capsule(const Vector3& sphere, const float& sphere_r, const Vector3 capsule[], const float& capsule_r)
 {
 	VECTOR sphere_pos = sphere;
@@ -46,7 +46,7 @@ bool Collision::sphere_to_capsule(const Vector3& sphere, const float& sphere_r,
 	return Segment_Point_MinLength_Square(capsule_start, capsule_end, sphere_pos) < std::powf(sphere_r + capsule_r, 2);
 }
 
-// ̂ƃJvZ̏Փˏ
+// 球体とカプセルの衝突処理
 bool Collision::sphere_to_capsule(const Vector3& sphere_p, const float& sphere_r, const Vector3& cap_pos, const Matrix& cap_mat, const float& cap_len, const float& cap_radius)
 {
 	Vector3 points[2];
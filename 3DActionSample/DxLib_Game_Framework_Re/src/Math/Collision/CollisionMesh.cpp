@@ -2,61 +2,67 @@
 #include "CollisionTriangle.h"
 #include <DxLib.h>
 
-// NXFՓ˔pbV
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：衝突判定用メッシュ
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
-// oCh̃f
+// バインド中のモデル
 int CollisionMesh::model_{ -1 };
-// fAZbg
+// モデルアセット
 ModelAsset CollisionMesh::asset_;
+// 遮蔽物
+std::unordered_map<int, OccluderMesh> CollisionMesh::occluders_;
 
-// 
+// 初期化
 void CollisionMesh::initialize()
 {
-	// IƓ
+	// 終了処理と同じ
 	finalize();
 }
 
-// I
+// 終了処理
 void CollisionMesh::finalize()
 {
 	asset_.clear();
+	occluders_.clear();
 	model_ = -1;
 }
 
-// ǂݍ
+// 読み込み（遮蔽カリング用の遮蔽物も抽出する）
 bool CollisionMesh::load(int id, const std::string& file_name, int frame, int div_x, int div_y, int div_z)
 {
 	auto result = asset_.load(id, file_name);
 	if (result)
 	{
-		// Փ˔\z
+		// 衝突判定情報を構築
 		MV1SetupCollInfo(asset_[id], frame, div_x, div_y, div_z);
+		// 遮蔽物を抽出
+		occluders_[id] = extract_occluders(id);
 	}
 
 	return result;
 }
 
-// 폜
+// 削除
 void CollisionMesh::erase(int id)
 {
 	model_ = (model_ == asset_[id]) ? -1 : model_;
 	asset_.erase(id);
+	occluders_.erase(id);
 }
 
-// bṼoCh
+// メッシュのバインド
 void CollisionMesh::bind(int id)
 {
 	model_ = asset_[id];
 }
 
-// `
+// 描画
 void CollisionMesh::draw()
 {
 	MV1DrawModel(model_);
 }
 
-// Ƃ̏Փ˔
+// 線分との衝突判定
 bool CollisionMesh::collide_line(const Vector3& start, const Vector3& end, Vector3* point, Vector3* normal)
 {
 	const auto coll_poly = MV1CollCheck_Line(model_, 0, start, end);
@@ -77,15 +83,15 @@ bool CollisionMesh::collide_line(const Vector3& start, const Vector3& end, Vecto
 	return false;
 }
 
-// ̂Ƃ̏Փ˔
+// 球体との衝突判定
 bool CollisionMesh::collide_sphere(const Vector3& center, float radius, Vector3* result)
 {
-	// ƃbV̏Փ˔
+	// 球とメッシュの衝突判定
 	const auto coll_poly = MV1CollCheck_Sphere(model_, 0, center, radius);
-	// Փ˂ĂȂΏI
+	// 衝突していなければ終了
 	if (coll_poly.HitNum == 0)
 	{
-		// Փ˔f[^̍폜
+		// 衝突判定データの削除
 		MV1CollResultPolyDimTerminate(coll_poly);
 
 		return false;
@@ -93,30 +99,30 @@ bool CollisionMesh::collide_sphere(const Vector3& center, float radius, Vector3*
 
 	VECTOR result_center = center;
 
-	// |S̕ʏɋ̂̈ʒu␳
+	// ポリゴンの平面上に球体の位置を補正する
 	for (int i = 0; i < coll_poly.HitNum; ++i)
 	{
-		// ʏ̍W̍ŋߓ_W߂
+		// 平面上の座標の最近点座標を求める
 		PLANE_POINT_RESULT plane_point_result;
 		Plane_Point_Analyse(
 			&coll_poly.Dim[i].Position[0],
 			&coll_poly.Dim[i].Normal,
 			&result_center,
 			&plane_point_result);
-		// Op`̓ɕʏ̍W̍ŋߓ_W邩ׂ
+		// 三角形の内部に平面上の座標の最近点座標があるか調べる
 		if (CollisionTriangle(
 			coll_poly.Dim[i].Position[0],
 			coll_poly.Dim[i].Position[1],
 			coll_poly.Dim[i].Position[2]).is_inside(plane_point_result.Plane_MinDist_Pos))
 		{
-			// @xNg̕֋̂o
+			// 法線ベクトルの方向へ球体を押し出す
 			const auto distance = std::sqrt(plane_point_result.Plane_Pnt_MinDist_Square);
 			const auto offset = VScale(coll_poly.Dim[i].Normal, radius - distance);
 			result_center = VAdd(result_center, offset);
 		}
 	}
 
-	// |S̃GbWɏdȂĂꍇɈʒu␳
+	// ポリゴンのエッジに重なっている場合に位置を補正する
 	for (int i = 0; i < coll_poly.HitNum; ++i)
 	{
 		CollisionTriangle(
@@ -124,50 +130,50 @@ bool CollisionMesh::collide_sphere(const Vector3& center, float radius, Vector3*
 			coll_poly.Dim[i].Position[1],
 			coll_poly.Dim[i].Position[2]).collide_edge_and_sphere(result_center, radius, &result_center);
 	}
-	// ␳̍Wݒ
+	// 補正後の座標を設定
 	if (result != nullptr)
 	{
 		*result = result_center;
 	}
-	// Փ˔f[^̍폜
+	// 衝突判定データの削除
 	MV1CollResultPolyDimTerminate(coll_poly);
 
 	return true;
 }
 
-// JvZƂ̏Փ˔
+// カプセルとの衝突判定
 bool CollisionMesh::collide_capsule(const Vector3& start, const Vector3& end, float radius, Vector3* result)
 {
-	bool is_hit = false;			// Փ˔
-	VECTOR result_start = start;	// JvZn_̍W
-	VECTOR result_end = end;		// JvZI_̍W
+	bool is_hit = false;			// 衝突判定
+	VECTOR result_start = start;	// カプセル始点の座標
+	VECTOR result_end = end;		// カプセル終点の座標
 
-	// I_ijɂĉos
+	// 終点（足元）を基準にして押し出し判定を行う
 	if (collide_sphere(result_end, radius, result))
 	{
-		// 牟oxNg쐬
+		// 足元から押し出しベクトルを作成
 		Vector3 move_vec_bottom = VSub(result_end, end);
-		// JvZ̎n_ɉoKp
+		// カプセルの始点に押し出しを適用
 		result_start = VAdd(result_start, move_vec_bottom);
 		is_hit = true;
 	}
 
-	// o_̎n_AI_ۑ
+	// 足元押し出し時点の始点、終点情報を保存
 	VECTOR save_start = result_start;
 	VECTOR save_end = result_end;
 
-	// n_ijɂĉos
+	// 始点（頭）を基準にして押し出し判定を行う
 	if (collide_sphere(result_start, radius, result))
 	{
-		//̉oxNg쐬
+		//頭からの押し出しベクトルを作成
 		Vector3 move_vec_top = VSub(result_start, save_start);
-		//JvZ̏I_ɉoKp
+		//カプセルの終点に押し出しを適用
 		result_end = VAdd(result_end, move_vec_top);
 		is_hit = true;
 	}
-	// ܂łŎn_I_̉o
+	// ここまでで始点終点の押し出しが完了
 
-	// JvZƃbV̏Փ˔
+	// カプセルとメッシュの衝突判定
 	MV1_COLL_RESULT_POLY_DIM HitDim = MV1CollCheck_Capsule(model_, -1, result_start, result_end, radius);
 	for (int i = 0; i < HitDim.HitNum; i++)
 	{
@@ -194,22 +200,55 @@ bool CollisionMesh::collide_capsule(const Vector3& start, const Vector3& end, fl
 		}
 	}
 
-	// ␳̍Wݒ
+	// 補正後の座標を設定
 	if (is_hit) *result = (result_start + result_end) * 0.5f;
-	// Փ˔f[^̍폜
+	// 衝突判定データの削除
 	MV1CollResultPolyDimTerminate(HitDim);
 
 	return is_hit;
 }
 
-// bVɊ܂܂钸_̃[JWł̍ől̎擾
+// 遮蔽物の取得（読み込まれていなければ空のメッシュ）
+const OccluderMesh& CollisionMesh::occluders(int id)
+{
+	static const OccluderMesh empty;
+	const auto found = occluders_.find(id);
+	return (found != occluders_.end()) ? found->second : empty;
+}
+
+// メッシュに含まれる頂点のローカル座標での最大値の取得
 Vector3 CollisionMesh::max_position()
 {
 	return MV1GetMeshMaxPosition(model_, 0);
 }
 
-// bVɊ܂܂钸_̃[JWł̍ŏl̎擾
+// メッシュに含まれる頂点のローカル座標での最小値の取得
 Vector3 CollisionMesh::min_position()
 {
 	return MV1GetMeshMinPosition(model_, 0);
 }
+
+
+// 遮蔽物の抽出
+OccluderMesh CollisionMesh::extract_occluders(int id)
+{
+	const int model = asset_[id];
+
+	// 参照用メッシュから全ポリゴンを取得し、面積の大きいものだけを残す
+	MV1SetupReferenceMesh(model, -1, TRUE);
+	const auto mesh = MV1GetReferenceMesh(model, -1, TRUE);
+	std::vector<Vector3> positions(mesh.VertexNum);
+	for (int i = 0; i < mesh.VertexNum; ++i)
+	{
+		positions[i] = mesh.Vertexs[i].Position;
+	}
+	std::vector<int> indices;
+	indices.reserve((size_t)mesh.PolygonNum * 3);
+	for (int i = 0; i < mesh.PolygonNum; ++i)
+	{
+		indices.insert(indices.end(), mesh.Polygons[i].VIndex, mesh.Polygons[i].VIndex + 3);
+	}
+	MV1TerminateReferenceMesh(model, -1, TRUE);
+
+	return OccluderMesh::create(positions, indices, OccluderTriangleMax);
+}
\ No newline at end of file
@@ -2,43 +2,56 @@
 #define COLLISION_MESH_H_
 
 #include <string>
+#include <unordered_map>
 #include "../../Math/Vector3.h"
 #include "../../Graphic/ModelAsset.h"
+#include "../../Graphic/OcclusionBuffer.h"
 
-// NXFՓ˔pbV
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：衝突判定用メッシュ
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 class CollisionMesh
 {
 public:
-	// 
+	// 初期化
 	static void initialize();
-	// I
+	// 終了処理
 	static void finalize();
-	// ǂݍ
+	// 読み込み（遮蔽カリング用の遮蔽物も抽出する）
 	static bool load(int id, const std::string& file_name, int frame = -1, int div_x = 32, int div_y = 8, int div_z = 32);
-	// 폜
+	// 削除
 	static void erase(int id);
-	// bṼoCh
+	// メッシュのバインド
 	static void bind(int id);
-	// `
+	// 描画
 	static void draw();
-	// Ƃ̏Փ˔
+	// 線分との衝突判定
 	static bool collide_line(const Vector3& start, const Vector3& end, Vector3* point = nullptr, Vector3* normal = nullptr);
-	// ̂Ƃ̏Փ˔
+	// 球体との衝突判定
 	static bool collide_sphere(const Vector3& center, float radius, Vector3* result = nullptr);
-	// JvZƂ̏Փ˔
+	// カプセルとの衝突判定
 	static bool collide_capsule(const Vector3& start, const Vector3& end, float radius, Vector3* result = nullptr);
 
-	// bVɊ܂܂钸_̃[JWł̍ől̎擾
+	// 遮蔽物の取得（読み込まれていなければ空のメッシュ）
+	static const OccluderMesh& occluders(int id);
+
+	// メッシュに含まれる頂点のローカル座標での最大値の取得
 	static Vector3 max_position();
-	// bVɊ܂܂钸_̃[JWł̍ŏl̎擾
+	// メッシュに含まれる頂点のローカル座標での最小値の取得
 	static Vector3 min_position();
 
 private:
-	// oCh̃f
+	// 遮蔽物の抽出
+	static OccluderMesh extract_occluders(int id);
+
+private:
+	// 遮蔽物として使う三角形の最大数（面積の大きい順）
+	static const int	OccluderTriangleMax{ 2048 };
+	// バインド中のモデル
 	static int			model_;
-	// fAZbg
+	// モデルアセット
 	static ModelAsset	asset_;
+	// 遮蔽物
+	static std::unordered_map<int, OccluderMesh>	occluders_;
 };
 
 #endif // !COLLISION_MESH_H_
\ No newline at end of file
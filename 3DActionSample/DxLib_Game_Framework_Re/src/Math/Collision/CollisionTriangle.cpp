@@ -1,22 +1,22 @@
 #include "CollisionTriangle.h"
 #include <cmath>
 
-// NXFՓ˔pOp`
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：衝突判定用三角形
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
-// RXgN^
+// コンストラクタ
 CollisionTriangle::CollisionTriangle(const VECTOR& p1, const VECTOR& p2, const VECTOR& p3) :
 	points_{ p1, p2, p3 }
 { }
 
-// Op`̓ɍW݂͑邩
+// 三角形の内側に座標は存在するか
 bool CollisionTriangle::is_inside(const VECTOR& point) const
 {
-	// Op`̏dSWvZ
+	// 三角形の重心座標を計算
 	float w1, w2, w3;
 	TriangleBarycenter(points_[0], points_[1], points_[2], point, &w1, &w2, &w3);
 
-	// dSW͎Op`ɂ邩
+	// 重心座標は三角形内にあるか
 	return (0.0f <= w1 && w1 <= 1.0f) && (0.0f <= w2 && w2 <= 1.0f) && (0.0f <= w3 && w3 <= 1.0f);
 }
 
@@ -2,19 +2,19 @@
 #include "MathHelper.h"
 #include <algorithm>
 
-// \́FJ[
-// ҁF Qi"Jacky" Ho Siu Kij
+// 構造体：カラー
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
-// 萔̎̂`
-const Color Color::Black(0.0f, 0.0f, 0.0f, 1.0f);	// 
-const Color Color::White(1.0f, 1.0f, 1.0f, 1.0f);	// 
+// 定数の実体を定義
+const Color Color::Black(0.0f, 0.0f, 0.0f, 1.0f);	// 黒
+const Color Color::White(1.0f, 1.0f, 1.0f, 1.0f);	// 白
 
-// RXgN^
+// コンストラクタ
 Color::Color(float r, float g, float b, float a) :
 	r{ r }, g{ g }, b{ b }, a{ a }
 { }
 
-// `
+// 線形補間
 Color Color::Lerp(const Color& v1, const Color& v2, float amount)
 {
 	return Color
@@ -26,7 +26,7 @@ Color Color::Lerp(const Color& v1, const Color& v2, float amount)
 	);
 }
 
-// veyA̍łႢl܂ރJ[߂
+// 一致する各成分ペアの最も低い値を含むカラーを求める
 Color Color::Min(const Color& v1, const Color& v2)
 {
 	return Color
@@ -38,7 +38,7 @@ Color Color::Min(const Color& v1, const Color& v2)
 	);
 }
 
-// veyA̍łl܂ރJ[߂
+// 一致する各成分ペアの最も高い値を含むカラーを求める
 Color Color::Max(const Color& v1, const Color& v2)
 {
 	return Color
@@ -50,7 +50,7 @@ Color Color::Max(const Color& v1, const Color& v2)
 	);
 }
 
-// l𐧌
+// 数値を制限
 Color Color::Clamp(const Color& value, const Color& min, const Color& max)
 {
 	return Color
@@ -62,7 +62,7 @@ Color Color::Clamp(const Color& value, const Color& min, const Color& max)
 	);
 }
 
-// ZqI[o[[h
+// 演算子オーバーロード
 Color& operator += (Color & c1, const Color & c2)
 {
 	c1.r += c2.r;
@@ -1,35 +1,35 @@
 #ifndef COLOR_H_
 #define COLOR_H_
 
-// \́FJ[
-// ҁF Qi"Jacky" Ho Siu Kij
+// 構造体：カラー
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 struct Color
 {
-	float r{ 1.0f };	// Ԑ
-	float g{ 1.0f };	// ΐ
-	float b{ 1.0f };	// 
-	float a{ 1.0f };	// At@
+	float r{ 1.0f };	// 赤成分
+	float g{ 1.0f };	// 緑成分
+	float b{ 1.0f };	// 青成分
+	float a{ 1.0f };	// アルファ成分
 
-	// ftHgRXgN^
+	// デフォルトコンストラクタ
 	Color() = default;
-	// RXgN^
+	// コンストラクタ
 	Color(float r, float g, float b, float a);
 
-	// `
+	// 線形補間
 	static Color Lerp(const Color& v1, const Color& v2, float amount);
-	// veyA̍łႢl܂ރJ[߂
+	// 一致する各成分ペアの最も低い値を含むカラーを求める
 	static Color Min(const Color& v1, const Color& v2);
-	// veyA̍łl܂ރJ[߂
+	// 一致する各成分ペアの最も高い値を含むカラーを求める
 	static Color Max(const Color& v1, const Color& v2);
-	// l𐧌
+	// 数値を制限
 	static Color Clamp(const Color& value, const Color& min = Color(0.0f, 0.0f, 0.0f, 0.0f), const Color& max = Color(1.0f, 1.0f, 1.0f, 1.0f));
 
-	// 萔
+	// 定数
 	static const Color Black;	// Color(0, 0, 0, 1)
 	static const Color White;   // Color(1, 1, 1, 1)
 };
 
-// ZqI[o[[h
+// 演算子オーバーロード
 Color& operator += (Color& c1, const Color& c2);
 Color& operator -= (Color& c1, const Color& c2);
 Color& operator *= (Color& c1, const Color& c2);
@@ -1,42 +1,42 @@
 #include "CountdownTimer.h"
 #include <algorithm>
 
-// NXFJEg_E^C}[iDeltaTimej
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：カウントダウンタイマー（DeltaTime式）
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
-// RXgN^iԂ̓t[œ́j
+// コンストラクタ（時間はフレーム数で入力）
 CountdownTimer::CountdownTimer(float time)
 {
 	time_set_ = time;
 }
 
-// XV
+// 更新
 void CountdownTimer::update(float delta_time)
 {
-	// ݒ肳ꂽԂ̊ԁAݎԂZ
+	// 設定された時間の間、現在時間を減算
 	time_current_ = std::max(time_current_ - delta_time, 0.0f);
 }
 
-// Zbg
+// リセット
 void CountdownTimer::reset()
 {
 	time_current_ = time_set_;
 }
 
-// ZbgiԂ̍Đݒ܂߁j
+// リセット（時間の再設定を含め）
 void CountdownTimer::reset_time(float time)
 {
 	time_set_ = time;
 	reset();
 }
 
-// I
+// 強制終了
 void CountdownTimer::shut()
 {
 	time_current_ = 0.0f;
 }
 
-// ^CAEg
+// タイムアウトか
 bool CountdownTimer::is_time_out() const
 {
 	return time_current_ <= 0.0f;
@@ -1,28 +1,28 @@
 #ifndef COUNTDOWN_TIMER_H_
 #define COUNTDOWN_TIMER_H_
 
-// NXFJEg_E^C}[iDeltaTimej
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：カウントダウンタイマー（DeltaTime式）
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
 class CountdownTimer
 {
 public:
-	// RXgN^iԂ̓t[œ́j
+	// コンストラクタ（時間はフレーム数で入力）
 	CountdownTimer(float time);
-	// XV
+	// 更新
 	void update(float delta_time);
-	// Zbg
+	// リセット
 	void reset();
-	// ZbgiԂ̍Đݒ܂߁j
+	// リセット（時間の再設定を含め）
 	void reset_time(float time);
-	// I
+	// 強制終了
 	void shut();
-	// ^CAEg
+	// タイムアウトか
 	bool is_time_out() const;
 
 private:
-	float time_current_{ 0.0f };	// ݂̎
-	float time_set_{ 0.0f };		// ݒ莞
+	float time_current_{ 0.0f };	// 現在の時間
+	float time_set_{ 0.0f };		// 設定時間
 };
 
 #endif // !COUNTDOWN_TIMER_H_
\ No newline at end of file
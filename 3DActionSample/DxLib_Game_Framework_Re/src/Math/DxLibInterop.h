@@ -0,0 +1,18 @@
+#ifndef DXLIB_INTEROP_H_
+#define DXLIB_INTEROP_H_
+
+// 数学ライブラリとDxLibとの相互変換の設定
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// MATH_NO_DXLIBを定義すると、DxLibに依存せずに数学ライブラリをビルドできる。
+// 座標系はDxLibと同じ左手系を既定とし、MATH_RIGHT_HANDEDを定義すると右手系になる。
+
+#ifndef MATH_NO_DXLIB
+#include <DxLib.h>
+#define MATH_DXLIB_INTEROP
+#endif
+
+#ifndef MATH_RIGHT_HANDED
+#define MATH_LEFT_HANDED
+#endif
+
+#endif // !DXLIB_INTEROP_H_
@@ -0,0 +1,103 @@
+#include "Frustum.h"
+#include "Vector3.h"
+#include "Matrix.h"
+#include "MathSIMD.h"
+#include <cmath>
+
+// 構造体：視錐台
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+
+// 視野変換行列 * 透視変換行列から視錐台を作成
+Frustum Frustum::CreateFromMatrix(const Matrix& view_projection)
+{
+	// 行ベクトル形式なので、クリップ座標の各成分は行列の列との内積になる
+	const auto& m = view_projection.m;
+	float column[4][4];
+	for (int i = 0; i < 4; ++i)
+	{
+		for (int j = 0; j < 4; ++j)
+		{
+			column[i][j] = m[j][i];
+		}
+	}
+
+	Frustum result;
+	for (int j = 0; j < 4; ++j)
+	{
+		result.planes[Left][j] = column[3][j] + column[0][j];
+		result.planes[Right][j] = column[3][j] - column[0][j];
+		result.planes[Bottom][j] = column[3][j] + column[1][j];
+		result.planes[Top][j] = column[3][j] - column[1][j];
+		result.planes[Near][j] = column[2][j];
+		result.planes[Far][j] = column[3][j] - column[2][j];
+	}
+
+	// 法線の長さで正規化し、係数dを距離として扱えるようにする
+	for (auto& plane : result.planes)
+	{
+		const float length = std::sqrt(plane[0] * plane[0] + plane[1] * plane[1] + plane[2] * plane[2]);
+		if (length > 0.0f)
+		{
+			for (auto& value : plane)
+			{
+				value /= length;
+			}
+		}
+	}
+
+	return result;
+}
+
+// 球と交差しているか（内側に含まれる場合も含む）
+bool Frustum::Intersects(const Vector3& center, float radius) const
+{
+	for (const auto& plane : planes)
+	{
+		if (plane[0] * center.x + plane[1] * center.y + plane[2] * center.z + plane[3] < -radius)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+// 複数の球を一括判定し、交差している球の番号をvisibleに格納（交差している球の数を返す）
+int Frustum::Intersects(const float x[], const float y[], const float z[], const float radius[], int count, int visible[]) const
+{
+	int result = 0;
+	int i = 0;
+#ifdef MATH_USE_SSE
+	// 4個ずつ、全平面の内側（距離 >= -半径）にあるかを判定
+	__m128 a[PlaneCount], b[PlaneCount], c[PlaneCount], d[PlaneCount];
+	for (int p = 0; p < PlaneCount; ++p)
+	{
+		a[p] = _mm_set1_ps(planes[p][0]);
+		b[p] = _mm_set1_ps(planes[p][1]);
+		c[p] = _mm_set1_ps(planes[p][2]);
+		d[p] = _mm_set1_ps(planes[p][3]);
+	}
+	for (; i + 4 <= count; i += 4)
+	{
+		const __m128 px = _mm_loadu_ps(&x[i]);
+		const __m128 py = _mm_loadu_ps(&y[i]);
+		const __m128 pz = _mm_loadu_ps(&z[i]);
+		const __m128 nr = _mm_sub_ps(_mm_setzero_ps(), _mm_loadu_ps(&radius[i]));
+		__m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+		for (int p = 0; p < PlaneCount; ++p)
+		{
+			const __m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(a[p], px), _mm_mul_ps(b[p], py)), _mm_add_ps(_mm_mul_ps(c[p], pz), d[p]));
+			inside = _mm_and_ps(inside, _mm_cmpge_ps(distance, nr));
+		}
+		const int mask = _mm_movemask_ps(inside);
+		for (int j = 0; j < 4; ++j)
+		{
+			if (mask & (1 << j)) visible[result++] = i + j;
+		}
+	}
+#endif
+	for (; i < count; ++i)
+	{
+		if (Intersects(Vector3(x[i], y[i], z[i]), radius[i])) visible[result++] = i;
+	}
+	return result;
+}
\ No newline at end of file
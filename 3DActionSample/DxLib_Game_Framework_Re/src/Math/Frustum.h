@@ -0,0 +1,39 @@
+#ifndef FRUSTUM_H_
+#define FRUSTUM_H_
+
+// 構造体：視錐台
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// 各平面は内側が正となる ax + by + cz + d の係数（正規化済み）で保持する。
+
+struct Vector3;		// 3Dベクトル構造体
+struct Matrix;		// 行列構造体
+
+struct Frustum
+{
+	// 平面の番号
+	enum Plane
+	{
+		Left,		// 左
+		Right,		// 右
+		Bottom,		// 下
+		Top,		// 上
+		Near,		// 手前
+		Far,		// 奥
+		PlaneCount,	// 平面の数
+	};
+
+	// 平面の係数（a, b, c, d）
+	float planes[PlaneCount][4]{ };
+
+	// デフォルトコンストラクタ
+	Frustum() = default;
+
+	// 視野変換行列 * 透視変換行列から視錐台を作成
+	static Frustum CreateFromMatrix(const Matrix& view_projection);
+	// 球と交差しているか（内側に含まれる場合も含む）
+	bool Intersects(const Vector3& center, float radius) const;
+	// 複数の球を一括判定し、交差している球の番号をvisibleに格納（交差している球の数を返す）
+	int Intersects(const float x[], const float y[], const float z[], const float radius[], int count, int visible[]) const;
+};
+
+#endif // !FRUSTUM_H_
\ No newline at end of file
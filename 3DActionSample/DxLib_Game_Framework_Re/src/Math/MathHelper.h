@@ -1,34 +1,34 @@
 #ifndef MATH_HELPER_H_
 #define MATH_HELPER_H_
 
-// NXFvZ⏕
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：計算補助
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 class MathHelper
 {
 public:
-	// ~̒萔
+	// 円周率の定数
 	static const float PI;
 
-	// WApxɕϊ
+	// ラジアンを角度に変換
 	static float radian_to_degree(float radian);
-	// pxWAɕϊ
+	// 角度をラジアンに変換
 	static float degree_to_radian(float degree);
-	// `
+	// 線形補間
 	static float lerp(float start, float end, float t);
-	// l𐧌
+	// 数値を制限
 	static float clamp(float value, float min, float max);
 
-	// TC߂
+	// サインを求める
 	static float sin(float degree);
-	// RTC߂
+	// コサインを求める
 	static float cos(float degree);
-	// ^WFg߂
+	// タンジェントを求める
 	static float tan(float degree);
-	// TCpx֋tZ
+	// サインから角度へ逆算
 	static float a_sin(float s);
-	// RTCpx֋tZ
+	// コサインから角度へ逆算
 	static float a_cos(float c);
-	// ^WFgpx֋tZ
+	// タンジェントから角度へ逆算
 	static float a_tan(float y, float x);
 };
 
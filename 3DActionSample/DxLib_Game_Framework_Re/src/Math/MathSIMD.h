@@ -0,0 +1,14 @@
+#ifndef MATH_SIMD_H_
+#define MATH_SIMD_H_
+
+// SIMD命令の使用設定
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+
+// x86/x64ではSSE2を使用する（それ以外とMATH_NO_SSEの定義時はスカラー処理にフォールバック）
+#if !defined(MATH_NO_SSE) && (defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__))
+#define MATH_USE_SSE
+#include <xmmintrin.h>
+#include <emmintrin.h>
+#endif
+
+#endif // !MATH_SIMD_H_
\ No newline at end of file
@@ -2,12 +2,77 @@
 #include "MathHelper.h"
 #include "Vector3.h"
 #include "Quaternion.h"
+#include "MathSIMD.h"
+#include <cmath>
 
-// \́Fϊs
-// ҁF Qi"Jacky" Ho Siu Kij
+// 構造体：変換行列
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
-// 萔̎̂`
-// Pʍs
+#ifdef MATH_USE_SSE
+// SIMD演算用の補助関数
+// 要素の並び替え（x, y, z, wは読み出す要素番号）
+template <int x, int y, int z, int w>
+static inline __m128 swizzle(__m128 v)
+{
+	return _mm_shuffle_ps(v, v, _MM_SHUFFLE(w, z, y, x));
+}
+
+// x, y, z成分のみを残すマスク
+static inline __m128 xyz_mask()
+{
+	return _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+}
+
+// 外積（w成分は0）
+static inline __m128 cross(__m128 a, __m128 b)
+{
+	return _mm_sub_ps
+	(
+		_mm_mul_ps(swizzle<1, 2, 0, 3>(a), swizzle<2, 0, 1, 3>(b)),
+		_mm_mul_ps(swizzle<2, 0, 1, 3>(a), swizzle<1, 2, 0, 3>(b))
+	);
+}
+
+// 内積
+static inline float dot(__m128 a, __m128 b)
+{
+	__m128 r = _mm_mul_ps(a, b);
+	r = _mm_add_ps(r, swizzle<2, 3, 0, 1>(r));
+	r = _mm_add_ps(r, swizzle<1, 0, 3, 2>(r));
+	return _mm_cvtss_f32(r);
+}
+
+// 2x2行列の積 A * B
+static inline __m128 mat2_mul(__m128 a, __m128 b)
+{
+	return _mm_add_ps(_mm_mul_ps(a, swizzle<0, 3, 0, 3>(b)), _mm_mul_ps(swizzle<1, 0, 3, 2>(a), swizzle<2, 1, 2, 1>(b)));
+}
+
+// 2x2行列の積 adj(A) * B
+static inline __m128 mat2_adj_mul(__m128 a, __m128 b)
+{
+	return _mm_sub_ps(_mm_mul_ps(swizzle<3, 3, 0, 0>(a), b), _mm_mul_ps(swizzle<1, 1, 2, 2>(a), swizzle<2, 3, 0, 1>(b)));
+}
+
+// 2x2行列の積 A * adj(B)
+static inline __m128 mat2_mul_adj(__m128 a, __m128 b)
+{
+	return _mm_sub_ps(_mm_mul_ps(a, swizzle<3, 0, 3, 0>(b)), _mm_mul_ps(swizzle<1, 0, 3, 2>(a), swizzle<2, 1, 2, 1>(b)));
+}
+
+// 逆行列の平行移動成分を求めて格納（r0～r2は逆行列の回転部分）
+static inline void store_inverse_translation(Matrix& result, __m128 r0, __m128 r1, __m128 r2, const Matrix& matrix)
+{
+	__m128 t = _mm_mul_ps(r0, _mm_set1_ps(matrix.m[3][0]));
+	t = _mm_add_ps(t, _mm_mul_ps(r1, _mm_set1_ps(matrix.m[3][1])));
+	t = _mm_add_ps(t, _mm_mul_ps(r2, _mm_set1_ps(matrix.m[3][2])));
+	t = _mm_sub_ps(_mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f), _mm_and_ps(t, xyz_mask()));
+	_mm_storeu_ps(result.m[3], t);
+}
+#endif
+
+// 定数の実体を定義
+// 単位行列
 const Matrix Matrix::Identity
 (
 	1.0f, 0.0f, 0.0f, 0.0f,
@@ -15,7 +80,7 @@ const Matrix Matrix::Identity
 	0.0f, 0.0f, 1.0f, 0.0f,
 	0.0f, 0.0f, 0.0f, 1.0f
 );
-// [s
+// ゼロ行列
 const Matrix Matrix::Zero
 (
 	0.0f, 0.0f, 0.0f, 0.0f,
@@ -24,7 +89,7 @@ const Matrix Matrix::Zero
 	0.0f, 0.0f, 0.0f, 0.0f
 );
 
-// RXgN^
+// コンストラクタ
 Matrix::Matrix(float m11, float m12, float m13, float m14,
 	float m21, float m22, float m23, float m24,
 	float m31,float m32, float m33, float m34,
@@ -36,7 +101,7 @@ Matrix::Matrix(float m11, float m12, float m13, float m14,
 	m[3][0] = m41; m[3][1] = m42; m[3][2] = m43; m[3][3] = m44;
 }
 
-// gks쐬
+// 拡大縮小行列を作成
 Matrix Matrix::CreateScale(const Vector3& scale)
 {
 	return Matrix
@@ -48,7 +113,7 @@ Matrix Matrix::CreateScale(const Vector3& scale)
 	);
 }
 
-// sړs쐬
+// 平行移動行列を作成
 Matrix Matrix::CreateTranslation(const Vector3& translation)
 {
 	return Matrix
@@ -60,13 +125,13 @@ Matrix Matrix::CreateTranslation(const Vector3& translation)
 	);
 }
 
-// Cӂ̃xNg̎͂]s쐬
+// 任意のベクトルの周囲を回転する行列を作成
 Matrix Matrix::CreateFromAxisAngle(const Vector3& axis, float degree)
 {
 	return CreateFromQuaternion(Quaternion(axis, degree));
 }
 
-// NH[^jI]s쐬
+// クォータニオンから回転行列を作成
 Matrix Matrix::CreateFromQuaternion(const Quaternion& rotate)
 {
 	float xx = rotate.x * rotate.x * 2.0f;
@@ -88,7 +153,7 @@ Matrix Matrix::CreateFromQuaternion(const Quaternion& rotate)
 	);
 }
 
-// w肵[Asb`A[ōs쐬
+// 指定したヨー、ピッチ、ロールで行列を作成
 Matrix Matrix::CreateFromYawPitchRoll(float yaw, float pitch, float roll)
 {
 	return Matrix::CreateRotationZ(roll)
@@ -96,7 +161,7 @@ Matrix Matrix::CreateFromYawPitchRoll(float yaw, float pitch, float roll)
 		* Matrix::CreateRotationY(yaw);
 }
 
-// x܂̉]s쐬
+// x軸まわりの回転行列を作成
 Matrix Matrix::CreateRotationX(float degree)
 {
 	float sin = MathHelper::sin(degree);
@@ -111,7 +176,7 @@ Matrix Matrix::CreateRotationX(float degree)
 	);
 }
 
-// y܂̉]s쐬
+// y軸まわりの回転行列を作成
 Matrix Matrix::CreateRotationY(float degree)
 {
 	float sin = MathHelper::sin(degree);
@@ -126,7 +191,7 @@ Matrix Matrix::CreateRotationY(float degree)
 	);
 }
 
-// z܂̉]s쐬
+// z軸まわりの回転行列を作成
 Matrix Matrix::CreateRotationZ(float degree)
 {
 	float sin = MathHelper::sin(degree);
@@ -141,20 +206,20 @@ Matrix Matrix::CreateRotationZ(float degree)
 	);
 }
 
-// [hϊs쐬
+// ワールド変換行列を作成
 Matrix Matrix::CreateWorld(const Vector3& scale, const Quaternion& rotation, const Vector3& translation)
 {
 	return CreateScale(scale) * CreateFromQuaternion(rotation) * CreateTranslation(translation);
 }
 
-// [hϊs쐬
+// ワールド変換行列を作成
 Matrix Matrix::CreateWorld(const Vector3& scale, const Matrix& rotation, const Vector3& translation)
 {
 	return CreateScale(scale) * rotation * CreateTranslation(translation);
 }
 
-#ifdef DX_LIB_H
-// [hϊs쐬
+#ifdef MATH_LEFT_HANDED
+// ワールド変換行列を作成
 Matrix Matrix::CreateWorld(const Vector3& position, const Vector3& forward, const Vector3& up)
 {
 	Vector3 l = Vector3::Normalize(Vector3::Cross(forward, up));
@@ -164,7 +229,7 @@ Matrix Matrix::CreateWorld(const Vector3& position, const Vector3& forward, cons
 	return Matrix(Matrix::Identity).Forward(f).Up(u).Left(l).Translation(position);
 }
 
-// is쐬
+// 遠景行列を作成
 Matrix Matrix::CreatePerspectiveFieldOfView(float fov, float aspect, float zn, float zf)
 {
 	float h = 1.0f / MathHelper::tan(fov / 2.0f);
@@ -179,7 +244,7 @@ Matrix Matrix::CreatePerspectiveFieldOfView(float fov, float aspect, float zn, f
 	);
 }
 
-// s쐬
+// 視野行列を作成
 Matrix Matrix::CreateLookAt(const Vector3& position, const Vector3& target, const Vector3& up)
 {
 	Vector3 z = Vector3::Normalize(target - position);
@@ -196,7 +261,7 @@ Matrix Matrix::CreateLookAt(const Vector3& position, const Vector3& target, cons
 }
 
 #else
-// [hϊs쐬
+// ワールド変換行列を作成
 Matrix Matrix::CreateWorld(const Vector3& position, const Vector3& forward, const Vector3& up)
 {
 	Vector3 l = Vector3::Normalize(Vector3::Cross(up, forward));
@@ -206,7 +271,7 @@ Matrix Matrix::CreateWorld(const Vector3& position, const Vector3& forward, cons
 	return Matrix(Matrix::Identity).Forward(f).Up(u).Left(l).Translation(position);
 }
 
-// is쐬
+// 遠景行列を作成
 Matrix Matrix::CreatePerspectiveFieldOfView(float fov, float aspect, float zn, float zf)
 {
 	float ys = 1.0f / MathHelper::tan(fov / 2.0f);
@@ -221,7 +286,7 @@ Matrix Matrix::CreatePerspectiveFieldOfView(float fov, float aspect, float zn, f
 	);
 }
 
-// s쐬
+// 視野行列を作成
 Matrix Matrix::CreateLookAt(const Vector3 & position, const Vector3 & target, const Vector3 & up)
 {
 	Vector3 z = Vector3::Normalize(position - target);
@@ -238,7 +303,7 @@ Matrix Matrix::CreateLookAt(const Vector3 & position, const Vector3 & target, co
 }
 #endif
 
-// XN[Ws쐬
+// スクリーン座標行列を作成
 Matrix Matrix::CreateScreen(float x, float y, float width, float height)
 {
 	float w = width / 2.0f;
@@ -253,9 +318,168 @@ Matrix Matrix::CreateScreen(float x, float y, float width, float height)
 	);
 }
 
-// ts߂
+// 逆行列を求める（行列の種類に応じて最適な計算方法を選択）
 Matrix Matrix::Invert(const Matrix& matrix)
 {
+	switch (matrix.Kind())
+	{
+	case MatrixKind::Rigid:		return InvertFast(matrix);
+	case MatrixKind::Affine:	return InvertAffine(matrix);
+	default:					return InvertGeneral(matrix);
+	}
+}
+
+// 逆行列を求める（回転と平行移動のみ）
+Matrix Matrix::InvertFast(const Matrix& matrix)
+{
+#ifdef MATH_USE_SSE
+	// 回転部分を転置（4列目は0のまま）
+	__m128 r0 = _mm_loadu_ps(matrix.m[0]);
+	__m128 r1 = _mm_loadu_ps(matrix.m[1]);
+	__m128 r2 = _mm_loadu_ps(matrix.m[2]);
+	__m128 r3 = _mm_setzero_ps();
+	_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+	// 平行移動成分を逆変換
+	Matrix result;
+	_mm_storeu_ps(result.m[0], r0);
+	_mm_storeu_ps(result.m[1], r1);
+	_mm_storeu_ps(result.m[2], r2);
+	store_inverse_translation(result, r0, r1, r2, matrix);
+
+	return result;
+#else
+	// 回転行列の逆行列を作成
+	Matrix inv_rotation = Matrix::Transpose(Matrix(matrix).Translation(Vector3::Zero));
+	// 平行移動成分を逆変換
+	Vector3 inv_translation = Vector3::Transform(-matrix.Translation(), inv_rotation);
+	// 逆行列を作成
+	return inv_rotation.Translation(inv_translation);
+#endif
+}
+
+// 逆行列を求める（4列目が（0, 0, 0, 1）のアフィン変換のみ）
+Matrix Matrix::InvertAffine(const Matrix& matrix)
+{
+#ifdef MATH_USE_SSE
+	// 各行の外積から余因子行列を求める（4列目は0）
+	const __m128 a = _mm_and_ps(_mm_loadu_ps(matrix.m[0]), xyz_mask());
+	const __m128 b = _mm_and_ps(_mm_loadu_ps(matrix.m[1]), xyz_mask());
+	const __m128 c = _mm_and_ps(_mm_loadu_ps(matrix.m[2]), xyz_mask());
+	__m128 r0 = cross(b, c);
+	__m128 r1 = cross(c, a);
+	__m128 r2 = cross(a, b);
+	__m128 r3 = _mm_setzero_ps();
+
+	// 行列式
+	const float det = dot(a, r0);
+	if (det == 0.0f)
+	{
+		return matrix;	// 逆行列が存在しない
+	}
+
+	// 余因子行列を転置して行列式で割る
+	_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+	const __m128 inv_det = _mm_set1_ps(1.0f / det);
+	r0 = _mm_mul_ps(r0, inv_det);
+	r1 = _mm_mul_ps(r1, inv_det);
+	r2 = _mm_mul_ps(r2, inv_det);
+
+	// 平行移動成分を逆変換
+	Matrix result;
+	_mm_storeu_ps(result.m[0], r0);
+	_mm_storeu_ps(result.m[1], r1);
+	_mm_storeu_ps(result.m[2], r2);
+	store_inverse_translation(result, r0, r1, r2, matrix);
+
+	return result;
+#else
+	const auto& a = matrix.m;
+	float c00 = a[1][1] * a[2][2] - a[1][2] * a[2][1];
+	float c01 = a[1][2] * a[2][0] - a[1][0] * a[2][2];
+	float c02 = a[1][0] * a[2][1] - a[1][1] * a[2][0];
+	float det = a[0][0] * c00 + a[0][1] * c01 + a[0][2] * c02;
+
+	if (det == 0.0f)
+	{
+		return matrix;	// 逆行列が存在しない
+	}
+
+	float inv_det = 1.0f / det;
+
+	Matrix result
+	(
+		c00 * inv_det, (a[0][2] * a[2][1] - a[0][1] * a[2][2]) * inv_det, (a[0][1] * a[1][2] - a[0][2] * a[1][1]) * inv_det, 0.0f,
+		c01 * inv_det, (a[0][0] * a[2][2] - a[0][2] * a[2][0]) * inv_det, (a[0][2] * a[1][0] - a[0][0] * a[1][2]) * inv_det, 0.0f,
+		c02 * inv_det, (a[0][1] * a[2][0] - a[0][0] * a[2][1]) * inv_det, (a[0][0] * a[1][1] - a[0][1] * a[1][0]) * inv_det, 0.0f,
+		0.0f, 0.0f, 0.0f, 1.0f
+	);
+
+	// 平行移動成分を逆変換
+	return result.Translation(-Vector3::TransformNormal(matrix.Translation(), result));
+#endif
+}
+
+// 逆行列を求める（一般の4x4行列）
+Matrix Matrix::InvertGeneral(const Matrix& matrix)
+{
+#ifdef MATH_USE_SSE
+	// 2x2の小行列に分割して求める
+	// | A B |
+	// | C D |
+	const __m128 m0 = _mm_loadu_ps(matrix.m[0]);
+	const __m128 m1 = _mm_loadu_ps(matrix.m[1]);
+	const __m128 m2 = _mm_loadu_ps(matrix.m[2]);
+	const __m128 m3 = _mm_loadu_ps(matrix.m[3]);
+	const __m128 A = _mm_movelh_ps(m0, m1);
+	const __m128 B = _mm_movehl_ps(m1, m0);
+	const __m128 C = _mm_movelh_ps(m2, m3);
+	const __m128 D = _mm_movehl_ps(m3, m2);
+
+	// 各小行列の行列式（|A|, |B|, |C|, |D|）
+	const __m128 det_sub = _mm_sub_ps
+	(
+		_mm_mul_ps(_mm_shuffle_ps(m0, m2, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(m1, m3, _MM_SHUFFLE(3, 1, 3, 1))),
+		_mm_mul_ps(_mm_shuffle_ps(m0, m2, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_ps(m1, m3, _MM_SHUFFLE(2, 0, 2, 0)))
+	);
+	const __m128 det_a = swizzle<0, 0, 0, 0>(det_sub);
+	const __m128 det_b = swizzle<1, 1, 1, 1>(det_sub);
+	const __m128 det_c = swizzle<2, 2, 2, 2>(det_sub);
+	const __m128 det_d = swizzle<3, 3, 3, 3>(det_sub);
+
+	const __m128 d_c = mat2_adj_mul(D, C);
+	const __m128 a_b = mat2_adj_mul(A, B);
+	__m128 x = _mm_sub_ps(_mm_mul_ps(det_d, A), mat2_mul(B, d_c));
+	__m128 w = _mm_sub_ps(_mm_mul_ps(det_a, D), mat2_mul(C, a_b));
+	__m128 y = _mm_sub_ps(_mm_mul_ps(det_b, C), mat2_mul_adj(D, a_b));
+	__m128 z = _mm_sub_ps(_mm_mul_ps(det_c, B), mat2_mul_adj(A, d_c));
+
+	// 行列式 |M| = |A||D| + |B||C| - tr((A#B)(D#C))
+	__m128 tr = _mm_mul_ps(a_b, swizzle<0, 2, 1, 3>(d_c));
+	tr = _mm_add_ps(tr, swizzle<2, 3, 0, 1>(tr));
+	tr = _mm_add_ps(tr, swizzle<1, 0, 3, 2>(tr));
+	const __m128 det = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(det_a, det_d), _mm_mul_ps(det_b, det_c)), tr);
+
+	if (_mm_cvtss_f32(det) == 0.0f)
+	{
+		return matrix;	// 逆行列が存在しない
+	}
+
+	const __m128 inv_det = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), det);
+	x = _mm_mul_ps(x, inv_det);
+	y = _mm_mul_ps(y, inv_det);
+	z = _mm_mul_ps(z, inv_det);
+	w = _mm_mul_ps(w, inv_det);
+
+	// 余因子の並びを戻して格納
+	Matrix result;
+	_mm_storeu_ps(result.m[0], _mm_shuffle_ps(x, y, _MM_SHUFFLE(1, 3, 1, 3)));
+	_mm_storeu_ps(result.m[1], _mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 2, 0, 2)));
+	_mm_storeu_ps(result.m[2], _mm_shuffle_ps(z, w, _MM_SHUFFLE(1, 3, 1, 3)));
+	_mm_storeu_ps(result.m[3], _mm_shuffle_ps(z, w, _MM_SHUFFLE(0, 2, 0, 2)));
+
+	return result;
+#else
 	float a0 = matrix.m[0][0] * matrix.m[1][1] - matrix.m[0][1] * matrix.m[1][0];
 	float a1 = matrix.m[0][0] * matrix.m[1][2] - matrix.m[0][2] * matrix.m[1][0];
 	float a2 = matrix.m[0][0] * matrix.m[1][3] - matrix.m[0][3] * matrix.m[1][0];
@@ -272,7 +496,7 @@ Matrix Matrix::Invert(const Matrix& matrix)
 
 	if (det == 0.0f)
 	{
-		return matrix;	// ts񂪑݂Ȃ
+		return matrix;	// 逆行列が存在しない
 	}
 
 	float invDet = 1.0f / det;
@@ -296,20 +520,37 @@ Matrix Matrix::Invert(const Matrix& matrix)
 		(-matrix.m[3][0] * a3 + matrix.m[3][1] * a1 - matrix.m[3][2] * a0) * invDet,
 		(matrix.m[2][0] * a3 - matrix.m[2][1] * a1 + matrix.m[2][2] * a0) * invDet
 	);
+#endif
 }
 
-// ts߂i]ƕsړ̂݁j
-Matrix Matrix::InvertFast(const Matrix& matrix)
+// 行列の種類を判定
+MatrixKind Matrix::Kind() const
 {
-	// ]s̋ts쐬
-	Matrix inv_rotation = Matrix::Transpose(Matrix(matrix).Translation(Vector3::Zero));
-	// sړtϊ
-	Vector3 inv_translation = Vector3::Transform(-matrix.Translation(), inv_rotation);
-	// ts쐬
-	return inv_rotation.Translation(inv_translation);
+	// 4列目が（0, 0, 0, 1）でなければ射影変換
+	if (m[0][3] != 0.0f || m[1][3] != 0.0f || m[2][3] != 0.0f || m[3][3] != 1.0f)
+	{
+		return MatrixKind::Projective;
+	}
+
+	// 回転部分の各軸が正規直交であれば剛体変換
+	const float Tolerance = 1.0e-5f;
+	const Vector3 l = Left();
+	const Vector3 u = Up();
+	const Vector3 f(m[2][0], m[2][1], m[2][2]);
+	if (std::fabs(l.LengthSquared() - 1.0f) <= Tolerance
+		&& std::fabs(u.LengthSquared() - 1.0f) <= Tolerance
+		&& std::fabs(f.LengthSquared() - 1.0f) <= Tolerance
+		&& std::fabs(Vector3::Dot(l, u)) <= Tolerance
+		&& std::fabs(Vector3::Dot(u, f)) <= Tolerance
+		&& std::fabs(Vector3::Dot(f, l)) <= Tolerance)
+	{
+		return MatrixKind::Rigid;
+	}
+
+	return MatrixKind::Affine;
 }
 
-// sƗւ
+// 行と列を入れ替える
 Matrix Matrix::Transpose(const Matrix& matrix)
 {
 	return Matrix
@@ -321,7 +562,7 @@ Matrix Matrix::Transpose(const Matrix& matrix)
 	);
 }
 
-// `ԏ
+// 線形補間処理
 Matrix Matrix::Lerp(const Matrix& v1, const Matrix& v2, float t)
 {
 	Vector3 scale = Vector3::One;// Vector3::Lerp(v1.Scale(), v2.Scale(), t);
@@ -331,21 +572,30 @@ Matrix Matrix::Lerp(const Matrix& v1, const Matrix& v2, float t)
 	return Matrix::CreateWorld(scale, rotate, translation);
 }
 
-// s𕪉
+// 行列を分解
 void Matrix::Decompose(Vector3& scale, Quaternion& rotation, Vector3& translation) const
 {
+	// 剛体変換であれば正規化を省略
+	if (Kind() == MatrixKind::Rigid)
+	{
+		scale = Vector3::One;
+		rotation = Quaternion::CreateFromRotationMatrix(*this);
+		translation = Translation();
+		return;
+	}
+
 	scale = Scale();
 	rotation = Rotation();
 	translation = Translation();
 }
 
-// K
+// 正規化
 Matrix Matrix::NormalizeRotationMatrix(const Matrix& matrix)
 {
 	return Matrix(matrix).NormalizeRotationMatrix();
 }
 
-// K
+// 正規化
 Matrix& Matrix::NormalizeRotationMatrix()
 {
 	Vector3 f(m[2][0], m[2][1], m[2][2]);
@@ -362,14 +612,14 @@ Matrix& Matrix::NormalizeRotationMatrix()
 	return *this;
 }
 
-#ifdef DX_LIB_H
-// OxNg擾
+#ifdef MATH_LEFT_HANDED
+// 前方ベクトルを取得
 Vector3 Matrix::Forward() const
 {
 	return Vector3(-m[2][0], -m[2][1], -m[2][2]);
 }
 
-// OxNgݒ
+// 前方ベクトルを設定
 Matrix& Matrix::Forward(const Vector3& forward)
 {
 	m[2][0] = -forward.x; m[2][1] = -forward.y; m[2][2] = -forward.z;
@@ -378,114 +628,114 @@ Matrix& Matrix::Forward(const Vector3& forward)
 }
 
 #else
-// OxNg擾
+// 前方ベクトルを取得
 Vector3 Matrix::Forward() const
 {
 	return Vector3(m[2][0], m[2][1], m[2][2]);
 }
 
-// OxNgݒ
+// 前方ベクトルを設定
 Matrix& Matrix::Forward(const Vector3& forward)
 {
 	m[2][0] = forward.x; m[2][1] = forward.y; m[2][2] = forward.z;
 	return *this;
 }
 
-#endif // DX_LIB_H
+#endif // MATH_LEFT_HANDED
 
-// xNg擾
+// 後方ベクトルを取得
 Vector3 Matrix::Backward() const
 {
 	return -Forward();
 }
 
-// xNgݒ
+// 後方ベクトルを設定
 Matrix& Matrix::Backward(const Vector3& backward) {
 	return Forward(-backward);
 }
 
-// xNg擾
+// 上方ベクトルを取得
 Vector3 Matrix::Up() const
 {
 	return Vector3(m[1][0], m[1][1], m[1][2]);
 }
 
-// xNgݒ
+// 上方ベクトルを設定
 Matrix& Matrix::Up(const Vector3& up)
 {
 	m[1][0] = up.x; m[1][1] = up.y; m[1][2] = up.z;
 	return *this;
 }
 
-// xNg擾
+// 下方ベクトルを取得
 Vector3 Matrix::Down() const
 {
 	return -Up();
 }
 
-// xNgݒ
+// 下方ベクトルを設定
 Matrix& Matrix::Down(const Vector3& down)
 {
 	return Up(-down);
 }
 
-// xNg擾
+// 左ベクトルを取得
 Vector3 Matrix::Left() const
 {
 	return Vector3(m[0][0], m[0][1], m[0][2]);
 }
 
-// xNgݒ
+// 左ベクトルを設定
 Matrix& Matrix::Left(const Vector3& left)
 {
 	m[0][0] = left.x; m[0][1] = left.y; m[0][2] = left.z;
 	return *this;
 }
 
-// ExNg擾
+// 右ベクトルを取得
 Matrix& Matrix::Right(const Vector3& right)
 {
 	return Left(-right);
 }
 
-// ExNgݒ
+// 右ベクトルを設定
 Vector3 Matrix::Right() const
 {
 	return -Left();
 }
 
-// sړxNg擾
+// 平行移動ベクトルを取得
 Vector3 Matrix::Translation() const
 {
 	return Vector3(m[3][0], m[3][1], m[3][2]);
 }
 
-// sړxNgݒ
+// 平行移動ベクトルを設定
 Matrix& Matrix::Translation(const Vector3& translation)
 {
 	m[3][0] = translation.x; m[3][1] = translation.y; m[3][2] = translation.z;
 	return *this;
 }
 
-// XP[l擾
+// スケール値を取得
 Vector3 Matrix::Scale() const
 {
 	return Vector3(Left().Length(), Up().Length(), Forward().Length());
 }
 
-// ]̎擾
+// 回転の取得
 Quaternion Matrix::Rotation() const
 {
 	return Quaternion::CreateFromRotationMatrix(NormalizeRotationMatrix(*this));
 }
 
-// ]s̎擾
+// 回転行列の取得
 Matrix Matrix::RotationMatrix() const
 {
 	return Matrix(*this).Translation(Vector3::Zero);
 }
 
-// ZqI[o[[h
+// 演算子オーバーロード
 Matrix& operator += (Matrix& m1, const Matrix& m2)
 {
 	for (int i = 0; i < 4; ++i)
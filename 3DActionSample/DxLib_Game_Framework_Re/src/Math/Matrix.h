@@ -1,17 +1,25 @@
 #ifndef MATRIX_H_
 #define MATRIX_H_
 
-#include <DxLib.h>
+#include "DxLibInterop.h"
 
-// \́Fϊs
-// ҁF Qi"Jacky" Ho Siu Kij
+// 構造体：変換行列
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
-struct Vector3;		// 3DxNg\
-struct Quaternion;	// NI[^jI\
+struct Vector3;		// 3Dベクトル構造体
+struct Quaternion;	// クオータニオン構造体
+
+// 列挙型：変換行列の種類
+enum class MatrixKind
+{
+	Rigid,		// 回転と平行移動のみ
+	Affine,		// 拡大縮小・せん断を含むアフィン変換
+	Projective,	// 射影変換を含む一般の行列
+};
 
 struct Matrix
 {
-	// Pʍs
+	// 単位行列
 	float m[4][4]
 	{
 		1.0f, 0.0f, 0.0f, 0.0f,
@@ -20,9 +28,9 @@ struct Matrix
 		0.0f, 0.0f, 0.0f, 1.0f
 	};
 
-	// ftHgRXgN^
+	// デフォルトコンストラクタ
 	Matrix() = default;
-	// RXgN^
+	// コンストラクタ
 	Matrix
 	(
 		float m11, float m12, float m13, float m14,
@@ -31,101 +39,107 @@ struct Matrix
 		float m41, float m42, float m43, float m44
 	);
 
-	// gks쐬
+	// 拡大縮小行列を作成
 	static Matrix CreateScale(const Vector3& scale);
-	// sړs쐬
+	// 平行移動行列を作成
 	static Matrix CreateTranslation(const Vector3& translation);
-	// Cӂ̃xNg̎͂]s쐬
+	// 任意のベクトルの周囲を回転する行列を作成
 	static Matrix CreateFromAxisAngle(const Vector3& axis, float degree);
-	// NH[^jI]s쐬
+	// クォータニオンから回転行列を作成
 	static Matrix CreateFromQuaternion(const Quaternion& rotate);
-	// w肵[Asb`A[ōs쐬
+	// 指定したヨー、ピッチ、ロールで行列を作成
 	static Matrix CreateFromYawPitchRoll(float yaw, float pitch, float roll);
-	// x܂̉]s쐬
+	// x軸まわりの回転行列を作成
 	static Matrix CreateRotationX(float degree);
-	// y܂̉]s쐬
+	// y軸まわりの回転行列を作成
 	static Matrix CreateRotationY(float degree);
-	// z܂̉]s쐬
+	// z軸まわりの回転行列を作成
 	static Matrix CreateRotationZ(float degree);
 
-	// [hϊs쐬
+	// ワールド変換行列を作成
 	static Matrix CreateWorld(const Vector3& scale, const Quaternion& rotation, const Vector3& translation);
-	// [hϊs쐬
+	// ワールド変換行列を作成
 	static Matrix CreateWorld(const Vector3& scale, const Matrix& rotation, const Vector3& translation);
-	// [hϊs쐬
+	// ワールド変換行列を作成
 	static Matrix CreateWorld(const Vector3& position, const Vector3& forward, const Vector3& up);
 
-	// is쐬
+	// 遠景行列を作成
 	static Matrix CreatePerspectiveFieldOfView(float fov, float aspect, float near, float far);
-	// s쐬
+	// 視野行列を作成
 	static Matrix CreateLookAt(const Vector3& position, const Vector3& target, const Vector3& up);
 
-	// XN[Ws쐬
+	// スクリーン座標行列を作成
 	static Matrix CreateScreen(float x, float y, float width, float height);
 
-	// ts߂
+	// 逆行列を求める（行列の種類に応じて最適な計算方法を選択）
 	static Matrix Invert(const Matrix& matrix);
-	// ts߂i]ƕsړ̂݁j
+	// 逆行列を求める（回転と平行移動のみ）
 	static Matrix InvertFast(const Matrix& matrix);
-	// sƗւ
+	// 逆行列を求める（4列目が（0, 0, 0, 1）のアフィン変換のみ）
+	static Matrix InvertAffine(const Matrix& matrix);
+	// 逆行列を求める（一般の4x4行列）
+	static Matrix InvertGeneral(const Matrix& matrix);
+	// 行列の種類を判定
+	MatrixKind Kind() const;
+	// 行と列を入れ替える
 	static Matrix Transpose(const Matrix& matrix);
-	// `ԏ
+	// 線形補間処理
 	static Matrix Lerp(const Matrix& v1, const Matrix& v2, float t);
-	// s𕪉
+	// 行列を分解
 	void Decompose(Vector3& scale, Quaternion& rotation, Vector3& translation) const;
-	// K
+	// 正規化
 	static Matrix NormalizeRotationMatrix(const Matrix& matrix);
-	// K
+	// 正規化
 	Matrix& NormalizeRotationMatrix();
 
-	// OxNg擾
+	// 前方ベクトルを取得
 	Vector3 Forward() const;
-	// OxNgݒ
+	// 前方ベクトルを設定
 	Matrix& Forward(const Vector3& forward);
-	// xNg擾
+	// 後方ベクトルを取得
 	Vector3 Backward() const;
-	// xNgݒ
+	// 後方ベクトルを設定
 	Matrix& Backward(const Vector3& backward);
-	// xNg擾
+	// 上方ベクトルを取得
 	Vector3 Up() const;
-	// xNgݒ
+	// 上方ベクトルを設定
 	Matrix& Up(const Vector3& up);
-	// xNg擾
+	// 下方ベクトルを取得
 	Vector3 Down() const;
-	// xNgݒ
+	// 下方ベクトルを設定
 	Matrix& Down(const Vector3& down);
-	// xNg擾
+	// 左ベクトルを取得
 	Vector3 Left() const;
-	// xNgݒ
+	// 左ベクトルを設定
 	Matrix& Left(const Vector3& left);
-	// ExNg擾
+	// 右ベクトルを取得
 	Vector3 Right() const;
-	// ExNgݒ
+	// 右ベクトルを設定
 	Matrix& Right(const Vector3& rignt);
-	// sړxNg擾
+	// 平行移動ベクトルを取得
 	Vector3 Translation() const;
-	// sړxNgݒ
+	// 平行移動ベクトルを設定
 	Matrix& Translation(const Vector3& translation);
 
-	// XP[l擾
+	// スケール値を取得
 	Vector3 Scale() const;
-	// ]̎擾
+	// 回転の取得
 	Quaternion Rotation() const;
-	// ]s̎擾
+	// 回転行列の取得
 	Matrix RotationMatrix() const;
 
-	// Pʍs̒萔
+	// 単位行列の定数
 	static const Matrix Identity;
-	// [s̒萔
+	// ゼロ行列の定数
 	static const Matrix Zero;
 
-#ifdef  DX_LIB_H
-	// Dxlibpϊ֐
+#ifdef MATH_DXLIB_INTEROP
+	// Dxlib用変換関数
 	Matrix(const DxLib::MATRIX& mat)
 	{
 		memcpy(this, &mat, sizeof(Matrix));
 	}
-	// DxLib̍sɕϊ
+	// DxLibの行列に変換
 	operator DxLib::MATRIX() const
 	{
 		DxLib::MATRIX result;
@@ -135,7 +149,7 @@ struct Matrix
 #endif
 };
 
-// ZqI[o[[h
+// 演算子オーバーロード
 Matrix& operator += (Matrix& m1, const Matrix& m2);
 Matrix& operator -= (Matrix& m1, const Matrix& m2);
 Matrix& operator *= (Matrix& m1, const Matrix& m2);
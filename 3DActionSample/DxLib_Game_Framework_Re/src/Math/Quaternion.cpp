@@ -2,20 +2,21 @@
 #include "MathHelper.h"
 #include "Vector3.h"
 #include "Matrix.h"
+#include "MathSIMD.h"
 #include <cmath>
 
-// \́FNI[^jIilj
-// ҁF Qi"Jacky" Ho Siu Kij
+// 構造体：クオータニオン（四元数）
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
-// PʃNI[^jI`
+// 単位クオータニオンを定義
 const Quaternion Quaternion::Identity(0.0f, 0.0f, 0.0f, 1.0f);
 
-// RXgN^ie𒼐ړ́j
+// コンストラクタ（各成分を直接入力）
 Quaternion::Quaternion(float x, float y, float z, float w) :
 	x{ x }, y{ y }, z{ z }, w{ w }
 { }
 
-// RXgN^iw莲̉]pxNI[^jIwj
+// コンストラクタ（指定軸回りの回転角度からクオータニオンを指定）
 Quaternion::Quaternion(const Vector3& axis, float angle)
 {
 	float sin = MathHelper::sin(angle / 2.0f);
@@ -25,13 +26,13 @@ Quaternion::Quaternion(const Vector3& axis, float angle)
 	w = MathHelper::cos(angle / 2.0f);
 }
 
-// K
+// 正規化
 Quaternion Quaternion::Normalize(const Quaternion& q)
 {
 	return Quaternion(q).Normalize();
 }
 
-// K
+// 正規化
 Quaternion& Quaternion::Normalize()
 {
 	float len = Length();
@@ -43,19 +44,19 @@ Quaternion& Quaternion::Normalize()
 	return *this;
 }
 
-// ς߂
+// 内積を求める
 float Quaternion::Dot(const Quaternion& q1, const Quaternion& q2)
 {
 	return (q1.x * q2.x) + (q1.y * q2.y) + (q1.z * q2.z) + (q1.w * q2.w);
 }
 
-// ߂
+// 長さを求める
 float Quaternion::Length() const
 {
 	return std::sqrt(Dot(*this, *this));
 }
 
-// `
+// 線形補間
 Quaternion Quaternion::Slerp(const Quaternion& q1, const Quaternion& q2, float t)
 {
 	float cos = Dot(q1, q2);
@@ -78,7 +79,109 @@ Quaternion Quaternion::Slerp(const Quaternion& q1, const Quaternion& q2, float t
 	return (q1 * k0) + (t2 * k1);
 }
 
-// ]s񂩂NI[^jI쐬
+// 補正後の補間率を求める（補間率tとクオータニオン間の内積の絶対値dから、slerpとの誤差を多項式で補正する）
+static inline float corrected_t(float t, float d)
+{
+	const float a = 1.0904f + d * (-3.2452f + d * (3.55645f - d * 1.43519f));
+	const float b = 0.848013f + d * (-1.06021f + d * 0.215638f);
+	const float k = a * (t - 0.5f) * (t - 0.5f) + b;
+	return t + t * (t - 0.5f) * (t - 1.0f) * k;
+}
+
+// 球面線形補間の近似（三角関数を使わない補正付き正規化線形補間）
+Quaternion Quaternion::Nlerp(const Quaternion& q1, const Quaternion& q2, float t)
+{
+	float cos = Dot(q1, q2);
+	const float sign = (cos < 0.0f) ? -1.0f : 1.0f;
+	const float ot = corrected_t(t, cos * sign);
+
+	return Normalize((q1 * (1.0f - ot)) + (q2 * (ot * sign)));
+}
+
+#ifdef MATH_USE_SSE
+// 4つのクオータニオンを補間（SoA形式に転置して計算）
+static inline void blend4(const Quaternion q1[], const Quaternion q2[], __m128 t, Quaternion result[])
+{
+	__m128 ax = _mm_loadu_ps(&q1[0].x), ay = _mm_loadu_ps(&q1[1].x), az = _mm_loadu_ps(&q1[2].x), aw = _mm_loadu_ps(&q1[3].x);
+	__m128 bx = _mm_loadu_ps(&q2[0].x), by = _mm_loadu_ps(&q2[1].x), bz = _mm_loadu_ps(&q2[2].x), bw = _mm_loadu_ps(&q2[3].x);
+	_MM_TRANSPOSE4_PS(ax, ay, az, aw);
+	_MM_TRANSPOSE4_PS(bx, by, bz, bw);
+
+	// 内積を求め、負であればq2の符号を反転する
+	__m128 cos = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ax, bx), _mm_mul_ps(ay, by)), _mm_add_ps(_mm_mul_ps(az, bz), _mm_mul_ps(aw, bw)));
+	const __m128 sign = _mm_and_ps(cos, _mm_set1_ps(-0.0f));
+	const __m128 d = _mm_xor_ps(cos, sign);
+
+	// 補正後の補間率
+	const __m128 one = _mm_set1_ps(1.0f);
+	const __m128 half = _mm_set1_ps(0.5f);
+	__m128 a = _mm_add_ps(_mm_set1_ps(3.55645f), _mm_mul_ps(d, _mm_set1_ps(-1.43519f)));
+	a = _mm_add_ps(_mm_set1_ps(-3.2452f), _mm_mul_ps(d, a));
+	a = _mm_add_ps(_mm_set1_ps(1.0904f), _mm_mul_ps(d, a));
+	__m128 b = _mm_add_ps(_mm_set1_ps(-1.06021f), _mm_mul_ps(d, _mm_set1_ps(0.215638f)));
+	b = _mm_add_ps(_mm_set1_ps(0.848013f), _mm_mul_ps(d, b));
+	const __m128 th = _mm_sub_ps(t, half);
+	const __m128 k = _mm_add_ps(_mm_mul_ps(a, _mm_mul_ps(th, th)), b);
+	const __m128 ot = _mm_add_ps(t, _mm_mul_ps(_mm_mul_ps(t, th), _mm_mul_ps(_mm_sub_ps(t, one), k)));
+
+	// 線形補間
+	const __m128 k0 = _mm_sub_ps(one, ot);
+	const __m128 k1 = _mm_xor_ps(ot, sign);
+	__m128 rx = _mm_add_ps(_mm_mul_ps(ax, k0), _mm_mul_ps(bx, k1));
+	__m128 ry = _mm_add_ps(_mm_mul_ps(ay, k0), _mm_mul_ps(by, k1));
+	__m128 rz = _mm_add_ps(_mm_mul_ps(az, k0), _mm_mul_ps(bz, k1));
+	__m128 rw = _mm_add_ps(_mm_mul_ps(aw, k0), _mm_mul_ps(bw, k1));
+
+	// 正規化
+	const __m128 len_sq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(rx, rx), _mm_mul_ps(ry, ry)), _mm_add_ps(_mm_mul_ps(rz, rz), _mm_mul_ps(rw, rw)));
+	const __m128 inv_len = _mm_div_ps(one, _mm_sqrt_ps(len_sq));
+	rx = _mm_mul_ps(rx, inv_len);
+	ry = _mm_mul_ps(ry, inv_len);
+	rz = _mm_mul_ps(rz, inv_len);
+	rw = _mm_mul_ps(rw, inv_len);
+
+	_MM_TRANSPOSE4_PS(rx, ry, rz, rw);
+	_mm_storeu_ps(&result[0].x, rx);
+	_mm_storeu_ps(&result[1].x, ry);
+	_mm_storeu_ps(&result[2].x, rz);
+	_mm_storeu_ps(&result[3].x, rw);
+}
+#endif
+
+// 配列の一括補間（全要素で同じ補間率）
+void Quaternion::Blend(const Quaternion q1[], const Quaternion q2[], float t, Quaternion result[], int count)
+{
+	int i = 0;
+#ifdef MATH_USE_SSE
+	const __m128 t4 = _mm_set1_ps(t);
+	for (; i + 4 <= count; i += 4)
+	{
+		blend4(&q1[i], &q2[i], t4, &result[i]);
+	}
+#endif
+	for (; i < count; ++i)
+	{
+		result[i] = Nlerp(q1[i], q2[i], t);
+	}
+}
+
+// 配列の一括補間（要素ごとの補間率）
+void Quaternion::Blend(const Quaternion q1[], const Quaternion q2[], const float t[], Quaternion result[], int count)
+{
+	int i = 0;
+#ifdef MATH_USE_SSE
+	for (; i + 4 <= count; i += 4)
+	{
+		blend4(&q1[i], &q2[i], _mm_loadu_ps(&t[i]), &result[i]);
+	}
+#endif
+	for (; i < count; ++i)
+	{
+		result[i] = Nlerp(q1[i], q2[i], t[i]);
+	}
+}
+
+// 回転行列からクオータニオンを作成
 Quaternion Quaternion::CreateFromRotationMatrix(const Matrix& matrix)
 {
 	Quaternion result;
@@ -122,7 +225,7 @@ Quaternion Quaternion::CreateFromRotationMatrix(const Matrix& matrix)
 	return result;
 }
 
-// ZqI[o[[h
+// 演算子オーバーロード
 Quaternion& operator += (Quaternion& q1, const Quaternion& q2)
 {
 	q1.x += q2.x;
@@ -1,44 +1,50 @@
 #ifndef QUATERNION_H_
 #define QUATERNION_H_
 
-struct Vector3;		// 3DxNg\
-struct Matrix;		// ϊs\
+struct Vector3;		// 3Dベクトル構造体
+struct Matrix;		// 変換行列構造体
 
-// \́FNI[^jIilj
-// ҁF Qi"Jacky" Ho Siu Kij
+// 構造体：クオータニオン（四元数）
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 struct Quaternion
 {
-	float x{ 0.0f };	// x
-	float y{ 0.0f };    // y
-	float z{ 0.0f };    // z
-	float w{ 1.0f };    // w
+	float x{ 0.0f };	// x成分
+	float y{ 0.0f };    // y成分
+	float z{ 0.0f };    // z成分
+	float w{ 1.0f };    // w成分
 
-	// ftHgRXgN^
+	// デフォルトコンストラクタ
 	Quaternion() = default;
-	// RXgN^ie𒼐ړ́j
+	// コンストラクタ（各成分を直接入力）
 	Quaternion(float x, float y, float z, float w);
-	// RXgN^iw莲̉]pxNI[^jIwj
+	// コンストラクタ（指定軸回りの回転角度からクオータニオンを指定）
 	Quaternion(const Vector3& axis, float angle);
 
-	// K
+	// 正規化
 	static Quaternion Normalize(const Quaternion& q);
-	// K
+	// 正規化
 	Quaternion& Normalize();
 
-	// ς߂
+	// 内積を求める
 	static float Dot(const Quaternion& q1, const Quaternion& q2);
-	// ߂
+	// 長さを求める
 	float Length() const;
 
-	// `
+	// 線形補間
 	static Quaternion Slerp(const Quaternion& q1, const Quaternion& q2, float t);
-	// ]s񂩂NI[^jI쐬
+	// 球面線形補間の近似（三角関数を使わない補正付き正規化線形補間）
+	static Quaternion Nlerp(const Quaternion& q1, const Quaternion& q2, float t);
+	// 配列の一括補間（全要素で同じ補間率）
+	static void Blend(const Quaternion q1[], const Quaternion q2[], float t, Quaternion result[], int count);
+	// 配列の一括補間（要素ごとの補間率）
+	static void Blend(const Quaternion q1[], const Quaternion q2[], const float t[], Quaternion result[], int count);
+	// 回転行列からクオータニオンを作成
 	static Quaternion CreateFromRotationMatrix(const Matrix& matrix);
-	// PʃNI[^jI
+	// 単位クオータニオン
 	static const Quaternion Identity;
 };
 
-// ZqI[o[[h
+// 演算子オーバーロード
 Quaternion& operator += (Quaternion& q1, const Quaternion& q2);
 Quaternion& operator -= (Quaternion& q1, const Quaternion& q2);
 Quaternion& operator *= (Quaternion& q, float s);
@@ -1,46 +1,110 @@
 #include "Random.h"
-#include <random>
 
-// NXF
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：乱数生成
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
-// `
-static std::mt19937 mt;
-// V[h`
-static unsigned int s_seed{ std::mt19937::default_seed };
+// 全体の乱数シードを定義
+static unsigned int s_seed{ 5489u };
 
-// 
-void Random::randomize()
+// 64ビット値の撹拌（SplitMix64の最終段）
+static inline unsigned long long mix(unsigned long long z)
 {
-	std::random_device rd;
-	randomize(rd());
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+	return z ^ (z >> 31);
 }
 
-// 
-void Random::randomize(unsigned int seed)
+// 鍵とカウンターから乱数を生成
+static inline unsigned long long generate(unsigned long long key, unsigned long long counter)
 {
-	s_seed = seed;
-	mt = std::mt19937(s_seed);
+	return mix(key + (counter + 1) * 0x9E3779B97F4A7C15ull);
+}
+
+// 64ビット乱数を[0, 1)のfloatに変換（上位24ビットを使用）
+static inline float to_unit_float(unsigned long long value)
+{
+	return (float)(value >> 40) * (1.0f / 16777216.0f);
+}
+
+// コンストラクタ
+Random::Random(unsigned int stream)
+{
+	randomize(stream);
+}
+
+// 初期化（ストリーム番号を指定、通常はアクターIDを使う）
+void Random::randomize(unsigned int stream)
+{
+	stream_ = stream;
+	key_ = mix(((unsigned long long)s_seed << 32) | stream_);
+	counter_ = 0;
 }
 
-// int^̗̐
+// 現在のtickを設定（tickごとに独立した乱数列になる）
+void Random::set_tick(unsigned int tick)
+{
+	counter_ = (unsigned long long)tick << 32;
+}
+
+// int型の乱数の生成（min以上max以下）
 int Random::rand_int(int min, int max)
 {
-	std::uniform_int_distribution<int> dist(min, max);
+	if (max <= min) return min;
+
+	// 偏りのない範囲変換（Lemireの方法）
+	const unsigned int range = (unsigned int)max - (unsigned int)min + 1u;
+	if (range == 0u) return (int)(unsigned int)next();	// int全域
+
+	unsigned long long m = (next() >> 32) * range;
+	unsigned int low = (unsigned int)m;
+	if (low < range)
+	{
+		const unsigned int threshold = (0u - range) % range;
+		while (low < threshold)
+		{
+			m = (next() >> 32) * range;
+			low = (unsigned int)m;
+		}
+	}
 
-	return dist(mt);
+	return (int)((unsigned int)min + (unsigned int)(m >> 32));
 }
 
-// float^̗̐
+// float型の乱数の生成（min以上max未満）
 float Random::rand_float(float min, float max)
 {
-	std::uniform_real_distribution<float> dist(min, max);
+	return min + (max - min) * to_unit_float(next());
+}
 
-	return dist(mt);
+// float型の乱数を一括生成（1個ずつ生成した場合と同じ乱数列になる）
+void Random::rand_float(float result[], int count, float min, float max)
+{
+	// SSE2には64ビットの乗算がないためスカラーのループのままにする
+	// 各要素はカウンターだけで決まり、ループ間に依存関係がないので、乗算はパイプラインで重なって実行される
+	const unsigned long long key = key_;
+	const unsigned long long base = counter_;
+	const float scale = (max - min) * (1.0f / 16777216.0f);
+	for (int i = 0; i < count; ++i)
+	{
+		result[i] = min + scale * (float)(generate(key, base + (unsigned long long)i) >> 40);
+	}
+	counter_ += (unsigned long long)count;
 }
 
-// V[h̎擾
+// 全体の乱数シードの設定
+void Random::set_seed(unsigned int seed)
+{
+	s_seed = seed;
+}
+
+// 全体の乱数シードの取得
 unsigned int Random::seed()
 {
 	return s_seed;
 }
+
+// 次の64ビット乱数を生成
+unsigned long long Random::next()
+{
+	return generate(key_, counter_++);
+}
\ No newline at end of file
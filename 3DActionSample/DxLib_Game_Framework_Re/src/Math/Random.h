@@ -1,21 +1,45 @@
 #ifndef RANDOM_H_
 #define RANDOM_H_
 
-// NXF
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：乱数生成
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// カウンター方式（SplitMix64）の乱数ストリーム。
+// 同じシード・ストリーム番号・tickからは常に同じ乱数列が生成され、
+// インスタンス間で状態を共有しないため、並列に更新しても結果は変わらない。
 class Random
 {
 public:
-	// 
-	static void randomize();
-	// 
-	static void randomize(unsigned int seed);
-	// int^̗̐
-	static int rand_int(int min, int max);
-	// float^̗̐
-	static float rand_float(float min, float max);
-	// V[h̎擾
+	// デフォルトコンストラクタ（ストリーム番号0）
+	Random() = default;
+	// コンストラクタ
+	explicit Random(unsigned int stream);
+	// 初期化（ストリーム番号を指定、通常はアクターIDを使う）
+	void randomize(unsigned int stream);
+	// 現在のtickを設定（tickごとに独立した乱数列になる）
+	void set_tick(unsigned int tick);
+	// int型の乱数の生成（min以上max以下）
+	int rand_int(int min, int max);
+	// float型の乱数の生成（min以上max未満）
+	float rand_float(float min, float max);
+	// float型の乱数を一括生成（1個ずつ生成した場合と同じ乱数列になる）
+	void rand_float(float result[], int count, float min, float max);
+
+	// 全体の乱数シードの設定
+	static void set_seed(unsigned int seed);
+	// 全体の乱数シードの取得
 	static unsigned int seed();
+
+private:
+	// 次の64ビット乱数を生成
+	unsigned long long next();
+
+private:
+	// ストリーム番号
+	unsigned int		stream_{ 0 };
+	// ストリーム固有の鍵（シードとストリーム番号から生成）
+	unsigned long long	key_{ 0 };
+	// カウンター（上位32ビットはtick、下位32ビットはtick内の生成回数）
+	unsigned long long	counter_{ 0 };
 };
 
 #endif // !RANDOM_H_
\ No newline at end of file
@@ -1,39 +1,39 @@
 #include "Timer.h"
 #include <algorithm>
 
-// NXF^C}[iZADeltaTimej
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：タイマー（加算、DeltaTime式）
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
-// RXgN^iԂݒ肷AԂ̓t[œ́j
+// コンストラクタ（制限時間を設定する、制限時間はフレーム数で入力）
 Timer::Timer(float limit_time)
 {
 	time_limit_ = limit_time;
 }
 
-// XV
+// 更新
 void Timer::update(float delta_time)
 {
-	// Ԃݒ肳ĂȂꍇADeltaTimeZ
-	// Ԃݒ肳ĂꍇAԂɒB܂DeltaTimeZ
+	// 制限時間を設定されていない場合、ずっとDeltaTimeを加算
+	// 制限時間を設定されている場合、制限時間に達するまでDeltaTimeを加算
 	(time_limit_ <= 0.0f) ? time_current_ += delta_time : time_current_ = std::min(time_current_ + delta_time, time_limit_);
 }
 
-// ݂̎Ԃ擾
+// 現在の時間を取得
 float Timer::get_time() const
 {
 	return time_current_;
 }
 
-// Zbg
+// リセット
 void Timer::reset()
 {
 	time_current_ = 0.0f;
 }
 
-// ^CAEg
+// タイムアウトか
 bool Timer::is_time_out() const
 {
-	if (time_limit_ <= 0.0f) return false;	// Ԃݒ肳ĂȂꍇAfalseԂ
+	if (time_limit_ <= 0.0f) return false;	// 制限時間を設定されていない場合、falseを返す
 
 	return time_current_ >= time_limit_;
 }
\ No newline at end of file
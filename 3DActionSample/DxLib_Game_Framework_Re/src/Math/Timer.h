@@ -1,28 +1,28 @@
 #ifndef TIMER_H_
 #define TIMER_H_
 
-// NXF^C}[iDeltaTimej
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：タイマー（DeltaTime式）
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
 class Timer
 {
 public:
-	// ftHgRXgN^iԂݒ肵Ȃj
+	// デフォルトコンストラクタ（制限時間を設定しない）
 	Timer() = default;
-	// RXgN^iԂݒ肷AԂ̓t[œ́j
+	// コンストラクタ（制限時間を設定する、制限時間はフレーム数で入力）
 	Timer(float limit_time);
-	// XV
+	// 更新
 	void update(float delta_time);
-	// ݂̎Ԃ擾
+	// 現在の時間を取得
 	float get_time() const;
-	// Zbg
+	// リセット
 	void reset();
-	// ^CAEg
+	// タイムアウトか
 	bool is_time_out() const;
 
 private:
-	float time_current_{ 0.0f };	// ݂̎
-	float time_limit_{ 0.0f };		// 
+	float time_current_{ 0.0f };	// 現在の時間
+	float time_limit_{ 0.0f };		// 制限時間
 };
 
 #endif // !TIMER_H_
\ No newline at end of file
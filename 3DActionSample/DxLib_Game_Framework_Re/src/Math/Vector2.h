@@ -1,51 +1,51 @@
 #ifndef VECTOR2_H_
 #define VECTOR2_H_
 
-// \́F2DxNg
-// ҁF Qi"Jacky" Ho Siu Kij
+// 構造体：2Dベクトル
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 struct Vector2
 {
-	float x{ 0.0f };	// x
-	float y{ 0.0f };	// y
+	float x{ 0.0f };	// x成分
+	float y{ 0.0f };	// y成分
 
-	// ftHgRXgN^
+	// デフォルトコンストラクタ
 	Vector2() = default;
-	// RXgN^
+	// コンストラクタ
 	Vector2(float x, float y);
 
-	// ς߂
+	// 内積を求める
 	float Dot(const Vector2& other) const;
-	// Oς߂
+	// 外積を求める
 	float Cross(const Vector2& other) const;
-	// ߂
+	// 長さを求める
 	float Length() const;
-	// KxNg߂
+	// 正規化したベクトルを求める
 	Vector2 Normalize() const;
 
-	// pxxNg̍쐬
+	// 角度からベクトルの作成
 	static Vector2 FromAngle(float degree);
-	// xNgĂpx߂
+	// ベクトルが向いている角度を求める
 	float ToAngle() const;
-	// ]
+	// 回転処理
 	Vector2 Rotate(float degree) const;
-	// 2̃xNgȂpx߂
+	// 2つのベクトルなす角度を求める
 	float InnerAngle(const Vector2& other) const;
 
-	// ߂
+	// 距離を求める
 	float Distance(const Vector2& other) const;
-	// `ԏ
+	// 線形補間処理
 	Vector2 Lerp(const Vector2& end, float t) const;
-	// l𐧌
+	// 数値を制限
 	Vector2 Clamp(const Vector2& min, const Vector2& max) const;
-	// ^[Qbg̃xNg߂
+	// ターゲット方向のベクトルを求める
 	Vector2 ToTarget(const Vector2& target) const;
-	// ^[Qbg̊px߂
+	// ターゲット方向の角度を求める
 	float ToTargetAngle(const Vector2& target) const;
 
-	// [xNgȂ̂
+	// ゼロベクトルなのか
 	bool is_zero() const;
 
-	// 萔
+	// 定数
 	static const Vector2 Zero;  //  0.0f  0.0f
 	static const Vector2 One;   //  1.0f  1.0f
 	static const Vector2 Left;  // -1.0f  0.0f
@@ -54,7 +54,7 @@ struct Vector2
 	static const Vector2 Up;    //  0.0f -1.0f
 };
 
-// ZqI[o[[h
+// 演算子オーバーロード
 Vector2& operator += (Vector2& lhs, const Vector2& rhs);
 Vector2& operator -= (Vector2& lhs, const Vector2& rhs);
 Vector2& operator *= (Vector2& lhs, float scalar);
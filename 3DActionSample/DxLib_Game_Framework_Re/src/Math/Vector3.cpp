@@ -4,15 +4,15 @@
 #include <cmath>
 #include <algorithm>
 
-// \́F3DxNg
-// ҁF Qi"Jacky" Ho Siu Kij
+// 構造体：3Dベクトル
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
-// 萔̎̂`
+// 定数の実体を定義
 const Vector3 Vector3::Up(0.0f, 1.0f, 0.0f);
 const Vector3 Vector3::Down(0.0f, -1.0f, 0.0f);
 const Vector3 Vector3::Left(-1.0f, 0.0f, 0.0f);
 const Vector3 Vector3::Right(1.0f, 0.0f, 0.0f);
-#ifdef DX_LIB_H
+#ifdef MATH_LEFT_HANDED
 const Vector3 Vector3::Backward(0.0f, 0.0f, 1.0f);
 const Vector3 Vector3::Forward(0.0f, 0.0f, -1.0f);
 #else
@@ -25,24 +25,24 @@ const Vector3 Vector3::UnitZ(0.0f, 0.0f, 1.0f);
 const Vector3 Vector3::One(1.0f, 1.0f, 1.0f);
 const Vector3 Vector3::Zero(0.0f, 0.0f, 0.0f);
 
-// RXgN^
+// コンストラクタ
 Vector3::Vector3(float x, float y, float z) :
 	x{ x }, y{ y }, z{ z }
 { }
 
-// ߂
+// 長さを求める
 float Vector3::Length() const
 {
 	return std::sqrt(LengthSquared());
 }
 
-// ̕߂
+// 長さの平方を求める
 float Vector3::LengthSquared() const
 {
 	return Dot(*this, *this);
 }
 
-// KxNg߂
+// 正規化したベクトルを求める
 Vector3& Vector3::Normalize()
 {
 	const float len = Length();
@@ -54,19 +54,19 @@ Vector3& Vector3::Normalize()
 	return *this;
 }
 
-// w肵xNg𐳋K
+// 指定したベクトルを正規化
 Vector3 Vector3::Normalize(const Vector3& v)
 {
 	return Vector3(v).Normalize();
 }
 
-// 2̃xNg̓ς߂
+// 2つのベクトルの内積を求める
 float Vector3::Dot(const Vector3& v1, const Vector3& v2)
 {
 	return (v1.x * v2.x) + (v1.y * v2.y) + (v1.z * v2.z);
 }
 
-// 2̃xNg̊Oς߂
+// 2つのベクトルの外積を求める
 Vector3 Vector3::Cross(const Vector3& v1, const Vector3& v2)
 {
 	return Vector3
@@ -77,7 +77,7 @@ Vector3 Vector3::Cross(const Vector3& v1, const Vector3& v2)
 	};
 }
 
-// 2̃xNg̋߂
+// 2つのベクトルの距離を求める
 float Vector3::Distance(const Vector3& v1, const Vector3& v2)
 {
 	return (v2 - v1).Length();
@@ -88,7 +88,7 @@ float Vector3::DistanceSquared(const Vector3& v1, const Vector3& v2)
 	return (v2 - v1).LengthSquared();
 }
 
-// `ԏ
+// 線形補間処理
 Vector3 Vector3::Lerp(const Vector3& v1, const Vector3& v2, float t)
 {
 	return Vector3
@@ -99,7 +99,7 @@ Vector3 Vector3::Lerp(const Vector3& v1, const Vector3& v2, float t)
 	);
 }
 
-// veyA̍łႢl܂ރxNg߂
+// 一致する各成分ペアの最も低い値を含むベクトルを求める
 Vector3 Vector3::Min(const Vector3& v1, const Vector3& v2)
 {
 	return Vector3
@@ -110,7 +110,7 @@ Vector3 Vector3::Min(const Vector3& v1, const Vector3& v2)
 	);
 }
 
-// veyA̍łl܂ރxNg߂
+// 一致する各成分ペアの最も高い値を含むベクトルを求める
 Vector3 Vector3::Max(const Vector3& v1, const Vector3& v2)
 {
 	return Vector3
@@ -121,7 +121,7 @@ Vector3 Vector3::Max(const Vector3& v1, const Vector3& v2)
 	);
 }
 
-// l𐧌
+// 数値を制限
 Vector3 Vector3::Clamp(const Vector3& value, const Vector3& min, const Vector3& max)
 {
 	return Vector3
@@ -132,7 +132,7 @@ Vector3 Vector3::Clamp(const Vector3& value, const Vector3& min, const Vector3&
 	);
 }
 
-// s3DxNgɕϊ
+// 行列を3Dベクトルに変換
 Vector3 Vector3::Transform(const Vector3& position, const Matrix& matrix)
 {
 	float w = position.x * matrix.m[0][3] + position.y * matrix.m[1][3] + position.z * matrix.m[2][3] + matrix.m[3][3];
@@ -145,7 +145,7 @@ Vector3 Vector3::Transform(const Vector3& position, const Matrix& matrix)
 	);
 }
 
-// s@xNgɕϊ
+// 行列を法線ベクトルに変換
 Vector3 Vector3::TransformNormal(const Vector3& position, const Matrix& matrix)
 {
 	return Vector3
@@ -156,7 +156,7 @@ Vector3 Vector3::TransformNormal(const Vector3& position, const Matrix& matrix)
 	);
 }
 
-// [Esb`xNg쐬
+// ヨー・ピッチからベクトルを作成
 Vector3 Vector3::CreateFromYawPitch(float yaw, float pitch)
 {
 	return Vector3
@@ -167,7 +167,7 @@ Vector3 Vector3::CreateFromYawPitch(float yaw, float pitch)
 	);
 }
 
-// [߂
+// ヨーを求める
 float Vector3::Yaw() const
 {
 	if (Length() == 0.0f)
@@ -178,7 +178,7 @@ float Vector3::Yaw() const
 	return MathHelper::a_tan(x, z);
 }
 
-// sb`߂
+// ピッチを求める
 float Vector3::Pitch() const
 {
 	float len = Length();
@@ -190,7 +190,7 @@ float Vector3::Pitch() const
 	return MathHelper::a_sin(-y / len);
 }
 
-//  2̃xNgԂ̉sp߂
+//  2つのベクトル間の鋭角を求める
 float Vector3::Angle(const Vector3& from, const Vector3& to)
 {
 	float d = Dot(Normalize(from), Normalize(to));
@@ -198,7 +198,7 @@ float Vector3::Angle(const Vector3& from, const Vector3& to)
 	return MathHelper::a_cos(MathHelper::clamp(d, -1.0f, 1.0f));
 }
 
-// ZqI[o[[h
+// 演算子オーバーロード
 Vector3& operator += (Vector3& v1, const Vector3& v2)
 {
 	v1.x += v2.x;
@@ -1,63 +1,63 @@
 #ifndef VECTOR3_H_
 #define VECTOR3_H_
 
-#include <DxLib.h>
+#include "DxLibInterop.h"
 
-// \́F3DxNg
-// ҁF Qi"Jacky" Ho Siu Kij
+// 構造体：3Dベクトル
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
-struct Matrix;	// ϊs\
+struct Matrix;	// 変換行列構造体
 
 struct Vector3
 {
-	float x{ 0.0f };	// x
-	float y{ 0.0f };	// y
-	float z{ 0.0f };	// z
+	float x{ 0.0f };	// x成分
+	float y{ 0.0f };	// y成分
+	float z{ 0.0f };	// z成分
 
-	// ftHgRXgN^
+	// デフォルトコンストラクタ
 	Vector3() = default;
-	// RXgN^
+	// コンストラクタ
 	Vector3(float x, float y, float z);
 
-	// ߂
+	// 長さを求める
 	float Length() const;
-	// ̕߂
+	// 長さの平方を求める
 	float LengthSquared() const;
-	// KxNg߂
+	// 正規化したベクトルを求める
 	Vector3& Normalize();
-	// w肵xNg𐳋K
+	// 指定したベクトルを正規化
 	static Vector3 Normalize(const Vector3& v);
-	// 2̃xNg̓ς߂
+	// 2つのベクトルの内積を求める
 	static float Dot(const Vector3& v1, const Vector3& v2);
-	// 2̃xNg̊Oς߂
+	// 2つのベクトルの外積を求める
 	static Vector3 Cross(const Vector3& v1, const Vector3& v2);
 
-	// 2̃xNg̋߂
+	// 2つのベクトルの距離を求める
 	static float Distance(const Vector3& v1, const Vector3& v2);
-	// 2̃xNg̋̕߂
+	// 2つのベクトルの距離の平方を求める
 	static float DistanceSquared(const Vector3& v1, const Vector3& v2);
-	// `ԏ
+	// 線形補間処理
 	static Vector3 Lerp(const Vector3& v1, const Vector3& v2, float t);
-	// veyA̍łႢl܂ރxNg߂
+	// 一致する各成分ペアの最も低い値を含むベクトルを求める
 	static Vector3 Min(const Vector3& v1, const Vector3& v2);
-	// veyA̍łl܂ރxNg߂
+	// 一致する各成分ペアの最も高い値を含むベクトルを求める
 	static Vector3 Max(const Vector3& v1, const Vector3& v2);
-	// l𐧌
+	// 数値を制限
 	static Vector3 Clamp(const Vector3& value, const Vector3& min, const Vector3& max);
-	// s3DxNgɕϊ
+	// 行列を3Dベクトルに変換
 	static Vector3 Transform(const Vector3& position, const Matrix& matrix);
-	// s@xNgɕϊ
+	// 行列を法線ベクトルに変換
 	static Vector3 TransformNormal(const Vector3& position, const Matrix& matrix);
-	// [Esb`xNg쐬
+	// ヨー・ピッチからベクトルを作成
 	static Vector3 CreateFromYawPitch(float yaw, float pitch);
-	// [߂
+	// ヨーを求める
 	float Yaw() const;
-	// sb`߂
+	// ピッチを求める
 	float Pitch() const;
-	//  2̃xNgԂ̉sp߂
+	//  2つのベクトル間の鋭角を求める
 	static float Angle(const Vector3& from, const Vector3& to);
 
-	// 萔
+	// 定数
 	static const Vector3 Up;		// Vector3( 0,  1,  0)
 	static const Vector3 Down;      // Vector3( 0, -1,  0)
 	static const Vector3 Left;      // Vector3(-1,  0,  0)
@@ -70,10 +70,10 @@ struct Vector3
 	static const Vector3 One;       // Vector3( 1,  1,  1)
 	static const Vector3 Zero;      // Vector3( 0,  0,  0)
 
-#ifdef DX_LIB_H
-	// Dxlibpϊ֐
+#ifdef MATH_DXLIB_INTEROP
+	// Dxlib用変換関数
 	Vector3(const DxLib::VECTOR& v) : x(v.x), y(v.y), z(v.z) { }
-	// DxLib̃xNgɕϊ
+	// DxLibのベクトルに変換
 	operator DxLib::VECTOR() const
 	{
 		return { x, y, z };
@@ -81,7 +81,7 @@ struct Vector3
 #endif
 };
 
-// ZqI[o[[h
+// 演算子オーバーロード
 Vector3& operator += (Vector3& v1, const Vector3& v2);
 Vector3& operator -= (Vector3& v1, const Vector3& v2);
 Vector3& operator *= (Vector3& v, float s);
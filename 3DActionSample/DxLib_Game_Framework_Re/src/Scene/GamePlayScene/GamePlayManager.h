@@ -6,79 +6,79 @@
 #include "../../Math/Vector2.h"
 #include "../../Math/CountdownTimer.h"
 
-// ҁF Qi"Jacky" Ho Siu Kij
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
-// vC
+// プレイ状況
 enum GamePlayPhase
 {
-	Phase1,		// 1iKiGj
-	Phase2,		// 2iKi{Xj
+	Phase1,		// 第1段階（雑魚戦）
+	Phase2,		// 第2段階（ボス戦）
 };
 
-// NXFQ[vCV[Ǘ
+// クラス：ゲームプレイシーン管理
 class GamePlayManager : public Actor
 {
 private:
-	const float PhaseChangeTime{ 180.0f };				// 1iKIA2iKɈڍs܂ł̃t[
-	const float SceneChangeTime_GameOver{ 120.0f };		// Q[I[o[ÃV[Ɉڍs܂ł̃t[
-	const float SceneChangeTime_GameClear{ 180.0f };	// Q[NAÃV[Ɉڍs܂ł̃t[
+	const float PhaseChangeTime{ 180.0f };				// 第1段階終了後、第2段階に移行するまでのフレーム数
+	const float SceneChangeTime_GameOver{ 120.0f };		// ゲームオーバー後、次のシーンに移行するまでのフレーム数
+	const float SceneChangeTime_GameClear{ 180.0f };	// ゲームクリア後、次のシーンに移行するまでのフレーム数
 
-	const int	EnemyPopNo{ 3 };						// GG̐
+	const int	EnemyPopNo{ 3 };						// 生成する雑魚敵の数
 
 public:
-	// RXgN^
+	// コンストラクタ
 	explicit GamePlayManager(IWorld* world);
-	// XV
+	// 更新
 	virtual void update(float delta_time) override;
-	// `
+	// 描画
 	virtual void draw() const override;
-	// bZ[W
+	// メッセージ処理
 	virtual void handle_message(EventMessage message, void* param = nullptr) override;
 
 private:
-	// vC󋵂̍XV
+	// プレイ状況の更新
 	void update_phase(float delta_time);
-	// Q[Jn
+	// ゲーム開始処理
 	void game_start();
-	// tF[Yڍs
+	// フェーズ移行
 	void change_phase();
-	// 1iK̏
+	// 第1段階の処理
 	void phase1(float delta_time);
-	// 2iK̏
+	// 第2段階の処理
 	void phase2(float delta_time);
-	// vC[̗̑̓Q[W\
+	// プレイヤーの体力ゲージを表示
 	void draw_playerHP() const;
-	// ݂̖ړI\
+	// 現在の目的を表示
 	void draw_message() const;
-	// {X̗̑̓Q[W\
+	// ボスの体力ゲージを表示
 	void draw_bossHP() const;
 
-	// 1iK͏IĂ邩
+	// 第1段階は終了しているか
 	bool phase1_end() const;
-	// 1iK̃XLbv
+	// 第1段階のスキップ
 	void skip_phase1();
 
 private:
-	// vC
+	// プレイ状況
 	GamePlayPhase	phase_{ GamePlayPhase::Phase1 };
-	// tF[Yڍs^C}[
+	// フェーズ移行タイマー
 	CountdownTimer	phase_change_timer_{ PhaseChangeTime };
-	// Q[I[o[V[ڍs^C}[
+	// ゲームオーバー後シーン移行タイマー
 	CountdownTimer	gameover_scene_timer_{ SceneChangeTime_GameOver };
-	// Q[NAV[ڍs^C}[
+	// ゲームクリア後シーン移行タイマー
 	CountdownTimer	gameclear_scene_timer_{ SceneChangeTime_GameClear };
-	// |ꂽG̐i󋵈ڍspj
+	// 倒された敵の数（状況移行判定用）
 	int				enemy_defeated_{ 0 };
-	// {X|ꂽ
+	// ボスが倒されたか
 	bool			boss_defeated_{ false };
-	// 2iK͏I
+	// 第2段階は終了したか
 	bool			phase2_end_{ false };
-	// vC[|ꂽ
+	// プレイヤーが倒れたか
 	bool			player_dead_{ false };
-	// Q[ItO
+	// ゲーム終了フラグ
 	bool			game_end_{ false };
 
-	int fade_counter_{ 0 };		// tF[hC/tF[hAEgpJE^[
+	int fade_counter_{ 0 };		// フェードイン/フェードアウト用カウンター
 };
 
 #endif // !GAME_PLAY_MANAGER_H_
\ No newline at end of file
@@ -1,27 +1,27 @@
 #ifndef ISCENE_H_
 #define ISCENE_H_
 
-// C^[tF[XFV[
-// ҁF Qi"Jacky" Ho Siu Kij
+// インターフェース：シーン
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
 enum class Scene;
 
 class IScene
 {
 public:
-	// zfXgN^
+	// 仮想デストラクタ
 	virtual ~IScene() {}
-	// Jn
+	// 開始
 	virtual void start() = 0;
-	// XV
+	// 更新
 	virtual void update(float delta_time) = 0;
-	// `
+	// 描画
 	virtual void draw() const = 0;
-	// IĂ邩
+	// 終了しているか
 	virtual bool is_end() const = 0;
-	// ̃V[̎擾
+	// 次のシーンの取得
 	virtual Scene next() const = 0;
-	// I
+	// 終了
 	virtual void end() = 0;
 };
 
@@ -3,12 +3,12 @@
 
 #include <memory>
 
-// |C^FV[
-// ҁF Qi"Jacky" Ho Siu Kij
+// ポインタ：シーン
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 class IScene;
 using IScenePtr = std::shared_ptr<IScene>;
 
-// V[̐
+// シーンの生成
 template<class T, class...Args>
 inline IScenePtr new_scene(Args&&... args)
 {
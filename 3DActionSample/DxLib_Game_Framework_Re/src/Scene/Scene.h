@@ -1,14 +1,14 @@
 #ifndef SCENE_H_
 #define SCENE_H_
 
-// 񋓌^FV[
-// ҁF Qi"Jacky" Ho Siu Kij
+// 列挙型：シーン種類
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 enum class Scene
 {
-	None,			// 󔒂̃V[
-	Loading,		// ǂݍ
-	Title,			// ^Cg
-	GamePlay,		// Q[vC
+	None,			// 空白のシーン
+	Loading,		// 読み込み
+	Title,			// タイトル
+	GamePlay,		// ゲームプレイ
 };
 
 #endif // !SCENE_H_
\ No newline at end of file
@@ -6,6 +6,9 @@
 #include "../ID/EventMessage.h"
 #include "../Actor/Camera/TPCamera.h"
 #include "../Graphic/Light.h"
+#include "../Graphic/AnimationLOD.h"
+#include "../Graphic/Shader/RenderTargetPool.h"
+#include "../Math/Random.h"
 #include "../Actor/Player/Player.h"
 #include "GamePlayScene/GamePlayManager.h"
 
@@ -19,61 +22,88 @@
 #include "../Graphic/Graphics2D.h"
 #include "../ID/SourceID.h"
 
-// NXFQ[vCV[
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：ゲームプレイシーン
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
 // ============================================================
-// ȉ͉摜XvCg̊֘A萔
+// 以下は画像スプライトの関連定数
 // ============================================================
 
-const int PauseTextWidth = 400;		// PAUSE摜̕
-const int PauseTextHeight = 160;	// PAUSE摜̍
+const int PauseTextWidth = 400;		// PAUSE文字画像の幅
+const int PauseTextHeight = 160;	// PAUSE文字画像の高さ
 
 // ============================================================
 
-// Jn
+// 開始
 void SceneGamePlay::start()
 {
-	// ItOfalseɂ
+	// 終了フラグをfalseにする
 	is_end_ = false;
-	// |[YԂfalseɂ
+	// ポーズ状態をfalseにする
 	is_pause_ = false;
-	// [h
+	// ワールドを初期化
 	world_.initialize();
 
-	// CxgbZ[WXi[o^
+	// イベントメッセージリスナーを登録
 	world_.add_event_message_listener([=](EventMessage message, void* param) {handle_message(message, param); });
 
-	// tB[hǉ
+	// フィールドを追加
 	world_.add_field(new_field<Field>(MESH_STAGE_CASTLE, MESH_SKYBOX));
-	// Jǉ
+	// カメラを追加
 	world_.add_camera(new_actor<TPCamera>(&world_));
-	// Cgǉ
+	// ライトを追加
 	world_.add_light(new_actor<Light>(&world_, Vector3{ 0.0f, 30.0f, -20.0f }));
 
-	// AN^[͂ɒǉ
-	world_.add_actor(ActorGroup::Player, new_actor<Player>(&world_, Vector3{ 0.0f, 0.0f, 100.0f }));	// vC[
-	world_.add_actor(ActorGroup::UI, new_actor<GamePlayManager>(&world_));								// Q[vCǗ
+	// アクターはここに追加
+	world_.add_actor(ActorGroup::Player, new_actor<Player>(&world_, Vector3{ 0.0f, 0.0f, 100.0f }));	// プレイヤー
+	world_.add_actor(ActorGroup::UI, new_actor<GamePlayManager>(&world_));								// ゲームプレイ管理者
 }
 
-// XV
+// 更新
 void SceneGamePlay::update(float delta_time)
 {
-	// |[YĂȂ΁AQ[isXV
+	// ポーズしていなければ、ゲーム進行を更新
 	if (!is_pause_)
 		world_.update(delta_time);
 
-	// |[Y
+	// ポーズ
 	if (PlayerInput::pause())
 		is_pause_ = (is_pause_) ? false : true;
 }
 
-// `
+// 描画
 void SceneGamePlay::draw() const
 {
 	world_.draw();
 
-	// |[YPAUSE摜`
+#ifdef _DEBUG
+	// アニメーションLODの統計を表示
+	AnimationLOD::draw_stats(0, 20);
+	// 視錐台カリングの統計を表示
+	DrawFormatString(0, 100, GetColor(255, 255, 255), "Frustum: %d visible / %d culled / %d occluded (%d / %d occluder tris)",
+		world_.culling().visible_count(), world_.culling().culled_count(), world_.culling().occluded_count(),
+		world_.occlusion().stats().rasterized, world_.occlusion().stats().triangles);
+	// 描画コマンドの統計を表示
+	const auto& render_stats = world_.render_queue().stats();
+	DrawFormatString(0, 116, GetColor(255, 255, 255), "Draw: %d commands, %d calls (%d instanced, %d instances), %d binds, %d shader, %d texture",
+		render_stats.commands, render_stats.draw_calls, render_stats.instanced_draws, render_stats.instances,
+		render_stats.model_binds, render_stats.shader_changes, render_stats.texture_changes);
+	// レンダーターゲットプールの統計を表示
+	DrawFormatString(0, 132, GetColor(255, 255, 255), "Render targets: %d, %d KB reserved, %d KB peak",
+		RenderTargetPool::target_count(), RenderTargetPool::reserved_bytes() / 1024, RenderTargetPool::peak_bytes() / 1024);
+	// ボーン行列のアップロードの統計を表示
+	const auto& upload_stats = SkeletalMesh::upload_stats();
+	DrawFormatString(0, 164, GetColor(255, 255, 255), "Bone upload: %d / %d bones, %d full (%d handle switches), %d skipped of %d draws",
+		upload_stats.uploaded_bones, upload_stats.total_bones, upload_stats.full_uploads, upload_stats.handle_switches, upload_stats.skipped_draws, upload_stats.draws);
+	// パーティクルの統計を表示
+	const auto& particle_stats = world_.particles().stats();
+	DrawFormatString(0, 148, GetColor(255, 255, 255), "Particles: %d / %d alive, %d emitted, %d dropped, %d draws",
+		particle_stats.alive, world_.particles().budget(), particle_stats.emitted, particle_stats.dropped, particle_stats.buffers);
+	// 乱数シードを表示（--seedで同じプレイを再現できる）
+	DrawFormatString(0, 180, GetColor(255, 255, 255), "Seed: %u", Random::seed());
+#endif
+
+	// ポーズ中にPAUSE画像を描画
 	if (is_pause_)
 	{
 		Graphics2D::draw(TEXTURE_PAUSE_BG, Vector2::Zero);
@@ -87,38 +117,38 @@ void SceneGamePlay::draw() const
 	}
 }
 
-// IĂ邩
+// 終了しているか
 bool SceneGamePlay::is_end() const
 {
-	// ItOԂ
+	// 終了フラグを返す
 	return is_end_;
 }
 
-// ̃V[̎擾
+// 次のシーンの取得
 Scene SceneGamePlay::next() const
 {
 	return next_scene_;
 }
 
-// I
+// 終了
 void SceneGamePlay::end()
 {
-	world_.clear();		// [hNA
+	world_.clear();		// ワールドをクリア
 }
 
-// bZ[W
+// メッセージ処理
 void SceneGamePlay::handle_message(EventMessage message, void* param)
 {
-	// 󂯎bZ[W̎ނɂāAs
+	// 受け取ったメッセージの種類によって、処理を行う
 
-	// Q[I[o[̏ꍇ
+	// ゲームオーバーの場合
 	if (message == EventMessage::GameOver)
 	{
 		is_end_ = true;
 		return;
 	}
 
-	// Q[NȀꍇ
+	// ゲームクリアの場合
 	if (message == EventMessage::StageClear)
 	{
 		is_end_ = true;
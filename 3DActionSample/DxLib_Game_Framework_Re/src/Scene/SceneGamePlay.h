@@ -5,37 +5,37 @@
 #include "../World/World.h"
 #include "Scene.h"
 
-// NXFQ[vCV[
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：ゲームプレイシーン
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 class SceneGamePlay : public IScene
 {
 public:
-	// ftHgRXgN^
+	// デフォルトコンストラクタ
 	SceneGamePlay() = default;
-	// Jn
+	// 開始
 	virtual void start() override;
-	// XV
+	// 更新
 	virtual void update(float delta_time) override;
-	// `
+	// 描画
 	virtual void draw() const override;
-	// IĂ邩
+	// 終了しているか
 	virtual bool is_end() const override;
-	// ̃V[̎擾
+	// 次のシーンの取得
 	virtual Scene next() const override;
-	// I
+	// 終了
 	virtual void end() override;
-	// bZ[W
+	// メッセージ処理
 	void handle_message(EventMessage message, void* param);
 
 private:
-	// [h
+	// ワールド
 	World	world_;
-	// ItO
+	// 終了フラグ
 	bool	is_end_{ false };
-	// ̃V[iftHg̓^CgV[j
+	// 次のシーン（デフォルトはタイトルシーン）
 	Scene	next_scene_{ Scene::Title };
 
-	// |[YȂ̂
+	// ポーズ中なのか
 	bool	is_pause_{ false };
 };
 
@@ -11,10 +11,10 @@
 #include "../Sound/Sound.h"
 #include "../ID/SourceID.h"
 
-// NXF[fBOV[
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：ローディングシーン
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
-// Jn
+// 開始
 void SceneLoading::start()
 {
 	is_loaded_ = false;
@@ -22,61 +22,63 @@ void SceneLoading::start()
 	is_end_ = false;
 }
 
-// XV
+// 更新
 void SceneLoading::update(float delta_time)
 {
-	// f[^܂ǂݍłȂꍇAf[^ǂݍ
+	// データをまだ読み込んでいない場合、データを読み込む
 	if (!is_loaded_)
 	{
 		//------------------------------------------------------------
-		// œǂݍޑfނ
+		// ここで読み込む素材を入力
 		//------------------------------------------------------------
 
-		// Xe[W
-		CollisionMesh::load(MESH_STAGE_CASTLE, "res/test_assets/castle/SampleStage_Castle.mv1");	// Xe[Wf
-		Skybox::load(MESH_SKYBOX, "res/test_assets/skybox/skydome1.mv1");							// XJC{bNXf
-		Billboard::load(0, "res/test_assets/Particle02.png");										// r{[h
-		// LN^[
-		SkeletalMesh::load(MESH_PALADIN, "res/assets/Paladin/Paladin.mv1");							// vC[f
-		SkeletalMesh::load(MESH_GHOUL, "res/assets/Ghoul/ghoul.mv1");								// GGf
-		SkeletalMesh::load(MESH_DRAGONBOAR, "res/assets/DragonBoar/DragonBoar.mv1");				// {XGf
-		// 2D摜
-		Graphics2D::load(TEXTURE_TITLELOGO, "res/assets/texture/TitleLogo.png");					// ^CgS
-		Graphics2D::load(TEXTURE_START, "res/assets/texture/Start.png");							// X^[g\
-		Graphics2D::load(TEXTURE_PLAYER_HPGAUGE, "res/assets/texture/PlayerHPgauge.png");			// vC[̗̑̓Q[W
-		Graphics2D::load(TEXTURE_PLAYER_HP, "res/assets/texture/PlayerHP.png");						// vC[̗͕̑\
-		Graphics2D::load(TEXTURE_P1MESSAGE, "res/assets/texture/P1message.png");					// tF[Y1ڕWbZ[W
-		Graphics2D::load(TEXTURE_P2MESSAGE, "res/assets/texture/P2message.png");					// tF[Y2ڕWbZ[W
-		Graphics2D::load(TEXTURE_BOSS_HPGAUGE, "res/assets/texture/BossHPGauge.png");				// {X̗̑̓Q[W
-		Graphics2D::load(TEXTURE_BOSS_HP, "res/assets/texture/BossHP.png");							// {X̗͕̑\
-		Graphics2D::load(TEXTURE_PAUSE_BG, "res/assets/texture/pause_bg.png");						// |[Yʔwi
-		Graphics2D::load(TEXTURE_PAUSE_TEXT, "res/assets/texture/pause_text.png");					// |[Yʕ
+		// ステージ
+		CollisionMesh::load(MESH_STAGE_CASTLE, "res/test_assets/castle/SampleStage_Castle.mv1");	// ステージモデル
+		Skybox::load(MESH_SKYBOX, "res/test_assets/skybox/skydome1.mv1");							// スカイボックスモデル
+		Billboard::load(BILLBOARD_PARTICLE, "res/test_assets/Particle02.png");						// パーティクル
+		// キャラクター
+		SkeletalMesh::load(MESH_PALADIN, "res/assets/Paladin/Paladin.mv1");							// プレイヤーモデル
+		SkeletalMesh::load(MESH_GHOUL, "res/assets/Ghoul/ghoul.mv1");								// 雑魚敵モデル
+		SkeletalMesh::load(MESH_DRAGONBOAR, "res/assets/DragonBoar/DragonBoar.mv1");				// ボス敵モデル
+		// 2D画像
+		Graphics2D::load(TEXTURE_TITLELOGO, "res/assets/texture/TitleLogo.png");					// タイトルロゴ
+		Graphics2D::load(TEXTURE_START, "res/assets/texture/Start.png");							// スタート表示
+		Graphics2D::load(TEXTURE_PLAYER_HPGAUGE, "res/assets/texture/PlayerHPgauge.png");			// プレイヤーの体力ゲージ
+		Graphics2D::load(TEXTURE_PLAYER_HP, "res/assets/texture/PlayerHP.png");						// プレイヤーの体力表示
+		Graphics2D::load(TEXTURE_P1MESSAGE, "res/assets/texture/P1message.png");					// フェーズ1目標メッセージ
+		Graphics2D::load(TEXTURE_P2MESSAGE, "res/assets/texture/P2message.png");					// フェーズ2目標メッセージ
+		Graphics2D::load(TEXTURE_BOSS_HPGAUGE, "res/assets/texture/BossHPGauge.png");				// ボスの体力ゲージ
+		Graphics2D::load(TEXTURE_BOSS_HP, "res/assets/texture/BossHP.png");							// ボスの体力表示
+		Graphics2D::load(TEXTURE_PAUSE_BG, "res/assets/texture/pause_bg.png");						// ポーズ画面背景
+		Graphics2D::load(TEXTURE_PAUSE_TEXT, "res/assets/texture/pause_text.png");					// ポーズ画面文字
 
 		// BGM
-		Sound::load_bgm(BGM_TITLE, "res/assets/BGM/title.wav");										// ^CgBGM
-		Sound::load_bgm(BGM_STAGE, "res/assets/BGM/stage.wav");										// Xe[WBGM
-		Sound::load_bgm(BGM_BOSS, "res/assets/BGM/boss.wav");										// {XBGM
+		Sound::load_bgm(BGM_TITLE, "res/assets/BGM/title.wav");										// タイトル画面BGM
+		Sound::load_bgm(BGM_STAGE, "res/assets/BGM/stage.wav");										// ステージBGM
+		Sound::load_bgm(BGM_BOSS, "res/assets/BGM/boss.wav");										// ボス戦BGM
 		// SE
-		Sound::load_se(SE_START, "res/assets/SE/start.wav");										// Q[X^[gSE
-		Sound::load_se(SE_SLASH, "res/assets/SE/slash.wav");										// vC[U
-		Sound::load_se(SE_BLOCK, "res/assets/SE/block.wav");										// vC[h
-		Sound::load_se(SE_PLAYER_ATK_HIT, "res/assets/SE/player_atk_hit.wav");						// vC[U
-		Sound::load_se(SE_ENEMY_ATK_LIGHT, "res/assets/SE/enemy_atk_light.wav");					// G̍Uij
-		Sound::load_se(SE_ENEMY_ATK_HEAVY, "res/assets/SE/enemy_atk_heavy.wav");					// G̍Uij
-		Sound::load_se(SE_BOSS_TACKLE, "res/assets/SE/boss_tackle.wav");							// {XG̃^bN
-		Sound::load_se(SE_BOSS_ROAR, "res/assets/SE/boss_roar.mp3");								// {XG̙K
-		// VF[_[
-		ShaderManager::load_ps((int)ShaderID::PS_BrightPass, "res/shader/BrightPass.cso");			// PxoVF[_[
-		ShaderManager::load_ps((int)ShaderID::PS_GaussianBlurH, "res/shader/GaussianBlurH.cso");	// u[VF[_[
-		ShaderManager::load_ps((int)ShaderID::PS_GaussianBlurV, "res/shader/GaussianBlurV.cso");	// u[VF[_[
-		ShaderManager::load_ps((int)ShaderID::PS_BloomCombine, "res/shader/BloomCombine.cso");		// u[VF[_[
+		Sound::load_se(SE_START, "res/assets/SE/start.wav");										// ゲームスタートSE
+		Sound::load_se(SE_SLASH, "res/assets/SE/slash.wav");										// プレイヤー攻撃
+		Sound::load_se(SE_BLOCK, "res/assets/SE/block.wav");										// プレイヤー防御
+		Sound::load_se(SE_PLAYER_ATK_HIT, "res/assets/SE/player_atk_hit.wav");						// プレイヤー攻撃命中
+		Sound::load_se(SE_ENEMY_ATK_LIGHT, "res/assets/SE/enemy_atk_light.wav");					// 敵の攻撃（小）
+		Sound::load_se(SE_ENEMY_ATK_HEAVY, "res/assets/SE/enemy_atk_heavy.wav");					// 敵の攻撃（大）
+		Sound::load_se(SE_BOSS_TACKLE, "res/assets/SE/boss_tackle.wav");							// ボス敵のタックル
+		Sound::load_se(SE_BOSS_ROAR, "res/assets/SE/boss_roar.mp3");								// ボス敵の咆哮
+		// シェーダー
+		ShaderManager::load_ps((int)ShaderID::PS_BrightPass, "res/shader/BrightPass.cso");			// 輝度抽出シェーダー
+		ShaderManager::load_ps((int)ShaderID::PS_GaussianBlurH, "res/shader/GaussianBlurH.cso");	// 水平方向ブラーシェーダー
+		ShaderManager::load_ps((int)ShaderID::PS_GaussianBlurV, "res/shader/GaussianBlurV.cso");	// 垂直方向ブラーシェーダー
+		ShaderManager::load_ps((int)ShaderID::PS_BloomCombine, "res/shader/BloomCombine.cso");		// ブルーム合成シェーダー
+		ShaderManager::load_ps((int)ShaderID::PS_RadiationBlur, "res/shader/RadiationBlurShader.cso");	// 放射ブラーシェーダー
+		ShaderManager::load_ps((int)ShaderID::PS_PostEffect, "res/shader/PostEffectShader.cso");		// グレースケールシェーダー
 
 		//------------------------------------------------------------
 
-		// ǂݍޔTrueɂiǂݍݏIj
+		// 読み込む判定をTrueにする（読み込み終了）
 		is_loaded_ = true;
 	}
-	// f[^ǂݍ񂾏ꍇAI^C}[쓮A2bɃvCV[ֈڍs
+	// データを読み込んだ場合、終了タイマーを作動し、2秒後にプレイシーンへ移行
 	else
 	{
 		if (end_timer_.is_time_out())
@@ -88,26 +90,26 @@ void SceneLoading::update(float delta_time)
 	}
 }
 
-// `
+// 描画
 void SceneLoading::draw() const
 {
-	DrawString(0, 0, "f[^ǂݍݒc", GetColor(255, 255, 255));
+	DrawString(0, 0, "データ読み込み中…", GetColor(255, 255, 255));
 }
 
-// IĂ邩
+// 終了しているか
 bool SceneLoading::is_end() const
 {
 	return is_end_;
 }
 
-// ̃V[Ԃ
+// 次のシーンを返す
 Scene SceneLoading::next() const
 {
 	return Scene::Title;
 }
 
-// I
+// 終了
 void SceneLoading::end()
 {
-	// Ȃ
+	// 何もしない
 }
\ No newline at end of file
@@ -4,33 +4,33 @@
 #include "IScene.h"
 #include "../Math/CountdownTimer.h"
 
-// NXF[fBOV[
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：ローディングシーン
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 class SceneLoading : public IScene
 {
 private:
-	const float SceneChangeTime{ 120.0f };	// ̃V[Ɉڍs܂ł̎
+	const float SceneChangeTime{ 120.0f };	// 次のシーンに移行するまでの時間
 
 public:
-	// RXgN^
+	// コンストラクタ
 	SceneLoading() = default;
-	// Jn
+	// 開始
 	virtual void start() override;
-	// XV
+	// 更新
 	virtual void update(float delta_time) override;
-	// `
+	// 描画
 	virtual void draw() const override;
-	// IĂ邩
+	// 終了しているか
 	virtual bool is_end() const override;
-	// ̃V[Ԃ
+	// 次のシーンを返す
 	virtual Scene next() const override;
-	// I
+	// 終了
 	virtual void end() override;
 
 private:
-	bool			is_loaded_{ false };			// ǂݍޔ
-	CountdownTimer	end_timer_{ SceneChangeTime };	// I^C}[
-	bool			is_end_{ false };				// ItO
+	bool			is_loaded_{ false };			// 読み込む判定
+	CountdownTimer	end_timer_{ SceneChangeTime };	// 終了タイマー
+	bool			is_end_{ false };				// 終了フラグ
 };
 
 #endif // !SCENE_LOAD_GAME_PLAY_H_
\ No newline at end of file
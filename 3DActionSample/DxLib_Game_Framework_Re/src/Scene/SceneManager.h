@@ -4,37 +4,37 @@
 #include "IScenePtr.h"
 #include <unordered_map>
 
-// NXFV[Ǘ
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：シーン管理
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
 enum class Scene;
 
 class SceneManager
 {
 public:
-	// RXgN^
+	// コンストラクタ
 	SceneManager();
-	// 
+	// 初期化
 	void initialize();
-	// XV
+	// 更新
 	void update(float delta_time);
-	// `
+	// 描画
 	void draw() const;
-	// I
+	// 終了
 	void end();
-	// V[̒ǉ
+	// シーンの追加
 	void add(Scene name, const IScenePtr& scene);
-	// V[̕ύX
+	// シーンの変更
 	void change(Scene name);
 
-	// Rs[֎~
+	// コピー禁止
 	SceneManager(const SceneManager& other) = delete;
 	SceneManager& operator = (const SceneManager& other) = delete;
 
 private:
-	// V[Xg
+	// シーンリスト
 	std::unordered_map<Scene, IScenePtr> scenes_;
-	// ݂̃V[
+	// 現在のシーン
 	IScenePtr current_scene_;
 };
 
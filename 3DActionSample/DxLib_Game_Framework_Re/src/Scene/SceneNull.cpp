@@ -1,43 +1,43 @@
 #include "SceneNull.h"
 #include "Scene.h"
 
-// NXF󔒂̃V[
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：空白のシーン
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
-// Jn
+// 開始
 void SceneNull::start()
 {
-	// Ȃ
+	// 何もしない
 }
 
-// XV
+// 更新
 void SceneNull::update(float delta_time)
 {
-	// Ȃ
+	// 何もしない
 }
 
-// `
+// 描画
 void SceneNull::draw() const
 {
-	// Ȃ
+	// 何もしない
 }
 
-// IĂ邩
+// 終了しているか
 bool SceneNull::is_end() const
 {
-	// FalseԂ
+	// Falseを返す
 	return false;
 }
 
-// ̃V[̎擾
+// 次のシーンの取得
 Scene SceneNull::next() const
 {
-	// 󔒂̃V[ԂiV[Jڂ͂Ȃj
+	// 空白のシーンを返す（シーン遷移はない）
 	return Scene::None;
 }
 
-// I
+// 終了
 void SceneNull::end()
 {
-	// Ȃ
+	// 何もしない
 }
\ No newline at end of file
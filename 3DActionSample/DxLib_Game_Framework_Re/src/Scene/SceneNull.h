@@ -3,22 +3,22 @@
 
 #include "IScene.h"
 
-// NXF󔒂̃V[
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：空白のシーン
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 class SceneNull : public IScene
 {
 public:
-	// Jn
+	// 開始
 	virtual void start() override;
-	// XV
+	// 更新
 	virtual void update(float delta_time) override;
-	// `
+	// 描画
 	virtual void draw() const override;
-	// IĂ邩
+	// 終了しているか
 	virtual bool is_end() const override;
-	// ̃V[̎擾
+	// 次のシーンの取得
 	virtual Scene next() const override;
-	// I
+	// 終了
 	virtual void end() override;
 };
 
@@ -4,47 +4,47 @@
 #include "IScene.h"
 #include "../World/World.h"
 
-// NXF^CgV[
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：タイトルシーン
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
 class SceneTitle : public IScene
 {
 public:
-	// ftHgRXgN^
+	// デフォルトコンストラクタ
 	SceneTitle() = default;
-	// Jn
+	// 開始
 	virtual void start() override;
-	// XV
+	// 更新
 	virtual void update(float delta_time) override;
-	// `
+	// 描画
 	virtual void draw() const override;
-	// IĂ邩
+	// 終了しているか
 	virtual bool is_end() const override;
-	// ̃V[̎擾
+	// 次のシーンの取得
 	virtual Scene next() const override;
-	// I
+	// 終了
 	virtual void end() override;
-	// bZ[W
+	// メッセージ処理
 	void handle_message(EventMessage message, void* param);
 
 private:
-	// ^CgS̕`
+	// タイトルロゴの描画
 	void draw_logo() const;
-	// X^[gbZ[W̕`
+	// スタートメッセージの描画
 	void draw_start() const;
 
 private:
-	// [hNX
+	// ワールドクラス
 	World	world_;
-	// ItO
+	// 終了フラグ
 	bool	is_end_{ false };
 
-	bool is_started_{ false };			// X^[g{^ꂽ
-	bool show_start_{ false };			// X^[gbZ[W\邩
-	float show_start_timer_{ 0.0f };	// ^CgʋN^C}[
-	float end_timer_{ 0.0f };			// V[I^C}[
+	bool is_started_{ false };			// スタートボタンが押されたか
+	bool show_start_{ false };			// スタートメッセージを表示するか
+	float show_start_timer_{ 0.0f };	// タイトル画面起動タイマー
+	float end_timer_{ 0.0f };			// シーン終了タイマー
 
-	int fade_counter_{ 0 };				// tF[hC/tF[hAEgpJE^[
+	int fade_counter_{ 0 };				// フェードイン/フェードアウト用カウンター
 };
 
 #endif // !SCENE_TITLE_H_
\ No newline at end of file
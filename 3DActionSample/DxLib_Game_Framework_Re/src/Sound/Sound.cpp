@@ -1,17 +1,17 @@
 #include "Sound.h"
 #include <DxLib.h>
 
-// NXFTEh
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：サウンド
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
-// BGMnh
+// BGMハンドル
 std::unordered_map<int, int> Sound::bgm_map_;
-// ĐBGM
+// 再生中のBGM
 int Sound::current_bgm_{ -1 };
-// SEnh
+// SEハンドル
 std::unordered_map<int, int> Sound::se_map_;
 
-// TEh̏
+// サウンドの初期化
 void Sound::initialize()
 {
 	stop_bgm();
@@ -21,23 +21,23 @@ void Sound::initialize()
 	current_bgm_ = -1;
 }
 
-// BGMf[^̓ǂݍ
+// BGMデータの読み込み
 void Sound::load_bgm(int id, const std::string& file_name)
 {
 	bgm_map_[id] = LoadSoundMem(file_name.c_str(), 1);
 }
 
-// BGM̍Đ
+// BGMの再生
 void Sound::play_bgm(int id)
 {
-	// ݍĐBGM~
+	// 現在再生中のBGMを停止
 	stop_bgm();
-	// VBGMĐi[vōĐj
+	// 新しいBGMを再生（ループで再生）
 	current_bgm_ = bgm_map_[id];
 	PlaySoundMem(current_bgm_, DX_PLAYTYPE_BACK | DX_PLAYTYPE_LOOP);
 }
 
-// BGM̒~
+// BGMの停止
 void Sound::stop_bgm()
 {
 	if (current_bgm_ == -1) return;
@@ -45,35 +45,35 @@ void Sound::stop_bgm()
 	current_bgm_ = -1;
 }
 
-// BGM̍폜
+// BGMの削除
 void Sound::delete_bgm(int id)
 {
 	DeleteSoundMem(bgm_map_[id]);
 	bgm_map_.erase(id);
 }
 
-// SEt@C̓ǂݍ
+// SEファイルの読み込み
 void Sound::load_se(int id, const std::string & file_name)
 {
 	se_map_[id] = LoadSoundMem(file_name.c_str());
 }
 
-// SE̍Đ
+// SEの再生
 void Sound::play_se(int id)
 {
 	PlaySoundMem(se_map_[id], DX_PLAYTYPE_BACK);
 }
 
-// SE̍폜
+// SEの削除
 void Sound::delete_se(int id)
 {
 	DeleteSoundMem(se_map_[id]);
 	se_map_.erase(id);
 }
 
-// TEh̏I
+// サウンドの終了処理
 void Sound::finalize()
 {
-	// Ɠ
+	// 初期化と同じ処理
 	initialize();
 }
\ No newline at end of file
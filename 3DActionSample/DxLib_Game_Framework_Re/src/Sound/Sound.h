@@ -4,36 +4,36 @@
 #include <string>
 #include <unordered_map>
 
-// NXFTEh
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：サウンド
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 class Sound
 {
 public:
-	// 
+	// 初期化
 	static void initialize();
-	// BGMt@C̓ǂݍ
+	// BGMファイルの読み込み
 	static void load_bgm(int id, const std::string& file_name);
-	// BGM̍Đ
+	// BGMの再生
 	static void play_bgm(int id);
-	// BGM̒~
+	// BGMの停止
 	static void stop_bgm();
-	// BGM̍폜
+	// BGMの削除
 	static void delete_bgm(int id);
-	// SEt@C̓ǂݍ
+	// SEファイルの読み込み
 	static void load_se(int id, const std::string& file_name);
-	// SE̍Đ
+	// SEの再生
 	static void play_se(int id);
-	// SE̍폜
+	// SEの削除
 	static void delete_se(int id);
-	// I
+	// 終了
 	static void finalize();
 
 private:
-	// BGMnh
+	// BGMハンドル
 	static std::unordered_map<int, int> bgm_map_;
-	// ĐBGM
+	// 再生中のBGM
 	static int current_bgm_;
-	// SEnh
+	// SEハンドル
 	static std::unordered_map<int, int> se_map_;
 };
 
@@ -5,34 +5,47 @@
 #include <string>
 #include <functional>
 
-// ۃC^[tF[XF[h
-// ҁF Qi"Jacky" Ho Siu Kij
+// 抽象インターフェース：ワールド
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
 enum class ActorGroup;
 enum class EventMessage;
 class Field;
+class AnimationArena;
+class RenderQueue;
+class ParticleSystem;
 
 class IWorld
 {
 public:
-	// zfXgN^
+	// 仮想デストラクタ
 	virtual ~IWorld() { }
-	// AN^[̒ǉ
+	// アクターの追加
 	virtual void add_actor(ActorGroup group, const ActorPtr& actor) = 0;
-	// AN^[̎擾
+	// アクターの取得
 	virtual ActorPtr find_actor(ActorGroup group, const std::string& name) const = 0;
-	// AN^[̎擾
+	// アクター数の取得
 	virtual unsigned int count_actor(ActorGroup group) const = 0;
-	// AN^[Xg̏
+	// アクターリストの巡回
 	virtual void each_actor(ActorGroup group, std::function<void(const ActorPtr&)> fn) const = 0;
-	// bZ[W̑M
+	// メッセージの送信
 	virtual void send_message(EventMessage message, void* param = nullptr) = 0;
-	// tB[h̎擾
+	// フィールドの取得
 	virtual Field& field() = 0;
-	// J̎擾
+	// カメラの取得
 	virtual ActorPtr camera() = 0;
-	// Cg̎擾
+	// ライトの取得
 	virtual ActorPtr light() = 0;
+	// 経過tick数の取得
+	virtual unsigned int tick() const = 0;
+	// アクターIDの採番（生成順に0から、メインスレッドのみ）
+	virtual unsigned int issue_actor_id() = 0;
+	// アニメーション用メモリアリーナの取得
+	virtual AnimationArena& animation_arena() = 0;
+	// 描画コマンドリストの取得
+	virtual RenderQueue& render_queue() = 0;
+	// パーティクルシステムの取得
+	virtual ParticleSystem& particles() = 0;
 };
 
 #endif // !IWORLD_H_
\ No newline at end of file
@@ -2,252 +2,308 @@
 #include "../Field/Field.h"
 #include "../Actor/ActorGroup.h"
 #include "../Actor/Actor.h"
-#include "../Graphic/Shader/BloomCB.h"
-#include "../Graphic/Shader/ShaderID.h"
 #include "../Graphic/Graphics3D.h"
-#include "../Graphic/Shader/ShaderManager.h"
+#include "../Graphic/PoseCache.h"
+#include "../Graphic/SkeletonJobs.h"
+#include "../Graphic/AnimationLOD.h"
+#include "../Graphic/SkeletalMesh.h"
 
-// NXF[h
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：ワールド
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
-// RXgN^
+// コンストラクタ
 World::World()
 {
-	// s
+	// 初期化処理を行う
 	initialize();
 }
 
-// 
+// 初期化
 void World::initialize()
 {
-	// SẴf[^
+	// 全てのデータを消去
 	clear();
-	// AN^[O[vAN^[O[v}l[W[ɒǉ
-	actors_.add_group(ActorGroup::None);			// 
-	actors_.add_group(ActorGroup::Player);			// vC[
-	actors_.add_group(ActorGroup::PlayerAttack);	// vC[̍U
-	actors_.add_group(ActorGroup::Enemy);			// G
-	actors_.add_group(ActorGroup::EnemyAttack);		// G̍U
-	actors_.add_group(ActorGroup::Effect);			// GtFNg
+	// アクターグループをアクターグループマネージャーに追加
+	actors_.add_group(ActorGroup::None);			// 所属無し
+	actors_.add_group(ActorGroup::Player);			// プレイヤー
+	actors_.add_group(ActorGroup::PlayerAttack);	// プレイヤーの攻撃
+	actors_.add_group(ActorGroup::Enemy);			// 敵
+	actors_.add_group(ActorGroup::EnemyAttack);		// 敵の攻撃
+	actors_.add_group(ActorGroup::Effect);			// エフェクト
 	actors_.add_group(ActorGroup::UI);				// UI
-
-	// VF[_[p萔obt@𐶐
-	cb_bloom_ = CreateShaderConstantBuffer(sizeof(BloomCB));
+	// アクターIDとtickをリセット（乱数ストリームの再現性を保つため）
+	next_actor_id_ = 0;
+	tick_ = 0;
 }
 
-// XV
+// 更新
 void World::update(float delta_time)
 {
-	// eAN^[̏ԂXV
+	// 前のtickのポーズキャッシュを消去
+	PoseCache::clear();
+	// アニメーションLOD用のカメラの状態と、前回の描画で作った遮蔽カリング用の深度バッファを取得
+	AnimationLOD::update_view(&occlusion_);
+	// パーティクルの統計をリセット
+	particles_.reset_stats();
+	// 各アクターの状態を更新
 	actors_.update(delta_time);
-	// ڐGs
+	// 各アクターのスケルトンのワールド変換行列を並列に計算
+	SkeletonJobs::run();
+	// 接触判定を行う
 	actors_.collide(ActorGroup::Player, ActorGroup::Enemy);
 	actors_.collide(ActorGroup::Player, ActorGroup::EnemyAttack);
 	actors_.collide(ActorGroup::PlayerAttack, ActorGroup::Enemy);
 	actors_.collide(ActorGroup::Enemy);
-	// SAN^[폜
+	// 死亡したアクターを削除
 	actors_.remove();
+	// このtickで発生したものを含め、全パーティクルを更新
+	particles_.update(delta_time);
 
-	// J̏ԂXV
+	// カメラの状態を更新
 	camera_->update(delta_time);
-	// Cg̏ԂXV
+	// ライトの状態を更新
 	light_->update(delta_time);
+
+	// tickを進める
+	++tick_;
 }
 
-// `
+// 描画
 void World::draw() const
 {
-	// u[VF[_[p̃p[^ݒ
-	BloomCB bloom_param;						// u[VF[_[p萔obt@錾
-	bloom_param.g_BrightPassThreshold = 0.5f;	// oPx̍ŏl
-	bloom_param.g_BloomIntensity = 0.75f;		// u[eNX`̋Px
-	bloom_param.g_BloomSaturation = 0.75f;		// u[eNX`̍ʓx
-	bloom_param.g_BaseIntensity = 0.8f;			// eNX`̋Px
-	bloom_param.g_BaseSaturation = 0.8f;		// eNX`̍ʓx
-
-	// sNZVF[_[p̒萔obt@̃AhX擾
-	auto cb = (BloomCB*)GetBufferShaderConstantBuffer(cb_bloom_);
-	// 萔obt@̒lݒ
-	*cb = bloom_param;
-	// sNZVF[_[p̒萔obt@XVāAe𔽉f
-	UpdateShaderConstantBuffer(cb_bloom_);
-	// sNZVF[_[̒萔obt@4Ԗڂ̃XbgɎw
-	SetShaderConstantBuffer(cb_bloom_, DX_SHADERTYPE_PIXEL, 4);
-
-	// --------------------------------------------------
-	// 摜Ƀ_O
-	// --------------------------------------------------
-	rt_source_.begin();		// 摜̃_[^[QbgN
-	Graphics3D::clear();	// ʂNA
-
-	// ŃVF[_[KpAN^[`
-	camera_->draw();		// Jݒ
-	light_->draw();
-	field_->draw();
-	actors_.draw(ActorGroup::Player);
-	actors_.draw(ActorGroup::Enemy);
-	actors_.draw(ActorGroup::PlayerAttack);
-	actors_.draw(ActorGroup::EnemyAttack);
-
-	rt_source_.end();		// 摜̃_[^[QbgI
-	// --------------------------------------------------
-
-	// --------------------------------------------------
-	// Px𒊏o
-	// --------------------------------------------------
-	rt_bright_.begin();										// Px̃_[^[QbgN
-	ShaderManager::set_ps((int)ShaderID::PS_BrightPass);	// PxoVF[_[w
-	SetUseTextureToShader(0, rt_source_.texture());			// 摜ɃVF[_[
-	rt_bright_.draw();										// Px̃_[^[Qbg`
-	rt_bright_.end();										// Px̃_[^[QbgI
-
-	// --------------------------------------------------
-
-	// --------------------------------------------------
-	// u[
-	// --------------------------------------------------
-
-	rt_bluer_h_.begin();									// u[̃_[^[QbgN
-	ShaderManager::set_ps((int)ShaderID::PS_GaussianBlurH);	// u[VF[_[w
-	SetUseTextureToShader(0, rt_bright_.texture());			// Pxo摜ɃVF[_[
-	rt_bluer_h_.draw();										// u[̃_[^[Qbg`
-	rt_bluer_h_.end();										// u[̃_[^[QbgI
-
-	// --------------------------------------------------
-
-	// --------------------------------------------------
-	// u[
-	// --------------------------------------------------
-
-	rt_bluer_v_.begin();									// u[̃_[^[QbgN
-	ShaderManager::set_ps((int)ShaderID::PS_GaussianBlurV);	// u[VF[_[w
-	SetUseTextureToShader(0, rt_bluer_h_.texture());		// u[ƍ摜ɃVF[_[
-	rt_bluer_v_.draw();										// u[̃_[^[Qbg`
-	rt_bluer_v_.end();										// u[̃_[^[QbgI
-
-	// --------------------------------------------------
-
-	// --------------------------------------------------
-	// 摜ƃu[摜
-	// --------------------------------------------------
-
-	rt_bloom_combine_.begin();								// u[p̃_[^[QbgN
-	ShaderManager::set_ps((int)ShaderID::PS_BloomCombine);	// u[VF[_[w
-	// 摜ƃu[摜
-	SetUseTextureToShader(0, rt_source_.texture());
-	SetUseTextureToShader(1, rt_bluer_v_.texture());
-	rt_bloom_combine_.draw();								// u[p̃_[^[Qbg`
-	rt_bloom_combine_.end();								// u[p̃_[^[QbgI
-
-	// --------------------------------------------------
+	// 有効なポストエフェクトの組み合わせが変わった場合はフレームグラフを作り直す
+	if (!frame_graph_built_ || !post_effects_.has_same_passes(built_post_effects_))
+	{
+		build_frame_graph();
+	}
+	frame_graph_.execute(frame_graph_backend_);
+}
 
-	// --------------------------------------------------
-	// ēx摜Ƀ_OāAVF[_[KpȂʂƓKpʂ
-	// --------------------------------------------------
+// フレームグラフの構築
+void World::build_frame_graph() const
+{
+	frame_graph_.reset();
+
+	// 元画像にシェーダーを適用するアクターを描画
+	const int source = frame_graph_.create_texture("Source", RenderTargetDesc{ WindowSetting::WindowWidth, WindowSetting::WindowHeight });
+	frame_graph_.add_pass("Scene", { }, source, [this](IFrameGraphBackend&, const FramePass&) { draw_scene(); });
+
+	// ブルームは常に宣言し、無効な場合は出力を使わないことでパスごと除かれる
+	const int bloom = PostEffect::add_bloom(frame_graph_, source, post_effects_);
+	int color = post_effects_.bloom ? bloom : source;
+	if (post_effects_.radiation_blur)
+	{
+		color = PostEffect::add_radiation_blur(frame_graph_, color, post_effects_);
+	}
+	if (post_effects_.grayscale)
+	{
+		color = PostEffect::add_grayscale(frame_graph_, color);
+	}
+
+	// シェーダーを適用しないアクターは最終画像に重ねて描画
+	frame_graph_.add_pass("Overlay", { }, color, [this](IFrameGraphBackend&, const FramePass&) { draw_overlay(); });
+
+	frame_graph_.compile(color);
+	built_post_effects_ = post_effects_;
+	frame_graph_built_ = true;
+}
 
-	rt_source_.begin();									// 摜̃_[^[QbgN
-	DrawGraph(0, 0, rt_bloom_combine_.texture(), TRUE);	// VF[_[f`
-	// ŃVF[_[KpȂAN^[`
-	camera_->draw();				// Jݒ
-	actors_.draw(ActorGroup::UI);	// AN^[`
-	rt_source_.end();									// 摜̃_[^[QbgI
+// シェーダーを適用するアクターの描画
+void World::draw_scene() const
+{
+	Graphics3D::clear();	// 画面をクリア
 
-	// --------------------------------------------------
+	camera_->draw();		// カメラを設定
+	light_->draw();
+	field_->draw();
+	// カメラの視錐台の外にあるアクターは描画しない
+	const auto view_projection = Graphics3D::get_view_matrix() * Graphics3D::get_projection_matrix();
+	culling_.begin(view_projection);
+	// フィールドの遮蔽物を低解像度の深度バッファに描画し、遮蔽物に隠れたアクターも描画しない
+	occlusion_.render(field_->occluders(), view_projection);
+	culling_.set_occlusion(&occlusion_);
+	// メッシュの描画はコマンドとして記録し、ソートしてからまとめて実行する
+	render_queue_.reset_stats();
+	SkeletalMesh::reset_upload_stats();
+	render_queue_.set_pass(PassSource);
+	actors_.draw(ActorGroup::Player, culling_);
+	actors_.draw(ActorGroup::Enemy, culling_);
+	actors_.draw(ActorGroup::PlayerAttack, culling_);
+	actors_.draw(ActorGroup::EnemyAttack, culling_);
+	render_queue_.sort();
+	render_queue_.execute(render_backend_);
+	// パーティクルはメッシュの後にバッファごとにまとめて描画
+	particle_renderer_.draw(particles_, Graphics3D::get_view_matrix());
+}
 
-	// ŏI摜`
-	DrawGraph(0, 0, rt_source_.texture(), FALSE);
+// シェーダーを適用しないアクターの描画
+void World::draw_overlay() const
+{
+	camera_->draw();				// カメラを設定
+	render_queue_.set_pass(PassOverlay);
+	actors_.draw(ActorGroup::UI);	// アクターを描画
+	render_queue_.sort();
+	render_queue_.execute(render_backend_);
 }
 
-// bZ[W
+// メッセージ処理
 void World::handle_message(EventMessage message, void* param)
 {
-	// [h̃bZ[W
+	// ワールドのメッセージ処理
 	listener_(message, param);
 
-	// AN^[̃bZ[W
+	// アクターのメッセージ処理
 	actors_.handle_message(message, param);
 	camera_->handle_message(message, param);
 	light_->handle_message(message, param);
 }
 
-// bZ[WXi[̓o^
+// メッセージリスナーの登録
 void World::add_event_message_listener(EventMessageListener listener)
 {
 	listener_ = listener;
 }
 
-// tB[h̒ǉ
+// フィールドの追加
 void World::add_field(const FieldPtr& field)
 {
 	field_ = field;
 }
 
-// J̒ǉ
+// カメラの追加
 void World::add_camera(const ActorPtr& camera)
 {
 	camera_ = camera;
 }
 
-// Cg̒ǉ
+// ライトの追加
 void World::add_light(const ActorPtr& light)
 {
 	light_ = light;
 }
 
-// Sf[^̏
+// 全データの消去
 void World::clear()
 {
 	actors_.clear();
+	particles_.clear();
+	occlusion_.clear();
 	field_ = nullptr;
 	light_ = nullptr;
 	camera_ = nullptr;
 	listener_ = [](EventMessage, void*) {};
 }
 
-// AN^[ǉ
+// アクターを追加
 void World::add_actor(ActorGroup group, const ActorPtr& actor)
 {
 	actors_.add_actor(group, actor);
 }
 
-// AN^[̎擾
+// アクターの取得
 ActorPtr World::find_actor(ActorGroup group, const std::string& name) const
 {
 	return actors_.find(group, name);
 }
 
-// AN^[̎擾
+// アクター数の取得
 unsigned int World::count_actor(ActorGroup group) const
 {
 	return actors_.count(group);
 }
 
-// AN^[Xg̏
+// アクターリストの巡回
 void World::each_actor(ActorGroup group, std::function<void(const ActorPtr&)> fn) const
 {
 	actors_.each(group, fn);
 }
 
-// bZ[W̑M
+// メッセージの送信
 void World::send_message(EventMessage message, void* param)
 {
 	handle_message(message, param);
 }
 
-// tB[h̎擾
+// フィールドの取得
 Field& World::field()
 {
 	return *field_;
 }
 
-// J̎擾
+// カメラの取得
 ActorPtr World::camera()
 {
 	return camera_;
 }
 
-// Cg̎擾
+// ライトの取得
 ActorPtr World::light()
 {
 	return light_;
+}
+
+// 経過tick数の取得
+unsigned int World::tick() const
+{
+	return tick_;
+}
+
+// アクターIDの採番（生成順に0から、メインスレッドのみ）
+unsigned int World::issue_actor_id()
+{
+	return next_actor_id_++;
+}
+
+// アニメーション用メモリアリーナの取得
+AnimationArena& World::animation_arena()
+{
+	return animation_arena_;
+}
+
+// 視錐台カリングの取得（統計の参照用）
+const FrustumCulling& World::culling() const
+{
+	return culling_;
+}
+
+// 描画コマンドリストの取得
+RenderQueue& World::render_queue()
+{
+	return render_queue_;
+}
+
+// 遮蔽カリング用の深度バッファの取得（統計の参照用）
+const OcclusionBuffer& World::occlusion() const
+{
+	return occlusion_;
+}
+
+// 描画コマンドリストの取得（統計の参照用）
+const RenderQueue& World::render_queue() const
+{
+	return render_queue_;
+}
+
+// パーティクルシステムの取得
+ParticleSystem& World::particles()
+{
+	return particles_;
+}
+
+// パーティクルシステムの取得（統計の参照用）
+const ParticleSystem& World::particles() const
+{
+	return particles_;
+}
+
+// ポストエフェクトの設定の取得
+PostEffectSettings& World::post_effects()
+{
+	return post_effects_;
+}
+
+// フレームグラフの取得（構築結果の参照用）
+const FrameGraph& World::frame_graph() const
+{
+	return frame_graph_;
 }
\ No newline at end of file
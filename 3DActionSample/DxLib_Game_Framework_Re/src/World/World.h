@@ -6,84 +6,145 @@
 #include "../Actor/ActorPtr.h"
 #include "../Field/FieldPtr.h"
 #include "../Game/WindowSetting.h"
-#include "../Graphic/Shader/RenderTarget.h"
+#include "../Graphic/Shader/FrameGraph.h"
+#include "../Graphic/Shader/PoolFrameGraphBackend.h"
+#include "../Graphic/Shader/PostEffect.h"
+#include "../Graphic/AnimationArena.h"
+#include "../Graphic/FrustumCulling.h"
+#include "../Graphic/OcclusionBuffer.h"
+#include "../Graphic/RenderQueue.h"
+#include "../Graphic/DxLibRenderBackend.h"
+#include "../Graphic/ParticleSystem.h"
+#include "../Graphic/ParticleRenderer.h"
 #include <functional>
 
-// NXF[h
-// ҁF Qi"Jacky" Ho Siu Kij
+// クラス：ワールド
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
 
 enum class EventMessage;
 
 class World : public IWorld
 {
 public:
-	// CxgbZ[WXi[
+	// イベントメッセージリスナー
 	using EventMessageListener = std::function<void(EventMessage, void*)>;
 
 public:
-	// RXgN^
+	// コンストラクタ
 	World();
-	// 
+	// 初期化
 	void initialize();
-	// XV
+	// 更新
 	void update(float delta_time);
-	// `
+	// 描画
 	void draw() const;
-	// bZ[W
+	// メッセージ処理
 	void handle_message(EventMessage message, void* param);
-	// bZ[WXi[̓o^
+	// メッセージリスナーの登録
 	void add_event_message_listener(EventMessageListener listener);
-	// tB[h̒ǉ
+	// フィールドの追加
 	void add_field(const FieldPtr& field);
-	// J̒ǉ
+	// カメラの追加
 	void add_camera(const ActorPtr& camera);
-	// Cg̒ǉ
+	// ライトの追加
 	void add_light(const ActorPtr& light);
-	// Sf[^̏
+	// 全データの消去
 	void clear();
 
-	// AN^[ǉ
+	// アクターを追加
 	virtual void add_actor(ActorGroup group, const ActorPtr& actor) override;
-	// AN^[̎擾
+	// アクターの取得
 	virtual ActorPtr find_actor(ActorGroup group, const std::string& name) const override;
-	// AN^[̎擾
+	// アクター数の取得
 	virtual unsigned int count_actor(ActorGroup group) const override;
-	// AN^[Xg̏
+	// アクターリストの巡回
 	virtual void each_actor(ActorGroup group, std::function<void(const ActorPtr&)> fn) const override;
-	// bZ[W̑M
+	// メッセージの送信
 	virtual void send_message(EventMessage message, void* param = nullptr) override;
-	// tB[h̎擾
+	// フィールドの取得
 	virtual Field& field() override;
-	// J̎擾
+	// カメラの取得
 	virtual ActorPtr camera() override;
-	// Cg̎擾
+	// ライトの取得
 	virtual ActorPtr light() override;
+	// 経過tick数の取得
+	virtual unsigned int tick() const override;
+	// アクターIDの採番（生成順に0から、メインスレッドのみ）
+	virtual unsigned int issue_actor_id() override;
+	// アニメーション用メモリアリーナの取得
+	virtual AnimationArena& animation_arena() override;
+	// 描画コマンドリストの取得
+	virtual RenderQueue& render_queue() override;
+	// パーティクルシステムの取得
+	virtual ParticleSystem& particles() override;
+	// 視錐台カリングの取得（統計の参照用）
+	const FrustumCulling& culling() const;
+	// 遮蔽カリング用の深度バッファの取得（統計の参照用）
+	const OcclusionBuffer& occlusion() const;
+	// 描画コマンドリストの取得（統計の参照用）
+	const RenderQueue& render_queue() const;
+	// パーティクルシステムの取得（統計の参照用）
+	const ParticleSystem& particles() const;
+	// ポストエフェクトの設定の取得（変更は次の描画から反映される）
+	PostEffectSettings& post_effects();
+	// フレームグラフの取得（構築結果の参照用）
+	const FrameGraph& frame_graph() const;
 
-	// Rs[֎~
+	// コピー禁止
 	World(const World& other) = delete;
 	World& operator = (const World& other) = delete;
 
 private:
-	// AN^[O[v}l[W[
+	// フレームグラフの構築
+	void build_frame_graph() const;
+	// シェーダーを適用するアクターの描画
+	void draw_scene() const;
+	// シェーダーを適用しないアクターの描画
+	void draw_overlay() const;
+
+private:
+	// アニメーション用メモリアリーナ（アクターより後に破棄する）
+	AnimationArena			animation_arena_;
+	// アクターグループマネージャー
 	ActorGroupManager		actors_;
-	// tB[h
+	// フィールド
 	FieldPtr				field_;
-	// J
+	// カメラ
 	ActorPtr				camera_;
-	// Cg
+	// ライト
 	ActorPtr				light_;
-	// bZ[WXi[
+	// メッセージリスナー
 	EventMessageListener	listener_{ [](EventMessage, void*) {} };
+	// 経過tick数
+	unsigned int			tick_{ 0 };
+	// 次に採番するアクターID
+	unsigned int			next_actor_id_{ 0 };
+	// 視錐台カリング
+	mutable FrustumCulling	culling_;
+	// 遮蔽カリング用の深度バッファ（次のtickのアニメーションLODでも使う）
+	mutable OcclusionBuffer	occlusion_;
+	// 描画コマンドリスト
+	mutable RenderQueue		render_queue_;
+	// 描画バックエンド
+	mutable DxLibRenderBackend	render_backend_;
+	// 描画パスの番号（描画コマンドのレンダーターゲット）
+	static const int		PassSource{ 0 };	// シェーダーを適用する描画
+	static const int		PassOverlay{ 1 };	// シェーダーを適用しない描画
+	// パーティクルシステム
+	ParticleSystem			particles_;
+	// パーティクルの描画
+	mutable ParticleRenderer	particle_renderer_;
 
-	// VF[_[p_[^[Qbg
-	mutable RenderTarget rt_source_{ WindowSetting::WindowWidth , WindowSetting::WindowHeight };
-	mutable RenderTarget rt_bright_{ WindowSetting::WindowWidth / 4 , WindowSetting::WindowHeight / 4 };
-	mutable RenderTarget rt_bluer_h_{ WindowSetting::WindowWidth / 4 , WindowSetting::WindowHeight / 4 };
-	mutable RenderTarget rt_bluer_v_{ WindowSetting::WindowWidth / 4 , WindowSetting::WindowHeight / 4 };
-	mutable RenderTarget rt_bloom_combine_{ WindowSetting::WindowWidth , WindowSetting::WindowHeight };
-
-	// sNZVF[_[p̒萔obt@
-	int cb_bloom_;	// u[p
+	// ポストエフェクトの設定
+	PostEffectSettings		post_effects_;
+	// フレームグラフ構築時のポストエフェクトの設定
+	mutable PostEffectSettings	built_post_effects_;
+	// フレームグラフが構築済みか
+	mutable bool			frame_graph_built_{ false };
+	// ポストエフェクトのフレームグラフ
+	mutable FrameGraph		frame_graph_;
+	// フレームグラフの実行先
+	mutable PoolFrameGraphBackend	frame_graph_backend_;
 };
 
 #endif // !WORLD_H_
\ No newline at end of file
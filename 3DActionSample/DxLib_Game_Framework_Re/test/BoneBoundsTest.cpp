@@ -0,0 +1,219 @@
+#include "../src/Graphic/BoneBounds.h"
+#include "../src/Graphic/Skeleton.h"
+#include "../src/Math/Quaternion.h"
+#include "../src/Math/Random.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+// ボーンの境界球の検証
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// 合成したバインドポーズのメッシュをBindPoseMesh::saveで書き出して読み込み、BoneBoundsで求めたAABBが
+// ランダムな姿勢でスキニングした全頂点（複数のボーンにまたがる頂点はウェイトもランダム）を含むことを確かめる。
+// SkeletalMesh::save_bind_poseで書き出したメッシュのファイルを引数に指定すると、それも同じ方法で検証する。
+// 使い方：bone_bounds_test [バインドポーズのファイル...]
+
+// 合成メッシュのボーン数
+static const int BoneCount{ 40 };
+// ボーンあたりの頂点数
+static const int VerticesPerBone{ 24 };
+// 検証する姿勢の数
+static const int PoseCount{ 200 };
+// 包含判定の許容誤差（単精度の変換の丸め誤差）
+static const float ContainTolerance{ 1.0e-3f };
+// 一時ファイル名
+static const char* TemporaryFile{ "bone_bounds_test.tmp" };
+
+// 失敗した検証の数
+static int s_failures{ 0 };
+
+// 検証結果の表示
+static void check(const char* name, bool passed)
+{
+	std::printf("%-48s %s\n", name, passed ? "ok" : "FAILED");
+	s_failures += passed ? 0 : 1;
+}
+
+// 合成メッシュの作成（鎖状のボーン、2頂点に1つは親ボーンにも登録し、数頂点はウェイトなし）
+static BindPoseMesh make_mesh()
+{
+	std::vector<int> parents(BoneCount);
+	std::vector<AffineMatrix> locals(BoneCount);
+	for (int bone = 0; bone < BoneCount; ++bone)
+	{
+		parents[bone] = (bone < 8) ? bone - 1 : bone - 8;
+		locals[bone] = AffineMatrix::CreateWorld(Vector3::One, Quaternion(Vector3::UnitZ, (bone < 8) ? 0.0f : 15.0f * (bone % 8)), (bone == 0) ? Vector3::Zero : Vector3(0.0f, 8.0f, 0.0f));
+	}
+	const Skeleton skeleton(parents);
+
+	BindPoseMesh mesh;
+	mesh.bone_matrices.resize(BoneCount);
+	skeleton.transform(locals.data(), AffineMatrix::Identity, mesh.bone_matrices.data());
+	Random random(1);
+	for (int bone = 0; bone < BoneCount; ++bone)
+	{
+		for (int i = 0; i < VerticesPerBone; ++i)
+		{
+			const Vector3 local(random.rand_float(-2.0f, 2.0f), random.rand_float(0.0f, 8.0f), random.rand_float(-2.0f, 2.0f));
+			const Vector3 position = AffineMatrix::Transform(local, mesh.bone_matrices[bone]);
+			mesh.positions.push_back(position);
+			mesh.bones.push_back((i == 0 && bone % 10 == 0) ? -1 : bone);
+			if (i % 2 == 0 && parents[bone] >= 0)
+			{
+				mesh.positions.push_back(position);
+				mesh.bones.push_back(parents[bone]);
+			}
+		}
+	}
+	return mesh;
+}
+
+// ランダムな姿勢（各ボーンのバインドポーズにランダムな回転・拡大・平行移動を掛けたワールド変換行列）
+static std::vector<AffineMatrix> random_pose(const BindPoseMesh& mesh, Random& random)
+{
+	std::vector<AffineMatrix> result(mesh.bone_matrices.size());
+	for (std::size_t bone = 0; bone < result.size(); ++bone)
+	{
+		const Vector3 axis = Vector3::Normalize(Vector3(random.rand_float(-1.0f, 1.0f), random.rand_float(-1.0f, 1.0f), random.rand_float(0.1f, 1.0f)));
+		const Vector3 scale(random.rand_float(0.8f, 1.2f), random.rand_float(0.8f, 1.2f), random.rand_float(0.8f, 1.2f));
+		const Vector3 translation(random.rand_float(-20.0f, 20.0f), random.rand_float(-20.0f, 20.0f), random.rand_float(-20.0f, 20.0f));
+		result[bone] = AffineMatrix::CreateWorld(scale, Quaternion(axis, random.rand_float(-180.0f, 180.0f)), translation) * mesh.bone_matrices[bone];
+	}
+	return result;
+}
+
+// 点がAABBに含まれるか
+static bool contains(const BoundingBox& box, const Vector3& position)
+{
+	return position.x >= box.minimum.x - ContainTolerance && position.x <= box.maximum.x + ContainTolerance
+		&& position.y >= box.minimum.y - ContainTolerance && position.y <= box.maximum.y + ContainTolerance
+		&& position.z >= box.minimum.z - ContainTolerance && position.z <= box.maximum.z + ContainTolerance;
+}
+
+// 最も近いボーン（ウェイトのない頂点の所有者、BoneBoundsと同じ規則）
+static int nearest_bone(const BindPoseMesh& mesh, const Vector3& position)
+{
+	int result = 0;
+	for (int bone = 1; bone < (int)mesh.bone_matrices.size(); ++bone)
+	{
+		if (Vector3::DistanceSquared(position, mesh.bone_matrices[bone].Translation())
+			< Vector3::DistanceSquared(position, mesh.bone_matrices[result].Translation())) result = bone;
+	}
+	return result;
+}
+
+// ランダムな姿勢でスキニングした頂点がAABBとボーンの境界球に含まれるか
+static void check_containment(const char* name, const BindPoseMesh& mesh)
+{
+	const BoneBounds bounds(mesh);
+	std::vector<AffineMatrix> inverses(mesh.bone_matrices.size());
+	for (std::size_t bone = 0; bone < inverses.size(); ++bone)
+	{
+		inverses[bone] = AffineMatrix::Invert(mesh.bone_matrices[bone]);
+	}
+
+	Random random(2);
+	bool in_box = true;
+	bool in_sphere = true;
+	bool same_as_spheres = true;
+	for (int pose = 0; pose < PoseCount; ++pose)
+	{
+		const auto world_matrices = random_pose(mesh, random);
+		BoundingBox box;
+		bounds.compute(world_matrices.data(), box);
+
+		// 境界球を1つずつ合わせたAABBと一致する（SSEの経路とスカラーの経路が同じ結果になる）
+		BoundingBox merged = BoundingBox::Empty;
+		for (const auto& sphere : bounds.spheres())
+		{
+			Vector3 center;
+			float radius;
+			bounds.bone_sphere(sphere.bone, world_matrices.data(), center, radius);
+			merged.Merge(center, radius);
+		}
+		same_as_spheres = same_as_spheres && Vector3::Distance(box.minimum, merged.minimum) <= ContainTolerance
+			&& Vector3::Distance(box.maximum, merged.maximum) <= ContainTolerance;
+
+		// 同じ座標を登録した頂点を、各ボーンで変換した位置のランダムな重み付き平均でスキニングする
+		for (std::size_t i = 0; i < mesh.positions.size(); )
+		{
+			std::size_t end = i + 1;
+			while (end < mesh.positions.size() && std::memcmp(&mesh.positions[end], &mesh.positions[i], sizeof(Vector3)) == 0) ++end;
+
+			Vector3 skinned = Vector3::Zero;
+			float total = 0.0f;
+			for (std::size_t k = i; k < end; ++k)
+			{
+				const int bone = (k < mesh.bones.size() && mesh.bones[k] >= 0) ? mesh.bones[k] : nearest_bone(mesh, mesh.positions[k]);
+				const Vector3 posed = AffineMatrix::Transform(AffineMatrix::Transform(mesh.positions[k], inverses[bone]), world_matrices[bone]);
+				const float weight = random.rand_float(0.05f, 1.0f);
+				skinned += posed * weight;
+				total += weight;
+
+				// 1ボーンで変換した位置はそのボーンの境界球に含まれる
+				Vector3 center;
+				float radius;
+				in_sphere = in_sphere && bounds.bone_sphere(bone, world_matrices.data(), center, radius)
+					&& Vector3::Distance(posed, center) <= radius + ContainTolerance;
+			}
+			in_box = in_box && contains(box, skinned / total);
+			i = end;
+		}
+	}
+
+	std::printf("%s (%d bones, %d positions, %d spheres)\n", name, (int)mesh.bone_matrices.size(), (int)mesh.positions.size(), (int)bounds.spheres().size());
+	check("  skinned vertices stay inside the box", in_box);
+	check("  posed vertices stay inside their bone sphere", in_sphere);
+	check("  box matches the merged bone spheres", same_as_spheres);
+}
+
+// 書き出しと読み込みの検証
+static void check_file(const BindPoseMesh& mesh)
+{
+	std::printf("save and load\n");
+	BindPoseMesh loaded;
+	const bool round_trip = mesh.save(TemporaryFile) && loaded.load(TemporaryFile)
+		&& loaded.bone_matrices.size() == mesh.bone_matrices.size() && loaded.positions.size() == mesh.positions.size() && loaded.bones == mesh.bones
+		&& std::memcmp(loaded.bone_matrices.data(), mesh.bone_matrices.data(), sizeof(AffineMatrix) * mesh.bone_matrices.size()) == 0
+		&& std::memcmp(loaded.positions.data(), mesh.positions.data(), sizeof(Vector3) * mesh.positions.size()) == 0;
+	check("  round trip keeps every value", round_trip);
+
+	// 途中で切れたファイルは読み込まず、読み込み先も変更しない
+	std::ifstream input(TemporaryFile, std::ios::binary);
+	std::vector<char> bytes((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+	input.close();
+	std::ofstream(TemporaryFile, std::ios::binary).write(bytes.data(), bytes.size() / 2);
+	check("  truncated file is rejected", !loaded.load(TemporaryFile) && loaded.positions.size() == mesh.positions.size());
+
+	// ウェイトの数が頂点数と異なるファイルは読み込まない
+	BindPoseMesh broken = mesh;
+	broken.bones.pop_back();
+	check("  mismatched weight count is rejected", broken.save(TemporaryFile) && !loaded.load(TemporaryFile));
+	std::remove(TemporaryFile);
+}
+
+int main(int argc, char* argv[])
+{
+	const BindPoseMesh mesh = make_mesh();
+	check_file(mesh);
+	check_containment("synthetic mesh", mesh);
+
+	// SkeletalMesh::save_bind_poseで書き出したメッシュ
+	for (int i = 1; i < argc; ++i)
+	{
+		BindPoseMesh dumped;
+		if (!dumped.load(argv[i]))
+		{
+			std::printf("%s\n", argv[i]);
+			check("  dumped mesh loads", false);
+			continue;
+		}
+		check_containment(argv[i], dumped);
+	}
+
+	std::printf("%d check(s) failed\n", s_failures);
+	return (s_failures == 0) ? 0 : 1;
+}
\ No newline at end of file
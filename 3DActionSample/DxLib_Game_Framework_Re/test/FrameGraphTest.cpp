@@ -0,0 +1,295 @@
+#include "../src/Graphic/Shader/FrameGraph.h"
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// フレームグラフの検証
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// DxLibの代わりに呼び出しを記録するモックの実行先でフレームグラフを実行し、確保と解放の順番、
+// compile()によるパスの除外と統合を確かめる。
+// モックはRenderTargetPoolと同じく、返却されたレンダーターゲットを同じ仕様の次の要求に再利用する。
+
+// 失敗した検証の数
+static int s_failures{ 0 };
+
+// 検証結果の表示
+static void check(const char* name, bool passed)
+{
+	std::printf("%-48s %s\n", name, passed ? "ok" : "FAILED");
+	s_failures += passed ? 0 : 1;
+}
+
+// クラス：モックの実行先
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// 確保、解放、描画の開始と終了、画面への描画を記録し、確保していないリソースの使用などの誤りを数える。
+class MockBackend : public IFrameGraphBackend
+{
+public:
+	// リソースの確保
+	virtual void acquire(int resource, const RenderTargetDesc& desc) override
+	{
+		log("acquire", resource);
+		if (is_acquired(resource)) ++errors_;
+
+		// 同じ仕様の空きがあれば最後に返されたものから再利用する
+		int target;
+		auto& free = free_[desc.key()];
+		if (!free.empty())
+		{
+			target = free.back();
+			free.pop_back();
+		}
+		else
+		{
+			target = (int)targets_.size();
+			targets_.push_back(desc);
+			reserved_bytes_ += desc.bytes();
+		}
+		if (resource >= (int)assigned_.size())
+		{
+			assigned_.resize(resource + 1, -1);
+		}
+		assigned_[resource] = target;
+		used_bytes_ += desc.bytes();
+		peak_bytes_ = std::max(peak_bytes_, used_bytes_);
+	}
+	// リソースの解放
+	virtual void release(int resource) override
+	{
+		log("release", resource);
+		if (!is_acquired(resource) || resource == drawing_)
+		{
+			++errors_;
+			return;
+		}
+		const auto& desc = targets_[assigned_[resource]];
+		used_bytes_ -= desc.bytes();
+		free_[desc.key()].push_back(assigned_[resource]);
+		assigned_[resource] = -1;
+	}
+	// リソースへの描画の開始
+	virtual void begin(int resource) override
+	{
+		log("begin", resource);
+		if (!is_acquired(resource) || drawing_ >= 0) ++errors_;
+		drawing_ = resource;
+	}
+	// リソースへの描画の終了
+	virtual void end(int resource) override
+	{
+		log("end", resource);
+		if (drawing_ != resource) ++errors_;
+		drawing_ = -1;
+	}
+	// リソースのテクスチャの取得（描画中のリソースは読めない）
+	virtual int texture(int resource) const override
+	{
+		if (!is_acquired(resource) || resource == drawing_) ++errors_;
+		return is_acquired(resource) ? assigned_[resource] : -1;
+	}
+	// 描画中のリソースに画面全体の矩形を描画
+	virtual void draw_quad(int resource) override
+	{
+		if (resource != drawing_) ++errors_;
+		++draws_;
+	}
+	// リソースを画面に描画
+	virtual void present(int resource) override
+	{
+		log("present", resource);
+		if (!is_acquired(resource) || drawing_ >= 0) ++errors_;
+	}
+
+	// 記録の消去（作成済みのレンダーターゲットは残す）
+	void clear_log()
+	{
+		log_.clear();
+		draws_ = 0;
+	}
+	// 記録の取得
+	const std::vector<std::string>& log() const { return log_; }
+	// 誤りの数の取得
+	int errors() const { return errors_; }
+	// 描画回数の取得
+	int draws() const { return draws_; }
+	// 作成したレンダーターゲット数の取得
+	int target_count() const { return (int)targets_.size(); }
+	// 作成したレンダーターゲットの推定メモリ量の取得（バイト）
+	int reserved_bytes() const { return reserved_bytes_; }
+	// 同時に使用されたレンダーターゲットの推定メモリ量の最大値の取得（バイト）
+	int peak_bytes() const { return peak_bytes_; }
+	// 使用中のレンダーターゲットの推定メモリ量の取得（バイト）
+	int used_bytes() const { return used_bytes_; }
+
+private:
+	// 記録
+	void log(const char* action, int resource)
+	{
+		log_.push_back(std::string(action) + " " + std::to_string(resource));
+	}
+	// 確保済みか
+	bool is_acquired(int resource) const
+	{
+		return resource >= 0 && resource < (int)assigned_.size() && assigned_[resource] >= 0;
+	}
+
+private:
+	// 作成したレンダーターゲットの仕様
+	std::vector<RenderTargetDesc>	targets_;
+	// 仕様ごとの空きレンダーターゲット
+	std::unordered_map<unsigned long long, std::vector<int>>	free_;
+	// リソースに割り当てたレンダーターゲット（未確保は負の値）
+	std::vector<int>				assigned_;
+	// 記録
+	std::vector<std::string>		log_;
+	// 描画中のリソース
+	int								drawing_{ -1 };
+	// 誤りの数
+	mutable int						errors_{ 0 };
+	// 描画回数
+	int								draws_{ 0 };
+	// 作成したレンダーターゲットの推定メモリ量
+	int								reserved_bytes_{ 0 };
+	// 使用中のレンダーターゲットの推定メモリ量
+	int								used_bytes_{ 0 };
+	// 同時に使用されたレンダーターゲットの推定メモリ量の最大値
+	int								peak_bytes_{ 0 };
+};
+
+// 入力を読み、出力に画面全体の矩形を描画するパスの処理
+static void draw_pass(IFrameGraphBackend& backend, const FramePass& pass)
+{
+	for (const auto input : pass.inputs)
+	{
+		backend.texture(input);
+	}
+	backend.draw_quad(pass.output);
+}
+
+// 画面の幅
+static const int ScreenWidth{ 1280 };
+// 画面の高さ
+static const int ScreenHeight{ 720 };
+
+// シーンとブルームのグラフの作成（PostEffect::add_bloomと同じ構成、最終出力のリソースを返す）
+static int build_bloom(FrameGraph& graph)
+{
+	const RenderTargetDesc scene_desc{ ScreenWidth, ScreenHeight };
+	const RenderTargetDesc blur_desc{ ScreenWidth / 4, ScreenHeight / 4, false, false };
+	const RenderTargetDesc combine_desc{ ScreenWidth, ScreenHeight, false, false };
+	const int scene = graph.create_texture("Scene", scene_desc);
+	const int bright = graph.create_texture("Bright", blur_desc);
+	const int blur_h = graph.create_texture("BlurH", blur_desc);
+	const int blur_v = graph.create_texture("BlurV", blur_desc);
+	const int combine = graph.create_texture("BloomCombine", combine_desc);
+	graph.add_pass("Scene", { }, scene, draw_pass);
+	graph.add_pass("BrightPass", { scene }, bright, draw_pass);
+	graph.add_pass("GaussianBlurH", { bright }, blur_h, draw_pass);
+	graph.add_pass("GaussianBlurV", { blur_h }, blur_v, draw_pass);
+	graph.add_pass("BloomCombine", { scene, blur_v }, combine, draw_pass);
+	return combine;
+}
+
+// 確保と解放の順番の検証
+static void test_allocation_schedule()
+{
+	FrameGraph graph;
+	graph.compile(build_bloom(graph));
+	MockBackend backend;
+	graph.execute(backend);
+
+	// 各リソースは最初に使うパスの前に確保し、最後に使うパスの後に解放する
+	const std::vector<std::string> expected
+	{
+		"acquire 0", "begin 0", "end 0",
+		"acquire 1", "begin 1", "end 1",
+		"acquire 2", "begin 2", "end 2", "release 1",
+		"acquire 3", "begin 3", "end 3", "release 2",
+		"acquire 4", "begin 4", "end 4", "release 0", "release 3",
+		"present 4", "release 4",
+	};
+	check("bloom chain schedule", backend.log() == expected);
+	check("no resource is used outside its lifetime", backend.errors() == 0);
+	check("every pass draws once", backend.draws() == 5);
+
+	// BlurVはBrightPassのレンダーターゲットを再利用するため、5個の宣言に対して4個で済む
+	const int scene_bytes = graph.desc(0).bytes();
+	const int blur_bytes = graph.desc(1).bytes();
+	const int combine_bytes = graph.desc(4).bytes();
+	std::printf("targets %d, reserved %d KB (%d KB without aliasing), peak %d KB\n", backend.target_count(), backend.reserved_bytes() / 1024,
+		(scene_bytes + blur_bytes * 3 + combine_bytes) / 1024, backend.peak_bytes() / 1024);
+	check("blur targets alias", backend.target_count() == 4);
+	check("reserved memory", backend.reserved_bytes() == scene_bytes + blur_bytes * 2 + combine_bytes);
+	check("peak memory", backend.peak_bytes() == scene_bytes + blur_bytes + combine_bytes);
+	check("all targets are returned", backend.used_bytes() == 0);
+
+	// 次のフレームでは新しいレンダーターゲットを作らない
+	backend.clear_log();
+	graph.execute(backend);
+	check("second frame reuses every target", backend.target_count() == 4 && backend.log() == expected && backend.errors() == 0);
+}
+
+// 最終出力に寄与しないパスの除外の検証
+static void test_culling()
+{
+	// ブルームを無効にした場合は、シーンを直接出力するのでシーンのパスだけが残る
+	FrameGraph graph;
+	build_bloom(graph);
+	graph.compile(0);
+	MockBackend backend;
+	graph.execute(backend);
+	const std::vector<std::string> scene_only{ "acquire 0", "begin 0", "end 0", "present 0", "release 0" };
+	check("bloom disabled keeps only the scene pass", graph.executed_pass_count() == 1 && !graph.is_culled(0) && graph.is_culled(4));
+	check("culled resources are never acquired", backend.log() == scene_only && backend.errors() == 0);
+
+	// 使われないリソースに書き込むパスを除く
+	graph.reset();
+	const int output = build_bloom(graph);
+	const int unused = graph.create_texture("Unused", RenderTargetDesc{ ScreenWidth / 4, ScreenHeight / 4, false, false });
+	graph.add_pass("Unused", { 0 }, unused, draw_pass);
+	graph.compile(output);
+	MockBackend unused_backend;
+	graph.execute(unused_backend);
+	check("pass writing an unused resource is culled", graph.pass_count() == 6 && graph.executed_pass_count() == 5 && graph.is_culled(5));
+	check("unused resource is never acquired",
+		std::find(unused_backend.log().begin(), unused_backend.log().end(), "acquire " + std::to_string(unused)) == unused_backend.log().end() &&
+		unused_backend.errors() == 0);
+}
+
+// 同じ出力への連続したパスの統合の検証
+static void test_merging()
+{
+	// 出力を読まないパスは前のパスと統合し、開始と終了を1回ずつにする
+	FrameGraph graph;
+	const RenderTargetDesc desc{ ScreenWidth, ScreenHeight };
+	const int scene = graph.create_texture("Scene", desc);
+	graph.add_pass("Opaque", { }, scene, draw_pass);
+	graph.add_pass("Transparent", { }, scene, draw_pass);
+	graph.compile(scene);
+	MockBackend backend;
+	graph.execute(backend);
+	const std::vector<std::string> merged{ "acquire 0", "begin 0", "end 0", "present 0", "release 0" };
+	check("passes with the same output merge", !graph.is_merged(0) && graph.is_merged(1));
+	check("merged passes begin and end once", backend.log() == merged && backend.draws() == 2 && backend.errors() == 0);
+
+	// 出力を読むパスは統合しない（読み込みの前に描画を終了する必要がある）
+	graph.reset();
+	const int history = graph.create_texture("History", desc);
+	graph.add_pass("Clear", { }, history, draw_pass);
+	graph.add_pass("Accumulate", { history }, history, draw_pass);
+	graph.compile(history);
+	MockBackend read_backend;
+	graph.execute(read_backend);
+	check("pass reading its own output is not merged", !graph.is_merged(1) && graph.executed_pass_count() == 2);
+}
+
+int main()
+{
+	test_allocation_schedule();
+	test_culling();
+	test_merging();
+	std::printf("%d check(s) failed\n", s_failures);
+	return (s_failures == 0) ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,172 @@
+#include "../src/Graphic/FrustumCulling.h"
+#include "../src/Graphic/OcclusionBuffer.h"
+#include "../src/Math/Random.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+// 視錐台カリングの検証
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// TPCameraと同じ透視変換（画角45度、0.3～1000）の視錐台で、ランダムな境界球をFrustumCullingで一括判定し、
+// カメラの位置と向きから倍精度で求めた6平面との距離による判定と比較する。
+// 平面の近く（丸め誤差で結果が変わる範囲）の球は比較しない。遮蔽カリングとの組み合わせと統計も確かめる。
+
+// 視点の数
+static const int ViewCount{ 50 };
+// 視点ごとの境界球の数（SIMDの4個単位で割り切れない数にする）
+static const int SphereCount{ 1003 };
+// 画角（度）
+static const float FieldOfView{ 45.0f };
+// 手前のクリップ距離
+static const float NearClip{ 0.3f };
+// 奥のクリップ距離
+static const float FarClip{ 1000.0f };
+// 比較しない平面からの距離（奥行きに対する割合）
+static const double BoundaryTolerance{ 1.0e-4 };
+
+// 失敗した検証の数
+static int s_failures{ 0 };
+
+// 検証結果の表示
+static void check(const char* name, bool passed)
+{
+	std::printf("%-48s %s\n", name, passed ? "ok" : "FAILED");
+	s_failures += passed ? 0 : 1;
+}
+
+// 倍精度のベクトル
+struct DVector3
+{
+	double x, y, z;
+};
+
+static DVector3 sub(const Vector3& a, const Vector3& b) { return DVector3{ (double)a.x - b.x, (double)a.y - b.y, (double)a.z - b.z }; }
+static double dot(const DVector3& a, const DVector3& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+static DVector3 cross(const DVector3& a, const DVector3& b) { return DVector3{ a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x }; }
+static DVector3 normalize(const DVector3& v)
+{
+	const double length = std::sqrt(dot(v, v));
+	return DVector3{ v.x / length, v.y / length, v.z / length };
+}
+
+// 構造体：倍精度の視錐台（カメラの位置と向きから作成する）
+struct ReferenceFrustum
+{
+	Vector3		eye;		// 視点
+	DVector3	forward;	// 前方向
+	DVector3	right;		// 右方向
+	DVector3	up;			// 上方向
+	double		tan_x;		// 横方向の半画角の正接
+	double		tan_y;		// 縦方向の半画角の正接
+
+	// 球の中心から最も外側にある平面までの符号付き距離（内側が正）
+	double distance(const Vector3& center) const
+	{
+		const DVector3 offset = sub(center, eye);
+		const double depth = dot(offset, forward);
+		const double x = dot(offset, right);
+		const double y = dot(offset, up);
+		double result = std::min(depth - NearClip, FarClip - depth);
+		result = std::min(result, (tan_x * depth - x) / std::sqrt(1.0 + tan_x * tan_x));
+		result = std::min(result, (tan_x * depth + x) / std::sqrt(1.0 + tan_x * tan_x));
+		result = std::min(result, (tan_y * depth - y) / std::sqrt(1.0 + tan_y * tan_y));
+		result = std::min(result, (tan_y * depth + y) / std::sqrt(1.0 + tan_y * tan_y));
+		return result;
+	}
+};
+
+int main()
+{
+	Random random(41);
+	const float aspect = 16.0f / 9.0f;
+	const Matrix projection = Matrix::CreatePerspectiveFieldOfView(FieldOfView, aspect, NearClip, FarClip);
+
+	int spheres = 0;
+	int compared = 0;
+	int mismatched = 0;
+	int reference_visible = 0;
+	bool counts_match = true;
+	bool sorted = true;
+	FrustumCulling culling;
+	for (int view = 0; view < ViewCount; ++view)
+	{
+		// 真上や真下を向かない視点
+		Vector3 eye;
+		Vector3 target;
+		DVector3 forward;
+		do
+		{
+			eye = Vector3(random.rand_float(-50.0f, 50.0f), random.rand_float(1.0f, 20.0f), random.rand_float(-50.0f, 50.0f));
+			target = Vector3(random.rand_float(-50.0f, 50.0f), random.rand_float(0.0f, 5.0f), random.rand_float(-50.0f, 50.0f));
+			forward = normalize(sub(target, eye));
+		} while (std::fabs(forward.y) > 0.9);
+
+		ReferenceFrustum reference;
+		reference.eye = eye;
+		reference.forward = forward;
+		reference.right = normalize(cross(DVector3{ 0.0, 1.0, 0.0 }, forward));
+		reference.up = cross(forward, reference.right);
+		reference.tan_y = std::tan(FieldOfView * 0.5 * 3.14159265358979323846 / 180.0);
+		reference.tan_x = reference.tan_y * aspect;
+
+		culling.begin(Matrix::CreateLookAt(eye, target, Vector3::Up) * projection);
+		std::vector<Vector3> centers(SphereCount);
+		std::vector<float> radii(SphereCount);
+		for (int i = 0; i < SphereCount; ++i)
+		{
+			centers[i] = Vector3(random.rand_float(-600.0f, 600.0f), random.rand_float(-100.0f, 100.0f), random.rand_float(-600.0f, 600.0f));
+			radii[i] = random.rand_float(0.1f, 30.0f);
+			culling.add(centers[i], radii[i]);
+		}
+		const auto& visible = culling.cull();
+		sorted = sorted && std::is_sorted(visible.begin(), visible.end());
+
+		std::vector<bool> is_visible(SphereCount, false);
+		for (const auto index : visible)
+		{
+			is_visible[index] = true;
+		}
+		for (int i = 0; i < SphereCount; ++i)
+		{
+			const double distance = reference.distance(centers[i]) + radii[i];
+			const double depth = std::fabs(dot(sub(centers[i], eye), forward));
+			++spheres;
+			if (std::fabs(distance) <= BoundaryTolerance * std::max(depth, 1.0)) continue;
+
+			const bool expected = distance > 0.0;
+			++compared;
+			reference_visible += expected ? 1 : 0;
+			mismatched += (is_visible[i] != expected) ? 1 : 0;
+		}
+		counts_match = counts_match && culling.visible_count() + culling.culled_count() == SphereCount
+			&& culling.visible_count() == (int)visible.size() && culling.occluded_count() == 0;
+	}
+
+	// 視点の前を全て覆う壁の奥の球は遮蔽物に隠れ、手前の球は見える
+	const Vector3 eye(0.0f, 0.0f, -10.0f);
+	const Vector3 target(0.0f, 0.0f, 0.0f);
+	const Matrix view_projection = Matrix::CreateLookAt(eye, target, Vector3::Up) * projection;
+	const std::vector<Vector3> wall{ Vector3(-100.0f, -100.0f, 0.0f), Vector3(-100.0f, 100.0f, 0.0f), Vector3(100.0f, 100.0f, 0.0f), Vector3(100.0f, -100.0f, 0.0f) };
+	const std::vector<int> wall_indices{ 0, 1, 2, 0, 2, 3, 0, 2, 1, 0, 3, 2 };
+	OcclusionBuffer occlusion;
+	occlusion.render(OccluderMesh::create(wall, wall_indices, 4), view_projection);
+	culling.begin(view_projection);
+	culling.set_occlusion(&occlusion);
+	culling.add(Vector3(0.0f, 0.0f, -5.0f), 1.0f);		// 手前
+	culling.add(Vector3(2.0f, 1.0f, 20.0f), 1.0f);		// 奥
+	culling.add(Vector3(-1.0f, 0.0f, 50.0f), 3.0f);		// 奥
+	culling.add(Vector3(0.0f, 0.0f, -30.0f), 1.0f);		// 視点の後ろ
+	const auto visible = culling.cull();
+	culling.set_occlusion(nullptr);
+
+	std::printf("spheres %d, compared %d, reference visible %d, mismatched %d\n", spheres, compared, reference_visible, mismatched);
+	check("batch result matches double-precision planes", mismatched == 0);
+	check("both visible and culled spheres are tested", reference_visible > 0 && reference_visible < compared);
+	check("visible indices are in submission order", sorted);
+	check("visible and culled counts add up", counts_match);
+	check("spheres behind an occluder are removed", visible == std::vector<int>{ 0 });
+	check("occluded and culled counts", culling.occluded_count() == 2 && culling.culled_count() == 1 && culling.visible_count() == 1);
+	std::printf("%d check(s) failed\n", s_failures);
+	return (s_failures == 0) ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,246 @@
+#include "../src/Graphic/OcclusionBuffer.h"
+#include "../src/Graphic/WorkerPool.h"
+#include "../src/Math/Random.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <vector>
+
+// 遮蔽カリングの検証
+// 製作者：何 兆祺（"Jacky" Ho Siu Ki）
+// 箱を並べたステージをOcclusionBufferに描画し、画素の中心からのレイキャストで求めた参照の深度と比較する。
+// 境界ボックスの判定は参照の深度による総当たりの判定と比較し、見えるボックスを隠れていると判定したら失敗とする。
+// ワーカースレッドありで描画した深度がメインスレッドだけの場合と一致することも確かめる。
+
+// 視点の数
+static const int ViewCount{ 8 };
+// 視点ごとの境界ボックスの判定数
+static const int BoxCount{ 300 };
+// 参照と深度が一致しない画素の割合の許容値（三角形の辺上の画素は丸め誤差でずれる）
+static const float PixelMismatchMax{ 1.0e-3f };
+// 参照と判定が異なるボックスの割合の許容値（隠れているボックスを見えると判定する分）
+static const float BoxMismatchMax{ 1.0e-2f };
+// 深度の比較の許容誤差
+static const float DepthTolerance{ 1.0e-4f };
+
+// 遮蔽がない深度
+static const float EmptyDepth{ std::numeric_limits<float>::infinity() };
+
+// 失敗した検証の数
+static int s_failures{ 0 };
+
+// 検証結果の表示
+static void check(const char* name, bool passed)
+{
+	std::printf("%-48s %s\n", name, passed ? "ok" : "FAILED");
+	s_failures += passed ? 0 : 1;
+}
+
+// 四角形を追加（外側から見て時計回り）
+static void add_quad(std::vector<Vector3>& positions, std::vector<int>& indices, const Vector3& a, const Vector3& b, const Vector3& c, const Vector3& d)
+{
+	const int base = (int)positions.size();
+	positions.insert(positions.end(), { a, b, c, d });
+	indices.insert(indices.end(), { base, base + 1, base + 2, base, base + 2, base + 3 });
+}
+
+// 直方体を追加
+static void add_box(std::vector<Vector3>& positions, std::vector<int>& indices, const Vector3& minimum, const Vector3& maximum)
+{
+	Vector3 p[8];
+	for (int i = 0; i < 8; ++i)
+	{
+		p[i] = Vector3((i & 1) ? maximum.x : minimum.x, (i & 2) ? maximum.y : minimum.y, (i & 4) ? maximum.z : minimum.z);
+	}
+	add_quad(positions, indices, p[0], p[2], p[3], p[1]);	// -z
+	add_quad(positions, indices, p[5], p[7], p[6], p[4]);	// +z
+	add_quad(positions, indices, p[4], p[6], p[2], p[0]);	// -x
+	add_quad(positions, indices, p[1], p[3], p[7], p[5]);	// +x
+	add_quad(positions, indices, p[2], p[6], p[7], p[3]);	// +y
+	add_quad(positions, indices, p[4], p[0], p[1], p[5]);	// -y
+}
+
+// レイと三角形の交差判定（tはレイの始点からの距離の割合）
+static bool intersect(const Vector3& origin, const Vector3& direction, const Vector3& a, const Vector3& b, const Vector3& c, float& t)
+{
+	const Vector3 edge1 = b - a;
+	const Vector3 edge2 = c - a;
+	const Vector3 p = Vector3::Cross(direction, edge2);
+	const float det = Vector3::Dot(edge1, p);
+	if (std::fabs(det) < 1.0e-12f) return false;
+
+	const float inv_det = 1.0f / det;
+	const Vector3 s = origin - a;
+	const float u = Vector3::Dot(s, p) * inv_det;
+	if (u < 0.0f || u > 1.0f) return false;
+	const Vector3 q = Vector3::Cross(s, edge1);
+	const float v = Vector3::Dot(direction, q) * inv_det;
+	if (v < 0.0f || u + v > 1.0f) return false;
+	t = Vector3::Dot(edge2, q) * inv_det;
+	return t > 0.0f;
+}
+
+// 画素の中心からのレイキャストで参照の深度を求める（視点に向いた面だけを対象にする）
+static std::vector<float> reference_depth(const OccluderMesh& mesh, const Matrix& view_projection, int width, int height)
+{
+#ifdef MATH_RIGHT_HANDED
+	const float near_z{ -1.0f };
+#else
+	const float near_z{ 0.0f };
+#endif
+	const Matrix inverse = Matrix::Invert(view_projection);
+	std::vector<float> result((size_t)width * height, EmptyDepth);
+	for (int y = 0; y < height; ++y)
+	{
+		for (int x = 0; x < width; ++x)
+		{
+			const float ndc_x = ((x + 0.5f) / width - 0.5f) * 2.0f;
+			const float ndc_y = (0.5f - (y + 0.5f) / height) * 2.0f;
+			const Vector3 origin = Vector3::Transform(Vector3(ndc_x, ndc_y, near_z), inverse);
+			const Vector3 direction = Vector3::Transform(Vector3(ndc_x, ndc_y, 1.0f), inverse) - origin;
+			float nearest = EmptyDepth;
+			for (size_t i = 0; i < mesh.indices.size(); i += 3)
+			{
+				const Vector3& a = mesh.positions[mesh.indices[i]];
+				const Vector3& b = mesh.positions[mesh.indices[i + 1]];
+				const Vector3& c = mesh.positions[mesh.indices[i + 2]];
+				if (Vector3::Dot(Vector3::Cross(b - a, c - a), direction) >= 0.0f) continue;
+
+				float t;
+				if (intersect(origin, direction, a, b, c, t) && t <= 1.0f) nearest = std::min(nearest, t);
+			}
+			if (nearest != EmptyDepth)
+			{
+				nearest = Vector3::Transform(origin + direction * nearest, view_projection).z;
+			}
+			result[(size_t)y * width + x] = nearest;
+		}
+	}
+	return result;
+}
+
+// 参照の深度による総当たりの判定（8頂点の画面上の範囲に、最も手前の深度以上の画素が1つでもあれば見える）
+static bool reference_visible(const BoundingBox& box, const Matrix& view_projection, const std::vector<float>& depth, int width, int height)
+{
+	float min_x = std::numeric_limits<float>::max();
+	float min_y = std::numeric_limits<float>::max();
+	float max_x = -std::numeric_limits<float>::max();
+	float max_y = -std::numeric_limits<float>::max();
+	float min_z = std::numeric_limits<float>::max();
+	for (int i = 0; i < 8; ++i)
+	{
+		const Vector3 corner((i & 1) ? box.maximum.x : box.minimum.x, (i & 2) ? box.maximum.y : box.minimum.y, (i & 4) ? box.maximum.z : box.minimum.z);
+		// 手前のクリップ面にかかるボックスは常に見える
+		const float z = corner.x * view_projection.m[0][2] + corner.y * view_projection.m[1][2] + corner.z * view_projection.m[2][2] + view_projection.m[3][2];
+#ifdef MATH_RIGHT_HANDED
+		const float w = corner.x * view_projection.m[0][3] + corner.y * view_projection.m[1][3] + corner.z * view_projection.m[2][3] + view_projection.m[3][3];
+		if (z + w <= 0.0f) return true;
+#else
+		if (z <= 0.0f) return true;
+#endif
+		const Vector3 screen = Vector3::Transform(corner, view_projection);
+		const float x = (screen.x * 0.5f + 0.5f) * width;
+		const float y = (0.5f - screen.y * 0.5f) * height;
+		min_x = std::min(min_x, x);
+		min_y = std::min(min_y, y);
+		max_x = std::max(max_x, x);
+		max_y = std::max(max_y, y);
+		min_z = std::min(min_z, screen.z);
+	}
+	if (max_x < 0.0f || max_y < 0.0f || min_x >= width || min_y >= height) return true;
+
+	for (int y = std::max((int)std::floor(min_y), 0); y <= std::min((int)std::floor(max_y), height - 1); ++y)
+	{
+		for (int x = std::max((int)std::floor(min_x), 0); x <= std::min((int)std::floor(max_x), width - 1); ++x)
+		{
+			if (depth[(size_t)y * width + x] >= min_z) return true;
+		}
+	}
+	return false;
+}
+
+int main()
+{
+	Random random(7);
+
+	// 壁と柱を並べたステージ
+	std::vector<Vector3> positions;
+	std::vector<int> indices;
+	for (int i = 0; i < 40; ++i)
+	{
+		const float x = random.rand_float(-400.0f, 400.0f);
+		const float z = random.rand_float(-400.0f, 400.0f);
+		if (i % 2 == 0)
+		{
+			add_box(positions, indices, Vector3(x, 0.0f, z), Vector3(x + 20.0f, 200.0f, z + 20.0f));
+		}
+		else
+		{
+			add_box(positions, indices, Vector3(x, 0.0f, z), Vector3(x + random.rand_float(10.0f, 200.0f), random.rand_float(50.0f, 150.0f), z + 8.0f));
+		}
+	}
+	const OccluderMesh mesh = OccluderMesh::create(positions, indices, (int)indices.size() / 3);
+
+	int pixels = 0;
+	int mismatched_pixels = 0;
+	int boxes = 0;
+	int occluded = 0;
+	int mismatched_boxes = 0;
+	int unsafe_boxes = 0;
+	bool same_depth = true;
+	OcclusionBuffer single;
+	OcclusionBuffer pooled;
+	for (int view = 0; view < ViewCount; ++view)
+	{
+		const Vector3 eye(random.rand_float(-300.0f, 300.0f), random.rand_float(20.0f, 120.0f), random.rand_float(-300.0f, 300.0f));
+		const Vector3 target(random.rand_float(-300.0f, 300.0f), 30.0f, random.rand_float(-300.0f, 300.0f));
+		const Matrix view_projection = Matrix::CreateLookAt(eye, target, Vector3::Up) * Matrix::CreatePerspectiveFieldOfView(60.0f, 16.0f / 9.0f, 1.0f, 3000.0f);
+
+		// メインスレッドだけの描画と、ワーカースレッドありの描画
+		WorkerPool::set_thread_count(1);
+		single.render(mesh, view_projection);
+		WorkerPool::set_thread_count(4);
+		pooled.render(mesh, view_projection);
+
+		const int width = single.width();
+		const int height = single.height();
+		const auto depth = reference_depth(mesh, view_projection, width, height);
+		for (int y = 0; y < height; ++y)
+		{
+			for (int x = 0; x < width; ++x)
+			{
+				const float actual = single.depth(x, y);
+				const float expected = depth[(size_t)y * width + x];
+				const bool empty = (actual == EmptyDepth);
+				if (empty != (expected == EmptyDepth) || (!empty && std::fabs(actual - expected) > DepthTolerance)) ++mismatched_pixels;
+				if (pooled.depth(x, y) != actual) same_depth = false;
+				++pixels;
+			}
+		}
+
+		for (int i = 0; i < BoxCount; ++i)
+		{
+			const Vector3 center(random.rand_float(-400.0f, 400.0f), random.rand_float(0.0f, 100.0f), random.rand_float(-400.0f, 400.0f));
+			const float radius = random.rand_float(5.0f, 40.0f);
+			const BoundingBox box(center - Vector3(radius, radius, radius), center + Vector3(radius, radius, radius));
+			const bool visible = single.is_visible(box);
+			const bool expected = reference_visible(box, view_projection, depth, width, height);
+			++boxes;
+			occluded += visible ? 0 : 1;
+			mismatched_boxes += (visible != expected) ? 1 : 0;
+			unsafe_boxes += (!visible && expected) ? 1 : 0;
+		}
+	}
+	WorkerPool::finalize();
+
+	std::printf("pixels %d, mismatched %d\n", pixels, mismatched_pixels);
+	std::printf("boxes %d, occluded %d, mismatched %d, culled but visible %d\n", boxes, occluded, mismatched_boxes, unsafe_boxes);
+	check("depth matches ray cast", mismatched_pixels <= pixels * PixelMismatchMax);
+	check("depth is the same with worker threads", same_depth);
+	check("no visible box is culled", unsafe_boxes == 0);
+	check("box visibility matches brute force", mismatched_boxes <= boxes * BoxMismatchMax);
+	check("some boxes are culled", occluded > 0);
+	std::printf("%d check(s) failed\n", s_failures);
+	return (s_failures == 0) ? 0 : 1;
+}
\ No newline at end of file